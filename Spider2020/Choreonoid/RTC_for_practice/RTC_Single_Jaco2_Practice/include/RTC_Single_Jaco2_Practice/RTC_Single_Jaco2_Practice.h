@@ -16,6 +16,7 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 // Service implementation headers
 // <rtc-template block="service_impl_h">
@@ -26,6 +27,7 @@
 // <rtc-template block="consumer_stub_h">
 #include "ExtendedDataTypesStub.h"
 #include "BasicDataTypeStub.h"
+#include "Spider2020Stub.h"
 
 // </rtc-template>
 
@@ -36,6 +38,7 @@
 #include <rtm/DataOutPort.h>
 
 #include "FingerDeltaWrapper.h"
+#include "LatestReader.h"
 
 using namespace cnoid;
 
@@ -287,17 +290,16 @@ protected:
 	 * - Unit: [m,rad]
 	 */
 	RTC::InPort<RTC::TimedPose3D> m_PoseDelta_InIn;
-	RTC::TimedLongSeq m_FingerDelta_In;
+	Spider2020::TimedFinger m_FingerDelta_In;
 	/*!
 	 * 指の開閉具合の変位速度
-	 * - Type: TimedLongSeq
-	 * - Number: 3
-	 * - Semantics: [0]: 親指
-	 *              [1]: 差指
-	 *              [2]: 中指
+	 * - Type: Spider2020::TimedFinger
+	 * - Semantics: thumb:         親指
+	 *              index_finger:  差指
+	 *              middle_finger: 中指
 	 * - Unit: [u]
 	 */
-	RTC::InPort<RTC::TimedLongSeq> m_FingerDelta_InIn;
+	RTC::InPort<Spider2020::TimedFinger> m_FingerDelta_InIn;
 	RTC::TimedLong m_Home_In;
 	/*!
 	 * 初期姿勢遷移指令
@@ -340,6 +342,9 @@ private:
 	// </rtc-template>
 
 	FingerDeltaWrapper m_FingerDelta_InWrap;	/*!< m_FingerDelta_Inのラッパークラス	*/
+	LatestReader<RTC::TimedPose3D> m_PoseDelta_InReader;	/*!< m_PoseDelta_InInの最新データの読み込み	*/
+	LatestReader<Spider2020::TimedFinger> m_FingerDelta_InReader;	/*!< m_FingerDelta_InInの最新データの読み込み	*/
+	LatestReader<RTC::TimedLong> m_Home_InReader;	/*!< m_Home_InInの最新データの読み込み	*/
 
 	struct timeval m_stPoseDeltaReadTime;		/*!< m_PoseDelta_Inの入力時刻			*/
 	struct timeval m_stFingerDeltaReadTime;		/*!< m_FingerDelta_Inの入力時刻			*/
@@ -63,6 +63,9 @@ RTC_Single_Jaco2_Practice::RTC_Single_Jaco2_Practice(RTC::Manager* manager)
 
 	// </rtc-template>
 	, m_FingerDelta_InWrap(m_FingerDelta_In)
+	, m_PoseDelta_InReader(m_PoseDelta_InIn, m_PoseDelta_In)
+	, m_FingerDelta_InReader(m_FingerDelta_InIn, m_FingerDelta_In)
+	, m_Home_InReader(m_Home_InIn, m_Home_In)
 	, m_stPoseDeltaReadTime({0})
 	, m_stFingerDeltaReadTime({0})
 {
@@ -404,14 +407,11 @@ void RTC_Single_Jaco2_Practice::ReadPoseDelta(void)
 	// 現在の時刻を取得する
 	gettimeofday(&ti, NULL);
 
-	// 手先位置姿勢の変位速度を更新する
-	if(m_PoseDelta_InIn.isNew())
+	// 手先位置姿勢の変位速度を最新のデータで更新する
+	if(m_PoseDelta_InReader.Read())
 	{
 		// 読み込み時刻を更新する
 		m_stPoseDeltaReadTime = ti;
-
-		// 次のデータを読み込む
-		m_PoseDelta_InIn.read();
 	}
 	else
 	{
@@ -435,14 +435,11 @@ void RTC_Single_Jaco2_Practice::ReadFingerDelta(void)
 	// 現在の時刻を取得する
 	gettimeofday(&ti, NULL);
 
-	// 指の開閉具合の変位速度を更新する
-	if(m_FingerDelta_InIn.isNew())
+	// 指の開閉具合の変位速度を最新のデータで更新する
+	if(m_FingerDelta_InReader.Read())
 	{
 		// 読み込み時刻を更新する
 		m_stFingerDeltaReadTime = ti;
-
-		// 次のデータを読み込む
-		m_FingerDelta_InIn.read();
 	}
 	else
 	{
@@ -456,12 +453,8 @@ void RTC_Single_Jaco2_Practice::ReadFingerDelta(void)
 
 void RTC_Single_Jaco2_Practice::ReadHome(void)
 {
-	// 初期姿勢遷移指令を更新する
-	if(m_Home_InIn.isNew())
-	{
-		// 次のデータを読み込む
-		m_Home_InIn.read();
-	}
+	// 初期姿勢遷移指令を最新のデータで更新する
+	m_Home_InReader.Read();
 }
 
 
@@ -15,6 +15,7 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 // Service implementation headers
 // <rtc-template block="service_impl_h">
@@ -25,6 +26,7 @@
 // <rtc-template block="consumer_stub_h">
 #include "ExtendedDataTypesStub.h"
 #include "BasicDataTypeStub.h"
+#include "Spider2020Stub.h"
 
 // </rtc-template>
 
@@ -35,6 +37,7 @@
 #include <rtm/DataOutPort.h>
 
 #include "FlipperPwmWrapper.h"
+#include "LatestReader.h"
 
 using namespace cnoid;
 
@@ -408,13 +411,12 @@ protected:
 	 * - Type: TimedVelocity2D
 	 */
 	RTC::InPort<RTC::TimedVelocity2D> m_Velocity2D_InIn;
-	RTC::TimedLongSeq m_FlipperPwm_In;
+	Spider2020::TimedFlipperPwm m_FlipperPwm_In;
 	/*!
 	 * フリッパーのPWM指令
-	 * - Type: TimedLongSeq
-	 * - Number: 4
+	 * - Type: Spider2020::TimedFlipperPwm
 	 */
-	RTC::InPort<RTC::TimedLongSeq> m_FlipperPwm_InIn;
+	RTC::InPort<Spider2020::TimedFlipperPwm> m_FlipperPwm_InIn;
 
 	// </rtc-template>
 
@@ -449,6 +451,8 @@ private:
 	// </rtc-template>
 
 	FlipperPwmWrapper m_FlipperPwm_InWrap;			/*!< m_FlipperPwm_Inのラッパークラス	*/
+	LatestReader<RTC::TimedVelocity2D> m_Velocity2D_InReader;	/*!< m_Velocity2D_InInの最新データの読み込み	*/
+	LatestReader<Spider2020::TimedFlipperPwm> m_FlipperPwm_InReader;	/*!< m_FlipperPwm_InInの最新データの読み込み	*/
 
 	Link*		m_cnoid_Link[LINK_NUM];				/*!< コレオノイドモデルのリンク			*/
 	double		m_cnoid_RefAngle[JOINT_NUM];		/*!< コレオノイドモデルの目標関節角度	*/
@@ -87,6 +87,8 @@ RTC_Spider2020_Crawler_Practice::RTC_Spider2020_Crawler_Practice(RTC::Manager* m
 
 	// </rtc-template>
 	, m_FlipperPwm_InWrap(m_FlipperPwm_In)
+	, m_Velocity2D_InReader(m_Velocity2D_InIn, m_Velocity2D_In)
+	, m_FlipperPwm_InReader(m_FlipperPwm_InIn, m_FlipperPwm_In)
 	, m_stVelocity2DReadTime({0})
 	, m_stFlipperPwmReadTime({0})
 {
@@ -340,14 +342,11 @@ void RTC_Spider2020_Crawler_Practice::ReadVelocity2D(void)
 	// 現在の時刻を取得する
 	gettimeofday(&ti, NULL);
 
-	// ２次元の速度を処理する
-	if(m_Velocity2D_InIn.isNew())
+	// ２次元の速度を最新のデータで処理する
+	if(m_Velocity2D_InReader.Read())
 	{
 		// 読み込み時刻を更新する
 		m_stVelocity2DReadTime = ti;
-
-		// 次のデータを読み込む
-		m_Velocity2D_InIn.read();
 	}
 	else
 	{
@@ -421,14 +420,11 @@ void RTC_Spider2020_Crawler_Practice::ReadFlipperPwm(void)
 	// 現在の時刻を取得する
 	gettimeofday(&ti, NULL);
 
-	// フリッパーのPWM指令を処理する
-	if(m_FlipperPwm_InIn.isNew())
+	// フリッパーのPWM指令を最新のデータで処理する
+	if(m_FlipperPwm_InReader.Read())
 	{
 		// 読み込み時刻を更新する
 		m_stFlipperPwmReadTime = ti;
-
-		// 次のデータを読み込む
-		m_FlipperPwm_InIn.read();
 	}
 	else
 	{
@@ -15,6 +15,7 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 // Service implementation headers
 // <rtc-template block="service_impl_h">
@@ -25,6 +26,7 @@
 // <rtc-template block="consumer_stub_h">
 #include "ExtendedDataTypesStub.h"
 #include "BasicDataTypeStub.h"
+#include "Spider2020Stub.h"
 
 // </rtc-template>
 
@@ -36,6 +38,7 @@
 
 #include "ArmAngularWrapper.h"
 #include "FingerStatusWrapper.h"
+#include "LatestReader.h"
 
 using namespace cnoid;
 
@@ -246,31 +249,29 @@ protected:
 
 	// DataInPort declaration
 	// <rtc-template block="inport_declare">
-	RTC::TimedDoubleSeq m_Angular_In;
+	Spider2020::TimedArmAngular m_Angular_In;
 	/*!
 	 * 腕の角度
-	 * - Type: TimedDoubleSeq
-	 * - Number: 6
-	 * - Semantics: [0]: 腕の1軸目
-	 *              [1]: 腕の2軸目
-	 *              [2]: 腕の3軸目
-	 *              [3]: 腕の4軸目
-	 *              [4]: 腕の5軸目
-	 *              [5]: 腕の6軸目
+	 * - Type: Spider2020::TimedArmAngular
+	 * - Semantics: shoulder: 腕の1軸目
+	 *              arm:      腕の2軸目
+	 *              forearm:  腕の3軸目
+	 *              wrist1:   腕の4軸目
+	 *              wrist2:   腕の5軸目
+	 *              hand:     腕の6軸目
 	 * - Unit: [rad]
 	 */
-	RTC::InPort<RTC::TimedDoubleSeq> m_Angular_InIn;
-	RTC::TimedLongSeq m_Finger_In;
+	RTC::InPort<Spider2020::TimedArmAngular> m_Angular_InIn;
+	Spider2020::TimedFinger m_Finger_In;
 	/*!
 	 * 指の開閉具合
-	 * - Type: TimedLongSeq
-	 * - Number: 3
-	 * - Semantics: [0]: 親指
-	 *              [1]: 差指
-	 *              [2]: 中指
+	 * - Type: Spider2020::TimedFinger
+	 * - Semantics: thumb:         親指
+	 *              index_finger:  差指
+	 *              middle_finger: 中指
 	 * - Unit: [u]
 	 */
-	RTC::InPort<RTC::TimedLongSeq> m_Finger_InIn;
+	RTC::InPort<Spider2020::TimedFinger> m_Finger_InIn;
 
 	// </rtc-template>
 
@@ -305,6 +306,8 @@ private:
 
 	ArmAngularWrapper m_Angular_InWrap;		/*!< m_Angular_Inのラッパークラス	*/
 	FingerStatusWrapper m_Finger_InWrap;	/*!< m_Finger_Inのラッパークラス	*/
+	LatestReader<Spider2020::TimedArmAngular> m_Angular_InReader;	/*!< m_Angular_InInの最新データの読み込み	*/
+	LatestReader<Spider2020::TimedFinger> m_Finger_InReader;	/*!< m_Finger_InInの最新データの読み込み	*/
 
 	Link* m_cnoid_Link[LINK_NUM];			/*!< コレオノイドモデルのリンク		*/
 
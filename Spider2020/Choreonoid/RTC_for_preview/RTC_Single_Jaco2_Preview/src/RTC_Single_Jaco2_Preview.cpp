@@ -48,6 +48,8 @@ RTC_Single_Jaco2_Preview::RTC_Single_Jaco2_Preview(RTC::Manager* manager)
 	// </rtc-template>
 	, m_Angular_InWrap(m_Angular_In)
 	, m_Finger_InWrap(m_Finger_In)
+	, m_Angular_InReader(m_Angular_InIn, m_Angular_In)
+	, m_Finger_InReader(m_Finger_InIn, m_Finger_In)
 {
 }
 
@@ -214,12 +216,9 @@ void RTC_Single_Jaco2_Preview::inputFromSimulator()
 
 void RTC_Single_Jaco2_Preview::outputToSimulator()
 {
-	// 腕の角度の入力を処理する
-	if(m_Angular_InIn.isNew())
+	// 腕の角度の入力を最新のデータで処理する
+	if(m_Angular_InReader.Read())
 	{
-		// 次のデータを読み込む
-		m_Angular_InIn.read();
-
 		// 腕の各リンクに角度を設定する
 		m_cnoid_Link[LINK_SHOULDER]->q_target() = m_Angular_InWrap.GetShoulderAngular();
 		m_cnoid_Link[LINK_ARM]->q_target()		= m_Angular_InWrap.GetArmAngular();
@@ -229,12 +228,9 @@ void RTC_Single_Jaco2_Preview::outputToSimulator()
 		m_cnoid_Link[LINK_HAND]->q_target()	 	= m_Angular_InWrap.GetHandAngular();
 	}
 
-	// 指の開閉具合の入力を処理する
-	if(m_Finger_InIn.isNew())
+	// 指の開閉具合の入力を最新のデータで処理する
+	if(m_Finger_InReader.Read())
 	{
-		// 次のデータを読み込む
-		m_Finger_InIn.read();
-
 		// 指の各リンクに角度を設定する
 		m_cnoid_Link[LINK_FINGER1]->q_target() = FINGER_ANGLE_ADJUST(FINGER_UNIT_TO_ANGLE(m_Finger_InWrap.GetThumbStatus()));
 		m_cnoid_Link[LINK_FINGER2]->q_target() = FINGER_ANGLE_ADJUST(FINGER_UNIT_TO_ANGLE(m_Finger_InWrap.GetIndexFingerStatus()));
@@ -15,6 +15,7 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 // Service implementation headers
 // <rtc-template block="service_impl_h">
@@ -25,6 +26,7 @@
 // <rtc-template block="consumer_stub_h">
 #include "ExtendedDataTypesStub.h"
 #include "BasicDataTypeStub.h"
+#include "Spider2020Stub.h"
 
 // </rtc-template>
 
@@ -35,6 +37,7 @@
 #include <rtm/DataOutPort.h>
 
 #include "FlipperAngleWrapper.h"
+#include "LatestReader.h"
 
 using namespace cnoid;
 
@@ -282,18 +285,17 @@ protected:
 	 * - Unit: [m,rad]
 	 */
 	RTC::InPort<RTC::TimedPose3D> m_Pose3D_InIn;
-	RTC::TimedDoubleSeq m_FlipperAngle_In;
+	Spider2020::TimedFlipperAngle m_FlipperAngle_In;
 	/*!
 	 * フリッパーの角度
-	 * - Type: TimedDoubleSeq
-	 * - Number: 4
-	 * - Semantics: [0]: 右前方フリッパー
-	 *              [1]: 左前方フリッパー
-	 *              [2]: 右後方フリッパー
-	 *              [3]: 左後方フリッパー
+	 * - Type: Spider2020::TimedFlipperAngle
+	 * - Semantics: front_r: 右前方フリッパー
+	 *              front_l: 左前方フリッパー
+	 *              back_r:  右後方フリッパー
+	 *              back_l:  左後方フリッパー
 	 * - Unit: [rad]
 	 */
-	RTC::InPort<RTC::TimedDoubleSeq> m_FlipperAngle_InIn;
+	RTC::InPort<Spider2020::TimedFlipperAngle> m_FlipperAngle_InIn;
 
 	// </rtc-template>
 
@@ -329,6 +331,8 @@ private:
 
 
 	FlipperAngleWrapper m_FlipperAngle_InWrap;		/*!< m_FlipperAngle_Inのラッパークラス	*/
+	LatestReader<RTC::TimedPose3D> m_Pose3D_InReader;	/*!< m_Pose3D_InInの最新データの読み込み	*/
+	LatestReader<Spider2020::TimedFlipperAngle> m_FlipperAngle_InReader;	/*!< m_FlipperAngle_InInの最新データの読み込み	*/
 
 	Link*		m_cnoid_Link[LINK_NUM];				/*!< コレオノイドモデルのリンク			*/
 
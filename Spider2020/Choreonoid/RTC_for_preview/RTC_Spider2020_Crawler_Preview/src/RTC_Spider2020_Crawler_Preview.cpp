@@ -50,6 +50,8 @@ RTC_Spider2020_Crawler_Preview::RTC_Spider2020_Crawler_Preview(RTC::Manager* man
 
 	// </rtc-template>
 	, m_FlipperAngle_InWrap(m_FlipperAngle_In)
+	, m_Pose3D_InReader(m_Pose3D_InIn, m_Pose3D_In)
+	, m_FlipperAngle_InReader(m_FlipperAngle_InIn, m_FlipperAngle_In)
 {
 }
 
@@ -216,12 +218,9 @@ void RTC_Spider2020_Crawler_Preview::inputFromSimulator()
 
 void RTC_Spider2020_Crawler_Preview::outputToSimulator()
 {
-	// ３次元の位置・姿勢の入力を処理する
-	if(m_Pose3D_InIn.isNew())
+	// ３次元の位置・姿勢の入力を最新のデータで処理する
+	if(m_Pose3D_InReader.Read())
 	{
-		// 次のデータを読み込む
-		m_Pose3D_InIn.read();
-
 		Vector3 T = Vector3(m_Pose3D_In.data.position.x, m_Pose3D_In.data.position.y, m_Pose3D_In.data.position.z);
 		Matrix3 R = rotFromRpy(m_Pose3D_In.data.orientation.r, m_Pose3D_In.data.orientation.p, m_Pose3D_In.data.orientation.y);
 
@@ -231,12 +230,9 @@ void RTC_Spider2020_Crawler_Preview::outputToSimulator()
 		m_cnoid_Link[LINK_CHASSIS]->setRotation(R);
 	}
 
-	// サブクローラの角度の入力を処理する
-	if(m_FlipperAngle_InIn.isNew())
+	// サブクローラの角度の入力を最新のデータで処理する
+	if(m_FlipperAngle_InReader.Read())
 	{
-		// 次のデータを読み込む
-		m_FlipperAngle_InIn.read();
-
 		m_cnoid_Link[LINK_FR_FLIPPER]->q_target() = m_FlipperAngle_InWrap.GetFrontRightAngle();
 		m_cnoid_Link[LINK_FL_FLIPPER]->q_target() = m_FlipperAngle_InWrap.GetFrontLeftAngle();
 		m_cnoid_Link[LINK_BR_FLIPPER]->q_target() = m_FlipperAngle_InWrap.GetBackRightAngle();
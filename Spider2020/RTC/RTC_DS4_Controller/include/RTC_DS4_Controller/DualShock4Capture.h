@@ -10,18 +10,24 @@
 #define DUALSHOCK4_CAPTURE_H
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "MetricsRegistry.h"
+
 /*!
  * DualShock4コントローラのキー入力の取得クラス
  */
 class DualShock4Capture
 {
 public:
+	typedef std::function<void(void)> InputCallback_t;	/*!< 入力の通知先の関数	*/
+	typedef std::function<void(void)> ThreadInitCallback_t;	/*!< スレッド開始時の設定関数	*/
+
 	/*!
 	 * コンストラクタ
 	 * @method DualShock4Capture
@@ -288,6 +294,35 @@ public:
 	 */
 	uint8_t GetCapacityRatio(void);
 
+	/*!
+	 * 最後に軸キーまたはボタンの入力を検出した時刻を取得する
+	 * @method GetInputEvent
+	 * @param  [out] iTimeNs 検出した時刻 [ns] (CLOCK_REALTIME)
+	 * @return 入力の通番(入力を検出する毎に加算、未検出の時は0)
+	 * @remark 通番が前回の取得から変化していれば、新しい入力がある
+	 */
+	uint32_t GetInputEvent(int64_t &iTimeNs);
+
+	/*!
+	 * 入力の通知先を設定する
+	 * @method SetInputCallback
+	 * @param  fnCallback 通知先の関数
+	 * @return なし
+	 * @remark 軸キーまたはボタンの入力を検出する毎に、キー入力の取得スレッドから
+	 *         ロックを保持したまま呼び出す。通知先では本クラスの取得関数を
+	 *         呼び出せるが、長時間ブロックしないこと。
+	 */
+	void SetInputCallback(InputCallback_t fnCallback);
+
+	/*!
+	 * キー入力の取得スレッドの開始時に呼び出す関数を設定する
+	 * @method SetThreadInitCallback
+	 * @param  fnCallback 設定関数(優先度やCPUアフィニティの設定に使用する)
+	 * @return なし
+	 * @remark 次にStartで開始したスレッドの先頭で、ロックを保持せずに呼び出す。
+	 */
+	void SetThreadInitCallback(ThreadInitCallback_t fnCallback);
+
 private:
 	/*!
 	 * キー入力の状態を更新する
@@ -371,6 +406,16 @@ private:
 	std::vector<int16_t> m_vecButtonValue;		/*!< ボタンの押下状態のコンテナ					*/
 	std::string m_sCapacityRatioName;			/*!< バッテリ残容量比名							*/
 	uint8_t m_uCapacityRatio;					/*!< バッテリ残存容量比							*/
+	uint32_t m_uInputSeq;						/*!< 入力の通番									*/
+	int64_t m_iInputTimeNs;						/*!< 最後に入力を検出した時刻 [ns]				*/
+	InputCallback_t m_fnInputCallback;			/*!< 入力の通知先の関数							*/
+
+	MetricHistogram m_PollMetric;				/*!< キー入力とバッテリの読み込み時間 [ns]		*/
+	MetricCounter m_EventMetric;				/*!< 読み込んだキー入力のイベント数				*/
+	MetricGauge m_SampleRateMetric;				/*!< １秒あたりのキー入力のイベント数			*/
+	uint32_t m_uRateEvents;						/*!< イベント数の集計中のイベント数				*/
+	int64_t m_iRateStartNs;						/*!< イベント数の集計の開始時刻 [ns]			*/
+	ThreadInitCallback_t m_fnThreadInitCallback;	/*!< 取得スレッドの開始時の設定関数			*/
 };
 
 #endif//DUALSHOCK4_CAPTURE_H
@@ -13,6 +13,7 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 // Service implementation headers
 // <rtc-template block="service_impl_h">
@@ -22,6 +23,7 @@
 // Service Consumer stub headers
 // <rtc-template block="consumer_stub_h">
 #include "BasicDataTypeStub.h"
+#include "Spider2020Stub.h"
 
 // </rtc-template>
 
@@ -34,6 +36,9 @@
 #include "AxisWrapper.h"
 #include "ButtonWrapper.h"
 #include "DualShock4Capture.h"
+#include "LatencyTrace.h"
+
+#include <mutex>
 
 using namespace RTC;
 
@@ -205,6 +210,30 @@ public:
 	 */
 	// virtual RTC::ReturnCode_t onRateChanged(RTC::UniqueId ec_id);
 
+	/*!
+	 * ボタンの押下状態をキー入力の取得クラスから更新する
+	 * @method UpdateButton
+	 * @param  Wrap 更新するボタンのラッパークラス
+	 * @return なし
+	 */
+	void UpdateButton(ButtonWrapper &Wrap);
+
+	/*!
+	 * キー入力を検出した時に非常停止のボタンを判定する(キー入力の取得スレッド)
+	 * @method OnInputEvent
+	 * @return なし
+	 * @remark 非常停止の状態が変化した場合は、実行周期を待たずにポートに出力する
+	 */
+	void OnInputEvent(void);
+
+	/*!
+	 * 非常停止の要求をポートに出力する
+	 * @method WriteEmergencyStop
+	 * @return なし
+	 * @remark m_EStopMutexをロックして呼び出す
+	 */
+	void WriteEmergencyStop(void);
+
 
 protected:
 	// <rtc-template block="protected_attribute">
@@ -234,6 +263,65 @@ protected:
 	 * - DefaultValue: 1
 	 */
 	long int m_USE_ERROR_STATE;
+	/*!
+	 * 1: キー入力を検出した時刻を起点とし、起点と出力の時刻を
+	 * 共有メモリのトレースバッファに記録する。軸キー及びボタンの
+	 * タイムスタンプには起点の時刻を設定して後段に伝搬する。
+	 * - Name: 遅延計測のトレースを記録するか TRACE_ENABLE
+	 * - DefaultValue: 0
+	 * - Constraint: 0: 記録しない
+	 *               1: 記録する
+	 */
+	long m_TRACE_ENABLE;
+	/*!
+	 * 非常停止を要求するボタンの組み合わせ。+で区切る(例: L1+R1+CROSS)。
+	 * 組み合わせの全てが押下されたら、キー入力の取得スレッドから直ちに
+	 * EmergencyStop_Outに出力し、解除されるまで保持する。
+	 * 空の場合は非常停止を使用しない。変更はアクティブ化時に反映する。
+	 * - Name: 非常停止のボタン ESTOP_BUTTONS
+	 * - DefaultValue: PS
+	 */
+	std::string m_ESTOP_BUTTONS;
+	/*!
+	 * 非常停止を解除するボタンの組み合わせ。+で区切る。
+	 * 非常停止のボタンを離した状態でのみ解除する。
+	 * 変更はアクティブ化時に反映する。
+	 * - Name: 非常停止の解除ボタン ESTOP_RELEASE_BUTTONS
+	 * - DefaultValue: SQUARE+R3
+	 */
+	std::string m_ESTOP_RELEASE_BUTTONS;
+	/*!
+	 * 実行コンテキストのスレッドの優先度。1～99はSCHED_FIFOの優先度で実行し、
+	 * 0は通常のスケジューリング(SCHED_OTHER)で実行する。
+	 * - Name: 実行コンテキストの優先度 RT_PRIORITY
+	 * - DefaultValue: 0
+	 * - Constraint: 0: SCHED_OTHER
+	 *               1～99: SCHED_FIFOの優先度
+	 */
+	long m_RT_PRIORITY;
+	/*!
+	 * 実行コンテキストのスレッドを割り当てるCPU("0"、"2-3"、"0,2"の形式)。
+	 * ALLは割り当てを変更しない。
+	 * - Name: 実行コンテキストのCPUアフィニティ RT_CPU_AFFINITY
+	 * - DefaultValue: ALL
+	 */
+	std::string m_RT_CPU_AFFINITY;
+	/*!
+	 * デバイスを読み込むキャプチャスレッドの優先度。1～99はSCHED_FIFOの
+	 * 優先度で実行し、0は通常のスケジューリング(SCHED_OTHER)で実行する。
+	 * - Name: キャプチャスレッドの優先度 CAPTURE_RT_PRIORITY
+	 * - DefaultValue: 0
+	 * - Constraint: 0: SCHED_OTHER
+	 *               1～99: SCHED_FIFOの優先度
+	 */
+	long m_CAPTURE_RT_PRIORITY;
+	/*!
+	 * キャプチャスレッドを割り当てるCPU("0"、"2-3"、"0,2"の形式)。
+	 * ALLは割り当てを変更しない。
+	 * - Name: キャプチャスレッドのCPUアフィニティ CAPTURE_CPU_AFFINITY
+	 * - DefaultValue: ALL
+	 */
+	std::string m_CAPTURE_CPU_AFFINITY;
 
 	// </rtc-template>
 
@@ -245,12 +333,12 @@ protected:
 
 	// DataOutPort declaration
 	// <rtc-template block="outport_declare">
-	RTC::TimedDoubleSeq m_Axis_Out;
+	Spider2020::TimedAxis m_Axis_Out;
 	/*!
 	 * DualShock4コントローラの軸キーの入力具合
-	 * - Type: TimedDoubleSeq
+	 * - Type: Spider2020::TimedAxis
 	 */
-	RTC::OutPort<RTC::TimedDoubleSeq> m_Axis_OutOut;
+	RTC::OutPort<Spider2020::TimedAxis> m_Axis_OutOut;
 	RTC::TimedULong m_Button_Out;
 	/*!
 	 * DualShock4コントローラのボタンの押下状態
@@ -264,6 +352,15 @@ protected:
 	 * - Unit: [%]
 	 */
 	RTC::OutPort<RTC::TimedDouble> m_CapacityRatio_OutOut;
+	RTC::TimedBoolean m_EmergencyStop_Out;
+	/*!
+	 * 非常停止の要求
+	 * - Type: TimedBoolean
+	 * - Semantics: true: 非常停止中
+	 *              false: 通常
+	 *              タイムスタンプはキー入力を検出した時刻
+	 */
+	RTC::OutPort<RTC::TimedBoolean> m_EmergencyStop_OutOut;
 
 	// </rtc-template>
 
@@ -296,6 +393,16 @@ private:
 
 	DualShock4Capture m_DS4Capture;		/*!< DualShock4のキー入力の取得クラス	*/
 
+	LatencyTrace m_Trace;				/*!< 遅延計測のトレースバッファ			*/
+	uint32_t m_uTraceSeq;				/*!< 最後に記録した入力の通番			*/
+	int64_t m_iTraceOriginNs;			/*!< 最後に記録した入力の時刻 [ns]		*/
+
+	std::mutex m_EStopMutex;			/*!< 非常停止の出力の排他制御			*/
+	uint32_t m_uEStopMask;				/*!< 非常停止のボタンのビットマスク		*/
+	uint32_t m_uEStopReleaseMask;		/*!< 非常停止の解除ボタンのビットマスク	*/
+	bool m_bEStopTrace;					/*!< 非常停止のトレースを記録するか		*/
+	int64_t m_iEStopTimeNs;				/*!< 非常停止の状態が変化した時刻 [ns]	*/
+
 };
 
 
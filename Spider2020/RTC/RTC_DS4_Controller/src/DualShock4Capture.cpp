@@ -13,6 +13,7 @@
 #include <iostream>
 #include <linux/joystick.h>
 #include <sys/stat.h>
+#include <time.h>
 #include <unistd.h>
 
 /*! @name キーマップ
@@ -67,7 +68,15 @@ DualShock4Capture::DualShock4Capture()
 	, m_uAxisNumber(0)
 	, m_uButtonNumber(0)
 	, m_uCapacityRatio(0xFF)
+	, m_uInputSeq(0)
+	, m_iInputTimeNs(0)
+	, m_uRateEvents(0)
+	, m_iRateStartNs(0)
 {
+	// 性能指標を登録する
+	m_PollMetric.Register("ds4.poll");
+	m_EventMetric.Register("ds4.events");
+	m_SampleRateMetric.Register("ds4.sample_rate");
 }
 
 DualShock4Capture::~DualShock4Capture()
@@ -417,8 +426,47 @@ uint8_t DualShock4Capture::GetCapacityRatio(void)
 	return m_uCapacityRatio;
 }
 
+uint32_t DualShock4Capture::GetInputEvent(int64_t &iTimeNs)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+	iTimeNs = m_iInputTimeNs;
+
+	return m_uInputSeq;
+}
+
+void DualShock4Capture::SetInputCallback(InputCallback_t fnCallback)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+	m_fnInputCallback = fnCallback;
+}
+
+void DualShock4Capture::SetThreadInitCallback(ThreadInitCallback_t fnCallback)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+
+	m_fnThreadInitCallback = fnCallback;
+}
+
 void DualShock4Capture::Run(void)
 {
+	int64_t iStartNs = 0;
+	ThreadInitCallback_t fnThreadInit;
+
+	// 取得スレッドの優先度とCPUアフィニティを設定する(設定関数はロック外で呼び出す)
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_Mutex);
+		fnThreadInit = m_fnThreadInitCallback;
+	}
+	if(fnThreadInit)
+	{
+		fnThreadInit();
+	}
+
+	m_uRateEvents = 0;
+	m_iRateStartNs = MetricsRegistry::GetTimeNs();
+
 	while(1)
 	{
 		{
@@ -439,10 +487,20 @@ void DualShock4Capture::Run(void)
 			}
 
 			// 軸キーの入力具合及びボタンの押下状態を更新する
+			iStartNs = MetricsRegistry::GetTimeNs();
 			UpdateKeyInfo();
 
 			// バッテリの残容量比を更新する
 			UpdateCapacityRatio();
+			m_PollMetric.RecordSince(iStartNs);
+
+			// １秒毎にイベント数を更新する
+			if(1000000000LL <= (iStartNs - m_iRateStartNs))
+			{
+				m_SampleRateMetric.Set((double)m_uRateEvents*1000000000.0/(double)(iStartNs - m_iRateStartNs));
+				m_uRateEvents = 0;
+				m_iRateStartNs = iStartNs;
+			}
 		}
 
 		// スレッドを休止する
@@ -504,7 +562,10 @@ void DualShock4Capture::UpdateKeyInfo(void)
 	std::lock_guard<std::recursive_mutex> lock(m_Mutex);
 
 	struct js_event event = {0};
+	struct timespec ts = {0};
 	ssize_t sizeRet = 0;
+	uint32_t uEvents = 0;
+	bool bInput = false;
 
 	// 情報取得の可否をチェックする
 	if(!IsValid())
@@ -520,6 +581,14 @@ void DualShock4Capture::UpdateKeyInfo(void)
 		{
 			break;
 		}
+		uEvents++;
+
+		// 初期状態の通知以外の入力は、最初に読み込んだ時刻を検出した時刻とする
+		if(!bInput && ((event.type & JS_EVENT_INIT) == 0))
+		{
+			clock_gettime(CLOCK_REALTIME, &ts);
+			bInput = true;
+		}
 
 		// 軸キーまたはボタンの入力の情報なら更新する
 		switch(event.type & (JS_EVENT_BUTTON|JS_EVENT_AXIS))
@@ -540,6 +609,27 @@ void DualShock4Capture::UpdateKeyInfo(void)
 			break;
 		}
 	}
+
+	// 読み込んだイベント数を記録する
+	m_EventMetric.Add(uEvents);
+	m_uRateEvents += uEvents;
+
+	// 入力を検出した時刻を更新する
+	if(bInput)
+	{
+		m_iInputTimeNs = (int64_t)ts.tv_sec*1000000000LL + (int64_t)ts.tv_nsec;
+		m_uInputSeq++;
+		if(m_uInputSeq == 0)
+		{
+			m_uInputSeq = 1;
+		}
+
+		// 入力を通知する
+		if(m_fnInputCallback)
+		{
+			m_fnInputCallback();
+		}
+	}
 }
 
 void DualShock4Capture::UpdateCapacityRatio(void)
@@ -8,6 +8,7 @@
  */
 
 #include "RTC_DS4_Controller.h"
+#include "RealtimeSetup.h"
 
 // Module specification
 // <rtc-template block="module_spec">
@@ -28,14 +29,35 @@ static const char* rtc_ds4_controller_spec[] =
 	// Configuration variables
 	"conf.default.DEVICE_NAME", "/dev/input/js0",
 	"conf.default.USE_ERROR_STATE", "1",
+	"conf.default.TRACE_ENABLE", "0",
+	"conf.default.ESTOP_BUTTONS", "PS",
+	"conf.default.ESTOP_RELEASE_BUTTONS", "SQUARE+R3",
+	"conf.default.RT_PRIORITY", "0",
+	"conf.default.RT_CPU_AFFINITY", "ALL",
+	"conf.default.CAPTURE_RT_PRIORITY", "0",
+	"conf.default.CAPTURE_CPU_AFFINITY", "ALL",
 
 	// Widget
 	"conf.__widget__.DEVICE_NAME", "text",
 	"conf.__widget__.USE_ERROR_STATE", "text",
+	"conf.__widget__.TRACE_ENABLE", "text",
+	"conf.__widget__.ESTOP_BUTTONS", "text",
+	"conf.__widget__.ESTOP_RELEASE_BUTTONS", "text",
+	"conf.__widget__.RT_PRIORITY", "text",
+	"conf.__widget__.RT_CPU_AFFINITY", "text",
+	"conf.__widget__.CAPTURE_RT_PRIORITY", "text",
+	"conf.__widget__.CAPTURE_CPU_AFFINITY", "text",
 
 	// Constraints
 	"conf.__type__.DEVICE_NAME", "string",
 	"conf.__type__.USE_ERROR_STATE", "long",
+	"conf.__type__.TRACE_ENABLE", "long",
+	"conf.__type__.ESTOP_BUTTONS", "string",
+	"conf.__type__.ESTOP_RELEASE_BUTTONS", "string",
+	"conf.__type__.RT_PRIORITY", "long",
+	"conf.__type__.RT_CPU_AFFINITY", "string",
+	"conf.__type__.CAPTURE_RT_PRIORITY", "long",
+	"conf.__type__.CAPTURE_CPU_AFFINITY", "string",
 
 	""
 };
@@ -51,10 +73,17 @@ RTC_DS4_Controller::RTC_DS4_Controller(RTC::Manager* manager)
 	,m_Axis_OutOut("Axis_Out", m_Axis_Out)
 	,m_Button_OutOut("Button_Out", m_Button_Out)
 	,m_CapacityRatio_OutOut("CapacityRatio_Out", m_CapacityRatio_Out)
+	,m_EmergencyStop_OutOut("EmergencyStop_Out", m_EmergencyStop_Out)
 
 	// </rtc-template>
 	, m_Axis_OutWrap(m_Axis_Out)
 	, m_Button_OutWrap(m_Button_Out)
+	, m_uTraceSeq(0)
+	, m_iTraceOriginNs(0)
+	, m_uEStopMask(0)
+	, m_uEStopReleaseMask(0)
+	, m_bEStopTrace(false)
+	, m_iEStopTimeNs(0)
 {
 }
 
@@ -75,6 +104,7 @@ RTC::ReturnCode_t RTC_DS4_Controller::onInitialize()
 	addOutPort("Axis_Out", m_Axis_OutOut);
 	addOutPort("Button_Out", m_Button_OutOut);
 	addOutPort("CapacityRatio_Out", m_CapacityRatio_OutOut);
+	addOutPort("EmergencyStop_Out", m_EmergencyStop_OutOut);
 
 	// Set service provider to Ports
 
@@ -88,6 +118,13 @@ RTC::ReturnCode_t RTC_DS4_Controller::onInitialize()
 	// Bind variables and configuration variable
 	bindParameter("DEVICE_NAME", m_DEVICE_NAME, "/dev/input/js0");
 	bindParameter("USE_ERROR_STATE", m_USE_ERROR_STATE, "1");
+	bindParameter("TRACE_ENABLE", m_TRACE_ENABLE, "0");
+	bindParameter("ESTOP_BUTTONS", m_ESTOP_BUTTONS, "PS");
+	bindParameter("ESTOP_RELEASE_BUTTONS", m_ESTOP_RELEASE_BUTTONS, "SQUARE+R3");
+	bindParameter("RT_PRIORITY", m_RT_PRIORITY, "0");
+	bindParameter("RT_CPU_AFFINITY", m_RT_CPU_AFFINITY, "ALL");
+	bindParameter("CAPTURE_RT_PRIORITY", m_CAPTURE_RT_PRIORITY, "0");
+	bindParameter("CAPTURE_CPU_AFFINITY", m_CAPTURE_CPU_AFFINITY, "ALL");
 	// </rtc-template>
 
 	// 軸キーの入力具合を初期化する
@@ -99,6 +136,12 @@ RTC::ReturnCode_t RTC_DS4_Controller::onInitialize()
 	// バッテリ残存容量比を初期化する
 	m_CapacityRatio_Out.data = -1.0;
 
+	// 非常停止の要求を初期化する
+	m_EmergencyStop_Out.data = false;
+
+	// キー入力の検出時に非常停止のボタンを判定する
+	m_DS4Capture.SetInputCallback([this](){ OnInputEvent(); });
+
 	return RTC::RTC_OK;
 }
 
@@ -125,7 +168,35 @@ RTC::ReturnCode_t RTC_DS4_Controller::onShutdown(RTC::UniqueId ec_id)
 
 RTC::ReturnCode_t RTC_DS4_Controller::onActivated(RTC::UniqueId ec_id)
 {
-	// キー入力の取得処理を開始する
+	int iCapturePriority = (int)m_CAPTURE_RT_PRIORITY;
+	std::string sCaptureCpuList = m_CAPTURE_CPU_AFFINITY;
+
+	// 実行コンテキストのスレッドの優先度とCPUアフィニティを設定する
+	RealtimeSetup::SetupThread((int)m_RT_PRIORITY, m_RT_CPU_AFFINITY, "ds4.ec");
+
+	// 遅延計測のトレースバッファを開く
+	m_uTraceSeq = 0;
+	m_iTraceOriginNs = 0;
+	if(m_TRACE_ENABLE)
+	{
+		m_Trace.Open();
+	}
+
+	// 非常停止のボタンの組み合わせを更新し、非常停止を解除した状態で開始する
+	{
+		std::lock_guard<std::mutex> lock(m_EStopMutex);
+
+		m_uEStopMask = ButtonWrapper::ParseMask(m_ESTOP_BUTTONS);
+		m_uEStopReleaseMask = ButtonWrapper::ParseMask(m_ESTOP_RELEASE_BUTTONS);
+		m_bEStopTrace = (m_TRACE_ENABLE != 0);
+		m_iEStopTimeNs = 0;
+		m_EmergencyStop_Out.data = false;
+	}
+
+	// キー入力の取得スレッドの優先度とCPUアフィニティは、取得スレッドの開始時に設定する
+	m_DS4Capture.SetThreadInitCallback([iCapturePriority, sCaptureCpuList](){ RealtimeSetup::SetupThread(iCapturePriority, sCaptureCpuList, "ds4.capture"); });
+
+	// キー入力の取得処理を開始する(入力の通知がm_EStopMutexをロックするため、ロック外で開始する)
 	m_DS4Capture.Start(m_DEVICE_NAME);
 
 	return RTC::RTC_OK;
@@ -136,6 +207,9 @@ RTC::ReturnCode_t RTC_DS4_Controller::onDeactivated(RTC::UniqueId ec_id)
 	// キー入力の取得処理を終了する
 	m_DS4Capture.Stop();
 
+	// 遅延計測のトレースバッファを閉じる
+	m_Trace.Close();
+
 	return RTC::RTC_OK;
 }
 
@@ -160,6 +234,21 @@ RTC::ReturnCode_t RTC_DS4_Controller::onExecute(RTC::UniqueId ec_id)
 		}
 	}
 
+	// 新しいキー入力を検出していれば、起点として記録する
+	bool bTraceInput = false;
+	if(m_TRACE_ENABLE)
+	{
+		int64_t iInputNs = 0;
+		uint32_t uInputSeq = m_DS4Capture.GetInputEvent(iInputNs);
+		if((uInputSeq != 0) && (uInputSeq != m_uTraceSeq))
+		{
+			m_uTraceSeq = uInputSeq;
+			m_iTraceOriginNs = iInputNs;
+			m_Trace.RecordAt(TRACE_DS4_INPUT, iInputNs, iInputNs, uInputSeq);
+			bTraceInput = true;
+		}
+	}
+
 	// 軸キーの入力具合を更新する
 	m_Axis_OutWrap.SetDirVertical(m_DS4Capture.GetDirVerticalAxisValue() / 32767.0);
 	m_Axis_OutWrap.SetDirHorizontal(m_DS4Capture.GetDirHorizontalAxisValue() / 32767.0);
@@ -171,27 +260,28 @@ RTC::ReturnCode_t RTC_DS4_Controller::onExecute(RTC::UniqueId ec_id)
 	m_Axis_OutWrap.SetR2(m_DS4Capture.GetR2AxisValue() / 32767.0);
 
 	// 軸キーの入力具合をポートに出力する
+	// (トレースを記録する場合、タイムスタンプは起点の時刻とする)
 	m_Axis_OutWrap.SetTimestamp();
+	if(m_TRACE_ENABLE && (m_iTraceOriginNs != 0))
+	{
+		LatencyTrace::FromNs(m_iTraceOriginNs, m_Axis_Out.tm);
+	}
+	if(bTraceInput)
+	{
+		m_Trace.Record(TRACE_DS4_OUTPUT, m_iTraceOriginNs, m_uTraceSeq);
+	}
 	m_Axis_OutOut.write();
 
 	// ボタンの押下状態を更新する
-	m_Button_OutWrap.SetSquare(m_DS4Capture.GetSquareButtonValue());
-	m_Button_OutWrap.SetCross(m_DS4Capture.GetCrossButtonValue());
-	m_Button_OutWrap.SetCircle(m_DS4Capture.GetCircleButtonValue());
-	m_Button_OutWrap.SetTriangle(m_DS4Capture.GetTriangleButtonValue());
-	m_Button_OutWrap.SetL1(m_DS4Capture.GetL1ButtonValue());
-	m_Button_OutWrap.SetR1(m_DS4Capture.GetR1ButtonValue());
-	m_Button_OutWrap.SetL2(m_DS4Capture.GetL2ButtonValue());
-	m_Button_OutWrap.SetR2(m_DS4Capture.GetR2ButtonValue());
-	m_Button_OutWrap.SetShare(m_DS4Capture.GetShareButtonValue());
-	m_Button_OutWrap.SetOptions(m_DS4Capture.GetOptionsButtonValue());
-	m_Button_OutWrap.SetL3(m_DS4Capture.GetL3ButtonValue());
-	m_Button_OutWrap.SetR3(m_DS4Capture.GetR3ButtonValue());
-	m_Button_OutWrap.SetPS(m_DS4Capture.GetPSButtonValue());
-	m_Button_OutWrap.SetTouch(m_DS4Capture.GetTouchButtonValue());
+	UpdateButton(m_Button_OutWrap);
 
 	// ボタンの押下状態をポートに出力する
+	// (トレースを記録する場合、タイムスタンプは起点の時刻とする)
 	m_Button_OutWrap.SetTimestamp();
+	if(m_TRACE_ENABLE && (m_iTraceOriginNs != 0))
+	{
+		LatencyTrace::FromNs(m_iTraceOriginNs, m_Button_Out.tm);
+	}
 	m_Button_OutOut.write();
 
 	// バッテリ残容量比を更新する
@@ -201,6 +291,12 @@ RTC::ReturnCode_t RTC_DS4_Controller::onExecute(RTC::UniqueId ec_id)
 	setTimestamp(m_CapacityRatio_Out);
 	m_CapacityRatio_OutOut.write();
 
+	// 非常停止の要求をポートに出力する(状態の変化はキー入力の検出時に出力済み)
+	{
+		std::lock_guard<std::mutex> lock(m_EStopMutex);
+		WriteEmergencyStop();
+	}
+
 	return RTC::RTC_OK;
 }
 
@@ -234,6 +330,12 @@ RTC::ReturnCode_t RTC_DS4_Controller::onError(RTC::UniqueId ec_id)
 	setTimestamp(m_CapacityRatio_Out);
 	m_CapacityRatio_OutOut.write();
 
+	// 非常停止の要求をポートに出力する(エラー状態でも非常停止は保持する)
+	{
+		std::lock_guard<std::mutex> lock(m_EStopMutex);
+		WriteEmergencyStop();
+	}
+
 	return RTC::RTC_OK;
 }
 
@@ -258,6 +360,78 @@ RTC::ReturnCode_t RTC_DS4_Controller::onRateChanged(RTC::UniqueId ec_id)
 }
 */
 
+void RTC_DS4_Controller::UpdateButton(ButtonWrapper &Wrap)
+{
+	Wrap.SetSquare(m_DS4Capture.GetSquareButtonValue());
+	Wrap.SetCross(m_DS4Capture.GetCrossButtonValue());
+	Wrap.SetCircle(m_DS4Capture.GetCircleButtonValue());
+	Wrap.SetTriangle(m_DS4Capture.GetTriangleButtonValue());
+	Wrap.SetL1(m_DS4Capture.GetL1ButtonValue());
+	Wrap.SetR1(m_DS4Capture.GetR1ButtonValue());
+	Wrap.SetL2(m_DS4Capture.GetL2ButtonValue());
+	Wrap.SetR2(m_DS4Capture.GetR2ButtonValue());
+	Wrap.SetShare(m_DS4Capture.GetShareButtonValue());
+	Wrap.SetOptions(m_DS4Capture.GetOptionsButtonValue());
+	Wrap.SetL3(m_DS4Capture.GetL3ButtonValue());
+	Wrap.SetR3(m_DS4Capture.GetR3ButtonValue());
+	Wrap.SetPS(m_DS4Capture.GetPSButtonValue());
+	Wrap.SetTouch(m_DS4Capture.GetTouchButtonValue());
+}
+
+void RTC_DS4_Controller::OnInputEvent(void)
+{
+	RTC::TimedULong stButton;
+	ButtonWrapper ButtonWrap(stButton);
+	int64_t iTimeNs = 0;
+
+	std::lock_guard<std::mutex> lock(m_EStopMutex);
+
+	// 非常停止を使用しない場合は何もしない
+	if(m_uEStopMask == 0)
+	{
+		return;
+	}
+
+	// 検出したボタンの押下状態を取得する
+	ButtonWrap.InitData();
+	UpdateButton(ButtonWrap);
+	m_DS4Capture.GetInputEvent(iTimeNs);
+
+	// 非常停止のボタンが全て押下されたら、非常停止を要求する
+	if(!m_EmergencyStop_Out.data && ButtonWrap.IsPressedAll(m_uEStopMask))
+	{
+		m_EmergencyStop_Out.data = true;
+		m_iEStopTimeNs = iTimeNs;
+		if(m_bEStopTrace)
+		{
+			m_Trace.RecordAt(TRACE_ESTOP_INPUT, iTimeNs, iTimeNs);
+		}
+		WriteEmergencyStop();
+		printf("emergency stop is requested\n");
+	}
+	// 非常停止のボタンを離して解除ボタンが全て押下されたら、非常停止を解除する
+	else if(m_EmergencyStop_Out.data && ButtonWrap.IsPressedAll(m_uEStopReleaseMask) && !ButtonWrap.IsPressedAll(m_uEStopMask))
+	{
+		m_EmergencyStop_Out.data = false;
+		m_iEStopTimeNs = iTimeNs;
+		WriteEmergencyStop();
+		printf("emergency stop is released\n");
+	}
+}
+
+void RTC_DS4_Controller::WriteEmergencyStop(void)
+{
+	// タイムスタンプは状態が変化したキー入力の検出時刻とする
+	if(m_iEStopTimeNs != 0)
+	{
+		LatencyTrace::FromNs(m_iEStopTimeNs, m_EmergencyStop_Out.tm);
+	}
+	else
+	{
+		setTimestamp(m_EmergencyStop_Out);
+	}
+	m_EmergencyStop_OutOut.write();
+}
 
 extern "C"
 {
@@ -12,6 +12,7 @@
 #include <string>
 #include <stdlib.h>
 #include "RTC_DS4_Controller.h"
+#include "RealtimeSetup.h"
 
 
 void MyModuleInit(RTC::Manager* manager)
@@ -76,6 +77,10 @@ int main (int argc, char** argv)
   RTC::Manager* manager;
   manager = RTC::Manager::init(argc, argv);
 
+  // Lock memory as configured in rtc.conf (spider2020.realtime.*)
+  // before the components and their execution contexts are created.
+  RealtimeSetup::SetupProcess(manager->getConfig());
+
   // Set module initialization proceduer
   // This procedure will be invoked in activateManager() function.
   manager->setModuleInitProc(MyModuleInit);
@@ -10,12 +10,39 @@
 #define ENATEC_BATTERY_CAPTURE_H
 
 #include <stdint.h>
+#include <sys/time.h>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+
+#include "MetricsRegistry.h"
 
 typedef uint8_t BYTE;
 
+/*!
+ * @enum 列挙子
+ * バッテリから取得する項目
+ */
+enum BATTERY_REG_t
+{
+	BATTERY_REG_MAKER,			/*!< 製造会社名				*/
+	BATTERY_REG_CAPACITY_RATIO,	/*!< 残存容量比 [%]			*/
+	BATTERY_REG_VOLTAGE,		/*!< 電圧 [V]				*/
+	BATTERY_REG_CURRENT,		/*!< 電流 [A](放電が負)		*/
+	BATTERY_REG_TEMPERATURE,	/*!< 温度 [℃]				*/
+	BATTERY_REG_CYCLE_COUNT,	/*!< 充放電サイクル数		*/
+	BATTERY_REG_NUM,			/*!< 取得する項目の数		*/
+};
+
 /*!
  * エナテック製バッテリの情報の取得クラス
+ * @details Start()でシリアルポートを開いたまま保持し、受信スレッドで定期的に
+ *          問い合わせを行う。各項目は有効期間(TTL)を持ち、期限切れの項目のコマンドを
+ *          まとめて連続送信し、応答を順に受信する。製造会社名は１度だけ取得する。
+ *          取得した値はGetCached～()で待ち時間なく参照できる。
+ *          受信スレッドの動作中は同期APIのGetMaker()、GetCapacityRatio()を呼ばないこと。
  */
 class EnatecBatteryCapture
 {
@@ -63,7 +90,74 @@ public:
 	 */
 	BYTE GetCapacityRatio(void);
 
+	/*!
+	 * 項目のコマンドを設定する(Start()の前に呼ぶ)
+	 * @method SetCommand
+	 * @param  eReg   項目
+	 * @param  btCmd  コマンド(0x00なら取得しない)
+	 * @return なし
+	 */
+	void SetCommand(BATTERY_REG_t eReg, BYTE btCmd);
+
+	/*!
+	 * シリアルポートを開いたまま定期的に問い合わせる受信スレッドを開始する
+	 * @method Start
+	 * @param  sDeviceName デバイス名
+	 * @param  dInterval   問い合わせ周期 [s]
+	 * @retval true 成功
+	 * @retval false 失敗(既に開始している)
+	 */
+	bool Start(const std::string &sDeviceName, double dInterval);
+
+	/*!
+	 * 受信スレッドを停止し、シリアルポートを閉じる
+	 * @method Stop
+	 * @return なし
+	 */
+	void Stop(void);
+
+	/*!
+	 * 受信スレッドが動作中か
+	 * @method IsRunning
+	 * @retval true 動作中
+	 * @retval false 停止中
+	 */
+	bool IsRunning(void);
+
+	/*!
+	 * 受信スレッドが取得した製造会社名を取得する
+	 * @method GetCachedMaker
+	 * @return 製造会社名(未取得なら空文字)
+	 */
+	std::string GetCachedMaker(void);
+
+	/*!
+	 * 受信スレッドが取得した項目の値を取得する
+	 * @method GetCachedValue
+	 * @param  [in]  eReg    項目(製造会社名以外)
+	 * @param  [out] dValue  値
+	 * @retval true 有効な値
+	 * @retval false 未取得または有効期間の超過
+	 */
+	bool GetCachedValue(BATTERY_REG_t eReg, double &dValue);
+
 private:
+	/*!
+	 * 受信スレッド
+	 * @method Run
+	 * @return なし
+	 */
+	void Run(void);
+
+	/*!
+	 * 受信スレッドの終了要求まで待機する
+	 * @method WaitForExit
+	 * @param  dTime 最大の待ち時間 [s]
+	 * @retval true 終了要求あり
+	 * @retval false タイムアウト
+	 */
+	bool WaitForExit(double dTime);
+
 	/*!
 	 * シリアルデータの送受信をする
 	 * @method SendAndRecv
@@ -75,7 +169,59 @@ private:
 	 */
 	bool SendAndRecv(BYTE btCmd, BYTE *pbtStatusBuff, BYTE btStatusBuffSize);
 
+	/*!
+	 * 複数のコマンドを連続して送信し、応答を順に受信する
+	 * @method SendAndRecvPipelined
+	 * @param  pbtCmd            コマンドの配列
+	 * @param  ppbtStatusBuff    ステータスの格納先の配列
+	 * @param  pbtStatusBuffSize ステータスのサイズの配列
+	 * @param  iCount            コマンド数
+	 * @return 先頭から正常に受信できた応答の数
+	 */
+	int SendAndRecvPipelined(const BYTE *pbtCmd, BYTE * const *ppbtStatusBuff, const BYTE *pbtStatusBuffSize, int iCount);
+
+	/*!
+	 * 有効期間が切れた項目をまとめて取得する
+	 * @method UpdateRegisters
+	 * @retval true 成功
+	 * @retval false 通信失敗
+	 */
+	bool UpdateRegisters(void);
+
+	/*!
+	 * 項目の有効期間を取得する
+	 * @method GetTimeToLive
+	 * @param  eReg 項目
+	 * @return 有効期間 [s] (負なら無期限)
+	 */
+	double GetTimeToLive(BATTERY_REG_t eReg);
+
 	int m_fd;		/*!< ファイルディスクリプタ			*/
+
+	std::string m_sDeviceName;					/*!< 受信スレッドが開くデバイス名		*/
+	double m_dInterval;							/*!< 受信スレッドの問い合わせ周期 [s]	*/
+	std::unique_ptr<std::thread> m_spThread;	/*!< 受信スレッドクラス				*/
+	bool m_bExitThread;							/*!< スレッド終了フラグ				*/
+	std::mutex m_ThreadMutex;					/*!< スレッド終了フラグのミューテックス	*/
+	std::condition_variable m_ThreadCond;		/*!< スレッド終了の通知				*/
+
+	/*!
+	 * 項目の取得値
+	 */
+	struct REGISTER_CACHE_t
+	{
+		BYTE btStatus[16];				/*!< 応答のステータス(受信バッファサイズ)	*/
+		struct timeval stTime;			/*!< 取得時刻				*/
+		bool bValid;					/*!< 取得済みか				*/
+	};
+
+	BYTE m_btCommand[BATTERY_REG_NUM];			/*!< 項目のコマンド					*/
+	std::mutex m_CacheMutex;					/*!< 取得値のミューテックス			*/
+	REGISTER_CACHE_t m_stCache[BATTERY_REG_NUM];	/*!< 項目の取得値					*/
+
+	MetricHistogram m_PollMetric;				/*!< 項目の取得の時間 [ns]			*/
+	MetricCounter m_ErrorMetric;				/*!< 項目の取得の失敗数				*/
+	MetricGauge m_SampleRateMetric;				/*!< １秒あたりの項目の取得数		*/
 };
 
 #endif//ENATEC_BATTERY_CAPTURE_H
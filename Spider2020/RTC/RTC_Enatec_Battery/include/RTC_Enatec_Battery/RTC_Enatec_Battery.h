@@ -115,7 +115,7 @@ public:
 	 * 
 	 * 
 	 */
-	// virtual RTC::ReturnCode_t onActivated(RTC::UniqueId ec_id);
+	virtual RTC::ReturnCode_t onActivated(RTC::UniqueId ec_id);
 
 	/***
 	 *
@@ -127,7 +127,7 @@ public:
 	 * 
 	 * 
 	 */
-	// virtual RTC::ReturnCode_t onDeactivated(RTC::UniqueId ec_id);
+	virtual RTC::ReturnCode_t onDeactivated(RTC::UniqueId ec_id);
 
 	/***
 	 *
@@ -219,6 +219,37 @@ protected:
 	 * - DefaultValue: /dev/ttyUSB3
 	 */
 	std::string m_DEVICE_NAME;
+	/*!
+	 * バッテリへの問い合わせ周期
+	 * - Name: 問い合わせ周期 UPDATE_INTERVAL
+	 * - DefaultValue: 1.0
+	 * - Unit: [s]
+	 */
+	double m_UPDATE_INTERVAL;
+	/*!
+	 * 電圧を取得するコマンド(0なら取得しない)
+	 * - Name: 電圧取得コマンド VOLTAGE_CMD
+	 * - DefaultValue: 0
+	 */
+	long m_VOLTAGE_CMD;
+	/*!
+	 * 電流を取得するコマンド(0なら取得しない)
+	 * - Name: 電流取得コマンド CURRENT_CMD
+	 * - DefaultValue: 0
+	 */
+	long m_CURRENT_CMD;
+	/*!
+	 * 温度を取得するコマンド(0なら取得しない)
+	 * - Name: 温度取得コマンド TEMPERATURE_CMD
+	 * - DefaultValue: 0
+	 */
+	long m_TEMPERATURE_CMD;
+	/*!
+	 * 充放電サイクル数を取得するコマンド(0なら取得しない)
+	 * - Name: 充放電サイクル数取得コマンド CYCLE_COUNT_CMD
+	 * - DefaultValue: 0
+	 */
+	long m_CYCLE_COUNT_CMD;
 
 	// </rtc-template>
 
@@ -237,6 +268,39 @@ protected:
 	 * - Unit: [%]
 	 */
 	RTC::OutPort<RTC::TimedDouble> m_CapacityRatio_OutOut;
+	RTC::TimedDouble m_Voltage_Out;
+	/*!
+	 * バッテリの電圧
+	 * - Type: TimedDouble
+	 * - Unit: [V]
+	 */
+	RTC::OutPort<RTC::TimedDouble> m_Voltage_OutOut;
+	RTC::TimedDouble m_Current_Out;
+	/*!
+	 * バッテリの電流(放電が負)
+	 * - Type: TimedDouble
+	 * - Unit: [A]
+	 */
+	RTC::OutPort<RTC::TimedDouble> m_Current_OutOut;
+	RTC::TimedDouble m_Temperature_Out;
+	/*!
+	 * バッテリの温度
+	 * - Type: TimedDouble
+	 * - Unit: [℃]
+	 */
+	RTC::OutPort<RTC::TimedDouble> m_Temperature_OutOut;
+	RTC::TimedLong m_CycleCount_Out;
+	/*!
+	 * バッテリの充放電サイクル数
+	 * - Type: TimedLong
+	 */
+	RTC::OutPort<RTC::TimedLong> m_CycleCount_OutOut;
+	RTC::TimedString m_Maker_Out;
+	/*!
+	 * バッテリの製造会社名
+	 * - Type: TimedString
+	 */
+	RTC::OutPort<RTC::TimedString> m_Maker_OutOut;
 
 	// </rtc-template>
 
@@ -264,6 +328,7 @@ private:
 
 	// </rtc-template>
 
+	EnatecBatteryCapture m_EnatecBattery;	/*!< エナテック製バッテリの情報の取得クラス */
 };
 
 
@@ -8,10 +8,13 @@
 
 #include "EnatecBatteryCapture.h"
 #include <fcntl.h>
+#include <poll.h>
 #include <stdio.h>
 #include <sys/time.h>
 #include <termios.h>
 #include <unistd.h>
+#include <algorithm>
+#include <chrono>
 
 /*! @name シリアル通信設定
  *	シリアル通信のバッファサイズ及びレスポンスの待ち時間
@@ -20,15 +23,68 @@
 #define SEND_BUFF_MAX	(2)			/*!< シリアル通信の送信バッファサイズ	*/
 #define RECV_BUFF_MAX	(16)		/*!< シリアル通信の受信バッファサイズ	*/
 #define RECV_WAIT 		(0.1)		/*!< シリアル通信の応答待ち [s]			*/
+#define BYTE_TIME		(10.0/4800.0)	/*!< 1byteの伝送時間(4800bps、10bit) [s]	*/
 /* @} */
 
+/*! @name 受信スレッド設定
+ *	受信スレッドの再接続の条件
+ */
+/*  @{ */
+#define REOPEN_WAIT		(1.0)		/*!< オープン失敗時の再試行までの待ち時間 [s]	*/
+#define REOPEN_COUNT	(3)			/*!< 再オープンする連続の通信失敗回数			*/
+#define STALE_COUNT		(3)			/*!< 取得値を有効とする有効期間の倍数			*/
+/* @} */
+
+/*!
+ * 項目の定義
+ */
+struct REGISTER_DEF_t
+{
+	BYTE btCmd;			/*!< コマンドの初期値(0x00なら取得しない)			*/
+	BYTE btSize;		/*!< ステータスのサイズ [byte]						*/
+	double dTTL;		/*!< 有効期間 [s] (0なら問い合わせ周期、負なら無期限)	*/
+};
+
+/*!
+ * 項目の定義(BATTERY_REG_tの順)
+ * 製造会社名と残存容量比以外のコマンドは機種によって異なるためSetCommand()で設定する。
+ * 2byteのステータスはビッグエンディアンとする。
+ */
+static const REGISTER_DEF_t g_stRegisterDef[BATTERY_REG_NUM] =
+{
+	{0x03, 9, -1.0},		// 製造会社名: 9byte、１度だけ取得する
+	{0x07, 1, 0.0},			// 残存容量比: 1byte [%]
+	{0x00, 2, 0.0},			// 電圧: 2byte [mV]
+	{0x00, 2, 0.0},			// 電流: 2byte 符号付き [mA]
+	{0x00, 2, 10.0},		// 温度: 2byte [0.1K]
+	{0x00, 2, 60.0},		// 充放電サイクル数: 2byte
+};
+
+#define TIMEVAL_DIFF(x1,x2)	(((double)x1.tv_sec + (double)x1.tv_usec/1000000.0) - ((double)x2.tv_sec + (double)x2.tv_usec/1000000.0))
+
 EnatecBatteryCapture::EnatecBatteryCapture()
 	: m_fd(-1)
+	, m_dInterval(1.0)
+	, m_bExitThread(false)
 {
+	for(int i = 0; i < BATTERY_REG_NUM; i++)
+	{
+		// 項目のコマンドと取得値を初期化する
+		m_btCommand[i] = g_stRegisterDef[i].btCmd;
+		m_stCache[i] = REGISTER_CACHE_t();
+	}
+
+	// 性能指標を登録する
+	m_PollMetric.Register("battery.poll");
+	m_ErrorMetric.Register("battery.error");
+	m_SampleRateMetric.Register("battery.sample_rate");
 }
 
 EnatecBatteryCapture::~EnatecBatteryCapture()
 {
+	// 受信スレッドを停止する
+	Stop();
+
 	// シリアルポートを閉じる
 	Close();
 }
@@ -136,40 +192,73 @@ BYTE EnatecBatteryCapture::GetCapacityRatio(void)
 
 bool EnatecBatteryCapture::SendAndRecv(BYTE btCmd, BYTE *pbtStatusBuff, BYTE btStatusBuffSize)
 {
-	BYTE btSendBuff[SEND_BUFF_MAX] = {0};
-	BYTE btRecvBuff[RECV_BUFF_MAX] = {0};
+	// 1コマンドを送受信する
+	return (SendAndRecvPipelined(&btCmd, &pbtStatusBuff, &btStatusBuffSize, 1) == 1);
+}
+
+int EnatecBatteryCapture::SendAndRecvPipelined(const BYTE *pbtCmd, BYTE * const *ppbtStatusBuff, const BYTE *pbtStatusBuffSize, int iCount)
+{
+	BYTE btSendBuff[SEND_BUFF_MAX*BATTERY_REG_NUM] = {0};
+	BYTE btRecvBuff[RECV_BUFF_MAX*BATTERY_REG_NUM] = {0};
 	BYTE btCheckSum = 0;
 	struct timeval stOldTime = {0};
 	struct timeval stNowTime = {0};
+	struct pollfd stPoll = {0};
+	double dWait = 0.0;
+	double dRemain = 0.0;
+	int iExpectSize = 0;
 	int iSize = 0;
+	int iOffset = 0;
+	int iRet = 0;
 	int i = 0;
+	int j = 0;
 
 	// 引数をチェックする
-	if((pbtStatusBuff == NULL) || (btStatusBuffSize == 0))
+	if((pbtCmd == NULL) || (ppbtStatusBuff == NULL) || (pbtStatusBuffSize == NULL) || (iCount <= 0) || (BATTERY_REG_NUM < iCount))
 	{
 		printf("parameter is not valid\n");
-		return false;
+		return 0;
+	}
+	for(i = 0; i < iCount; i++)
+	{
+		if((ppbtStatusBuff[i] == NULL) || (pbtStatusBuffSize[i] == 0) || ((RECV_BUFF_MAX - 3) < pbtStatusBuffSize[i]))
+		{
+			printf("parameter is not valid\n");
+			return 0;
+		}
 	}
 
 	// デバイスのオープンをチェックする
 	if(m_fd == -1)
 	{
 		printf("device is not opened\n");
-		return false;
+		return 0;
 	}
 
-	// 要求コマンドを作成する
-	btSendBuff[0] = 0xAA;		// 識別ヘッダ
-	btSendBuff[1] = btCmd;		// コマンド
+	// 前回の通信で遅れて届いた応答を破棄する
+	tcflush(m_fd, TCIFLUSH);
+
+	for(i = 0; i < iCount; i++)
+	{
+		// 要求コマンドを作成する
+		btSendBuff[i*SEND_BUFF_MAX + 0] = 0xAA;			// 識別ヘッダ
+		btSendBuff[i*SEND_BUFF_MAX + 1] = pbtCmd[i];	// コマンド
+
+		// 期待データ数: ヘッダ＋コマンド＋ステータス＋チェックサム
+		iExpectSize += pbtStatusBuffSize[i] + 3;
+	}
 
-	// 要求を送信する
-	iSize = write(m_fd, btSendBuff, sizeof(btSendBuff));
-	if(iSize != sizeof(btSendBuff))
+	// 全ての要求を連続して送信する
+	iSize = write(m_fd, btSendBuff, iCount*SEND_BUFF_MAX);
+	if(iSize != iCount*SEND_BUFF_MAX)
 	{
 		printf("write is failed\n");
-		return false;
+		return 0;
 	}
 
+	// 応答待ちの時間は送受信の伝送時間を加算する
+	dWait = RECV_WAIT + (iCount*SEND_BUFF_MAX + iExpectSize)*BYTE_TIME;
+
 	// 受信文字数を初期化する
 	iSize = 0;
 
@@ -178,61 +267,362 @@ bool EnatecBatteryCapture::SendAndRecv(BYTE btCmd, BYTE *pbtStatusBuff, BYTE btS
 
 	do
 	{
-		// 応答を受信する
-		iSize += read(m_fd, &btRecvBuff[iSize], sizeof(btRecvBuff) - iSize);
+		// 現在時刻を取得する
+		gettimeofday(&stNowTime, NULL);
 
-		// 期待データ数を受信したらループを抜ける
-		// 期待データ数: ヘッダ＋コマンド＋ステータス＋チェックサム
-		if(iSize == (btStatusBuffSize + 3))
+		// シリアル通信の応答待ちをチェックする(受信済みの応答は検証する)
+		dRemain = dWait - TIMEVAL_DIFF(stNowTime, stOldTime);
+		if(dRemain <= 0.0)
 		{
+			printf("read is timeout\n");
 			break;
 		}
 
-		// 現在時刻を取得する
-		gettimeofday(&stNowTime, NULL);
+		// 応答の到着を残り時間だけ待つ
+		stPoll.fd = m_fd;
+		stPoll.events = POLLIN;
+		iRet = poll(&stPoll, 1, (int)(dRemain*1000.0) + 1);
+		if(iRet <= 0)
+		{
+			continue;
+		}
 
-		// シリアル通信の応答待ちをチェックする
-		if((((double)(stOldTime.tv_sec)+(double)(stOldTime.tv_usec)*0.001*0.001) + RECV_WAIT) <= ((double)(stNowTime.tv_sec)+(double)(stNowTime.tv_usec)*0.001*0.001))
+		// 応答を受信する
+		iRet = read(m_fd, &btRecvBuff[iSize], iExpectSize - iSize);
+		if(0 < iRet)
 		{
-			printf("read is timeout\n");
-			return false;
+			iSize += iRet;
 		}
 	}
-	while(1);
+	while(iSize < iExpectSize);
 
-	// チェックサムを求める
-	for(i = 2; i < (iSize-1); i++)
+	for(i = 0; i < iCount; i++)
 	{
-		btCheckSum |= btRecvBuff[i];
+		// 応答を受信しきれていなければ終了する
+		if(iSize < iOffset + pbtStatusBuffSize[i] + 3)
+		{
+			return i;
+		}
+
+		// チェックサムを求める
+		btCheckSum = 0;
+		for(j = 0; j < pbtStatusBuffSize[i]; j++)
+		{
+			btCheckSum |= btRecvBuff[iOffset + 2 + j];
+		}
+
+		// 応答の内容を検証する(識別ヘッダ)
+		if(btRecvBuff[iOffset + 0] != 0xAA)
+		{
+			printf("header is not matched\n");
+			return i;
+		}
+
+		// 応答の内容を検証する(コマンド)
+		if(btRecvBuff[iOffset + 1] != pbtCmd[i])
+		{
+			printf("command is not matched\n");
+			return i;
+		}
+
+		// 応答の内容を検証する(チェックサム)
+		if(btCheckSum != btRecvBuff[iOffset + 2 + pbtStatusBuffSize[i]])
+		{
+			printf("checksum is not matched\n");
+			return i;
+		}
+
+		// ステータスをコピーする
+		for(j = 0; j < pbtStatusBuffSize[i]; j++)
+		{
+			ppbtStatusBuff[i][j] = btRecvBuff[iOffset + 2 + j];
+		}
+
+		// 次の応答に進む
+		iOffset += pbtStatusBuffSize[i] + 3;
 	}
 
-	// 応答の内容を検証する(識別ヘッダ)
-	if(btSendBuff[0] != btRecvBuff[0])
+	// 正常終了
+	return iCount;
+}
+
+void EnatecBatteryCapture::SetCommand(BATTERY_REG_t eReg, BYTE btCmd)
+{
+	// 範囲外の項目は設定しない
+	if((eReg < 0) || (BATTERY_REG_NUM <= eReg))
+	{
+		return;
+	}
+
+	m_btCommand[eReg] = btCmd;
+}
+
+bool EnatecBatteryCapture::Start(const std::string &sDeviceName, double dInterval)
+{
+	// 多重起動を防止する
+	if(m_spThread != nullptr)
 	{
-		printf("header is not matched\n");
+		printf("thread is already started\n");
 		return false;
 	}
 
-	// 応答の内容を検証する(コマンド)
-	if(btSendBuff[1] != btRecvBuff[1])
+	// 取得値を初期化する
+	{
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		for(int i = 0; i < BATTERY_REG_NUM; i++)
+		{
+			m_stCache[i].bValid = false;
+		}
+	}
+
+	// 受信スレッドを開始する(オープンは受信スレッドで行う)
+	m_sDeviceName = sDeviceName;
+	m_dInterval = dInterval;
+	m_bExitThread = false;
+	m_spThread.reset(new std::thread(&EnatecBatteryCapture::Run, this));
+
+	return true;
+}
+
+void EnatecBatteryCapture::Stop(void)
+{
+	if(m_spThread == nullptr)
+	{
+		return;
+	}
+
+	// 受信スレッドに終了を通知する
+	{
+		std::lock_guard<std::mutex> lock(m_ThreadMutex);
+		m_bExitThread = true;
+	}
+	m_ThreadCond.notify_all();
+
+	// 受信スレッドの終了を待つ
+	m_spThread->join();
+	m_spThread.reset();
+}
+
+bool EnatecBatteryCapture::IsRunning(void)
+{
+	return (m_spThread != nullptr);
+}
+
+std::string EnatecBatteryCapture::GetCachedMaker(void)
+{
+	char szMaker[RECV_BUFF_MAX + 1] = {0};
+
+	std::lock_guard<std::mutex> lock(m_CacheMutex);
+
+	// 未取得なら空文字とする
+	if(!m_stCache[BATTERY_REG_MAKER].bValid)
+	{
+		return "";
+	}
+
+	// 製造会社名を文字列にする
+	for(int i = 0; i < g_stRegisterDef[BATTERY_REG_MAKER].btSize; i++)
+	{
+		szMaker[i] = (char)m_stCache[BATTERY_REG_MAKER].btStatus[i];
+	}
+
+	return szMaker;
+}
+
+bool EnatecBatteryCapture::GetCachedValue(BATTERY_REG_t eReg, double &dValue)
+{
+	struct timeval stNowTime = {0};
+	const BYTE *pbtStatus = NULL;
+	double dTTL = 0.0;
+
+	// 製造会社名及び範囲外の項目は取得しない
+	if((eReg <= BATTERY_REG_MAKER) || (BATTERY_REG_NUM <= eReg))
 	{
-		printf("command is not matched\n");
 		return false;
 	}
 
-	// 応答の内容を検証する(チェックサム)
-	if(btCheckSum != btRecvBuff[iSize - 1])
+	gettimeofday(&stNowTime, NULL);
+	dTTL = GetTimeToLive(eReg);
+
+	std::lock_guard<std::mutex> lock(m_CacheMutex);
+
+	// 未取得または古い値は取得失敗とする
+	if(!m_stCache[eReg].bValid || ((0.0 <= dTTL) && (dTTL*STALE_COUNT < TIMEVAL_DIFF(stNowTime, m_stCache[eReg].stTime))))
 	{
-		printf("checksum is not matched\n");
 		return false;
 	}
 
-	// ステータスをコピーする
-	for(i = 0; i < btStatusBuffSize; i++)
+	// ステータスを値に変換する
+	pbtStatus = m_stCache[eReg].btStatus;
+	switch(eReg)
 	{
-		pbtStatusBuff[i] = btRecvBuff[2 + i];
+	case BATTERY_REG_CAPACITY_RATIO:
+		dValue = (double)pbtStatus[0];
+		break;
+	case BATTERY_REG_VOLTAGE:
+		dValue = (double)(uint16_t)((pbtStatus[0] << 8) | pbtStatus[1])/1000.0;
+		break;
+	case BATTERY_REG_CURRENT:
+		dValue = (double)(int16_t)((pbtStatus[0] << 8) | pbtStatus[1])/1000.0;
+		break;
+	case BATTERY_REG_TEMPERATURE:
+		dValue = (double)(uint16_t)((pbtStatus[0] << 8) | pbtStatus[1])/10.0 - 273.15;
+		break;
+	case BATTERY_REG_CYCLE_COUNT:
+		dValue = (double)(uint16_t)((pbtStatus[0] << 8) | pbtStatus[1]);
+		break;
+	default:
+		return false;
 	}
 
-	// 正常終了
 	return true;
 }
+
+double EnatecBatteryCapture::GetTimeToLive(BATTERY_REG_t eReg)
+{
+	// 無期限の項目
+	if(g_stRegisterDef[eReg].dTTL < 0.0)
+	{
+		return -1.0;
+	}
+
+	// 問い合わせ周期より短い有効期間は問い合わせ周期とする
+	return (g_stRegisterDef[eReg].dTTL < m_dInterval) ? m_dInterval : g_stRegisterDef[eReg].dTTL;
+}
+
+bool EnatecBatteryCapture::UpdateRegisters(void)
+{
+	BYTE btCmd[BATTERY_REG_NUM] = {0};
+	BYTE btStatus[BATTERY_REG_NUM][RECV_BUFF_MAX] = {{0}};
+	BYTE *pbtStatus[BATTERY_REG_NUM] = {NULL};
+	BYTE btSize[BATTERY_REG_NUM] = {0};
+	int iReg[BATTERY_REG_NUM] = {0};
+	struct timeval stNowTime = {0};
+	double dTTL = 0.0;
+	int iCount = 0;
+	int iRecv = 0;
+	int i = 0;
+
+	gettimeofday(&stNowTime, NULL);
+
+	{
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		for(i = 0; i < BATTERY_REG_NUM; i++)
+		{
+			// コマンドが未設定の項目は取得しない
+			if(m_btCommand[i] == 0x00)
+			{
+				continue;
+			}
+
+			// 有効期間内の項目は取得しない(待機の誤差は応答待ち時間で吸収する)
+			dTTL = GetTimeToLive((BATTERY_REG_t)i);
+			if(m_stCache[i].bValid && ((dTTL < 0.0) || (TIMEVAL_DIFF(stNowTime, m_stCache[i].stTime) < dTTL - RECV_WAIT)))
+			{
+				continue;
+			}
+
+			// 取得する項目に追加する
+			btCmd[iCount] = m_btCommand[i];
+			btSize[iCount] = g_stRegisterDef[i].btSize;
+			pbtStatus[iCount] = btStatus[iCount];
+			iReg[iCount] = i;
+			iCount++;
+		}
+	}
+
+	// 期限切れの項目がなければ終了する
+	if(iCount == 0)
+	{
+		return true;
+	}
+
+	// 期限切れの項目をまとめて取得する
+	iRecv = SendAndRecvPipelined(btCmd, pbtStatus, btSize, iCount);
+
+	// 取得値を更新する
+	gettimeofday(&stNowTime, NULL);
+	{
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		for(i = 0; i < iRecv; i++)
+		{
+			// 残存容量比の0xFFは取得失敗とする
+			if((iReg[i] == BATTERY_REG_CAPACITY_RATIO) && (btStatus[i][0] == 0xFF))
+			{
+				continue;
+			}
+
+			std::copy(btStatus[i], btStatus[i] + RECV_BUFF_MAX, m_stCache[iReg[i]].btStatus);
+			m_stCache[iReg[i]].stTime = stNowTime;
+			m_stCache[iReg[i]].bValid = true;
+		}
+	}
+
+	return (0 < iRecv);
+}
+
+void EnatecBatteryCapture::Run(void)
+{
+	int iFailCount = 0;
+	int64_t iStartNs = 0;
+	int64_t iLastNs = 0;
+
+	while(1)
+	{
+		// シリアルポートが閉じていれば開く
+		if(m_fd == -1)
+		{
+			if(!Open(m_sDeviceName))
+			{
+				// 再試行まで待機する
+				if(WaitForExit(REOPEN_WAIT))
+				{
+					break;
+				}
+				continue;
+			}
+			iFailCount = 0;
+		}
+
+		// 有効期間が切れた項目をまとめて取得する
+		iStartNs = MetricsRegistry::GetTimeNs();
+		if(UpdateRegisters())
+		{
+			iFailCount = 0;
+
+			// 取得の時間と取得の間隔を記録する
+			m_PollMetric.RecordSince(iStartNs);
+			if(iLastNs != 0)
+			{
+				m_SampleRateMetric.Set(1000000000.0/(double)(iStartNs - iLastNs));
+			}
+			iLastNs = iStartNs;
+		}
+		else
+		{
+			m_ErrorMetric.Add();
+			if(REOPEN_COUNT <= ++iFailCount)
+			{
+				// 通信失敗が続く場合はシリアルポートを開き直す
+				Close();
+			}
+		}
+
+		// 次の問い合わせまで待機する
+		if(WaitForExit(m_dInterval))
+		{
+			break;
+		}
+	}
+
+	// シリアルポートを閉じる
+	Close();
+}
+
+bool EnatecBatteryCapture::WaitForExit(double dTime)
+{
+	std::unique_lock<std::mutex> lock(m_ThreadMutex);
+
+	// 終了要求があるか指定時間が経過するまで待機する
+	return m_ThreadCond.wait_for(lock, std::chrono::microseconds((long long)(dTime*1000000.0)), [this]{ return m_bExitThread; });
+}
@@ -27,12 +27,27 @@ static const char* rtc_enatec_battery_spec[] =
 
 	// Configuration variables
 	"conf.default.DEVICE_NAME", "/dev/ttyUSB3",
+	"conf.default.UPDATE_INTERVAL", "1.0",
+	"conf.default.VOLTAGE_CMD", "0",
+	"conf.default.CURRENT_CMD", "0",
+	"conf.default.TEMPERATURE_CMD", "0",
+	"conf.default.CYCLE_COUNT_CMD", "0",
 
 	// Widget
 	"conf.__widget__.DEVICE_NAME", "text",
+	"conf.__widget__.UPDATE_INTERVAL", "text",
+	"conf.__widget__.VOLTAGE_CMD", "text",
+	"conf.__widget__.CURRENT_CMD", "text",
+	"conf.__widget__.TEMPERATURE_CMD", "text",
+	"conf.__widget__.CYCLE_COUNT_CMD", "text",
 
 	// Constraints
 	"conf.__type__.DEVICE_NAME", "string",
+	"conf.__type__.UPDATE_INTERVAL", "double",
+	"conf.__type__.VOLTAGE_CMD", "long",
+	"conf.__type__.CURRENT_CMD", "long",
+	"conf.__type__.TEMPERATURE_CMD", "long",
+	"conf.__type__.CYCLE_COUNT_CMD", "long",
 
 	""
 };
@@ -46,6 +61,11 @@ RTC_Enatec_Battery::RTC_Enatec_Battery(RTC::Manager* manager)
 	// <rtc-template block="initializer">
 	: RTC::DataFlowComponentBase(manager)
 	, m_CapacityRatio_OutOut("CapacityRatio_Out", m_CapacityRatio_Out)
+	, m_Voltage_OutOut("Voltage_Out", m_Voltage_Out)
+	, m_Current_OutOut("Current_Out", m_Current_Out)
+	, m_Temperature_OutOut("Temperature_Out", m_Temperature_Out)
+	, m_CycleCount_OutOut("CycleCount_Out", m_CycleCount_Out)
+	, m_Maker_OutOut("Maker_Out", m_Maker_Out)
 
 	// </rtc-template>
 {
@@ -66,6 +86,11 @@ RTC::ReturnCode_t RTC_Enatec_Battery::onInitialize()
 
 	// Set OutPort buffer
 	addOutPort("CapacityRatio_Out", m_CapacityRatio_OutOut);
+	addOutPort("Voltage_Out", m_Voltage_OutOut);
+	addOutPort("Current_Out", m_Current_OutOut);
+	addOutPort("Temperature_Out", m_Temperature_OutOut);
+	addOutPort("CycleCount_Out", m_CycleCount_OutOut);
+	addOutPort("Maker_Out", m_Maker_OutOut);
 
 	// Set service provider to Ports
 
@@ -78,11 +103,23 @@ RTC::ReturnCode_t RTC_Enatec_Battery::onInitialize()
 	// <rtc-template block="bind_config">
 	// Bind variables and configuration variable
 	bindParameter("DEVICE_NAME", m_DEVICE_NAME, "/dev/ttyUSB3");
+	bindParameter("UPDATE_INTERVAL", m_UPDATE_INTERVAL, "1.0");
+	bindParameter("VOLTAGE_CMD", m_VOLTAGE_CMD, "0");
+	bindParameter("CURRENT_CMD", m_CURRENT_CMD, "0");
+	bindParameter("TEMPERATURE_CMD", m_TEMPERATURE_CMD, "0");
+	bindParameter("CYCLE_COUNT_CMD", m_CYCLE_COUNT_CMD, "0");
 	// </rtc-template>
 
 	// バッテリ残存容量比を初期化する
 	m_CapacityRatio_Out.data = -1.0;
 
+	// バッテリの電圧、電流、温度、充放電サイクル数、製造会社名を初期化する
+	m_Voltage_Out.data = 0.0;
+	m_Current_Out.data = 0.0;
+	m_Temperature_Out.data = 0.0;
+	m_CycleCount_Out.data = 0;
+	m_Maker_Out.data = "";
+
 	return RTC::RTC_OK;
 }
 
@@ -107,38 +144,36 @@ RTC::ReturnCode_t RTC_Enatec_Battery::onShutdown(RTC::UniqueId ec_id)
 }
 */
 
-/*
 RTC::ReturnCode_t RTC_Enatec_Battery::onActivated(RTC::UniqueId ec_id)
 {
+	// 機種毎に異なる項目のコマンドを設定する
+	m_EnatecBattery.SetCommand(BATTERY_REG_VOLTAGE, (BYTE)m_VOLTAGE_CMD);
+	m_EnatecBattery.SetCommand(BATTERY_REG_CURRENT, (BYTE)m_CURRENT_CMD);
+	m_EnatecBattery.SetCommand(BATTERY_REG_TEMPERATURE, (BYTE)m_TEMPERATURE_CMD);
+	m_EnatecBattery.SetCommand(BATTERY_REG_CYCLE_COUNT, (BYTE)m_CYCLE_COUNT_CMD);
+
+	// シリアルポートを開いたまま問い合わせる受信スレッドを開始する
+	m_EnatecBattery.Start(m_DEVICE_NAME, m_UPDATE_INTERVAL);
+
 	return RTC::RTC_OK;
 }
-*/
 
-/*
 RTC::ReturnCode_t RTC_Enatec_Battery::onDeactivated(RTC::UniqueId ec_id)
 {
+	// 受信スレッドを停止し、シリアルポートを閉じる
+	m_EnatecBattery.Stop();
+
 	return RTC::RTC_OK;
 }
-*/
 
 RTC::ReturnCode_t RTC_Enatec_Battery::onExecute(RTC::UniqueId ec_id)
 {
-	EnatecBatteryCapture oEnatecBattery;
-	bool bIsOpen = false;
-
-	// デバイスをオープンする
-	bIsOpen = oEnatecBattery.Open(m_DEVICE_NAME);
-	if(bIsOpen)
-	{
-		// バッテリ残存容量比を更新する
-		m_CapacityRatio_Out.data = (double)((int8_t)oEnatecBattery.GetCapacityRatio());
+	double dValue = 0.0;
+	std::string sMaker;
 
-		// デバイスをクローズする
-		oEnatecBattery.Close();
-	}
-	else
+	// 受信スレッドが最後に取得したバッテリ残存容量比を更新する(未取得、古い値は-1)
+	if(!m_EnatecBattery.GetCachedValue(BATTERY_REG_CAPACITY_RATIO, m_CapacityRatio_Out.data))
 	{
-		// バッテリ残存容量比を初期化する
 		m_CapacityRatio_Out.data = -1.0;
 	}
 
@@ -146,6 +181,45 @@ RTC::ReturnCode_t RTC_Enatec_Battery::onExecute(RTC::UniqueId ec_id)
 	setTimestamp(m_CapacityRatio_Out);
 	m_CapacityRatio_OutOut.write();
 
+	// 以降の項目は有効な値を取得できた場合のみ出力する
+	// バッテリの電圧をポートに出力する
+	if(m_EnatecBattery.GetCachedValue(BATTERY_REG_VOLTAGE, m_Voltage_Out.data))
+	{
+		setTimestamp(m_Voltage_Out);
+		m_Voltage_OutOut.write();
+	}
+
+	// バッテリの電流をポートに出力する
+	if(m_EnatecBattery.GetCachedValue(BATTERY_REG_CURRENT, m_Current_Out.data))
+	{
+		setTimestamp(m_Current_Out);
+		m_Current_OutOut.write();
+	}
+
+	// バッテリの温度をポートに出力する
+	if(m_EnatecBattery.GetCachedValue(BATTERY_REG_TEMPERATURE, m_Temperature_Out.data))
+	{
+		setTimestamp(m_Temperature_Out);
+		m_Temperature_OutOut.write();
+	}
+
+	// バッテリの充放電サイクル数をポートに出力する
+	if(m_EnatecBattery.GetCachedValue(BATTERY_REG_CYCLE_COUNT, dValue))
+	{
+		m_CycleCount_Out.data = (CORBA::Long)dValue;
+		setTimestamp(m_CycleCount_Out);
+		m_CycleCount_OutOut.write();
+	}
+
+	// バッテリの製造会社名をポートに出力する
+	sMaker = m_EnatecBattery.GetCachedMaker();
+	if(!sMaker.empty())
+	{
+		m_Maker_Out.data = sMaker.c_str();
+		setTimestamp(m_Maker_Out);
+		m_Maker_OutOut.write();
+	}
+
 	return RTC::RTC_OK;
 }
 
@@ -0,0 +1,199 @@
+// -*- C++ -*-
+/*!
+ * @file IMUSampleFilter.h
+ * @brief 受信したIMUのサンプルを出力周期に間引くフィルタ
+ * @date 2026/10/19
+ */
+
+#ifndef IMU_SAMPLE_FILTER_H
+#define IMU_SAMPLE_FILTER_H
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <vector>
+
+#include "IMU_GX5_25_Capture.h"
+
+/*!
+ * @enum 列挙子
+ * 間引きフィルタの種類
+ */
+enum IMU_FILTER_MODE_t
+{
+	IMU_FILTER_MODE_LATEST,			/*!< 最新のサンプル							*/
+	IMU_FILTER_MODE_BOXCAR,			/*!< 前回出力以降のサンプルの移動平均		*/
+	IMU_FILTER_MODE_EXPONENTIAL,	/*!< サンプル毎の指数平滑					*/
+	IMU_FILTER_MODE_QUATERNION,		/*!< 前回出力以降の姿勢のクォータニオン平均	*/
+	IMU_FILTER_MODE_NUM,			/*!< フィルタの種類の数						*/
+};
+
+/*!
+ * 受信したIMUのサンプルを出力周期に間引くフィルタ
+ * @details ストリーミングで受信した高レートのサンプルを、出力毎に加速度と姿勢それぞれ
+ *          指定したフィルタで１つの値にまとめ、IMU座標系からロボット座標系に変換する。
+ *          座標変換の回転行列は取り付け角の設定時に１度だけ計算する。
+ *          演算は固定長の行列及びベクトルで行い、実行中に動的確保を行わない。
+ */
+class IMUSampleFilter
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method IMUSampleFilter
+	 */
+	IMUSampleFilter();
+
+	/*!
+	 * デストラクタ
+	 * @method ~IMUSampleFilter
+	 */
+	virtual ~IMUSampleFilter();
+
+	/*!
+	 * IMUの取り付け角を設定し、座標変換の回転行列を計算する
+	 * @method SetMountRotation
+	 * @param  dX  X軸の回転 [deg]
+	 * @param  dY  Y軸の回転 [deg]
+	 * @param  dZ  Z軸の回転 [deg]
+	 * @return なし
+	 */
+	void SetMountRotation(double dX, double dY, double dZ);
+
+	/*!
+	 * フィルタの種類を設定する
+	 * @method SetMode
+	 * @param  lAccelMode        加速度のフィルタ(IMU_FILTER_MODE_t)
+	 * @param  lOrientationMode  姿勢のフィルタ(IMU_FILTER_MODE_t)
+	 * @param  dAlpha            指数平滑の係数(0～1、大きいほど新しいサンプルを重視する)
+	 * @return なし
+	 */
+	void SetMode(long lAccelMode, long lOrientationMode, double dAlpha);
+
+	/*!
+	 * フィルタの状態を初期化する
+	 * @method Reset
+	 * @return なし
+	 */
+	void Reset(void);
+
+	/*!
+	 * 前回出力以降のサンプルでフィルタを更新する
+	 * @method Update
+	 * @param  vecSample 前回出力以降のサンプル(古い順)
+	 * @retval true 更新した
+	 * @retval false サンプルがないため前回の値を保持した
+	 */
+	bool Update(const std::vector<IMU_SAMPLE_t> &vecSample);
+
+	/*!
+	 * IMU座標系のベクトルをロボット座標系に変換する
+	 * @method ConvertToRobotFrame
+	 * @param  [in]  dX    IMU座標系のベクトル(X)
+	 * @param  [in]  dY    IMU座標系のベクトル(Y)
+	 * @param  [in]  dZ    IMU座標系のベクトル(Z)
+	 * @param  [out] dOutX ロボット座標系のベクトル(X)
+	 * @param  [out] dOutY ロボット座標系のベクトル(Y)
+	 * @param  [out] dOutZ ロボット座標系のベクトル(Z)
+	 * @return なし
+	 */
+	void ConvertToRobotFrame(double dX, double dY, double dZ, double &dOutX, double &dOutY, double &dOutZ) const;
+
+	/*!
+	 * ロボット座標系の加速度を取得する
+	 * @method GetAccelX
+	 * @return X軸方向の加速度 [m/s^2]
+	 */
+	double GetAccelX(void) const;
+
+	/*!
+	 * ロボット座標系の加速度を取得する
+	 * @method GetAccelY
+	 * @return Y軸方向の加速度 [m/s^2]
+	 */
+	double GetAccelY(void) const;
+
+	/*!
+	 * ロボット座標系の加速度を取得する
+	 * @method GetAccelZ
+	 * @return Z軸方向の加速度 [m/s^2]
+	 */
+	double GetAccelZ(void) const;
+
+	/*!
+	 * ロボット座標系の姿勢を取得する
+	 * @method GetRoll
+	 * @return ロール角 [rad]
+	 */
+	double GetRoll(void) const;
+
+	/*!
+	 * ロボット座標系の姿勢を取得する
+	 * @method GetPitch
+	 * @return ピッチ角 [rad]
+	 */
+	double GetPitch(void) const;
+
+	/*!
+	 * ロボット座標系の姿勢を取得する
+	 * @method GetYaw
+	 * @return ヨー角 [rad]
+	 */
+	double GetYaw(void) const;
+
+	/*!
+	 * 最後に取り込んだサンプルの時刻を取得する
+	 * @method GetTime
+	 * @return サンプリング時刻 [s] (UNIX時刻)
+	 */
+	double GetTime(void) const;
+
+private:
+	/*!
+	 * 加速度を更新する
+	 * @method UpdateAccel
+	 * @param  vecSample 前回出力以降のサンプル
+	 * @return なし
+	 */
+	void UpdateAccel(const std::vector<IMU_SAMPLE_t> &vecSample);
+
+	/*!
+	 * 姿勢を更新する
+	 * @method UpdateOrientation
+	 * @param  vecSample 前回出力以降のサンプル
+	 * @return なし
+	 */
+	void UpdateOrientation(const std::vector<IMU_SAMPLE_t> &vecSample);
+
+	/*!
+	 * オイラー角をクォータニオンに変換する
+	 * @method ToQuaternion
+	 * @param  stSample サンプル
+	 * @return クォータニオン
+	 */
+	static Eigen::Quaterniond ToQuaternion(const IMU_SAMPLE_t &stSample);
+
+	/*!
+	 * クォータニオンをオイラー角に変換する
+	 * @method ToEuler
+	 * @param  quat クォータニオン
+	 * @return オイラー角(ロール、ピッチ、ヨー) [rad]
+	 */
+	static Eigen::Vector3d ToEuler(const Eigen::Quaterniond &quat);
+
+	Eigen::Matrix3d m_matMount;			/*!< IMU座標系からロボット座標系への回転行列	*/
+	IMU_FILTER_MODE_t m_eAccelMode;		/*!< 加速度のフィルタ						*/
+	IMU_FILTER_MODE_t m_eOrientationMode;	/*!< 姿勢のフィルタ						*/
+	double m_dAlpha;					/*!< 指数平滑の係数							*/
+
+	bool m_bValid;						/*!< フィルタの状態が有効か					*/
+	double m_dTime;						/*!< 最後に取り込んだサンプルの時刻 [s]		*/
+	Eigen::Vector3d m_vecAccel;			/*!< IMU座標系のフィルタ後の加速度			*/
+	Eigen::Quaterniond m_quatOrientation;	/*!< IMU座標系のフィルタ後の姿勢			*/
+	Eigen::Vector3d m_vecAccelOut;		/*!< ロボット座標系の加速度					*/
+	Eigen::Vector3d m_vecEulerOut;		/*!< ロボット座標系のオイラー角				*/
+
+public:
+	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+#endif//IMU_SAMPLE_FILTER_H
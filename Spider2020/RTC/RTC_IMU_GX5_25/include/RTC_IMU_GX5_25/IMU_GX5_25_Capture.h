@@ -11,12 +11,38 @@
 
 #include "mscl/mscl.h"
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "MetricsRegistry.h"
+
+/*!
+ * ストリーミングで受信したESTFILTERの１サンプル
+ */
+struct IMU_SAMPLE_t
+{
+	double dTime;			/*!< サンプリング時刻 [s] (UNIX時刻)		*/
+	float fLinearAccelX;	/*!< X軸方向の加速度					*/
+	float fLinearAccelY;	/*!< Y軸方向の加速度					*/
+	float fLinearAccelZ;	/*!< Z軸方向の加速度					*/
+	float fEulerAnglesR;	/*!< オイラー角のロール					*/
+	float fEulerAnglesP;	/*!< オイラー角のピッチ					*/
+	float fEulerAnglesY;	/*!< オイラー角のヨー					*/
+};
+
 /*!
  * LORD製3DM-GX5-25の情報の取得クラス
  */
 class IMU_GX5_25_Capture
 {
 public:
+	typedef std::function<void(void)> ThreadInitCallback_t;	/*!< スレッド開始時の設定関数	*/
+
 	/*!
 	 * コンストラクタ
 	 * @method IMU_GX5_25_Capture
@@ -120,9 +146,91 @@ public:
 	 */
 	float GetEstEulerAnglesY(void);
 
+	/*!
+	 * ESTFILTERのデータストリーミングを開始する
+	 * @method StartStream
+	 * @param  uRate サンプリング周波数 [Hz] (1〜500)
+	 * @retval true 成功
+	 * @retval false 失敗
+	 * @remark 加速度及びオイラー角のチャンネルを設定し、受信スレッドを生成する
+	 */
+	bool StartStream(uint16_t uRate);
+
+	/*!
+	 * ESTFILTERのデータストリーミングを停止する
+	 * @method StopStream
+	 * @return なし
+	 */
+	void StopStream(void);
+
+	/*!
+	 * ストリーミング中かをチェックする
+	 * @method IsStreaming
+	 * @retval true ストリーミング中
+	 * @retval false 停止中
+	 */
+	bool IsStreaming(void);
+
+	/*!
+	 * 前回の呼び出し以降に受信したサンプルを取得する
+	 * @method ReadSamples
+	 * @param  [out] vecSample 受信したサンプル(古い順)
+	 * @return 取得したサンプル数
+	 * @remark 最新のサンプルでESTFILTERの加速度及びオイラー角を更新する
+	 */
+	size_t ReadSamples(std::vector<IMU_SAMPLE_t> &vecSample);
+
+	/*!
+	 * 受信スレッドの開始時に呼び出す関数を設定する
+	 * @method SetThreadInitCallback
+	 * @param  fnCallback 設定関数(優先度やCPUアフィニティの設定に使用する)
+	 * @return なし
+	 * @remark 次にStartStreamで生成したスレッドの先頭で呼び出す。
+	 */
+	void SetThreadInitCallback(ThreadInitCallback_t fnCallback);
+
 private:
+	/*!
+	 * ストリーミングデータの受信スレッド
+	 * @method Run
+	 * @return なし
+	 */
+	void Run(void);
+
+	/*!
+	 * 受信パケットからサンプルを取り出す
+	 * @method ParsePacket
+	 * @param  [in]  packet   受信パケット
+	 * @param  [in,out] stSample サンプル
+	 * @retval true 加速度またはオイラー角を含む
+	 * @retval false 対象データなし
+	 */
+	bool ParsePacket(const mscl::MipDataPacket &packet, IMU_SAMPLE_t &stSample);
+
+	/*!
+	 * サンプルをリングバッファに追加する
+	 * @method PushSample
+	 * @param  [in] stSample サンプル
+	 * @return なし
+	 */
+	void PushSample(const IMU_SAMPLE_t &stSample);
 
 	mscl::Connection* m_pConnection;	/*!< シリアル接続管理						*/
+	std::unique_ptr<mscl::InertialNode> m_spNode;	/*!< 通信ノード					*/
+	std::mutex m_NodeMutex;				/*!< 通信ノードへのコマンドのミューテックス(受信待ちは含まない)	*/
+
+	std::unique_ptr<std::thread> m_spThread;	/*!< 受信スレッドクラス				*/
+	bool m_bExitThread;					/*!< スレッド終了フラグ					*/
+
+	std::mutex m_SampleMutex;			/*!< リングバッファのミューテックス		*/
+	std::vector<IMU_SAMPLE_t> m_vecSampleRing;	/*!< サンプルのリングバッファ		*/
+	size_t m_sizeRingHead;				/*!< 次に書き込む位置					*/
+	size_t m_sizeRingCount;				/*!< 格納済みのサンプル数				*/
+	uint64_t m_uSampleSeq;				/*!< 受信したサンプルの通番				*/
+	uint64_t m_uReadSeq;				/*!< 最後に読み込んだサンプルの通番		*/
+	double m_dClockOffset;				/*!< デバイス時刻からホスト時刻への補正量	*/
+	bool m_bClockOffsetValid;			/*!< デバイス時刻の補正量が有効か		*/
+
 	float m_fEstLinearAccelX;			/*!< ESTFILTERクラスのX軸方向の加速度		*/
 	float m_fEstLinearAccelY;			/*!< ESTFILTERクラスのY軸方向の加速度		*/
 	float m_fEstLinearAccelZ;			/*!< ESTFILTERクラスのZ軸方向の加速度		*/
@@ -130,6 +238,13 @@ private:
 	float m_fEstEulerAnglesP;			/*!< ESTFILTERクラスのオイラー角のピッチ	*/
 	float m_fEstEulerAnglesY;			/*!< ESTFILTERクラスのオイラー角のヨー		*/
 
+	MetricHistogram m_PollMetric;		/*!< パケットの取得と処理の時間 [ns]		*/
+	MetricCounter m_SampleMetric;		/*!< 受信したサンプル数					*/
+	MetricGauge m_SampleRateMetric;		/*!< １秒あたりのサンプル数				*/
+	MetricCounter m_ErrorMetric;		/*!< パケットの取得の失敗数				*/
+
+	ThreadInitCallback_t m_fnThreadInitCallback;	/*!< 受信スレッドの開始時の設定関数	*/
+
 };
 
 #endif//IMU_GX5_25_Capture_H
@@ -32,7 +32,12 @@
 #include <rtm/DataInPort.h>
 #include <rtm/DataOutPort.h>
 
+#include <vector>
+
 #include "IMU_GX5_25_Capture.h"
+#include "OrientationHistoryWrapper.h"
+#include "LatestReader.h"
+#include "IMUSampleFilter.h"
 
 /*!
  * @class RTC_IMU_GX5_25
@@ -224,6 +229,20 @@ public:
 	 */
 	void WriteOrientation3D(void);
 
+	/*!
+	 * 前回出力以降の時刻付き３次元の姿勢をまとめてポートに出力する
+	 * @method WriteOrientation3DHistory
+	 * @return なし
+	 */
+	void WriteOrientation3DHistory(void);
+
+	/*!
+	 * ポーリングした加速度とオイラー角を今回のサンプルに追加する
+	 * @method AppendPolledSample
+	 * @return なし
+	 */
+	void AppendPolledSample(void);
+
 
 protected:
 	// <rtc-template block="protected_attribute">
@@ -263,6 +282,69 @@ protected:
 	 * - Unit: [deg]
 	 */
 	double m_Z_ROTATION;
+	/*!
+	 * ESTFILTERの取得方法(1:ストリーミング, 0:ポーリング)
+	 * - Name: ストリーミングモード STREAM_MODE
+	 * - DefaultValue: 1
+	 */
+	long m_STREAM_MODE;
+	/*!
+	 * ストリーミング時のサンプリング周波数(最大500)
+	 * - Name: ストリーミング周波数 STREAM_RATE
+	 * - DefaultValue: 100
+	 * - Unit: [Hz]
+	 */
+	long m_STREAM_RATE;
+	/*!
+	 * 加速度の間引きフィルタ(0:最新, 1:移動平均, 2:指数平滑)
+	 * - Name: 加速度のフィルタ ACCEL_FILTER
+	 * - DefaultValue: 1
+	 */
+	long m_ACCEL_FILTER;
+	/*!
+	 * 姿勢の間引きフィルタ(0:最新, 1:移動平均, 2:指数平滑, 3:クォータニオン平均)
+	 * - Name: 姿勢のフィルタ ORIENTATION_FILTER
+	 * - DefaultValue: 3
+	 */
+	long m_ORIENTATION_FILTER;
+	/*!
+	 * 指数平滑の係数(サンプル毎、0～1、大きいほど新しいサンプルを重視する)
+	 * - Name: 指数平滑の係数 FILTER_ALPHA
+	 * - DefaultValue: 0.2
+	 */
+	double m_FILTER_ALPHA;
+	/*!
+	 * 実行コンテキストのスレッドの優先度。1～99はSCHED_FIFOの優先度で実行し、
+	 * 0は通常のスケジューリング(SCHED_OTHER)で実行する。
+	 * - Name: 実行コンテキストの優先度 RT_PRIORITY
+	 * - DefaultValue: 0
+	 * - Constraint: 0: SCHED_OTHER
+	 *               1～99: SCHED_FIFOの優先度
+	 */
+	long m_RT_PRIORITY;
+	/*!
+	 * 実行コンテキストのスレッドを割り当てるCPU("0"、"2-3"、"0,2"の形式)。
+	 * ALLは割り当てを変更しない。
+	 * - Name: 実行コンテキストのCPUアフィニティ RT_CPU_AFFINITY
+	 * - DefaultValue: ALL
+	 */
+	std::string m_RT_CPU_AFFINITY;
+	/*!
+	 * デバイスを読み込むキャプチャスレッドの優先度。1～99はSCHED_FIFOの
+	 * 優先度で実行し、0は通常のスケジューリング(SCHED_OTHER)で実行する。
+	 * - Name: キャプチャスレッドの優先度 CAPTURE_RT_PRIORITY
+	 * - DefaultValue: 0
+	 * - Constraint: 0: SCHED_OTHER
+	 *               1～99: SCHED_FIFOの優先度
+	 */
+	long m_CAPTURE_RT_PRIORITY;
+	/*!
+	 * キャプチャスレッドを割り当てるCPU("0"、"2-3"、"0,2"の形式)。
+	 * ALLは割り当てを変更しない。
+	 * - Name: キャプチャスレッドのCPUアフィニティ CAPTURE_CPU_AFFINITY
+	 * - DefaultValue: ALL
+	 */
+	std::string m_CAPTURE_CPU_AFFINITY;
 
 	// </rtc-template>
 
@@ -299,6 +381,18 @@ protected:
 	* - Unit: [rad]
 	*/
 	RTC::OutPort<RTC::TimedOrientation3D> m_Orientation3D_OutOut;
+	RTC::TimedDoubleSeq m_Orientation3DHistory_Out;
+	/*!
+	 * ロボットの座標系に合わせた時刻付き３次元の姿勢の履歴
+	 * - Type: TimedDoubleSeq
+	 * - Number: 4×サンプル数
+	 * - Semantics: [4n+0]: 時刻 [s]
+	 *              [4n+1]: ロール角
+	 *              [4n+2]: ピッチ角
+	 *              [4n+3]: ヨー角
+	 * - Unit: [s,rad]
+	 */
+	RTC::OutPort<RTC::TimedDoubleSeq> m_Orientation3DHistory_OutOut;
 
 	// </rtc-template>
 
@@ -326,7 +420,12 @@ private:
 
 	// </rtc-template>
 
+	OrientationHistoryWrapper m_Orientation3DHistory_OutWrap;	/*!< m_Orientation3DHistory_Outのラッパークラス */
+	LatestReader<RTC::TimedLong> m_ResetFilter_InReader;		/*!< m_ResetFilter_InInの最新データの読み込み */
+
 	IMU_GX5_25_Capture m_IMUCapture;	/*!< LORD製3DM-GX5-25の情報の取得クラス */
+	std::vector<IMU_SAMPLE_t> m_vecSample;	/*!< 今回受信したサンプル			*/
+	IMUSampleFilter m_SampleFilter;		/*!< サンプルの間引きフィルタ			*/
 
 	long m_lLastResetFilter;			/*!< 前回のフィルタをリセット指令		*/
 
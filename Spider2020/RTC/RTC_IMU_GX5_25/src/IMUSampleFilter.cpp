@@ -0,0 +1,234 @@
+#include "IMUSampleFilter.h"
+#include <algorithm>
+#include <cmath>
+
+#define DEG_TO_RAD(x)	((M_PI/180)*(x))
+
+/*!
+ * 角度を-π～πに正規化する
+ * @param  dAngle 角度 [rad]
+ * @return 正規化した角度 [rad]
+ */
+static double WrapAngle(double dAngle)
+{
+	return std::atan2(std::sin(dAngle), std::cos(dAngle));
+}
+
+IMUSampleFilter::IMUSampleFilter()
+	: m_matMount(Eigen::Matrix3d::Identity())
+	, m_eAccelMode(IMU_FILTER_MODE_LATEST)
+	, m_eOrientationMode(IMU_FILTER_MODE_LATEST)
+	, m_dAlpha(1.0)
+{
+	Reset();
+}
+
+IMUSampleFilter::~IMUSampleFilter()
+{
+}
+
+void IMUSampleFilter::SetMountRotation(double dX, double dY, double dZ)
+{
+	// IMU座標系をロボット座標系に回転する行列を計算する
+	m_matMount = (Eigen::AngleAxisd(DEG_TO_RAD(dZ), Eigen::Vector3d::UnitZ())
+	            * Eigen::AngleAxisd(DEG_TO_RAD(dY), Eigen::Vector3d::UnitY())
+	            * Eigen::AngleAxisd(DEG_TO_RAD(dX), Eigen::Vector3d::UnitX())).toRotationMatrix();
+}
+
+void IMUSampleFilter::SetMode(long lAccelMode, long lOrientationMode, double dAlpha)
+{
+	// 範囲外のフィルタは最新のサンプルとする
+	m_eAccelMode = ((0 <= lAccelMode) && (lAccelMode < IMU_FILTER_MODE_NUM)) ? (IMU_FILTER_MODE_t)lAccelMode : IMU_FILTER_MODE_LATEST;
+	m_eOrientationMode = ((0 <= lOrientationMode) && (lOrientationMode < IMU_FILTER_MODE_NUM)) ? (IMU_FILTER_MODE_t)lOrientationMode : IMU_FILTER_MODE_LATEST;
+
+	// 指数平滑の係数を0～1に制限する
+	m_dAlpha = std::max(0.0, std::min(dAlpha, 1.0));
+}
+
+void IMUSampleFilter::Reset(void)
+{
+	// フィルタの状態を初期化する
+	m_bValid = false;
+	m_dTime = 0.0;
+	m_vecAccel.setZero();
+	m_quatOrientation.setIdentity();
+	m_vecAccelOut.setZero();
+	m_vecEulerOut.setZero();
+}
+
+bool IMUSampleFilter::Update(const std::vector<IMU_SAMPLE_t> &vecSample)
+{
+	// サンプルがなければ前回の値を保持する
+	if(vecSample.empty())
+	{
+		return false;
+	}
+
+	// 加速度と姿勢を更新する
+	UpdateAccel(vecSample);
+	UpdateOrientation(vecSample);
+	m_bValid = true;
+	m_dTime = vecSample.back().dTime;
+
+	// ロボット座標系に変換する
+	m_vecAccelOut = m_matMount*m_vecAccel;
+	m_vecEulerOut = m_matMount*ToEuler(m_quatOrientation);
+
+	return true;
+}
+
+void IMUSampleFilter::ConvertToRobotFrame(double dX, double dY, double dZ, double &dOutX, double &dOutY, double &dOutZ) const
+{
+	Eigen::Vector3d vec;
+
+	// IMU座標系をロボット座標系に回転する
+	vec = m_matMount*Eigen::Vector3d(dX, dY, dZ);
+
+	dOutX = vec(0);
+	dOutY = vec(1);
+	dOutZ = vec(2);
+}
+
+double IMUSampleFilter::GetAccelX(void) const
+{
+	return m_vecAccelOut(0);
+}
+
+double IMUSampleFilter::GetAccelY(void) const
+{
+	return m_vecAccelOut(1);
+}
+
+double IMUSampleFilter::GetAccelZ(void) const
+{
+	return m_vecAccelOut(2);
+}
+
+double IMUSampleFilter::GetRoll(void) const
+{
+	return m_vecEulerOut(0);
+}
+
+double IMUSampleFilter::GetPitch(void) const
+{
+	return m_vecEulerOut(1);
+}
+
+double IMUSampleFilter::GetYaw(void) const
+{
+	return m_vecEulerOut(2);
+}
+
+double IMUSampleFilter::GetTime(void) const
+{
+	return m_dTime;
+}
+
+void IMUSampleFilter::UpdateAccel(const std::vector<IMU_SAMPLE_t> &vecSample)
+{
+	Eigen::Vector3d vecSum(Eigen::Vector3d::Zero());
+	Eigen::Vector3d vec;
+
+	switch(m_eAccelMode)
+	{
+	case IMU_FILTER_MODE_BOXCAR:
+	case IMU_FILTER_MODE_QUATERNION:
+		// 前回出力以降のサンプルを平均する
+		for(size_t i = 0; i < vecSample.size(); i++)
+		{
+			vecSum += Eigen::Vector3d(vecSample[i].fLinearAccelX, vecSample[i].fLinearAccelY, vecSample[i].fLinearAccelZ);
+		}
+		m_vecAccel = vecSum/(double)vecSample.size();
+		break;
+
+	case IMU_FILTER_MODE_EXPONENTIAL:
+		// サンプル毎に指数平滑する(初回は最初のサンプルで初期化する)
+		for(size_t i = 0; i < vecSample.size(); i++)
+		{
+			vec = Eigen::Vector3d(vecSample[i].fLinearAccelX, vecSample[i].fLinearAccelY, vecSample[i].fLinearAccelZ);
+			m_vecAccel = (m_bValid || (0 < i)) ? (m_vecAccel + m_dAlpha*(vec - m_vecAccel)).eval() : vec;
+		}
+		break;
+
+	default:
+		// 最新のサンプルとする
+		m_vecAccel = Eigen::Vector3d(vecSample.back().fLinearAccelX, vecSample.back().fLinearAccelY, vecSample.back().fLinearAccelZ);
+		break;
+	}
+}
+
+void IMUSampleFilter::UpdateOrientation(const std::vector<IMU_SAMPLE_t> &vecSample)
+{
+	Eigen::Vector4d vecSum(Eigen::Vector4d::Zero());
+	Eigen::Vector4d vecQuat;
+	Eigen::Vector3d vecBase;
+	Eigen::Vector3d vecDiff(Eigen::Vector3d::Zero());
+	Eigen::Quaterniond quat;
+	IMU_SAMPLE_t stMean;
+
+	switch(m_eOrientationMode)
+	{
+	case IMU_FILTER_MODE_BOXCAR:
+		// 最初のサンプルからの差を-π～πで平均し、角度の折り返しをまたいでも平均できるようにする
+		vecBase = Eigen::Vector3d(vecSample.front().fEulerAnglesR, vecSample.front().fEulerAnglesP, vecSample.front().fEulerAnglesY);
+		for(size_t i = 1; i < vecSample.size(); i++)
+		{
+			vecDiff(0) += WrapAngle(vecSample[i].fEulerAnglesR - vecBase(0));
+			vecDiff(1) += WrapAngle(vecSample[i].fEulerAnglesP - vecBase(1));
+			vecDiff(2) += WrapAngle(vecSample[i].fEulerAnglesY - vecBase(2));
+		}
+		vecBase += vecDiff/(double)vecSample.size();
+		stMean = vecSample.back();
+		stMean.fEulerAnglesR = (float)WrapAngle(vecBase(0));
+		stMean.fEulerAnglesP = (float)WrapAngle(vecBase(1));
+		stMean.fEulerAnglesY = (float)WrapAngle(vecBase(2));
+		m_quatOrientation = ToQuaternion(stMean);
+		break;
+
+	case IMU_FILTER_MODE_EXPONENTIAL:
+		// サンプル毎に球面線形補間で指数平滑する(初回は最初のサンプルで初期化する)
+		for(size_t i = 0; i < vecSample.size(); i++)
+		{
+			quat = ToQuaternion(vecSample[i]);
+			m_quatOrientation = (m_bValid || (0 < i)) ? m_quatOrientation.slerp(m_dAlpha, quat) : quat;
+		}
+		break;
+
+	case IMU_FILTER_MODE_QUATERNION:
+		// 符号を揃えたクォータニオンを加算して正規化する(近接した姿勢の平均の近似)
+		for(size_t i = 0; i < vecSample.size(); i++)
+		{
+			vecQuat = ToQuaternion(vecSample[i]).coeffs();
+			vecSum += (vecSum.dot(vecQuat) < 0.0) ? (-vecQuat).eval() : vecQuat;
+		}
+		m_quatOrientation.coeffs() = vecSum.normalized();
+		break;
+
+	default:
+		// 最新のサンプルとする
+		m_quatOrientation = ToQuaternion(vecSample.back());
+		break;
+	}
+}
+
+Eigen::Quaterniond IMUSampleFilter::ToQuaternion(const IMU_SAMPLE_t &stSample)
+{
+	// ZYX順のオイラー角からクォータニオンを計算する
+	return Eigen::AngleAxisd(stSample.fEulerAnglesY, Eigen::Vector3d::UnitZ())
+	     * Eigen::AngleAxisd(stSample.fEulerAnglesP, Eigen::Vector3d::UnitY())
+	     * Eigen::AngleAxisd(stSample.fEulerAnglesR, Eigen::Vector3d::UnitX());
+}
+
+Eigen::Vector3d IMUSampleFilter::ToEuler(const Eigen::Quaterniond &quat)
+{
+	double dSinP;
+
+	// クォータニオンからZYX順のオイラー角を計算する
+	dSinP = 2.0*(quat.w()*quat.y() - quat.z()*quat.x());
+	dSinP = std::max(-1.0, std::min(dSinP, 1.0));
+
+	return Eigen::Vector3d(
+		std::atan2(2.0*(quat.w()*quat.x() + quat.y()*quat.z()), 1.0 - 2.0*(quat.x()*quat.x() + quat.y()*quat.y())),
+		std::asin(dSinP),
+		std::atan2(2.0*(quat.w()*quat.z() + quat.x()*quat.y()), 1.0 - 2.0*(quat.y()*quat.y() + quat.z()*quat.z())));
+}
@@ -8,8 +8,47 @@
 
 #include "IMU_GX5_25_Capture.h"
 
+#include <algorithm>
+#include <chrono>
+
+/*!
+ * @brief リングバッファに保持するサンプル数
+ */
+#define SAMPLE_RING_SIZE		(1024)
+
+/*!
+ * @brief ストリーミングの最大サンプリング周波数 [Hz]
+ */
+#define STREAM_RATE_MAX			(500)
+
+/*!
+ * @brief 受信スレッドのパケット待ち時間 [ms]
+ */
+#define STREAM_RECV_TIMEOUT		(10)
+
+/*!
+ * @brief パケットの取得に失敗した場合の待ち時間の初期値及び最大値 [ms]
+ * @details 抜線等で失敗が続く間は待ち時間を倍にしていき、取得に成功すれば初期値に戻す
+ */
+#define STREAM_ERROR_WAIT_MIN	(10)
+#define STREAM_ERROR_WAIT_MAX	(1000)
+
+/*!
+ * @brief デバイス時刻の補正量を追従させる割合 [s/サンプル]
+ * @details 補正量は受信遅延が最小のサンプルに合わせ、クロックのずれに追従するため少しずつ増やす
+ */
+#define CLOCK_OFFSET_DRIFT		(0.00001)
+
 IMU_GX5_25_Capture::IMU_GX5_25_Capture()
 	: m_pConnection(nullptr)
+	, m_bExitThread(false)
+	, m_vecSampleRing(SAMPLE_RING_SIZE)
+	, m_sizeRingHead(0)
+	, m_sizeRingCount(0)
+	, m_uSampleSeq(0)
+	, m_uReadSeq(0)
+	, m_dClockOffset(0.0)
+	, m_bClockOffsetValid(false)
 	, m_fEstLinearAccelX(0.0)
 	, m_fEstLinearAccelY(0.0)
 	, m_fEstLinearAccelZ(0.0)
@@ -17,6 +56,11 @@ IMU_GX5_25_Capture::IMU_GX5_25_Capture()
 	, m_fEstEulerAnglesP(0.0)
 	, m_fEstEulerAnglesY(0.0)
 {
+	// 性能指標を登録する
+	m_PollMetric.Register("imu.poll");
+	m_SampleMetric.Register("imu.samples");
+	m_SampleRateMetric.Register("imu.sample_rate");
+	m_ErrorMetric.Register("imu.error");
 }
 
 IMU_GX5_25_Capture::~IMU_GX5_25_Capture()
@@ -46,10 +90,14 @@ bool IMU_GX5_25_Capture::Open(const std::string &sDeviceName)
 
 		// シリアルポートを開く
 		*m_pConnection = mscl::Connection::Serial(sDeviceName.c_str(), 115200);
+
+		// 通信ノードを作成する
+		m_spNode.reset(new mscl::InertialNode(*m_pConnection));
 	}
 	catch(const std::exception& e)
 	{
 		std::cout << e.what() << std::endl;
+		Close();
 		return false;
 	}
 
@@ -58,6 +106,12 @@ bool IMU_GX5_25_Capture::Open(const std::string &sDeviceName)
 
 void IMU_GX5_25_Capture::Close()
 {
+	// ストリーミングを停止する
+	StopStream();
+
+	// 通信ノードを破棄する
+	m_spNode.reset();
+
 	if(m_pConnection != nullptr)
 	{
 		delete m_pConnection;
@@ -67,16 +121,15 @@ void IMU_GX5_25_Capture::Close()
 
 bool IMU_GX5_25_Capture::ResetEstFilter(void)
 {
-	if(m_pConnection == nullptr)
+	if(m_spNode == nullptr)
 	{
 		return false;
 	}
 
-	// 通信ノードを作成する
-	mscl::InertialNode iNode(*m_pConnection);
+	std::lock_guard<std::mutex> lock(m_NodeMutex);
 
 	// ESTFILTERをリセットする
-	iNode.resetFilter();
+	m_spNode->resetFilter();
 
 	return true;
 }
@@ -85,16 +138,15 @@ bool IMU_GX5_25_Capture::InitEstFilter(float fRoll, float fPitch, float fYaw)
 {
 	mscl::EulerAngles ea(fRoll, fPitch, fYaw);
 
-	if(m_pConnection == nullptr)
+	if(m_spNode == nullptr)
 	{
 		return false;
 	}
 
-	// 通信ノードを作成する
-	mscl::InertialNode iNode(*m_pConnection);
+	std::lock_guard<std::mutex> lock(m_NodeMutex);
 
 	// ESTFILTERを初期化する
-	iNode.setInitialAttitude(ea);
+	m_spNode->setInitialAttitude(ea);
 
 	return true;
 }
@@ -105,24 +157,23 @@ bool IMU_GX5_25_Capture::PollEstLinearAccel(void)
 	mscl::MipDataPackets packets;
 	mscl::MipDataPoints data;
 
-	if(m_pConnection == nullptr)
+	if(m_spNode == nullptr)
 	{
 		return false;
 	}
 
+	std::lock_guard<std::mutex> lock(m_NodeMutex);
+
 	try
 	{
-		// 通信ノードを作成する
-		mscl::InertialNode iNode(*m_pConnection);
-
 		// ポーリング対象データを登録する
 		fields.push_back(mscl::MipTypes::ChannelField::CH_FIELD_ESTFILTER_ESTIMATED_LINEAR_ACCEL);
 
 		// ポーリングする
-		iNode.pollData(mscl::MipTypes::CLASS_ESTFILTER, fields);
+		m_spNode->pollData(mscl::MipTypes::CLASS_ESTFILTER, fields);
 
 		// ポーリングしたパケットを処理する
-		packets = iNode.getDataPackets();
+		packets = m_spNode->getDataPackets();
 		for(mscl::MipDataPackets::iterator itPacket = packets.begin(); itPacket != packets.end(); itPacket++)
 		{
 			// データを処理する
@@ -195,24 +246,23 @@ bool IMU_GX5_25_Capture::PollEstEulerAngles(void)
 	mscl::MipDataPackets packets;
 	mscl::MipDataPoints data;
 
-	if(m_pConnection == nullptr)
+	if(m_spNode == nullptr)
 	{
 		return false;
 	}
 
+	std::lock_guard<std::mutex> lock(m_NodeMutex);
+
 	try
 	{
-		// 通信ノードを作成する
-		mscl::InertialNode iNode(*m_pConnection);
-
 		// ポーリング対象データを登録する
 		fields.push_back(mscl::MipTypes::ChannelField::CH_FIELD_ESTFILTER_ESTIMATED_ORIENT_EULER);
 
 		// ポーリングする
-		iNode.pollData(mscl::MipTypes::CLASS_ESTFILTER, fields);
+		m_spNode->pollData(mscl::MipTypes::CLASS_ESTFILTER, fields);
 
 		// ポーリングしたパケットを処理する
-		packets = iNode.getDataPackets();
+		packets = m_spNode->getDataPackets();
 		for(mscl::MipDataPackets::iterator itPacket = packets.begin(); itPacket != packets.end(); itPacket++)
 		{
 			// データを処理する
@@ -278,3 +328,300 @@ float IMU_GX5_25_Capture::GetEstEulerAnglesY(void)
 
 	return m_fEstEulerAnglesY;
 }
+
+bool IMU_GX5_25_Capture::StartStream(uint16_t uRate)
+{
+	mscl::MipChannels channels;
+
+	if(m_spNode == nullptr || m_spThread != nullptr)
+	{
+		return false;
+	}
+
+	// サンプリング周波数を制限する
+	uRate = std::max<uint16_t>(1, std::min<uint16_t>(uRate, STREAM_RATE_MAX));
+
+	try
+	{
+		std::lock_guard<std::mutex> lock(m_NodeMutex);
+
+		// ストリーミング対象チャンネルを登録する
+		channels.push_back(mscl::MipChannel(mscl::MipTypes::ChannelField::CH_FIELD_ESTFILTER_ESTIMATED_LINEAR_ACCEL, mscl::SampleRate::Hertz(uRate)));
+		channels.push_back(mscl::MipChannel(mscl::MipTypes::ChannelField::CH_FIELD_ESTFILTER_ESTIMATED_ORIENT_EULER, mscl::SampleRate::Hertz(uRate)));
+		channels.push_back(mscl::MipChannel(mscl::MipTypes::ChannelField::CH_FIELD_ESTFILTER_GPS_TIMESTAMP, mscl::SampleRate::Hertz(uRate)));
+		m_spNode->setActiveChannelFields(mscl::MipTypes::CLASS_ESTFILTER, channels);
+
+		// ストリーミングを開始する
+		m_spNode->enableDataStream(mscl::MipTypes::CLASS_ESTFILTER);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+		return false;
+	}
+
+	// リングバッファを初期化する
+	{
+		std::lock_guard<std::mutex> lock(m_SampleMutex);
+		m_sizeRingHead = 0;
+		m_sizeRingCount = 0;
+		m_uSampleSeq = 0;
+		m_uReadSeq = 0;
+		m_bClockOffsetValid = false;
+	}
+
+	// 受信スレッドを生成する
+	m_bExitThread = false;
+	m_spThread.reset(new std::thread(&IMU_GX5_25_Capture::Run, this));
+
+	return true;
+}
+
+void IMU_GX5_25_Capture::StopStream(void)
+{
+	if(m_spThread == nullptr)
+	{
+		return;
+	}
+
+	// 受信スレッドを終了する
+	{
+		std::lock_guard<std::mutex> lock(m_NodeMutex);
+		m_bExitThread = true;
+	}
+	m_spThread->join();
+	m_spThread.reset();
+
+	try
+	{
+		std::lock_guard<std::mutex> lock(m_NodeMutex);
+
+		// ストリーミングを停止する
+		m_spNode->enableDataStream(mscl::MipTypes::CLASS_ESTFILTER, false);
+	}
+	catch(const std::exception& e)
+	{
+		std::cout << e.what() << std::endl;
+	}
+}
+
+bool IMU_GX5_25_Capture::IsStreaming(void)
+{
+	return (m_spThread != nullptr);
+}
+
+size_t IMU_GX5_25_Capture::ReadSamples(std::vector<IMU_SAMPLE_t> &vecSample)
+{
+	size_t sizeNumber = 0;
+	size_t sizeStart = 0;
+
+	vecSample.clear();
+
+	{
+		std::lock_guard<std::mutex> lock(m_SampleMutex);
+
+		// 未読のサンプル数を求める(上書きされたサンプルは除く)
+		sizeNumber = (size_t)std::min<uint64_t>(m_uSampleSeq - m_uReadSeq, m_sizeRingCount);
+		if(sizeNumber == 0)
+		{
+			return 0;
+		}
+
+		// 未読のサンプルを古い順に取り出す
+		sizeStart = (m_sizeRingHead + SAMPLE_RING_SIZE - sizeNumber) % SAMPLE_RING_SIZE;
+		for(size_t i = 0; i < sizeNumber; i++)
+		{
+			vecSample.push_back(m_vecSampleRing[(sizeStart + i) % SAMPLE_RING_SIZE]);
+		}
+		m_uReadSeq = m_uSampleSeq;
+	}
+
+	// 最新のサンプルで加速度及びオイラー角を更新する
+	m_fEstLinearAccelX = vecSample.back().fLinearAccelX;
+	m_fEstLinearAccelY = vecSample.back().fLinearAccelY;
+	m_fEstLinearAccelZ = vecSample.back().fLinearAccelZ;
+	m_fEstEulerAnglesR = vecSample.back().fEulerAnglesR;
+	m_fEstEulerAnglesP = vecSample.back().fEulerAnglesP;
+	m_fEstEulerAnglesY = vecSample.back().fEulerAnglesY;
+
+	return sizeNumber;
+}
+
+void IMU_GX5_25_Capture::SetThreadInitCallback(ThreadInitCallback_t fnCallback)
+{
+	// 受信スレッドの生成前に呼び出すため、排他しない
+	m_fnThreadInitCallback = fnCallback;
+}
+
+void IMU_GX5_25_Capture::Run(void)
+{
+	mscl::MipDataPackets packets;
+	IMU_SAMPLE_t stSample = {};
+	int64_t iStartNs = 0;
+	int64_t iRateStartNs = MetricsRegistry::GetTimeNs();
+	uint32_t uRateSamples = 0;
+	uint32_t uSamples = 0;
+	int iErrorWait = 0;
+
+	// 受信スレッドの優先度とCPUアフィニティを設定する
+	if(m_fnThreadInitCallback)
+	{
+		m_fnThreadInitCallback();
+	}
+
+	while(true)
+	{
+		try
+		{
+			// 終了要求をチェックする
+			iStartNs = MetricsRegistry::GetTimeNs();
+			uSamples = 0;
+			packets.clear();
+			{
+				std::lock_guard<std::mutex> lock(m_NodeMutex);
+				if(m_bExitThread)
+				{
+					break;
+				}
+			}
+
+			// 受信済みのパケットを取得する
+			// MSCLのパケット受信バッファは内部で排他されるため、受信待ちの間は通信ノードをロックせず、
+			// onExecuteからのESTFILTERのリセット等のコマンドを待たせない
+			packets = m_spNode->getDataPackets(STREAM_RECV_TIMEOUT);
+			iErrorWait = 0;
+
+			// パケットを処理する
+			for(mscl::MipDataPackets::iterator itPacket = packets.begin(); itPacket != packets.end(); itPacket++)
+			{
+				if(ParsePacket(*itPacket, stSample))
+				{
+					PushSample(stSample);
+					uSamples++;
+				}
+			}
+
+			// 取得と処理の時間、サンプル数を記録する(１秒毎にサンプル数を更新する)
+			if(!packets.empty())
+			{
+				m_PollMetric.RecordSince(iStartNs);
+				m_SampleMetric.Add(uSamples);
+				uRateSamples += uSamples;
+			}
+			if(1000000000LL <= (iStartNs - iRateStartNs))
+			{
+				m_SampleRateMetric.Set((double)uRateSamples*1000000000.0/(double)(iStartNs - iRateStartNs));
+				uRateSamples = 0;
+				iRateStartNs = iStartNs;
+			}
+		}
+		catch(const std::exception& e)
+		{
+			m_ErrorMetric.Add();
+
+			// 失敗が続く間は最初の１回だけ表示し、待ち時間を延ばしながら再試行する
+			if(iErrorWait == 0)
+			{
+				std::cout << e.what() << std::endl;
+				iErrorWait = STREAM_ERROR_WAIT_MIN;
+			}
+			else
+			{
+				iErrorWait = std::min(iErrorWait*2, STREAM_ERROR_WAIT_MAX);
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(iErrorWait));
+			continue;
+		}
+
+		// パケットがなければ待機する
+		if(packets.empty())
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+}
+
+bool IMU_GX5_25_Capture::ParsePacket(const mscl::MipDataPacket &packet, IMU_SAMPLE_t &stSample)
+{
+	bool bFound = false;
+	double dHostTime = 0.0;
+	double dDeviceTime = 0.0;
+	const mscl::MipDataPoints &data = packet.data();
+
+	// 受信時刻を取得する
+	dHostTime = packet.collectedTimestamp().nanoseconds() / 1.0e9;
+	stSample.dTime = dHostTime;
+
+	// デバイス時刻があればホスト時刻に合わせてサンプリング時刻とする
+	if(packet.hasDeviceTime())
+	{
+		dDeviceTime = packet.deviceTimestamp().nanoseconds() / 1.0e9;
+
+		// 受信遅延が最小のサンプルに補正量を合わせる
+		if(!m_bClockOffsetValid || (dHostTime - dDeviceTime) < m_dClockOffset)
+		{
+			m_dClockOffset = dHostTime - dDeviceTime;
+			m_bClockOffsetValid = true;
+		}
+		else
+		{
+			m_dClockOffset += CLOCK_OFFSET_DRIFT;
+		}
+		stSample.dTime = dDeviceTime + m_dClockOffset;
+	}
+
+	// データを処理する
+	for(mscl::MipDataPoints::const_iterator itData = data.begin(); itData != data.end(); itData++)
+	{
+		if(itData->field() == mscl::MipTypes::ChannelField::CH_FIELD_ESTFILTER_ESTIMATED_LINEAR_ACCEL)
+		{
+			// 加速度を取得する
+			if(itData->qualifier() == mscl::MipTypes::ChannelQualifier::CH_X)
+			{
+				stSample.fLinearAccelX = itData->as_float();
+			}
+			else if(itData->qualifier() == mscl::MipTypes::ChannelQualifier::CH_Y)
+			{
+				stSample.fLinearAccelY = itData->as_float();
+			}
+			else if(itData->qualifier() == mscl::MipTypes::ChannelQualifier::CH_Z)
+			{
+				stSample.fLinearAccelZ = itData->as_float();
+			}
+			bFound = true;
+		}
+		else if(itData->field() == mscl::MipTypes::ChannelField::CH_FIELD_ESTFILTER_ESTIMATED_ORIENT_EULER)
+		{
+			// オイラー角を取得する
+			if(itData->qualifier() == mscl::MipTypes::ChannelQualifier::CH_ROLL)
+			{
+				stSample.fEulerAnglesR = itData->as_float();
+			}
+			else if(itData->qualifier() == mscl::MipTypes::ChannelQualifier::CH_PITCH)
+			{
+				stSample.fEulerAnglesP = itData->as_float();
+			}
+			else if(itData->qualifier() == mscl::MipTypes::ChannelQualifier::CH_YAW)
+			{
+				stSample.fEulerAnglesY = itData->as_float();
+			}
+			bFound = true;
+		}
+	}
+
+	return bFound;
+}
+
+void IMU_GX5_25_Capture::PushSample(const IMU_SAMPLE_t &stSample)
+{
+	std::lock_guard<std::mutex> lock(m_SampleMutex);
+
+	// リングバッファに書き込む
+	m_vecSampleRing[m_sizeRingHead] = stSample;
+	m_sizeRingHead = (m_sizeRingHead + 1) % SAMPLE_RING_SIZE;
+	if(m_sizeRingCount < SAMPLE_RING_SIZE)
+	{
+		m_sizeRingCount++;
+	}
+	m_uSampleSeq++;
+}
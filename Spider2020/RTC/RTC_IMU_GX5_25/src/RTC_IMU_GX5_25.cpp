@@ -8,10 +8,9 @@
  */
 
 #include "RTC_IMU_GX5_25.h"
-#include <Eigen/Geometry>
-
-#define DEG_TO_RAD(x)	((M_PI/180)*(x))
-#define RAD_TO_DEG(x)	((180/M_PI)*(x))
+#include "RealtimeSetup.h"
+#include <algorithm>
+#include <sys/time.h>
 
 #define TIMEVAL_DIFF(x1,x2)	(((double)x1.tv_sec + (double)x1.tv_usec/1000000.0) - ((double)x2.tv_sec + (double)x2.tv_usec/1000000.0))
 
@@ -36,18 +35,45 @@ static const char* rtc_imu_gx5_25_spec[] =
 	"conf.default.X_ROTATION", "0.0",
 	"conf.default.Y_ROTATION", "0.0",
 	"conf.default.Z_ROTATION", "0.0",
+	"conf.default.STREAM_MODE", "1",
+	"conf.default.STREAM_RATE", "100",
+	"conf.default.ACCEL_FILTER", "1",
+	"conf.default.ORIENTATION_FILTER", "3",
+	"conf.default.FILTER_ALPHA", "0.2",
+	"conf.default.RT_PRIORITY", "0",
+	"conf.default.RT_CPU_AFFINITY", "ALL",
+	"conf.default.CAPTURE_RT_PRIORITY", "0",
+	"conf.default.CAPTURE_CPU_AFFINITY", "ALL",
 
 	// Widget
 	"conf.__widget__.DEVICE_NAME", "text",
 	"conf.__widget__.X_ROTATION", "text",
 	"conf.__widget__.Y_ROTATION", "text",
 	"conf.__widget__.Z_ROTATION", "text",
+	"conf.__widget__.STREAM_MODE", "text",
+	"conf.__widget__.STREAM_RATE", "text",
+	"conf.__widget__.ACCEL_FILTER", "text",
+	"conf.__widget__.ORIENTATION_FILTER", "text",
+	"conf.__widget__.FILTER_ALPHA", "text",
+	"conf.__widget__.RT_PRIORITY", "text",
+	"conf.__widget__.RT_CPU_AFFINITY", "text",
+	"conf.__widget__.CAPTURE_RT_PRIORITY", "text",
+	"conf.__widget__.CAPTURE_CPU_AFFINITY", "text",
 
 	// Constraints
 	"conf.__type__.DEVICE_NAME", "string",
 	"conf.__type__.X_ROTATION", "double",
 	"conf.__type__.Y_ROTATION", "double",
 	"conf.__type__.Z_ROTATION", "double",
+	"conf.__type__.STREAM_MODE", "long",
+	"conf.__type__.STREAM_RATE", "long",
+	"conf.__type__.ACCEL_FILTER", "long",
+	"conf.__type__.ORIENTATION_FILTER", "long",
+	"conf.__type__.FILTER_ALPHA", "double",
+	"conf.__type__.RT_PRIORITY", "long",
+	"conf.__type__.RT_CPU_AFFINITY", "string",
+	"conf.__type__.CAPTURE_RT_PRIORITY", "long",
+	"conf.__type__.CAPTURE_CPU_AFFINITY", "string",
 
 	""
 };
@@ -63,8 +89,11 @@ RTC_IMU_GX5_25::RTC_IMU_GX5_25(RTC::Manager* manager)
 	, m_ResetFilter_InIn("ResetFilter_In", m_ResetFilter_In)
 	, m_Acceleration3D_OutOut("Acceleration3D_Out", m_Acceleration3D_Out)
 	, m_Orientation3D_OutOut("Orientation3D_Out", m_Orientation3D_Out)
+	, m_Orientation3DHistory_OutOut("Orientation3DHistory_Out", m_Orientation3DHistory_Out)
 
 	// </rtc-template>
+	, m_Orientation3DHistory_OutWrap(m_Orientation3DHistory_Out)
+	, m_ResetFilter_InReader(m_ResetFilter_InIn, m_ResetFilter_In)
 {
 }
 
@@ -85,6 +114,7 @@ RTC::ReturnCode_t RTC_IMU_GX5_25::onInitialize()
 	// Set OutPort buffer
 	addOutPort("Acceleration3D_Out", m_Acceleration3D_OutOut);
 	addOutPort("Orientation3D_Out", m_Orientation3D_OutOut);
+	addOutPort("Orientation3DHistory_Out", m_Orientation3DHistory_OutOut);
 
 	// Set service provider to Ports
 
@@ -100,6 +130,15 @@ RTC::ReturnCode_t RTC_IMU_GX5_25::onInitialize()
 	bindParameter("X_ROTATION", m_X_ROTATION, "0.0");
 	bindParameter("Y_ROTATION", m_Y_ROTATION, "0.0");
 	bindParameter("Z_ROTATION", m_Z_ROTATION, "0.0");
+	bindParameter("STREAM_MODE", m_STREAM_MODE, "1");
+	bindParameter("STREAM_RATE", m_STREAM_RATE, "100");
+	bindParameter("ACCEL_FILTER", m_ACCEL_FILTER, "1");
+	bindParameter("ORIENTATION_FILTER", m_ORIENTATION_FILTER, "3");
+	bindParameter("FILTER_ALPHA", m_FILTER_ALPHA, "0.2");
+	bindParameter("RT_PRIORITY", m_RT_PRIORITY, "0");
+	bindParameter("RT_CPU_AFFINITY", m_RT_CPU_AFFINITY, "ALL");
+	bindParameter("CAPTURE_RT_PRIORITY", m_CAPTURE_RT_PRIORITY, "0");
+	bindParameter("CAPTURE_CPU_AFFINITY", m_CAPTURE_CPU_AFFINITY, "ALL");
 	// </rtc-template>
 
 	// フィルタリセットの入力を初期化する
@@ -115,6 +154,12 @@ RTC::ReturnCode_t RTC_IMU_GX5_25::onInitialize()
 	m_Orientation3D_Out.data.p = 0.0;
 	m_Orientation3D_Out.data.y = 0.0;
 
+	// ロボットの座標系に合わせた時刻付き３次元の姿勢の履歴の出力を初期化する
+	m_Orientation3DHistory_OutWrap.InitData();
+
+	// 受信したサンプルの格納領域を確保する
+	m_vecSample.reserve(1024);
+
 	// 前回のフィルタリセット指令を初期化する
 	m_lLastResetFilter = 0;
 
@@ -145,6 +190,17 @@ RTC::ReturnCode_t RTC_IMU_GX5_25::onShutdown(RTC::UniqueId ec_id)
 
 RTC::ReturnCode_t RTC_IMU_GX5_25::onActivated(RTC::UniqueId ec_id)
 {
+	int iCapturePriority = (int)m_CAPTURE_RT_PRIORITY;
+	std::string sCaptureCpuList = m_CAPTURE_CPU_AFFINITY;
+
+	// 実行コンテキストのスレッドの優先度とCPUアフィニティを設定する
+	RealtimeSetup::SetupThread((int)m_RT_PRIORITY, m_RT_CPU_AFFINITY, "imu.ec");
+
+	// 座標変換の回転行列と間引きフィルタを設定する
+	m_SampleFilter.SetMountRotation(m_X_ROTATION, m_Y_ROTATION, m_Z_ROTATION);
+	m_SampleFilter.SetMode(m_ACCEL_FILTER, m_ORIENTATION_FILTER, m_FILTER_ALPHA);
+	m_SampleFilter.Reset();
+
 	// シリアルポートを開く
 	m_IMUCapture.Open(m_DEVICE_NAME);
 
@@ -154,6 +210,17 @@ RTC::ReturnCode_t RTC_IMU_GX5_25::onActivated(RTC::UniqueId ec_id)
 	// Estimationフィルタを初期化する
 	m_IMUCapture.InitEstFilter(0.0, 0.0, 0.0);
 
+	// ストリーミングモードの場合
+	if(m_STREAM_MODE == 1)
+	{
+		// ESTFILTERのストリーミングを開始する(受信スレッドの開始時に優先度とCPUアフィニティを設定する)
+		m_IMUCapture.SetThreadInitCallback([iCapturePriority, sCaptureCpuList](){ RealtimeSetup::SetupThread(iCapturePriority, sCaptureCpuList, "imu.capture"); });
+		if(!m_IMUCapture.StartStream((uint16_t)std::max(1L, std::min(m_STREAM_RATE, 500L))))
+		{
+			printf("StartStream is failed\n");
+		}
+	}
+
 	return RTC::RTC_OK;
 }
 
@@ -170,6 +237,9 @@ RTC::ReturnCode_t RTC_IMU_GX5_25::onExecute(RTC::UniqueId ec_id)
 	// リセットフィルタ指令をポートから読み込む
 	ReadResetFilter();
 
+	// 前回受信したサンプルを破棄する
+	m_vecSample.clear();
+
 	// フィルタをリセットする場合
 	if((m_lLastResetFilter != 1) && (m_ResetFilter_In.data == 1))
 	{
@@ -178,6 +248,15 @@ RTC::ReturnCode_t RTC_IMU_GX5_25::onExecute(RTC::UniqueId ec_id)
 
 		// Estimationフィルタを初期化する
 		m_IMUCapture.InitEstFilter(0.0, 0.0, 0.0);
+
+		// 間引きフィルタの状態を初期化する
+		m_SampleFilter.Reset();
+	}
+	// ストリーミング中の場合
+	else if(m_IMUCapture.IsStreaming())
+	{
+		// 前回以降に受信したサンプルを取得する
+		m_IMUCapture.ReadSamples(m_vecSample);
 	}
 	// フィルタをリセットしない場合
 	else
@@ -187,15 +266,27 @@ RTC::ReturnCode_t RTC_IMU_GX5_25::onExecute(RTC::UniqueId ec_id)
 
 		// ESTFILTERのオイラー角をポーリングする
 		m_IMUCapture.PollEstEulerAngles();
+
+		// ポーリングした値を１つのサンプルとする
+		AppendPolledSample();
 	}
 	m_lLastResetFilter = m_ResetFilter_In.data;
 
+	// 前回出力以降のサンプルを出力周期に間引く
+	m_SampleFilter.Update(m_vecSample);
+
 	// ３軸の加速度をポートに出力する
 	WriteAcceleration3D();
 
 	// ３次元の姿勢をポートに出力する
 	WriteOrientation3D();
 
+	// 時刻付き３次元の姿勢の履歴をポートに出力する
+	if(m_IMUCapture.IsStreaming())
+	{
+		WriteOrientation3DHistory();
+	}
+
 	return RTC::RTC_OK;
 }
 
@@ -236,36 +327,36 @@ RTC::ReturnCode_t RTC_IMU_GX5_25::onRateChanged(RTC::UniqueId ec_id)
 
 void RTC_IMU_GX5_25::ReadResetFilter(void)
 {
-	// リセットフィルタ指令を更新する
-	if(m_ResetFilter_InIn.isNew())
-	{
-		// 次のデータを読み込む
-		m_ResetFilter_InIn.read();
-	}
+	// リセットフィルタ指令を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_ResetFilter_InReader.Read();
+}
+
+void RTC_IMU_GX5_25::AppendPolledSample(void)
+{
+	IMU_SAMPLE_t stSample;
+	struct timeval stTime;
+
+	// ポーリングした時刻をサンプリング時刻とする
+	gettimeofday(&stTime, NULL);
+	stSample.dTime = (double)stTime.tv_sec + (double)stTime.tv_usec/1000000.0;
+
+	// ポーリングした加速度とオイラー角を設定する
+	stSample.fLinearAccelX = m_IMUCapture.GetEstLinearAccelX();
+	stSample.fLinearAccelY = m_IMUCapture.GetEstLinearAccelY();
+	stSample.fLinearAccelZ = m_IMUCapture.GetEstLinearAccelZ();
+	stSample.fEulerAnglesR = m_IMUCapture.GetEstEulerAnglesR();
+	stSample.fEulerAnglesP = m_IMUCapture.GetEstEulerAnglesP();
+	stSample.fEulerAnglesY = m_IMUCapture.GetEstEulerAnglesY();
+
+	m_vecSample.push_back(stSample);
 }
 
 void RTC_IMU_GX5_25::WriteAcceleration3D(void)
 {
-	double dLinearAccelX = 0.0;
-	double dLinearAccelY = 0.0;
-	double dLinearAccelZ = 0.0;
-	Eigen::Vector3d vec(3);
-
-	// IMUの加速度を取得する
-	dLinearAccelX = m_IMUCapture.GetEstLinearAccelX();
-	dLinearAccelY = m_IMUCapture.GetEstLinearAccelY();
-	dLinearAccelZ = m_IMUCapture.GetEstLinearAccelZ();
-
-	// IMU座標系の加速度をロボット座標系の加速度に変換する
-	vec = Eigen::AngleAxisd(DEG_TO_RAD(m_Z_ROTATION), Eigen::Vector3d::UnitZ())
-	    * Eigen::AngleAxisd(DEG_TO_RAD(m_Y_ROTATION), Eigen::Vector3d::UnitY())
-	    * Eigen::AngleAxisd(DEG_TO_RAD(m_X_ROTATION), Eigen::Vector3d::UnitX())
-		* Eigen::Vector3d(dLinearAccelX, dLinearAccelY, dLinearAccelZ);
-
-	// ロボット座標系の加速度を出力データに設定する
-	m_Acceleration3D_Out.data.ax = vec(0);
-	m_Acceleration3D_Out.data.ay = vec(1);
-	m_Acceleration3D_Out.data.az = vec(2);
+	// 間引きフィルタ後のロボット座標系の加速度を出力データに設定する
+	m_Acceleration3D_Out.data.ax = m_SampleFilter.GetAccelX();
+	m_Acceleration3D_Out.data.ay = m_SampleFilter.GetAccelY();
+	m_Acceleration3D_Out.data.az = m_SampleFilter.GetAccelZ();
 
 	// ロボット座標系の加速度をポートに出力する
 	setTimestamp(m_Acceleration3D_Out);
@@ -273,31 +364,51 @@ void RTC_IMU_GX5_25::WriteAcceleration3D(void)
 }
 
 void RTC_IMU_GX5_25::WriteOrientation3D(void)
+{
+	// 間引きフィルタ後のロボット座標系のオイラー角を出力データに設定する
+	m_Orientation3D_Out.data.r = m_SampleFilter.GetRoll();
+	m_Orientation3D_Out.data.p = m_SampleFilter.GetPitch();
+	m_Orientation3D_Out.data.y = m_SampleFilter.GetYaw();
+
+	// ロボット座標系の加速度をポートに出力する
+	setTimestamp(m_Orientation3D_Out);
+
+	// ストリーミング中ならば最新サンプルのサンプリング時刻をタイムスタンプとする
+	if(!m_vecSample.empty())
+	{
+		m_Orientation3D_Out.tm.sec = (CORBA::ULong)m_vecSample.back().dTime;
+		m_Orientation3D_Out.tm.nsec = (CORBA::ULong)((m_vecSample.back().dTime - (double)m_Orientation3D_Out.tm.sec)*1000000000.0);
+	}
+	m_Orientation3D_OutOut.write();
+}
+
+void RTC_IMU_GX5_25::WriteOrientation3DHistory(void)
 {
 	double dEulerAngleR = 0.0;
 	double dEulerAngleP = 0.0;
 	double dEulerAngleY = 0.0;
-	Eigen::Vector3d vec(3);
 
-	// IMUの加速度を取得する
-	dEulerAngleR = m_IMUCapture.GetEstEulerAnglesR();
-	dEulerAngleP = m_IMUCapture.GetEstEulerAnglesP();
-	dEulerAngleY = m_IMUCapture.GetEstEulerAnglesY();
+	// 新しいサンプルがなければ出力しない
+	if(m_vecSample.empty())
+	{
+		return;
+	}
+
+	// サンプル数を設定する
+	m_Orientation3DHistory_OutWrap.SetNumber(m_vecSample.size());
 
-	// IMU座標系のオイラー角をロボット座標系のオイラー角に変換する
-	vec = Eigen::AngleAxisd(DEG_TO_RAD(m_Z_ROTATION), Eigen::Vector3d::UnitZ())
-	    * Eigen::AngleAxisd(DEG_TO_RAD(m_Y_ROTATION), Eigen::Vector3d::UnitY())
-	    * Eigen::AngleAxisd(DEG_TO_RAD(m_X_ROTATION), Eigen::Vector3d::UnitX())
-		* Eigen::Vector3d(dEulerAngleR, dEulerAngleP, dEulerAngleY);
+	for(uint32_t i = 0; i < m_vecSample.size(); i++)
+	{
+		// IMU座標系のオイラー角をロボット座標系のオイラー角に変換する
+		m_SampleFilter.ConvertToRobotFrame(m_vecSample[i].fEulerAnglesR, m_vecSample[i].fEulerAnglesP, m_vecSample[i].fEulerAnglesY, dEulerAngleR, dEulerAngleP, dEulerAngleY);
 
-	// ロボット座標系のオイラー角を出力データに設定する
-	m_Orientation3D_Out.data.r = vec(0);
-	m_Orientation3D_Out.data.p = vec(1);
-	m_Orientation3D_Out.data.y = vec(2);
+		// 時刻付きの姿勢を出力データに設定する
+		m_Orientation3DHistory_OutWrap.SetSample(i, m_vecSample[i].dTime, dEulerAngleR, dEulerAngleP, dEulerAngleY);
+	}
 
-	// ロボット座標系の加速度をポートに出力する
-	setTimestamp(m_Orientation3D_Out);
-	m_Orientation3D_OutOut.write();
+	// 時刻付き３次元の姿勢の履歴をポートに出力する
+	m_Orientation3DHistory_OutWrap.SetTimestamp();
+	m_Orientation3DHistory_OutOut.write();
 }
 
 
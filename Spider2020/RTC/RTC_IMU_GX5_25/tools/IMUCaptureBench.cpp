@@ -0,0 +1,195 @@
+// -*- C++ -*-
+/*!
+ * @file IMUCaptureBench.cpp
+ * @brief IMU_GX5_25_Captureのポーリング方式とストリーミング方式の性能計測
+ * @date 2026/10/19
+ *
+ * 使用例:
+ *   MIPSimulator -l /tmp/ttyIMU -d 2 -j 1 &
+ *   IMUCaptureBench -D /tmp/ttyIMU -m poll -n 500
+ *   IMUCaptureBench -D /tmp/ttyIMU -m stream -r 100 -t 10
+ * 最終行に結果を key=value 形式で出力する
+ */
+
+#include "IMU_GX5_25_Capture.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <sys/time.h>
+#include <unistd.h>
+
+/*!
+ * 現在時刻を取得する
+ * @return UNIX時刻 [s]
+ */
+static double Now(void)
+{
+	struct timeval stTime;
+	gettimeofday(&stTime, NULL);
+	return stTime.tv_sec + stTime.tv_usec/1000000.0;
+}
+
+/*!
+ * 百分位数を取得する
+ * @param  vecValue ソート済みの値
+ * @param  dRate    割合 (0-1)
+ * @return 百分位数
+ */
+static double Percentile(const std::vector<double> &vecValue, double dRate)
+{
+	if(vecValue.empty())
+	{
+		return 0.0;
+	}
+	return vecValue[std::min(vecValue.size() - 1, (size_t)(dRate*vecValue.size()))];
+}
+
+/*!
+ * ポーリング方式の計測
+ * @param  Capture IMUの取得クラス
+ * @param  iCount  ポーリング回数
+ * @retval 0 成功
+ * @retval 1 失敗
+ */
+static int BenchPoll(IMU_GX5_25_Capture &Capture, int iCount)
+{
+	std::vector<double> vecLatency;
+	double dStart, dSum = 0.0;
+	int iError = 0;
+
+	vecLatency.reserve(iCount);
+	for(int i = 0; i < iCount; i++)
+	{
+		// 加速度と姿勢を続けてポーリングする(RTCのonExecuteと同じ手順)
+		dStart = Now();
+		if(!Capture.PollEstLinearAccel() || !Capture.PollEstEulerAngles())
+		{
+			iError++;
+			continue;
+		}
+		vecLatency.push_back(Now() - dStart);
+		dSum += vecLatency.back();
+	}
+
+	std::sort(vecLatency.begin(), vecLatency.end());
+	printf("mode=poll count=%d error=%d mean_ms=%.3f p50_ms=%.3f p99_ms=%.3f max_ms=%.3f\n",
+		iCount, iError,
+		vecLatency.empty() ? 0.0 : dSum/vecLatency.size()*1000.0,
+		Percentile(vecLatency, 0.50)*1000.0,
+		Percentile(vecLatency, 0.99)*1000.0,
+		vecLatency.empty() ? 0.0 : vecLatency.back()*1000.0);
+	return (iError < iCount) ? 0 : 1;
+}
+
+/*!
+ * ストリーミング方式の計測
+ * @param  Capture IMUの取得クラス
+ * @param  iRate   ストリーミング周波数 [Hz]
+ * @param  dPeriod 計測時間 [s]
+ * @retval 0 成功
+ * @retval 1 失敗
+ */
+static int BenchStream(IMU_GX5_25_Capture &Capture, int iRate, double dPeriod)
+{
+	std::vector<IMU_SAMPLE_t> vecSample;
+	double dStart, dNow, dLastTime = 0.0;
+	double dAgeSum = 0.0, dAgeMax = 0.0;
+	uint64_t uCount = 0, uGap = 0;
+
+	// ストリーミングを開始する
+	if(!Capture.StartStream((uint16_t)iRate))
+	{
+		printf("StartStream is failed\n");
+		return 1;
+	}
+
+	// RTCの実行周期を模して定期的に読み出す
+	vecSample.reserve(1024);
+	dStart = Now();
+	while((dNow = Now()) - dStart < dPeriod)
+	{
+		vecSample.clear();
+		Capture.ReadSamples(vecSample);
+		for(size_t i = 0; i < vecSample.size(); i++)
+		{
+			double dAge = dNow - vecSample[i].dTime;
+			dAgeSum += dAge;
+			dAgeMax = std::max(dAgeMax, dAge);
+			if((0.0 < dLastTime) && (1.5/iRate < vecSample[i].dTime - dLastTime))
+			{
+				uGap++;
+			}
+			dLastTime = vecSample[i].dTime;
+			uCount++;
+		}
+		usleep(20000);
+	}
+	dPeriod = Now() - dStart;
+
+	// ストリーミングを停止する
+	Capture.StopStream();
+
+	printf("mode=stream rate=%d samples=%llu rate_hz=%.1f gaps=%llu age_mean_ms=%.3f age_max_ms=%.3f\n",
+		iRate, (unsigned long long)uCount, uCount/dPeriod, (unsigned long long)uGap,
+		uCount ? dAgeSum/uCount*1000.0 : 0.0, dAgeMax*1000.0);
+	return (0 < uCount) ? 0 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+	IMU_GX5_25_Capture Capture;
+	std::string sDeviceName = "/dev/ttyACM0";
+	std::string sMode = "poll";
+	int iCount = 500;
+	int iRate = 100;
+	double dPeriod = 10.0;
+	int iOpt, iResult;
+
+	// 引数を解析する
+	while((iOpt = getopt(argc, argv, "D:m:n:r:t:h")) != -1)
+	{
+		switch(iOpt)
+		{
+		case 'D':
+			sDeviceName = optarg;
+			break;
+		case 'm':
+			sMode = optarg;
+			break;
+		case 'n':
+			iCount = atoi(optarg);
+			break;
+		case 'r':
+			iRate = atoi(optarg);
+			break;
+		case 't':
+			dPeriod = atof(optarg);
+			break;
+		default:
+			printf("usage: %s [-D device] [-m poll|stream] [-n poll_count] [-r stream_rate] [-t stream_sec]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	// デバイスを開く
+	if(!Capture.Open(sDeviceName))
+	{
+		printf("Open is failed\n");
+		return 1;
+	}
+
+	if(sMode == "stream")
+	{
+		iResult = BenchStream(Capture, iRate, dPeriod);
+	}
+	else
+	{
+		iResult = BenchPoll(Capture, iCount);
+	}
+
+	Capture.Close();
+	return iResult;
+}
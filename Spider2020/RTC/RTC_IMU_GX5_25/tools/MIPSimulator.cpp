@@ -0,0 +1,839 @@
+// -*- C++ -*-
+/*!
+ * @file MIPSimulator.cpp
+ * @brief 3DM-GX5-25のMIPプロトコルを模擬する疑似端末シミュレータ
+ * @date 2026/10/19
+ */
+
+#include "MIPSimulator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <errno.h>
+#include <fcntl.h>
+#include <fstream>
+#include <poll.h>
+#include <sstream>
+#include <termios.h>
+#include <unistd.h>
+
+/*! @name MIPフレーム
+ *	MIPプロトコルのフレーム構成
+ */
+/* @{ */
+#define MIP_SYNC1					(0x75)		/*!< 同期バイト１					*/
+#define MIP_SYNC2					(0x65)		/*!< 同期バイト２					*/
+#define MIP_HEADER_SIZE				(4)			/*!< ヘッダ長						*/
+#define MIP_CHECKSUM_SIZE			(2)			/*!< チェックサム長					*/
+/* @} */
+
+/*! @name ディスクリプタセット
+ *	MIPプロトコルのディスクリプタセット
+ */
+/* @{ */
+#define DESC_SET_BASE				(0x01)		/*!< Baseコマンド					*/
+#define DESC_SET_3DM				(0x0C)		/*!< 3DMコマンド					*/
+#define DESC_SET_EF					(0x0D)		/*!< Estimation Filterコマンド		*/
+#define DESC_SET_EF_DATA			(0x82)		/*!< Estimation Filterデータ		*/
+/* @} */
+
+/*! @name コマンドディスクリプタ
+ *	シミュレータが応答するコマンド
+ */
+/* @{ */
+#define BASE_PING					(0x01)		/*!< Ping							*/
+#define BASE_SET_IDLE				(0x02)		/*!< Set to Idle					*/
+#define BASE_DEVICE_INFO			(0x03)		/*!< Get Device Info				*/
+#define BASE_DESCRIPTOR_SETS		(0x04)		/*!< Get Descriptor Sets			*/
+#define BASE_RESUME					(0x06)		/*!< Resume							*/
+#define DM_POLL_EF					(0x03)		/*!< Poll Estimation Filter Data	*/
+#define DM_IMU_BASE_RATE			(0x06)		/*!< Get IMU Base Rate				*/
+#define DM_GNSS_BASE_RATE			(0x07)		/*!< Get GNSS Base Rate				*/
+#define DM_EF_FORMAT				(0x0A)		/*!< EF Message Format				*/
+#define DM_EF_BASE_RATE				(0x0B)		/*!< Get EF Base Rate				*/
+#define DM_DATA_STREAM				(0x11)		/*!< Continuous Data Stream			*/
+#define EF_RESET_FILTER				(0x01)		/*!< Reset Filter					*/
+#define EF_INIT_ATTITUDE			(0x02)		/*!< Set Initial Attitude			*/
+/* @} */
+
+/*! @name 応答ディスクリプタ
+ *	コマンド応答のフィールド
+ */
+/* @{ */
+#define REPLY_ACK					(0xF1)		/*!< ACK/NACK						*/
+#define REPLY_DEVICE_INFO			(0x81)		/*!< Device Info					*/
+#define REPLY_DESCRIPTOR_SETS		(0x82)		/*!< Descriptor Sets				*/
+#define REPLY_IMU_BASE_RATE			(0x83)		/*!< IMU Base Rate					*/
+#define REPLY_GNSS_BASE_RATE		(0x84)		/*!< GNSS Base Rate					*/
+#define REPLY_DATA_STREAM			(0x85)		/*!< Continuous Data Stream			*/
+#define REPLY_EF_FORMAT				(0x82)		/*!< EF Message Format				*/
+#define REPLY_EF_BASE_RATE			(0x8A)		/*!< EF Base Rate					*/
+/* @} */
+
+/*! @name ACKのエラーコード
+ *	コマンド応答のエラーコード
+ */
+/* @{ */
+#define ACK_OK						(0x00)		/*!< 正常							*/
+#define ACK_UNKNOWN_COMMAND			(0x01)		/*!< 未対応のコマンド				*/
+#define ACK_INVALID_PARAMETER		(0x03)		/*!< パラメータ異常					*/
+/* @} */
+
+/*! @name データディスクリプタ
+ *	Estimation Filterデータのフィールド
+ */
+/* @{ */
+#define EF_DATA_EULER				(0x05)		/*!< オイラー角						*/
+#define EF_DATA_LINEAR_ACCEL		(0x0D)		/*!< 加速度							*/
+#define EF_DATA_GPS_TIMESTAMP		(0x11)		/*!< GPSタイムスタンプ				*/
+/* @} */
+
+/*! @name レート
+ *	データ出力レート
+ */
+/* @{ */
+#define IMU_BASE_RATE				(1000)		/*!< IMUの基準レート [Hz]			*/
+#define GNSS_BASE_RATE				(4)			/*!< GNSSの基準レート [Hz]			*/
+#define EF_BASE_RATE				(500)		/*!< Estimation Filterの基準レート [Hz]	*/
+#define DEFAULT_DECIMATION			(5)			/*!< 初期の間引き数(100Hz)			*/
+/* @} */
+
+#define DATA_STREAM_EF				(0x03)		/*!< Continuous Data Streamの対象(EF)	*/
+#define GRAVITY						(9.80665)	/*!< 重力加速度 [m/s^2]				*/
+#define RECV_BUFFER_SIZE			(1024)		/*!< １回の読み込みサイズ				*/
+
+/*!
+ * ビッグエンディアンで値を追加する
+ * @param  vecData 追加先
+ * @param  value   値
+ */
+template<typename T>
+static void PushBE(std::vector<uint8_t> &vecData, T value)
+{
+	uint8_t buf[sizeof(T)];
+
+	memcpy(buf, &value, sizeof(T));
+	for(int i = sizeof(T) - 1; 0 <= i; i--)
+	{
+		vecData.push_back(buf[i]);
+	}
+}
+
+/*!
+ * ビッグエンディアンの値を取り出す
+ * @param  pData 取り出し元
+ * @return 値
+ */
+template<typename T>
+static T ReadBE(const uint8_t *pData)
+{
+	uint8_t buf[sizeof(T)];
+	T value;
+
+	for(size_t i = 0; i < sizeof(T); i++)
+	{
+		buf[i] = pData[sizeof(T) - 1 - i];
+	}
+	memcpy(&value, buf, sizeof(T));
+
+	return value;
+}
+
+/*!
+ * 固定長の文字列フィールドを追加する
+ * @param  vecData 追加先
+ * @param  sValue  文字列
+ * @param  uSize   フィールド長
+ */
+static void PushString(std::vector<uint8_t> &vecData, const char *sValue, size_t uSize)
+{
+	size_t uLength = strlen(sValue);
+
+	for(size_t i = 0; i < uSize; i++)
+	{
+		vecData.push_back((i < uLength) ? sValue[i] : ' ');
+	}
+}
+
+MIPSimulator::MIPSimulator()
+	: m_fdMaster(-1)
+	, m_stConfig()
+	, m_stStat()
+	, m_dStartTime(0.0)
+	, m_uDecimation(DEFAULT_DECIMATION)
+	, m_bStreamEnable(false)
+	, m_bIdle(false)
+	, m_dNextStreamTime(0.0)
+	, m_fInitRoll(0.0f)
+	, m_fInitPitch(0.0f)
+	, m_fInitYaw(0.0f)
+	, m_dFilterResetTime(0.0)
+	, m_bPollData(false)
+{
+	// 初期のストリーミング対象を設定する
+	m_vecFormatDesc.push_back(EF_DATA_LINEAR_ACCEL);
+	m_vecFormatDesc.push_back(EF_DATA_EULER);
+}
+
+MIPSimulator::~MIPSimulator()
+{
+	// 疑似端末を閉じる
+	Close();
+}
+
+bool MIPSimulator::Open(const MIP_SIMULATOR_CONFIG_t &stConfig)
+{
+	struct termios stTermios;
+
+	// 多重オープンを防止する
+	if(m_fdMaster != -1)
+	{
+		printf("open is failed\n");
+		return false;
+	}
+
+	m_stConfig = stConfig;
+	m_Random.seed(stConfig.uSeed);
+	memset(&m_stStat, 0, sizeof(m_stStat));
+
+	// 再生ファイルを読み込む
+	if(!m_stConfig.sReplayFile.empty())
+	{
+		if(!LoadReplayFile(m_stConfig.sReplayFile))
+		{
+			printf("load(%s) is failed\n", m_stConfig.sReplayFile.c_str());
+			return false;
+		}
+	}
+
+	do
+	{
+		// 疑似端末を生成する
+		m_fdMaster = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+		if(m_fdMaster == -1)
+		{
+			printf("posix_openpt is failed\n");
+			break;
+		}
+
+		if((grantpt(m_fdMaster) != 0) || (unlockpt(m_fdMaster) != 0))
+		{
+			printf("grantpt is failed\n");
+			break;
+		}
+		m_sSlaveName = ptsname(m_fdMaster);
+
+		// エコーや改行変換をしないrawモードにする
+		if(tcgetattr(m_fdMaster, &stTermios) == 0)
+		{
+			cfmakeraw(&stTermios);
+			tcsetattr(m_fdMaster, TCSANOW, &stTermios);
+		}
+
+		// シンボリックリンクを作成する
+		if(!m_stConfig.sLinkName.empty())
+		{
+			unlink(m_stConfig.sLinkName.c_str());
+			if(symlink(m_sSlaveName.c_str(), m_stConfig.sLinkName.c_str()) != 0)
+			{
+				printf("symlink(%s) is failed\n", m_stConfig.sLinkName.c_str());
+				break;
+			}
+		}
+
+		// 起動時刻を記録する
+		m_dStartTime = 0.0;
+		m_dStartTime = Now();
+		m_dNextStreamTime = 0.0;
+
+		return true;
+	} while(0);
+
+	Close();
+
+	return false;
+}
+
+void MIPSimulator::Close(void)
+{
+	if(m_fdMaster != -1)
+	{
+		// シンボリックリンクを削除する
+		if(!m_stConfig.sLinkName.empty())
+		{
+			unlink(m_stConfig.sLinkName.c_str());
+		}
+
+		close(m_fdMaster);
+		m_fdMaster = -1;
+	}
+}
+
+std::string MIPSimulator::GetSlaveName(void)
+{
+	return m_sSlaveName;
+}
+
+bool MIPSimulator::Process(double dTimeout)
+{
+	struct pollfd stPoll;
+	uint8_t buf[RECV_BUFFER_SIZE];
+	double dNow = 0.0;
+	double dWait = dTimeout;
+	int iSize = 0;
+	std::vector<uint8_t> vecPayload;
+
+	if(m_fdMaster == -1)
+	{
+		return false;
+	}
+
+	// 次のデータ送出または送出待ちフレームまでの時間だけ待つ
+	dNow = Now();
+	if(m_bStreamEnable && !m_bIdle)
+	{
+		dWait = std::min(dWait, m_dNextStreamTime - dNow);
+	}
+	if(!m_deqSend.empty())
+	{
+		dWait = std::min(dWait, m_deqSend.front().dDueTime - dNow);
+	}
+	dWait = std::max(dWait, 0.0);
+
+	// コマンドを受信する
+	stPoll.fd = m_fdMaster;
+	stPoll.events = POLLIN;
+	stPoll.revents = 0;
+	if(0 < poll(&stPoll, 1, (int)(dWait*1000.0)))
+	{
+		if(stPoll.revents & POLLIN)
+		{
+			iSize = read(m_fdMaster, buf, sizeof(buf));
+			if(0 < iSize)
+			{
+				m_vecRecv.insert(m_vecRecv.end(), buf, buf + iSize);
+				ParseFrames();
+			}
+		}
+		else if(stPoll.revents & POLLHUP)
+		{
+			// スレーブ側が開かれていなければ待機する
+			usleep((useconds_t)(std::max(dWait, 0.01)*1000000.0));
+		}
+	}
+
+	// ストリーミングのデータを生成する
+	dNow = Now();
+	if(m_bStreamEnable && !m_bIdle)
+	{
+		if(m_dNextStreamTime < dNow - 1.0)
+		{
+			// 大きく遅れた場合は追いつかずに再同期する
+			m_dNextStreamTime = dNow;
+		}
+
+		while(m_dNextStreamTime <= dNow)
+		{
+			BuildDataPacket(m_vecFormatDesc, vecPayload);
+			if(QueueFrame(DESC_SET_EF_DATA, vecPayload, m_stConfig.dDropRate))
+			{
+				m_stStat.uSendData++;
+			}
+			else
+			{
+				m_stStat.uDropData++;
+			}
+			m_dNextStreamTime += (double)m_uDecimation/EF_BASE_RATE;
+		}
+	}
+
+	// 送出時刻に達したフレームを書き込む
+	return FlushFrames();
+}
+
+const MIP_SIMULATOR_STAT_t& MIPSimulator::GetStat(void)
+{
+	return m_stStat;
+}
+
+void MIPSimulator::ParseFrames(void)
+{
+	size_t uPos = 0;
+	uint8_t uLength = 0;
+	uint8_t uSum1 = 0;
+	uint8_t uSum2 = 0;
+
+	while(MIP_HEADER_SIZE + MIP_CHECKSUM_SIZE <= m_vecRecv.size() - uPos)
+	{
+		// 同期バイトを探す
+		if((m_vecRecv[uPos] != MIP_SYNC1) || (m_vecRecv[uPos + 1] != MIP_SYNC2))
+		{
+			uPos++;
+			continue;
+		}
+
+		// フレーム全体が揃うまで待つ
+		uLength = m_vecRecv[uPos + 3];
+		if(m_vecRecv.size() - uPos < (size_t)(MIP_HEADER_SIZE + uLength + MIP_CHECKSUM_SIZE))
+		{
+			break;
+		}
+
+		// チェックサムを検証する
+		uSum1 = 0;
+		uSum2 = 0;
+		for(size_t i = 0; i < (size_t)(MIP_HEADER_SIZE + uLength); i++)
+		{
+			uSum1 += m_vecRecv[uPos + i];
+			uSum2 += uSum1;
+		}
+		if((m_vecRecv[uPos + MIP_HEADER_SIZE + uLength] != uSum1) || (m_vecRecv[uPos + MIP_HEADER_SIZE + uLength + 1] != uSum2))
+		{
+			m_stStat.uRecvError++;
+			uPos++;
+			continue;
+		}
+
+		// コマンドを処理する
+		HandleCommand(m_vecRecv[uPos + 2], &m_vecRecv[uPos + MIP_HEADER_SIZE], uLength);
+		uPos += MIP_HEADER_SIZE + uLength + MIP_CHECKSUM_SIZE;
+	}
+
+	// 処理済みのデータを破棄する
+	m_vecRecv.erase(m_vecRecv.begin(), m_vecRecv.begin() + uPos);
+}
+
+void MIPSimulator::HandleCommand(uint8_t uDescSet, const uint8_t *pPayload, uint8_t uLength)
+{
+	std::vector<uint8_t> vecReply;
+	std::vector<uint8_t> vecAck;
+	std::vector<uint8_t> vecData;
+	uint8_t uPos = 0;
+	uint8_t uFieldLength = 0;
+	uint8_t uError = 0;
+
+	while(uPos + 2 <= uLength)
+	{
+		uFieldLength = pPayload[uPos];
+		if((uFieldLength < 2) || (uLength < uPos + uFieldLength))
+		{
+			m_stStat.uRecvError++;
+			return;
+		}
+
+		m_stStat.uRecvCommand++;
+		if(m_stConfig.bVerbose)
+		{
+			printf("command set=0x%02X desc=0x%02X len=%d\n", uDescSet, pPayload[uPos + 1], uFieldLength);
+		}
+
+		// フィールドを処理する
+		vecData.clear();
+		uError = HandleField(uDescSet, pPayload[uPos + 1], &pPayload[uPos + 2], uFieldLength - 2, vecData);
+
+		// ACKフィールドを追加する
+		vecReply.push_back(4);
+		vecReply.push_back(REPLY_ACK);
+		vecReply.push_back(pPayload[uPos + 1]);
+		vecReply.push_back(uError);
+		vecReply.insert(vecReply.end(), vecData.begin(), vecData.end());
+
+		uPos += uFieldLength;
+	}
+
+	// 応答を送出する
+	if(!vecReply.empty())
+	{
+		if(QueueFrame(uDescSet, vecReply, m_stConfig.dReplyDropRate))
+		{
+			m_stStat.uSendReply++;
+		}
+		else
+		{
+			m_stStat.uDropReply++;
+		}
+	}
+
+	// Poll EF Dataのデータパケットは応答の後に続ける
+	if(m_bPollData)
+	{
+		if(QueueFrame(DESC_SET_EF_DATA, m_vecPollData, m_stConfig.dDropRate))
+		{
+			m_stStat.uSendData++;
+		}
+		else
+		{
+			m_stStat.uDropData++;
+		}
+		m_bPollData = false;
+	}
+}
+
+uint8_t MIPSimulator::HandleField(uint8_t uDescSet, uint8_t uDesc, const uint8_t *pData, uint8_t uLength, std::vector<uint8_t> &vecReply)
+{
+	std::vector<uint8_t> vecField;
+	std::vector<uint8_t> vecDesc;
+	uint8_t uNumber = 0;
+
+	if(uDescSet == DESC_SET_BASE)
+	{
+		switch(uDesc)
+		{
+		case BASE_PING:
+			return ACK_OK;
+
+		case BASE_SET_IDLE:
+			m_bIdle = true;
+			return ACK_OK;
+
+		case BASE_RESUME:
+			m_bIdle = false;
+			m_dNextStreamTime = Now();
+			return ACK_OK;
+
+		case BASE_DEVICE_INFO:
+			// デバイス情報を応答する
+			vecField.push_back(REPLY_DEVICE_INFO);
+			PushBE<uint16_t>(vecField, 1108);
+			PushString(vecField, "3DM-GX5-25", 16);
+			PushString(vecField, "6251-4220", 16);
+			PushString(vecField, "6251.00000", 16);
+			PushString(vecField, "SIMULATOR", 16);
+			PushString(vecField, "5g, 300dps", 16);
+			break;
+
+		case BASE_DESCRIPTOR_SETS:
+			{
+				// 対応するディスクリプタを応答する
+				static const uint16_t uSupported[] =
+				{
+					0x0101, 0x0102, 0x0103, 0x0104, 0x0106,
+					0x0C03, 0x0C06, 0x0C07, 0x0C0A, 0x0C0B, 0x0C11,
+					0x0D01, 0x0D02,
+					0x8205, 0x820D, 0x8211,
+				};
+
+				vecField.push_back(REPLY_DESCRIPTOR_SETS);
+				for(size_t i = 0; i < sizeof(uSupported)/sizeof(uSupported[0]); i++)
+				{
+					PushBE<uint16_t>(vecField, uSupported[i]);
+				}
+			}
+			break;
+
+		default:
+			return ACK_UNKNOWN_COMMAND;
+		}
+	}
+	else if(uDescSet == DESC_SET_3DM)
+	{
+		switch(uDesc)
+		{
+		case DM_POLL_EF:
+			// 要求されたフィールド(なければストリーミング対象)のデータパケットを送出する
+			if(uLength < 2)
+			{
+				return ACK_INVALID_PARAMETER;
+			}
+			uNumber = pData[1];
+			for(uint8_t i = 0; (i < uNumber) && (2 + i*3 < uLength); i++)
+			{
+				vecDesc.push_back(pData[2 + i*3]);
+			}
+			BuildDataPacket(vecDesc.empty() ? m_vecFormatDesc : vecDesc, m_vecPollData);
+			m_bPollData = true;
+			return ACK_OK;
+
+		case DM_IMU_BASE_RATE:
+			vecField.push_back(REPLY_IMU_BASE_RATE);
+			PushBE<uint16_t>(vecField, IMU_BASE_RATE);
+			break;
+
+		case DM_GNSS_BASE_RATE:
+			vecField.push_back(REPLY_GNSS_BASE_RATE);
+			PushBE<uint16_t>(vecField, GNSS_BASE_RATE);
+			break;
+
+		case DM_EF_BASE_RATE:
+			vecField.push_back(REPLY_EF_BASE_RATE);
+			PushBE<uint16_t>(vecField, EF_BASE_RATE);
+			break;
+
+		case DM_EF_FORMAT:
+			if(uLength < 1)
+			{
+				return ACK_INVALID_PARAMETER;
+			}
+			// 書式を設定する
+			if(pData[0] == 0x01)
+			{
+				if(uLength < 2)
+				{
+					return ACK_INVALID_PARAMETER;
+				}
+				uNumber = pData[1];
+				m_vecFormatDesc.clear();
+				for(uint8_t i = 0; (i < uNumber) && (2 + i*3 + 2 < uLength); i++)
+				{
+					m_vecFormatDesc.push_back(pData[2 + i*3]);
+					m_uDecimation = std::max<uint16_t>(1, ReadBE<uint16_t>(&pData[2 + i*3 + 1]));
+				}
+				return ACK_OK;
+			}
+			// 書式を読み出す
+			else if(pData[0] == 0x02)
+			{
+				vecField.push_back(REPLY_EF_FORMAT);
+				vecField.push_back((uint8_t)m_vecFormatDesc.size());
+				for(size_t i = 0; i < m_vecFormatDesc.size(); i++)
+				{
+					vecField.push_back(m_vecFormatDesc[i]);
+					PushBE<uint16_t>(vecField, m_uDecimation);
+				}
+				break;
+			}
+			// 保存・読込・初期化は受け付けるのみ
+			return ACK_OK;
+
+		case DM_DATA_STREAM:
+			if(uLength < 2)
+			{
+				return ACK_INVALID_PARAMETER;
+			}
+			if(pData[1] != DATA_STREAM_EF)
+			{
+				return ACK_OK;
+			}
+			// ストリーミングを許可・禁止する
+			if((pData[0] == 0x01) && (3 <= uLength))
+			{
+				m_bStreamEnable = (pData[2] != 0);
+				m_dNextStreamTime = Now();
+				return ACK_OK;
+			}
+			// ストリーミングの状態を読み出す
+			else if(pData[0] == 0x02)
+			{
+				vecField.push_back(REPLY_DATA_STREAM);
+				vecField.push_back(DATA_STREAM_EF);
+				vecField.push_back(m_bStreamEnable ? 1 : 0);
+				break;
+			}
+			return ACK_OK;
+
+		default:
+			return ACK_UNKNOWN_COMMAND;
+		}
+	}
+	else if(uDescSet == DESC_SET_EF)
+	{
+		switch(uDesc)
+		{
+		case EF_RESET_FILTER:
+			// フィルタの経過時間を初期化する
+			m_dFilterResetTime = Now();
+			m_fInitRoll = 0.0f;
+			m_fInitPitch = 0.0f;
+			m_fInitYaw = 0.0f;
+			return ACK_OK;
+
+		case EF_INIT_ATTITUDE:
+			// 初期姿勢を設定する
+			if(uLength < 12)
+			{
+				return ACK_INVALID_PARAMETER;
+			}
+			m_fInitRoll = ReadBE<float>(&pData[0]);
+			m_fInitPitch = ReadBE<float>(&pData[4]);
+			m_fInitYaw = ReadBE<float>(&pData[8]);
+			m_dFilterResetTime = Now();
+			return ACK_OK;
+
+		default:
+			return ACK_UNKNOWN_COMMAND;
+		}
+	}
+	else
+	{
+		return ACK_UNKNOWN_COMMAND;
+	}
+
+	// 応答フィールドを追加する
+	vecReply.push_back((uint8_t)(vecField.size() + 1));
+	vecReply.insert(vecReply.end(), vecField.begin(), vecField.end());
+
+	return ACK_OK;
+}
+
+void MIPSimulator::BuildDataPacket(const std::vector<uint8_t> &vecDesc, std::vector<uint8_t> &vecPayload)
+{
+	double dNow = Now();
+	SAMPLE_t stSample = GetSample(dNow - m_dFilterResetTime);
+
+	vecPayload.clear();
+	for(size_t i = 0; i < vecDesc.size(); i++)
+	{
+		switch(vecDesc[i])
+		{
+		case EF_DATA_EULER:
+			vecPayload.push_back(16);
+			vecPayload.push_back(EF_DATA_EULER);
+			PushBE<float>(vecPayload, stSample.fRoll + m_fInitRoll);
+			PushBE<float>(vecPayload, stSample.fPitch + m_fInitPitch);
+			PushBE<float>(vecPayload, stSample.fYaw + m_fInitYaw);
+			PushBE<uint16_t>(vecPayload, 0x0001);
+			break;
+
+		case EF_DATA_LINEAR_ACCEL:
+			vecPayload.push_back(16);
+			vecPayload.push_back(EF_DATA_LINEAR_ACCEL);
+			PushBE<float>(vecPayload, stSample.fAccelX);
+			PushBE<float>(vecPayload, stSample.fAccelY);
+			PushBE<float>(vecPayload, stSample.fAccelZ);
+			PushBE<uint16_t>(vecPayload, 0x0001);
+			break;
+
+		case EF_DATA_GPS_TIMESTAMP:
+			// 起動からの経過時間をTime of Weekとして出力する
+			vecPayload.push_back(14);
+			vecPayload.push_back(EF_DATA_GPS_TIMESTAMP);
+			PushBE<double>(vecPayload, dNow);
+			PushBE<uint16_t>(vecPayload, 0);
+			PushBE<uint16_t>(vecPayload, 0x0007);
+			break;
+
+		default:
+			break;
+		}
+	}
+}
+
+bool MIPSimulator::QueueFrame(uint8_t uDescSet, const std::vector<uint8_t> &vecPayload, double dDropRate)
+{
+	std::uniform_real_distribution<double> dist(0.0, 1.0);
+	FRAME_t stFrame;
+	uint8_t uSum1 = 0;
+	uint8_t uSum2 = 0;
+
+	// 指定確率で破棄する
+	if((0.0 < dDropRate) && (dist(m_Random) < dDropRate))
+	{
+		return false;
+	}
+
+	// フレームを組み立てる
+	stFrame.vecData.push_back(MIP_SYNC1);
+	stFrame.vecData.push_back(MIP_SYNC2);
+	stFrame.vecData.push_back(uDescSet);
+	stFrame.vecData.push_back((uint8_t)vecPayload.size());
+	stFrame.vecData.insert(stFrame.vecData.end(), vecPayload.begin(), vecPayload.end());
+	for(size_t i = 0; i < stFrame.vecData.size(); i++)
+	{
+		uSum1 += stFrame.vecData[i];
+		uSum2 += uSum1;
+	}
+	stFrame.vecData.push_back(uSum1);
+	stFrame.vecData.push_back(uSum2);
+
+	// 遅延を加えた送出時刻を求める(順序は保つ)
+	stFrame.dDueTime = Now() + m_stConfig.dLatency + m_stConfig.dJitter*dist(m_Random);
+	if(!m_deqSend.empty())
+	{
+		stFrame.dDueTime = std::max(stFrame.dDueTime, m_deqSend.back().dDueTime);
+	}
+	m_deqSend.push_back(stFrame);
+
+	return true;
+}
+
+bool MIPSimulator::FlushFrames(void)
+{
+	double dNow = Now();
+	ssize_t iSize = 0;
+
+	while(!m_deqSend.empty() && (m_deqSend.front().dDueTime <= dNow))
+	{
+		iSize = write(m_fdMaster, m_deqSend.front().vecData.data(), m_deqSend.front().vecData.size());
+		if((iSize < 0) && (errno != EAGAIN) && (errno != EIO))
+		{
+			printf("write is failed\n");
+			return false;
+		}
+
+		// スレーブ側が読み出していない場合は破棄する
+		m_deqSend.pop_front();
+	}
+
+	return true;
+}
+
+MIPSimulator::SAMPLE_t MIPSimulator::GetSample(double dTime)
+{
+	SAMPLE_t stSample;
+	size_t uIndex = 0;
+	double dPeriod = 0.0;
+
+	// 再生ファイルがあればループ再生する
+	if(!m_vecReplay.empty())
+	{
+		dPeriod = m_vecReplay.back().dTime - m_vecReplay.front().dTime;
+		if(0.0 < dPeriod)
+		{
+			dTime = m_vecReplay.front().dTime + fmod(dTime, dPeriod);
+		}
+		while((uIndex + 1 < m_vecReplay.size()) && (m_vecReplay[uIndex + 1].dTime <= dTime))
+		{
+			uIndex++;
+		}
+		stSample = m_vecReplay[uIndex];
+		stSample.dTime = dTime;
+		return stSample;
+	}
+
+	// 合成波形(ゆっくりした揺動と一定の旋回)を生成する
+	stSample.dTime = dTime;
+	stSample.fRoll = (float)(0.10*sin(2.0*M_PI*0.20*dTime));
+	stSample.fPitch = (float)(0.05*sin(2.0*M_PI*0.13*dTime + 0.5));
+	stSample.fYaw = (float)remainder(0.10*dTime, 2.0*M_PI);
+	stSample.fAccelX = (float)(0.5*sin(2.0*M_PI*0.5*dTime));
+	stSample.fAccelY = (float)(0.2*cos(2.0*M_PI*0.5*dTime));
+	stSample.fAccelZ = (float)(-GRAVITY);
+
+	return stSample;
+}
+
+bool MIPSimulator::LoadReplayFile(const std::string &sFileName)
+{
+	std::ifstream ifs(sFileName);
+	std::string sLine;
+	SAMPLE_t stSample;
+	int iRet = 0;
+
+	if(!ifs)
+	{
+		return false;
+	}
+
+	// 時刻,ロール,ピッチ,ヨー[,加速度X,加速度Y,加速度Z]の行を読み込む
+	m_vecReplay.clear();
+	while(std::getline(ifs, sLine))
+	{
+		memset(&stSample, 0, sizeof(stSample));
+		stSample.fAccelZ = (float)(-GRAVITY);
+		iRet = sscanf(sLine.c_str(), "%lf,%f,%f,%f,%f,%f,%f", &stSample.dTime, &stSample.fRoll, &stSample.fPitch, &stSample.fYaw, &stSample.fAccelX, &stSample.fAccelY, &stSample.fAccelZ);
+		if(4 <= iRet)
+		{
+			m_vecReplay.push_back(stSample);
+		}
+	}
+
+	return !m_vecReplay.empty();
+}
+
+double MIPSimulator::Now(void)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count() - m_dStartTime;
+}
@@ -0,0 +1,239 @@
+// -*- C++ -*-
+/*!
+ * @file MIPSimulator.h
+ * @brief 3DM-GX5-25のMIPプロトコルを模擬する疑似端末シミュレータ
+ * @date 2026/10/19
+ */
+
+#ifndef MIP_SIMULATOR_H
+#define MIP_SIMULATOR_H
+
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+/*!
+ * シミュレータの設定
+ */
+struct MIP_SIMULATOR_CONFIG_t
+{
+	std::string sLinkName;		/*!< 疑似端末へのシンボリックリンク名(空なら作成しない)	*/
+	std::string sReplayFile;	/*!< 再生する姿勢のCSVファイル(空なら合成波形)		*/
+	double dLatency;			/*!< 応答及びデータの送出遅延 [s]					*/
+	double dJitter;				/*!< 送出遅延のばらつき(一様分布の幅) [s]			*/
+	double dDropRate;			/*!< データパケットを破棄する確率					*/
+	double dReplyDropRate;		/*!< コマンド応答を破棄する確率						*/
+	uint32_t uSeed;				/*!< 乱数の種										*/
+	bool bVerbose;				/*!< 受信したコマンドを表示するか					*/
+};
+
+/*!
+ * シミュレータの統計情報
+ */
+struct MIP_SIMULATOR_STAT_t
+{
+	uint64_t uRecvCommand;		/*!< 受信したコマンド数						*/
+	uint64_t uRecvError;		/*!< チェックサム異常などで破棄したフレーム数	*/
+	uint64_t uSendReply;		/*!< 送信したコマンド応答数					*/
+	uint64_t uDropReply;		/*!< 破棄したコマンド応答数					*/
+	uint64_t uSendData;			/*!< 送信したデータパケット数				*/
+	uint64_t uDropData;			/*!< 破棄したデータパケット数				*/
+};
+
+/*!
+ * 3DM-GX5-25のMIPプロトコルを模擬する疑似端末シミュレータ
+ * @details IMU_GX5_25_Captureが使用する次のコマンドに応答する
+ *          - Base: Ping, Set to Idle, Get Device Info, Get Descriptor Sets, Resume
+ *          - 3DM: Poll EF Data, EF Message Format, Get EF Base Rate, Continuous Data Stream
+ *          - EF: Reset Filter, Set Initial Attitude
+ *          データパケットはESTFILTERの加速度、オイラー角、GPSタイムスタンプを含む
+ */
+class MIPSimulator
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method MIPSimulator
+	 */
+	MIPSimulator();
+
+	/*!
+	 * デストラクタ
+	 * @method ~MIPSimulator
+	 */
+	virtual ~MIPSimulator();
+
+	/*!
+	 * 疑似端末を開く
+	 * @method Open
+	 * @param  stConfig シミュレータの設定
+	 * @retval true 成功
+	 * @retval false 失敗
+	 */
+	bool Open(const MIP_SIMULATOR_CONFIG_t &stConfig);
+
+	/*!
+	 * 疑似端末を閉じる
+	 * @method Close
+	 * @return なし
+	 */
+	void Close(void);
+
+	/*!
+	 * 疑似端末のスレーブ側のデバイス名を取得する
+	 * @method GetSlaveName
+	 * @return デバイス名
+	 */
+	std::string GetSlaveName(void);
+
+	/*!
+	 * コマンドの受信とデータの送出を１回処理する
+	 * @method Process
+	 * @param  dTimeout 受信待ちの最大時間 [s]
+	 * @retval true 成功
+	 * @retval false 疑似端末の異常
+	 */
+	bool Process(double dTimeout);
+
+	/*!
+	 * 統計情報を取得する
+	 * @method GetStat
+	 * @return 統計情報
+	 */
+	const MIP_SIMULATOR_STAT_t& GetStat(void);
+
+private:
+	/*!
+	 * 姿勢及び加速度のサンプル
+	 */
+	struct SAMPLE_t
+	{
+		double dTime;			/*!< 時刻 [s]				*/
+		float fRoll;			/*!< ロール角 [rad]			*/
+		float fPitch;			/*!< ピッチ角 [rad]			*/
+		float fYaw;				/*!< ヨー角 [rad]			*/
+		float fAccelX;			/*!< 加速度(X) [m/s^2]		*/
+		float fAccelY;			/*!< 加速度(Y) [m/s^2]		*/
+		float fAccelZ;			/*!< 加速度(Z) [m/s^2]		*/
+	};
+
+	/*!
+	 * 送出待ちのフレーム
+	 */
+	struct FRAME_t
+	{
+		double dDueTime;				/*!< 送出時刻 [s]		*/
+		std::vector<uint8_t> vecData;	/*!< フレーム			*/
+	};
+
+	/*!
+	 * 受信したデータからフレームを取り出して処理する
+	 * @method ParseFrames
+	 * @return なし
+	 */
+	void ParseFrames(void);
+
+	/*!
+	 * コマンドフレームを処理する
+	 * @method HandleCommand
+	 * @param  uDescSet ディスクリプタセット
+	 * @param  pPayload ペイロード
+	 * @param  uLength  ペイロード長
+	 * @return なし
+	 */
+	void HandleCommand(uint8_t uDescSet, const uint8_t *pPayload, uint8_t uLength);
+
+	/*!
+	 * コマンドフィールドを処理し、応答フィールドを生成する
+	 * @method HandleField
+	 * @param  [in]  uDescSet  ディスクリプタセット
+	 * @param  [in]  uDesc     フィールドディスクリプタ
+	 * @param  [in]  pData     フィールドデータ
+	 * @param  [in]  uLength   フィールドデータ長
+	 * @param  [out] vecReply  応答フィールド(ACKの後に追加する)
+	 * @return ACKのエラーコード
+	 */
+	uint8_t HandleField(uint8_t uDescSet, uint8_t uDesc, const uint8_t *pData, uint8_t uLength, std::vector<uint8_t> &vecReply);
+
+	/*!
+	 * データパケットを生成する
+	 * @method BuildDataPacket
+	 * @param  [in]  vecDesc 含めるフィールドディスクリプタ
+	 * @param  [out] vecPayload ペイロード
+	 * @return なし
+	 */
+	void BuildDataPacket(const std::vector<uint8_t> &vecDesc, std::vector<uint8_t> &vecPayload);
+
+	/*!
+	 * フレームを送出待ちに追加する
+	 * @method QueueFrame
+	 * @param  uDescSet   ディスクリプタセット
+	 * @param  vecPayload ペイロード
+	 * @param  dDropRate  破棄する確率
+	 * @retval true 追加した
+	 * @retval false 破棄した
+	 */
+	bool QueueFrame(uint8_t uDescSet, const std::vector<uint8_t> &vecPayload, double dDropRate);
+
+	/*!
+	 * 送出時刻に達したフレームを書き込む
+	 * @method FlushFrames
+	 * @retval true 成功
+	 * @retval false 書き込み失敗
+	 */
+	bool FlushFrames(void);
+
+	/*!
+	 * 指定時刻の姿勢を取得する
+	 * @method GetSample
+	 * @param  dTime 時刻 [s]
+	 * @return サンプル
+	 */
+	SAMPLE_t GetSample(double dTime);
+
+	/*!
+	 * 再生ファイルを読み込む
+	 * @method LoadReplayFile
+	 * @param  sFileName ファイル名
+	 * @retval true 成功
+	 * @retval false 失敗
+	 */
+	bool LoadReplayFile(const std::string &sFileName);
+
+	/*!
+	 * 現在時刻を取得する
+	 * @method Now
+	 * @return シミュレータ起動からの経過時間 [s]
+	 */
+	double Now(void);
+
+	int m_fdMaster;							/*!< 疑似端末のマスタ側				*/
+	std::string m_sSlaveName;				/*!< 疑似端末のスレーブ側のデバイス名	*/
+	MIP_SIMULATOR_CONFIG_t m_stConfig;		/*!< シミュレータの設定				*/
+	MIP_SIMULATOR_STAT_t m_stStat;			/*!< 統計情報						*/
+	double m_dStartTime;					/*!< 起動時刻 [s]					*/
+
+	std::vector<uint8_t> m_vecRecv;			/*!< 受信済みデータ					*/
+	std::deque<FRAME_t> m_deqSend;			/*!< 送出待ちのフレーム				*/
+	std::mt19937 m_Random;					/*!< 乱数生成器						*/
+
+	std::vector<uint8_t> m_vecFormatDesc;	/*!< ストリーミングするフィールド		*/
+	uint16_t m_uDecimation;					/*!< ストリーミングの間引き数			*/
+	bool m_bStreamEnable;					/*!< ストリーミング許可				*/
+	bool m_bIdle;							/*!< アイドル状態					*/
+	double m_dNextStreamTime;				/*!< 次のデータ送出時刻 [s]			*/
+
+	float m_fInitRoll;						/*!< 初期姿勢(ロール) [rad]			*/
+	float m_fInitPitch;						/*!< 初期姿勢(ピッチ) [rad]			*/
+	float m_fInitYaw;						/*!< 初期姿勢(ヨー) [rad]			*/
+	double m_dFilterResetTime;				/*!< フィルタをリセットした時刻 [s]	*/
+
+	std::vector<SAMPLE_t> m_vecReplay;		/*!< 再生する姿勢					*/
+
+	std::vector<uint8_t> m_vecPollData;		/*!< ポーリング応答のデータパケット	*/
+	bool m_bPollData;						/*!< ポーリング応答の送出要求			*/
+};
+
+#endif//MIP_SIMULATOR_H
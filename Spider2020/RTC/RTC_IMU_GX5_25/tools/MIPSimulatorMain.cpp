@@ -0,0 +1,137 @@
+// -*- C++ -*-
+/*!
+ * @file MIPSimulatorMain.cpp
+ * @brief 3DM-GX5-25のMIPプロトコルを模擬する疑似端末シミュレータの起動
+ * @date 2026/10/19
+ *
+ * 使用例:
+ *   MIPSimulator -l /tmp/ttyIMU -d 2 -j 1 -p 0.01
+ *   RTC_IMU_GX5_25のDEVICE_NAMEに/tmp/ttyIMUを設定して起動する
+ */
+
+#include "MIPSimulator.h"
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+/*! 終了要求 */
+static volatile sig_atomic_t g_bExit = 0;
+
+/*!
+ * シグナルハンドラ
+ * @param  iSignal シグナル番号
+ * @return なし
+ */
+static void SignalHandler(int iSignal)
+{
+	(void)iSignal;
+	g_bExit = 1;
+}
+
+/*!
+ * 使用方法を表示する
+ * @param  pName 実行ファイル名
+ * @return なし
+ */
+static void Usage(const char *pName)
+{
+	printf("usage: %s [-l link] [-f replay.csv] [-d latency_ms] [-j jitter_ms] [-p data_drop_rate] [-q reply_drop_rate] [-s seed] [-v]\n", pName);
+	printf("  -l  疑似端末へのシンボリックリンクを作成する\n");
+	printf("  -f  姿勢を再生するCSV (time,roll,pitch,yaw[,ax,ay,az])\n");
+	printf("  -d  応答及びデータの送出遅延 [ms]\n");
+	printf("  -j  送出遅延のばらつき [ms]\n");
+	printf("  -p  データパケットを破棄する確率 (0-1)\n");
+	printf("  -q  コマンド応答を破棄する確率 (0-1)\n");
+	printf("  -s  乱数の種\n");
+	printf("  -v  受信したコマンドを表示する\n");
+}
+
+int main(int argc, char *argv[])
+{
+	MIP_SIMULATOR_CONFIG_t stConfig;
+	MIPSimulator Simulator;
+	int iOpt;
+
+	// 設定を初期化する
+	stConfig.sLinkName = "";
+	stConfig.sReplayFile = "";
+	stConfig.dLatency = 0.0;
+	stConfig.dJitter = 0.0;
+	stConfig.dDropRate = 0.0;
+	stConfig.dReplyDropRate = 0.0;
+	stConfig.uSeed = 0;
+	stConfig.bVerbose = false;
+
+	// 引数を解析する
+	while((iOpt = getopt(argc, argv, "l:f:d:j:p:q:s:vh")) != -1)
+	{
+		switch(iOpt)
+		{
+		case 'l':
+			stConfig.sLinkName = optarg;
+			break;
+		case 'f':
+			stConfig.sReplayFile = optarg;
+			break;
+		case 'd':
+			stConfig.dLatency = atof(optarg)/1000.0;
+			break;
+		case 'j':
+			stConfig.dJitter = atof(optarg)/1000.0;
+			break;
+		case 'p':
+			stConfig.dDropRate = atof(optarg);
+			break;
+		case 'q':
+			stConfig.dReplyDropRate = atof(optarg);
+			break;
+		case 's':
+			stConfig.uSeed = (uint32_t)strtoul(optarg, NULL, 0);
+			break;
+		case 'v':
+			stConfig.bVerbose = true;
+			break;
+		default:
+			Usage(argv[0]);
+			return 1;
+		}
+	}
+
+	// 疑似端末を開く
+	if(!Simulator.Open(stConfig))
+	{
+		printf("Open is failed\n");
+		return 1;
+	}
+	printf("MIPSimulator: %s", Simulator.GetSlaveName().c_str());
+	if(!stConfig.sLinkName.empty())
+	{
+		printf(" -> %s", stConfig.sLinkName.c_str());
+	}
+	printf("\n");
+	fflush(stdout);
+
+	// 終了要求まで処理する
+	signal(SIGINT, SignalHandler);
+	signal(SIGTERM, SignalHandler);
+	while(!g_bExit)
+	{
+		if(!Simulator.Process(0.1))
+		{
+			printf("Process is failed\n");
+			break;
+		}
+	}
+
+	// 統計情報を表示する
+	const MIP_SIMULATOR_STAT_t &stStat = Simulator.GetStat();
+	printf("command=%llu error=%llu reply=%llu reply_drop=%llu data=%llu data_drop=%llu\n",
+		(unsigned long long)stStat.uRecvCommand, (unsigned long long)stStat.uRecvError,
+		(unsigned long long)stStat.uSendReply, (unsigned long long)stStat.uDropReply,
+		(unsigned long long)stStat.uSendData, (unsigned long long)stStat.uDropData);
+
+	Simulator.Close();
+	return 0;
+}
@@ -0,0 +1,230 @@
+// -*- C++ -*-
+/*!
+ * @file Jaco2Arm.h
+ * @brief １本のJaco2アームの速度指令と状態の取得を行うスレッド
+ * @date 2026/10/19
+ */
+
+#ifndef JACO2_ARM_H
+#define JACO2_ARM_H
+
+#include "KinovaBus.h"
+#include "MetricsRegistry.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <sys/time.h>
+
+/*!
+ * Jaco2アームの状態のスナップショット
+ */
+struct JACO2_TELEMETRY_t
+{
+	CartesianPosition stCartesian;		/*!< 手先位置姿勢及び指の位置		*/
+	AngularPosition stAngular;			/*!< アクチュエータ及び指の角度		*/
+	AngularPosition stCurrent;			/*!< アクチュエータ及び指の電流		*/
+	struct timeval stTime;				/*!< 取得時刻						*/
+};
+
+/*!
+ * アーム毎のスレッドの設定
+ */
+struct JACO2_ARM_CONFIG_t
+{
+	double dTelemetrySec;		/*!< 状態の取得周期 [s]				*/
+	double dCommandEpsilon;		/*!< 速度指令の不感帯				*/
+	double dKeepAliveSec;		/*!< 速度指令の再送周期 [s]			*/
+};
+
+/*!
+ * アーム毎のスレッドの統計情報
+ */
+struct JACO2_ARM_STAT_t
+{
+	uint64_t uPost;				/*!< 受け取った指令の数						*/
+	uint64_t uSend;				/*!< 送信した指令の数						*/
+	uint64_t uTelemetry;		/*!< 取得した状態の数						*/
+	uint64_t uError;			/*!< デバイス異常の回数						*/
+	double dLatencySum;			/*!< 指令を受け取ってから送信完了までの合計 [s]	*/
+	double dLatencyMax;			/*!< 指令を受け取ってから送信完了までの最大 [s]	*/
+};
+
+/*!
+ * １本のJaco2アームの速度指令と状態の取得を行うスレッド
+ * @details RTCのスレッドはPostCommandで速度指令を渡し、ReadTelemetryで最新の
+ *          状態を読み出すのみで、KinovaAPIは呼び出さない。
+ *          アーム毎のスレッドはKinovaBusでKinovaAPIを共有し、APIの呼び出し
+ *          毎にロックするため、他のアームの状態の取得中でも速度指令は
+ *          APIの呼び出し１回分の待ちで送信できる。
+ *          自身の状態の取得中に受け取った指令も、状態の取得のAPIの呼び出しの
+ *          間で送信する。
+ *          デバイスの異常を検出した場合は、同じシリアル番号のデバイスを
+ *          一定周期で再検索し、見つかれば制御を再開する。
+ */
+class Jaco2Arm
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method Jaco2Arm
+	 * @param  Bus    KinovaAPIの排他制御
+	 * @param  iIndex アームの番号(0～)
+	 */
+	Jaco2Arm(KinovaBus &Bus, int iIndex);
+
+	/*!
+	 * デストラクタ
+	 * @method ~Jaco2Arm
+	 */
+	virtual ~Jaco2Arm();
+
+	/*!
+	 * 指と姿勢を初期化し、スレッドを開始する
+	 * @method Start
+	 * @param  stDevice 操作するデバイス
+	 * @param  stConfig スレッドの設定
+	 * @retval true 成功
+	 * @retval false 失敗
+	 */
+	bool Start(const KinovaDevice &stDevice, const JACO2_ARM_CONFIG_t &stConfig);
+
+	/*!
+	 * スレッドを停止する
+	 * @method Stop
+	 * @return なし
+	 */
+	void Stop(void);
+
+	/*!
+	 * スレッドの設定を更新する
+	 * @method SetConfig
+	 * @param  stConfig スレッドの設定
+	 * @return なし
+	 */
+	void SetConfig(const JACO2_ARM_CONFIG_t &stConfig);
+
+	/*!
+	 * 今回の周期の指令を渡す
+	 * @method PostCommand
+	 * @param  stPoint 速度指令
+	 * @param  bHome   初期姿勢に戻すか(trueならば速度指令は無視する)
+	 * @return なし
+	 */
+	void PostCommand(const TrajectoryPoint &stPoint, bool bHome);
+
+	/*!
+	 * 最新の状態を読み出す
+	 * @method ReadTelemetry
+	 * @param  [out] stTelemetry 状態
+	 * @retval true 前回の読み出し以降に取得した状態がある
+	 * @retval false 新しい状態がない
+	 */
+	bool ReadTelemetry(JACO2_TELEMETRY_t &stTelemetry);
+
+	/*!
+	 * デバイスが使用可能か判定する
+	 * @method IsReady
+	 * @retval true 使用可能
+	 * @retval false 再検索中
+	 */
+	bool IsReady(void) const;
+
+	/*!
+	 * 統計情報を取得する
+	 * @method GetStat
+	 * @return 統計情報
+	 */
+	JACO2_ARM_STAT_t GetStat(void);
+
+private:
+	/*!
+	 * スレッドの処理
+	 * @method Run
+	 * @return なし
+	 */
+	void Run(void);
+
+	/*!
+	 * 指令を処理する
+	 * @method ProcessCommand
+	 * @param  stPoint  速度指令
+	 * @param  bHome    初期姿勢に戻すか
+	 * @param  stConfig スレッドの設定
+	 * @param  [out] bSent 送信したか
+	 * @retval true 成功(送信不要の場合を含む)
+	 * @retval false デバイス異常
+	 */
+	bool ProcessCommand(const TrajectoryPoint &stPoint, bool bHome, const JACO2_ARM_CONFIG_t &stConfig, bool &bSent);
+
+	/*!
+	 * 未処理の指令があれば取り出して処理する
+	 * @method ProcessPostedCommand
+	 * @retval true 成功(未処理の指令がない場合を含む)
+	 * @retval false デバイス異常
+	 * @remark 状態の取得中にも、KinovaAPIの呼び出しの間で呼び出す
+	 */
+	bool ProcessPostedCommand(void);
+
+	/*!
+	 * 速度指令を送信するか判定する
+	 * @method IsCommandRequired
+	 * @param  stPoint  速度指令
+	 * @param  stConfig スレッドの設定
+	 * @retval true 前回から変化した、または再送周期が経過した
+	 * @retval false 送信不要
+	 */
+	bool IsCommandRequired(const TrajectoryPoint &stPoint, const JACO2_ARM_CONFIG_t &stConfig);
+
+	/*!
+	 * 状態を取得し、ダブルバッファを入れ替える
+	 * @method AcquireTelemetry
+	 * @retval true 成功
+	 * @retval false デバイス異常
+	 */
+	bool AcquireTelemetry(void);
+
+	/*!
+	 * 同じシリアル番号のデバイスを再検索してカレント設定する
+	 * @method Reconnect
+	 * @retval true 成功
+	 * @retval false 未検出
+	 */
+	bool Reconnect(void);
+
+	KinovaBus &m_Bus;							/*!< KinovaAPIの排他制御				*/
+	int m_iIndex;								/*!< アームの番号						*/
+	KinovaDevice m_stDevice;					/*!< 操作するデバイス					*/
+	std::atomic<bool> m_bReady;					/*!< デバイスが使用可能か				*/
+
+	std::unique_ptr<std::thread> m_spThread;	/*!< アームのスレッド					*/
+	std::mutex m_Mutex;							/*!< 指令及び設定のミューテックス		*/
+	std::condition_variable m_Cond;				/*!< 指令及び終了の通知					*/
+	bool m_bExit;								/*!< スレッドの終了フラグ				*/
+	bool m_bPosted;								/*!< 未処理の指令があるか				*/
+	bool m_bPostedHome;							/*!< 初期姿勢に戻す指令					*/
+	TrajectoryPoint m_stPostedPoint;			/*!< 速度指令							*/
+	std::chrono::steady_clock::time_point m_tpPosted;	/*!< 指令を受け取った時刻		*/
+	JACO2_ARM_CONFIG_t m_stConfig;				/*!< スレッドの設定						*/
+	JACO2_ARM_STAT_t m_stStat;					/*!< 統計情報							*/
+
+	bool m_bCommandSent;						/*!< 速度指令を送信済みか				*/
+	TrajectoryPoint m_stLastCommand;			/*!< 前回送信した速度指令				*/
+	std::chrono::steady_clock::time_point m_tpCommand;	/*!< 前回の速度指令の送信時刻	*/
+
+	std::mutex m_TelemetryMutex;				/*!< ダブルバッファのミューテックス		*/
+	JACO2_TELEMETRY_t m_stTelemetryBuffer[2];	/*!< 状態のダブルバッファ				*/
+	int m_iTelemetryFront;						/*!< 読み出し側のバッファの番号			*/
+	uint64_t m_uTelemetrySeq;					/*!< 取得した状態の通番					*/
+	uint64_t m_uTelemetryReadSeq;				/*!< 最後に読み出した状態の通番			*/
+
+	MetricHistogram m_SendMetric;				/*!< 指令の送信のAPI呼び出し時間 [ns]	*/
+	MetricHistogram m_GetMetric;				/*!< 状態の取得のAPI呼び出し時間 [ns]	*/
+	MetricCounter m_ApiErrorMetric;				/*!< API呼び出しの失敗数				*/
+};
+
+#endif//JACO2_ARM_H
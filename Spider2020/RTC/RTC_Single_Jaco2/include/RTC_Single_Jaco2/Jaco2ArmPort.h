@@ -0,0 +1,185 @@
+// -*- C++ -*-
+/*!
+ * @file Jaco2ArmPort.h
+ * @brief １本のJaco2アームの入出力ポート
+ * @date 2026/10/19
+ */
+
+#ifndef JACO2_ARM_PORT_H
+#define JACO2_ARM_PORT_H
+
+#include <rtm/idl/BasicDataTypeSkel.h>
+#include <rtm/idl/ExtendedDataTypesSkel.h>
+#include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
+
+#include <rtm/DataFlowComponentBase.h>
+#include <rtm/DataInPort.h>
+#include <rtm/DataOutPort.h>
+
+#include "ArmAngularWrapper.h"
+#include "ArmCurrentWrapper.h"
+#include "FingerDeltaWrapper.h"
+#include "FingerStatusWrapper.h"
+#include "LatestReader.h"
+#include "Jaco2Arm.h"
+
+#include <string>
+
+/*!
+ * １本のJaco2アームの入出力ポート
+ * @details ポート名はアーム毎の接頭辞にRTC.xmlのポート名を続けたものとする。
+ *          １本目のアームは接頭辞なし(従来と同じポート名)、２本目以降は
+ *          "Arm2"のようにアームの番号を付ける。
+ */
+class Jaco2ArmPort
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method Jaco2ArmPort
+	 * @param  sPrefix ポート名の接頭辞
+	 */
+	Jaco2ArmPort(const std::string &sPrefix);
+
+	/*!
+	 * デストラクタ
+	 * @method ~Jaco2ArmPort
+	 */
+	virtual ~Jaco2ArmPort();
+
+	/*!
+	 * ポートをRTCに登録する
+	 * @method Register
+	 * @param  Rtc 登録先のRTC
+	 * @return なし
+	 */
+	void Register(RTC::RTObject_impl &Rtc);
+
+	/*!
+	 * 入出力データを初期化する
+	 * @method InitData
+	 * @return なし
+	 */
+	void InitData(void);
+
+	/*!
+	 * 入力ポートから指令を読み込む
+	 * @method Read
+	 * @param  dFailSafeSec フェイルセーフ時間 [s]
+	 * @return なし
+	 */
+	void Read(double dFailSafeSec);
+
+	/*!
+	 * 初期姿勢遷移指令があるか判定する
+	 * @method IsHomeRequested
+	 * @retval true 初期姿勢に戻す
+	 * @retval false 速度指令で制御する
+	 */
+	bool IsHomeRequested(void) const;
+
+	/*!
+	 * 入力した変位速度から速度指令を作成する
+	 * @method GetCommand
+	 * @param  [out] stPoint 速度指令
+	 * @return なし
+	 */
+	void GetCommand(TrajectoryPoint &stPoint);
+
+	/*!
+	 * Jaco2アームの状態を出力ポートに書き込む
+	 * @method Write
+	 * @param  stTelemetry Jaco2アームの状態
+	 * @return なし
+	 */
+	void Write(const JACO2_TELEMETRY_t &stTelemetry);
+
+private:
+	/*!
+	 * 手先位置姿勢の変位速度をポートから読み込む
+	 * @method ReadPoseDelta
+	 * @param  dFailSafeSec フェイルセーフ時間 [s]
+	 * @return なし
+	 */
+	void ReadPoseDelta(double dFailSafeSec);
+
+	/*!
+	 * 指の開閉具合の変位速度をポートから読み込む
+	 * @method ReadFingerDelta
+	 * @param  dFailSafeSec フェイルセーフ時間 [s]
+	 * @return なし
+	 */
+	void ReadFingerDelta(double dFailSafeSec);
+
+	/*!
+	 * 初期姿勢遷移指令をポートから読み込む
+	 * @method ReadHome
+	 * @return なし
+	 */
+	void ReadHome(void);
+
+	/*!
+	 * 手先位置姿勢をポートに出力する
+	 * @method WritePose3D
+	 * @param  stTelemetry Jaco2アームの状態
+	 * @return なし
+	 */
+	void WritePose3D(const JACO2_TELEMETRY_t &stTelemetry);
+
+	/*!
+	 * 腕の角度をポートに出力する
+	 * @method WriteAngular
+	 * @param  stTelemetry Jaco2アームの状態
+	 * @return なし
+	 */
+	void WriteAngular(const JACO2_TELEMETRY_t &stTelemetry);
+
+	/*!
+	 * 指の開閉具合をポートに出力する
+	 * @method WriteFinger
+	 * @param  stTelemetry Jaco2アームの状態
+	 * @return なし
+	 */
+	void WriteFinger(const JACO2_TELEMETRY_t &stTelemetry);
+
+	/*!
+	 * モータ負荷をポートに出力する
+	 * @method WriteCurrent
+	 * @param  stTelemetry Jaco2アームの状態
+	 * @return なし
+	 */
+	void WriteCurrent(const JACO2_TELEMETRY_t &stTelemetry);
+
+	std::string m_sPrefix;							/*!< ポート名の接頭辞						*/
+
+	RTC::TimedPose3D m_PoseDelta_In;				/*!< 手先位置姿勢の変位速度 [m,rad]			*/
+	RTC::InPort<RTC::TimedPose3D> m_PoseDelta_InIn;
+	Spider2020::TimedFinger m_FingerDelta_In;		/*!< 指の開閉具合の変位速度 [u]				*/
+	RTC::InPort<Spider2020::TimedFinger> m_FingerDelta_InIn;
+	RTC::TimedLong m_Home_In;						/*!< 初期姿勢遷移指令						*/
+	RTC::InPort<RTC::TimedLong> m_Home_InIn;
+
+	RTC::TimedPose3D m_Pose3D_Out;					/*!< 手先位置姿勢 [m,rad]					*/
+	RTC::OutPort<RTC::TimedPose3D> m_Pose3D_OutOut;
+	Spider2020::TimedArmAngular m_Angular_Out;		/*!< 腕の角度 [rad]							*/
+	RTC::OutPort<Spider2020::TimedArmAngular> m_Angular_OutOut;
+	Spider2020::TimedFinger m_Finger_Out;			/*!< 指の開閉具合 [u]						*/
+	RTC::OutPort<Spider2020::TimedFinger> m_Finger_OutOut;
+	Spider2020::TimedArmCurrent m_Current_Out;		/*!< モータ負荷 [A]							*/
+	RTC::OutPort<Spider2020::TimedArmCurrent> m_Current_OutOut;
+
+	FingerDeltaWrapper m_FingerDelta_InWrap;		/*!< m_FingerDelta_Inのラッパークラス		*/
+	ArmAngularWrapper m_Angular_OutWrap;			/*!< m_Angular_Outのラッパークラス			*/
+	ArmCurrentWrapper m_Current_OutWrap;			/*!< m_Current_Outのラッパークラス			*/
+	FingerStatusWrapper m_Finger_OutWrap;			/*!< m_Finger_Outのラッパークラス			*/
+
+	LatestReader<RTC::TimedPose3D> m_PoseDelta_InReader;			/*!< m_PoseDelta_InInの最新データの読み込み		*/
+	LatestReader<Spider2020::TimedFinger> m_FingerDelta_InReader;	/*!< m_FingerDelta_InInの最新データの読み込み	*/
+	LatestReader<RTC::TimedLong> m_Home_InReader;					/*!< m_Home_InInの最新データの読み込み			*/
+
+	struct timeval m_stPoseDeltaReadTime;			/*!< m_PoseDelta_Inの入力時刻				*/
+	struct timeval m_stFingerDeltaReadTime;			/*!< m_FingerDelta_Inの入力時刻				*/
+};
+
+#endif//JACO2_ARM_PORT_H
@@ -0,0 +1,115 @@
+// -*- C++ -*-
+/*!
+ * @file KinovaApi.h
+ * @brief KinovaAPIの呼び出しを抽象化するインタフェース
+ * @date 2026/10/19
+ */
+
+#ifndef KINOVA_API_H
+#define KINOVA_API_H
+
+#include </opt/JACO2_SDK/API/KinovaTypes.h>
+
+/*!
+ * KinovaAPIの呼び出しを抽象化するインタフェース
+ * @details 実機用のUSBコマンドレイヤ(KinovaUsbApi)と、実機なしで動作確認及び
+ *          性能計測を行うためのシミュレータ(KinovaSimApi)を切り替えて使用する。
+ *          各メソッドの引数と戻り値はKinovaAPIの同名の関数と同じとする。
+ */
+class KinovaApi
+{
+public:
+	/*!
+	 * デストラクタ
+	 * @method ~KinovaApi
+	 */
+	virtual ~KinovaApi() {}
+
+	/*!
+	 * APIを読み込む
+	 * @method Load
+	 * @retval true 成功
+	 * @retval false 失敗
+	 */
+	virtual bool Load(void) = 0;
+
+	/*!
+	 * APIを初期化する
+	 * @method InitAPI
+	 * @return KinovaAPIの戻り値
+	 */
+	virtual int InitAPI(void) = 0;
+
+	/*!
+	 * 接続しているJaco2アームの一覧を取得する
+	 * @method GetDevices
+	 * @param  [out] devices デバイスの一覧
+	 * @param  [out] result  KinovaAPIの戻り値
+	 * @return デバイス数
+	 */
+	virtual int GetDevices(KinovaDevice devices[MAX_KINOVA_DEVICE], int &result) = 0;
+
+	/*!
+	 * 以降のAPIで操作するJaco2アームを設定する
+	 * @method SetActiveDevice
+	 * @param  device デバイス
+	 * @return KinovaAPIの戻り値
+	 */
+	virtual int SetActiveDevice(KinovaDevice device) = 0;
+
+	/*!
+	 * ホームポジションに移動する
+	 * @method MoveHome
+	 * @return KinovaAPIの戻り値
+	 */
+	virtual int MoveHome(void) = 0;
+
+	/*!
+	 * 指を初期化する
+	 * @method InitFingers
+	 * @return KinovaAPIの戻り値
+	 */
+	virtual int InitFingers(void) = 0;
+
+	/*!
+	 * 軌道点(速度指令)を送信する
+	 * @method SendBasicTrajectory
+	 * @param  command 軌道点
+	 * @return KinovaAPIの戻り値
+	 */
+	virtual int SendBasicTrajectory(TrajectoryPoint command) = 0;
+
+	/*!
+	 * 手先位置姿勢を取得する
+	 * @method GetCartesianPosition
+	 * @param  [out] Response 手先位置姿勢及び指の位置
+	 * @return KinovaAPIの戻り値
+	 */
+	virtual int GetCartesianPosition(CartesianPosition &Response) = 0;
+
+	/*!
+	 * 全てのアクチュエータの角度を取得する
+	 * @method GetAngularPosition
+	 * @param  [out] Response アクチュエータ及び指の角度
+	 * @return KinovaAPIの戻り値
+	 */
+	virtual int GetAngularPosition(AngularPosition &Response) = 0;
+
+	/*!
+	 * 全てのアクチュエータの負荷を取得する
+	 * @method GetAngularCurrent
+	 * @param  [out] Response アクチュエータ及び指の電流
+	 * @return KinovaAPIの戻り値
+	 */
+	virtual int GetAngularCurrent(AngularPosition &Response) = 0;
+
+	/*!
+	 * ロボットアームの汎用情報を取得する
+	 * @method GetGeneralInformations
+	 * @param  [out] Response 汎用情報
+	 * @return KinovaAPIの戻り値
+	 */
+	virtual int GetGeneralInformations(GeneralInformations &Response) = 0;
+};
+
+#endif//KINOVA_API_H
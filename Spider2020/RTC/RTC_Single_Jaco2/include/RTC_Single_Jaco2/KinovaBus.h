@@ -0,0 +1,119 @@
+// -*- C++ -*-
+/*!
+ * @file KinovaBus.h
+ * @brief 複数のJaco2アームでKinovaAPIを共有するための排他制御
+ * @date 2026/10/19
+ */
+
+#ifndef KINOVA_BUS_H
+#define KINOVA_BUS_H
+
+#include "KinovaApi.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+/*!
+ * 複数のJaco2アームでKinovaAPIを共有するための排他制御
+ * @details KinovaAPIはカレント設定したデバイスに対して操作するため、
+ *          アーム毎のスレッドはミューテックスをロックしてからSelectで自分の
+ *          デバイスをカレント設定し、続けてAPIを呼び出す。
+ *          カレント設定は既に同じデバイスならば省略する。
+ *          速度指令の送信はLockCommand、状態の取得はLockTelemetryでロックし、
+ *          送信待ちの速度指令があれば状態の取得より先にロックを渡す。
+ */
+class KinovaBus
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method KinovaBus
+	 * @param  Api KinovaAPI
+	 */
+	KinovaBus(KinovaApi &Api);
+
+	/*!
+	 * デストラクタ
+	 * @method ~KinovaBus
+	 */
+	virtual ~KinovaBus();
+
+	/*!
+	 * KinovaAPI呼び出しのミューテックスを取得する
+	 * @method GetMutex
+	 * @return ミューテックス
+	 */
+	std::mutex &GetMutex(void);
+
+	/*!
+	 * KinovaAPIを取得する(GetMutexのロック中のみ呼び出すこと)
+	 * @method GetApi
+	 * @return KinovaAPI
+	 */
+	KinovaApi &GetApi(void);
+
+	/*!
+	 * 速度指令の送信のためにロックする
+	 * @method LockCommand
+	 * @param  lock GetMutexのロック(未ロック)
+	 * @return なし
+	 * @remark ロックするまでの間、LockTelemetryの呼び出し元を待たせる
+	 */
+	void LockCommand(std::unique_lock<std::mutex> &lock);
+
+	/*!
+	 * 状態の取得のためにロックする
+	 * @method LockTelemetry
+	 * @param  lock GetMutexのロック(未ロック)
+	 * @return なし
+	 * @remark 送信待ちの速度指令があれば、全て送信するまで待つ
+	 */
+	void LockTelemetry(std::unique_lock<std::mutex> &lock);
+
+	/*!
+	 * デバイスをカレント設定する(GetMutexのロック中のみ呼び出すこと)
+	 * @method Select
+	 * @param  stDevice デバイス
+	 * @retval true 成功
+	 * @retval false 失敗
+	 */
+	bool Select(const KinovaDevice &stDevice);
+
+	/*!
+	 * デバイスの一覧を取得する(GetMutexのロック中のみ呼び出すこと)
+	 * @method Enumerate
+	 * @param  [out] list デバイスの一覧
+	 * @return デバイス数
+	 */
+	int Enumerate(KinovaDevice list[MAX_KINOVA_DEVICE]);
+
+	/*!
+	 * カレント設定を切り替えた回数を取得する
+	 * @method GetSwitchCount
+	 * @return 切り替えた回数
+	 */
+	uint64_t GetSwitchCount(void);
+
+	/*!
+	 * ２つのデバイスが同じか判定する
+	 * @method IsSameDevice
+	 * @param  stDevice1 デバイス
+	 * @param  stDevice2 デバイス
+	 * @retval true 同じ(シリアル番号が一致)
+	 * @retval false 異なる
+	 */
+	static bool IsSameDevice(const KinovaDevice &stDevice1, const KinovaDevice &stDevice2);
+
+private:
+	KinovaApi &m_Api;				/*!< KinovaAPI							*/
+	std::mutex m_Mutex;				/*!< KinovaAPI呼び出しのミューテックス	*/
+	bool m_bSelected;				/*!< カレント設定済みか					*/
+	KinovaDevice m_stSelected;		/*!< カレント設定したデバイス			*/
+	uint64_t m_uSwitchCount;		/*!< カレント設定を切り替えた回数		*/
+	std::atomic<int> m_iCommandWaiting;			/*!< ロック待ちの速度指令の数			*/
+	std::condition_variable m_CommandCond;		/*!< 速度指令のロック待ちの解消の通知	*/
+};
+
+#endif//KINOVA_BUS_H
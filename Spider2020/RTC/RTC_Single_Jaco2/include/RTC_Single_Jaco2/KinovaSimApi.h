@@ -0,0 +1,110 @@
+// -*- C++ -*-
+/*!
+ * @file KinovaSimApi.h
+ * @brief 実機なしで動作するJaco2アームのシミュレータ
+ * @date 2026/10/19
+ */
+
+#ifndef KINOVA_SIM_API_H
+#define KINOVA_SIM_API_H
+
+#include "KinovaApi.h"
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+/*!
+ * シミュレータの設定
+ */
+struct KINOVA_SIM_CONFIG_t
+{
+	int iDeviceNum;				/*!< 模擬するJaco2アームの数						*/
+	double dLatency;			/*!< APIの呼び出し毎の処理時間 [s]					*/
+	double dCommandTimeout;		/*!< 速度指令が途絶えてから停止するまでの時間 [s]	*/
+};
+
+/*!
+ * 実機なしで動作するJaco2アームのシミュレータ
+ * @details 速度指令を積分して手先位置姿勢及び指の位置を更新し、簡易的な
+ *          2リンクの逆運動学でアクチュエータの角度を、速度に比例する値で
+ *          負荷を模擬する(Jaco2の実際のリンク構成とは一致しない)。
+ *          実機のUSB通信と同様に、APIの呼び出しは１本ずつ順に処理し、
+ *          呼び出し毎に設定した処理時間だけ待機する。
+ */
+class KinovaSimApi : public KinovaApi
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method KinovaSimApi
+	 * @param  stConfig シミュレータの設定
+	 */
+	KinovaSimApi(const KINOVA_SIM_CONFIG_t &stConfig);
+
+	/*!
+	 * デストラクタ
+	 * @method ~KinovaSimApi
+	 */
+	virtual ~KinovaSimApi();
+
+	// KinovaApiの実装(説明はKinovaApiを参照)
+	virtual bool Load(void);
+	virtual int InitAPI(void);
+	virtual int GetDevices(KinovaDevice devices[MAX_KINOVA_DEVICE], int &result);
+	virtual int SetActiveDevice(KinovaDevice device);
+	virtual int MoveHome(void);
+	virtual int InitFingers(void);
+	virtual int SendBasicTrajectory(TrajectoryPoint command);
+	virtual int GetCartesianPosition(CartesianPosition &Response);
+	virtual int GetAngularPosition(AngularPosition &Response);
+	virtual int GetAngularCurrent(AngularPosition &Response);
+	virtual int GetGeneralInformations(GeneralInformations &Response);
+
+private:
+	/*!
+	 * 模擬するJaco2アームの状態
+	 */
+	struct SIM_ARM_t
+	{
+		CartesianInfo stPose;			/*!< 手先位置姿勢 [m,rad]			*/
+		FingersPosition stFingers;		/*!< 指の位置						*/
+		CartesianInfo stVelocity;		/*!< 手先位置姿勢の速度指令			*/
+		FingersPosition stFingerVelocity;	/*!< 指の速度指令				*/
+		std::chrono::steady_clock::time_point tpCommand;	/*!< 速度指令の受信時刻	*/
+		std::chrono::steady_clock::time_point tpUpdate;		/*!< 状態の更新時刻		*/
+	};
+
+	/*!
+	 * API呼び出しの処理時間だけ待機し、カレントのアームの状態を現在時刻まで進める
+	 * @method Process
+	 * @return カレントのアーム(未設定ならNULL)
+	 */
+	SIM_ARM_t *Process(void);
+
+	/*!
+	 * アームをホームポジションに設定する
+	 * @method SetHome
+	 * @param  stArm アームの状態
+	 * @return なし
+	 */
+	static void SetHome(SIM_ARM_t &stArm);
+
+	/*!
+	 * 速度指令が有効か判定する
+	 * @method IsMoving
+	 * @param  stArm アームの状態
+	 * @param  tpNow 現在時刻
+	 * @retval true 速度指令が有効
+	 * @retval false 速度指令が途絶えて停止中
+	 */
+	bool IsMoving(const SIM_ARM_t &stArm, std::chrono::steady_clock::time_point tpNow) const;
+
+	KINOVA_SIM_CONFIG_t m_stConfig;		/*!< シミュレータの設定				*/
+	std::mutex m_Mutex;					/*!< API呼び出しのミューテックス	*/
+	std::vector<SIM_ARM_t> m_vecArm;	/*!< 模擬するアームの状態			*/
+	int m_iActive;						/*!< カレントのアームの番号			*/
+	std::chrono::steady_clock::time_point m_tpStart;	/*!< 初期化時刻		*/
+};
+
+#endif//KINOVA_SIM_API_H
@@ -0,0 +1,60 @@
+// -*- C++ -*-
+/*!
+ * @file KinovaUsbApi.h
+ * @brief USBコマンドレイヤを動的に読み込んで呼び出すKinovaAPI
+ * @date 2026/10/19
+ */
+
+#ifndef KINOVA_USB_API_H
+#define KINOVA_USB_API_H
+
+#include "KinovaApi.h"
+
+/*!
+ * USBコマンドレイヤを動的に読み込んで呼び出すKinovaAPI
+ * @details Kinova.API.USBCommandLayerUbuntu.soをdlopenし、使用する関数の
+ *          アドレスを取得して呼び出す。
+ */
+class KinovaUsbApi : public KinovaApi
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method KinovaUsbApi
+	 */
+	KinovaUsbApi();
+
+	/*!
+	 * デストラクタ
+	 * @method ~KinovaUsbApi
+	 */
+	virtual ~KinovaUsbApi();
+
+	// KinovaApiの実装(説明はKinovaApiを参照)
+	virtual bool Load(void);
+	virtual int InitAPI(void);
+	virtual int GetDevices(KinovaDevice devices[MAX_KINOVA_DEVICE], int &result);
+	virtual int SetActiveDevice(KinovaDevice device);
+	virtual int MoveHome(void);
+	virtual int InitFingers(void);
+	virtual int SendBasicTrajectory(TrajectoryPoint command);
+	virtual int GetCartesianPosition(CartesianPosition &Response);
+	virtual int GetAngularPosition(AngularPosition &Response);
+	virtual int GetAngularCurrent(AngularPosition &Response);
+	virtual int GetGeneralInformations(GeneralInformations &Response);
+
+private:
+	void *m_pHandle;											/*!< コマンドレイヤのハンドル		*/
+	int (*m_pInitAPI)();										/*!< 初期化API						*/
+	int (*m_pGetDevices)(KinovaDevice devices[MAX_KINOVA_DEVICE], int &result);	/*!< デバイス一覧取得API	*/
+	int (*m_pSetActiveDevice)(KinovaDevice device);				/*!< カレントデバイス設定API		*/
+	int (*m_pMoveHome)();										/*!< ホームポジション移動API		*/
+	int (*m_pInitFingers)();									/*!< 指の初期化API					*/
+	int (*m_pSendBasicTrajectory)(TrajectoryPoint command);		/*!< 手先位置姿勢設定API			*/
+	int (*m_pGetCartesianPosition)(CartesianPosition &);		/*!< 手先位置姿勢取得API			*/
+	int (*m_pGetAngularPosition)(AngularPosition &);			/*!< アクチュエータの角度取得API	*/
+	int (*m_pGetAngularCurrent)(AngularPosition &);				/*!< アクチュエータの負荷取得API	*/
+	int (*m_pGetGeneralInformations)(GeneralInformations &);	/*!< 汎用情報取得API				*/
+};
+
+#endif//KINOVA_USB_API_H
@@ -13,6 +13,7 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 // Service implementation headers
 // <rtc-template block="service_impl_h">
@@ -23,6 +24,7 @@
 // <rtc-template block="consumer_stub_h">
 #include "ExtendedDataTypesStub.h"
 #include "BasicDataTypeStub.h"
+#include "Spider2020Stub.h"
 
 // </rtc-template>
 
@@ -32,10 +34,13 @@
 #include <rtm/DataInPort.h>
 #include <rtm/DataOutPort.h>
 
-#include "ArmAngularWrapper.h"
-#include "ArmCurrentWrapper.h"
-#include "FingerDeltaWrapper.h"
-#include "FingerStatusWrapper.h"
+#include "Jaco2Arm.h"
+#include "Jaco2ArmPort.h"
+#include "KinovaApi.h"
+#include "KinovaBus.h"
+
+#include <memory>
+#include <vector>
 
 /*!
  * @class RTC_Single_Jaco2
@@ -131,7 +136,7 @@ public:
 	 *
 	 *
 	 */
-	// virtual RTC::ReturnCode_t onDeactivated(RTC::UniqueId ec_id);
+	virtual RTC::ReturnCode_t onDeactivated(RTC::UniqueId ec_id);
 
 	/***
 	 *
@@ -206,53 +211,11 @@ public:
 	// virtual RTC::ReturnCode_t onRateChanged(RTC::UniqueId ec_id);
 
 	/*!
-	 * 手先位置姿勢の変位速度をポートから読み込む
-	 * @method ReadPoseDelta
-	 * @return なし
-	 */
-	void ReadPoseDelta(void);
-
-	/*!
-	 * 指の開閉具合の変位速度をポートから読み込む
-	 * @method ReadFingerDelta
-	 * @return なし
-	 */
-	void ReadFingerDelta(void);
-
-	/*!
-	 * 初期姿勢遷移指令をポートから読み込む
-	 * @method ReadHome
-	 * @return なし
-	 */
-	void ReadHome(void);
-
-	/*!
-	 * 手先位置姿勢をポートに出力する
-	 * @method WritePose3D
-	 * @return なし
-	 */
-	void WritePose3D(void);
-
-	/*!
-	 * 腕の角度をポートに出力する
-	 * @method WriteAngular
-	 * @return なし
+	 * アーム毎のスレッドの設定を作成する
+	 * @method GetArmConfig
+	 * @return スレッドの設定
 	 */
-	void WriteAngular(void);
-
-	/*!
-	 * 指の開閉具合をポートに出力する
-	 * @method WriteFinger
-	 * @return なし
-	 */
-	void WriteFinger(void);
-
-	/*!
-	 * モータ負荷をポートに出力する
-	 * @method WriteCurrent
-	 * @return なし
-	 */
-	void WriteCurrent(void);
+	JACO2_ARM_CONFIG_t GetArmConfig(void);
 
 protected:
 	// <rtc-template block="protected_attribute">
@@ -272,102 +235,79 @@ protected:
 	 * - DefaultValue: 1.0
 	 */
 	double m_FAILSAFE_SEC;
+	/*!
+	 * 制御するJaco2アームの本数
+	 * ※２本目以降のポート名は先頭にArm2などのアームの番号を付ける。
+	 * 起動時のみ反映する。
+	 * - Name: Jaco2アームの本数 ARM_NUM
+	 * - DefaultValue: 1
+	 */
+	long m_ARM_NUM;
 	/*!
 	 * Jaco2アームの情報を出力する周期
-	 * ※Jaco2アームから情報を取得するのに数十msかかるため、周期を短
-	 * くするとアーム制御が不安定になる。
+	 * ※情報の取得はTELEMETRY_SECの周期で別スレッドが行い、出力時は
+	 * 最新の取得値を出力する。
 	 * - Name: OutPort出力周期 OUT_SEC
 	 * - DefaultValue: 0.2
 	 * - Unit: [s]
 	 */
 	double m_OUT_SEC;
-
-	// </rtc-template>
-
-	// DataInPort declaration
-	// <rtc-template block="inport_declare">
-	RTC::TimedPose3D m_PoseDelta_In;
 	/*!
-	 * 手先位置姿勢の変位速度
-	 * - Type: TimedPose3D
-	 * - Number: 1
-	 * - Unit: [m,rad]
+	 * Jaco2アームの状態を取得する周期
+	 * ※Jaco2アームから情報を取得するのに数十msかかるが、速度指令と
+	 * は別スレッドで取得するため、指令の周期には影響しない。
+	 * OUT_SECより短くしても出力されない状態を取得するだけのため、
+	 * OUT_SEC未満の値はOUT_SECとして扱う。
+	 * - Name: 状態の取得周期 TELEMETRY_SEC
+	 * - DefaultValue: 0.2
+	 * - Unit: [s]
+	 */
+	double m_TELEMETRY_SEC;
+	/*!
+	 * 前回送信した速度指令からの変化がこの値以下ならば、速度指令を送
+	 * 信しない。
+	 * - Name: 速度指令の不感帯 CMD_EPSILON
+	 * - DefaultValue: 0.0001
+	 */
+	double m_CMD_EPSILON;
+	/*!
+	 * 速度指令が変化しなくても、前回の送信からこの時間が経過すれば同
+	 * じ速度指令を再送する。
+	 * ※Jaco2アームは速度指令が途絶えると停止するため、停止までの時
+	 * 間より短くすること。0を設定すれば従来どおり毎周期送信する。
+	 * - Name: 速度指令の再送周期 KEEPALIVE_SEC
+	 * - DefaultValue: 0.05
+	 * - Unit: [s]
 	 */
-	RTC::InPort<RTC::TimedPose3D> m_PoseDelta_InIn;
-	RTC::TimedLongSeq m_FingerDelta_In;
+	double m_KEEPALIVE_SEC;
 	/*!
-	 * 指の開閉具合の変位速度
-	 * - Type: TimedLongSeq
-	 * - Number: 3
-	 * - Semantics: [0]: 親指
-	 *              [1]: 差指
-	 *              [2]: 中指
-	 * - Unit: [u]
+	 * KinovaAPIの呼び出し先
+	 * usb: 実機(USBコマンドレイヤ)
+	 * sim: シミュレータ
+	 * - Name: KinovaAPIの種類 API_BACKEND
+	 * - DefaultValue: usb
 	 */
-	RTC::InPort<RTC::TimedLongSeq> m_FingerDelta_InIn;
-	RTC::TimedLong m_Home_In;
+	std::string m_API_BACKEND;
 	/*!
-	 * 初期姿勢遷移指令
-	 * - Type: TimedLong
-	 * - Number: 1
+	 * API_BACKENDがsimの場合の、KinovaAPIの呼び出し毎の処理時間
+	 * - Name: シミュレータの処理時間 SIM_LATENCY
+	 * - DefaultValue: 0.002
+	 * - Unit: [s]
 	 */
-	RTC::InPort<RTC::TimedLong> m_Home_InIn;
+	double m_SIM_LATENCY;
+
+	// </rtc-template>
+
+	// DataInPort declaration
+	// <rtc-template block="inport_declare">
+	// アーム毎の入力ポートはJaco2ArmPortで宣言する
 
 	// </rtc-template>
 
 
 	// DataOutPort declaration
 	// <rtc-template block="outport_declare">
-	RTC::TimedPose3D m_Pose3D_Out;
-	/*!
-	 * 手先位置姿勢
-	 * (ロボット座標系)
-	 * - Type: TimedPose3D
-	 * - Number: 1
-	 * - Unit: [m,rad]
-	 */
-	RTC::OutPort<RTC::TimedPose3D> m_Pose3D_OutOut;
-	RTC::TimedDoubleSeq m_Angular_Out;
-	/*!
-	 * 腕の角度
-	 * - Type: TimedDoubleSeq
-	 * - Number: 6
-	 * - Semantics: [0]: 腕の1軸目
-	 *              [1]: 腕の2軸目
-	 *              [2]: 腕の3軸目
-	 *              [3]: 腕の4軸目
-	 *              [4]: 腕の5軸目
-	 *              [5]: 腕の6軸目
-	 */
-	RTC::OutPort<RTC::TimedDoubleSeq> m_Angular_OutOut;
-	RTC::TimedLongSeq m_Finger_Out;
-	/*!
-	 * 指の開閉具合
-	 * - Type: TimedLongSeq
-	 * - Number: 3
-	 * - Semantics: [0]: 親指
-	 *              [1]: 差指
-	 *              [2]: 中指
-	 * - Unit: [u]
-	 */
-	RTC::OutPort<RTC::TimedLongSeq> m_Finger_OutOut;
-	RTC::TimedDoubleSeq m_Current_Out;
-	/*!
-	 * モータ負荷
-	 * - Type: TimedDoubleSeq
-	 * - Number: 9
-	 * - Semantics: [0]: 腕の1軸目
-	 *              [1]: 腕の2軸目
-	 *              [2]: 腕の3軸目
-	 *              [3]: 腕の4軸目
-	 *              [4]: 腕の5軸目
-	 *              [5]: 腕の6軸目
-	 *              [6]: 親指
-	 *              [7]: 差指
-	 *              [8]: 中指
-	 * - Unit: [A]
-	 */
-	RTC::OutPort<RTC::TimedDoubleSeq> m_Current_OutOut;
+	// アーム毎の出力ポートはJaco2ArmPortで宣言する
 
 	// </rtc-template>
 
@@ -395,16 +335,15 @@ private:
 
 	// </rtc-template>
 
-	FingerDeltaWrapper m_FingerDelta_InWrap;	/*!< m_FingerDelta_Inのラッパークラス	*/
+	std::vector<std::unique_ptr<Jaco2ArmPort>> m_vecPort;	/*!< アーム毎の入出力ポート	*/
 
-	ArmAngularWrapper m_Angular_OutWrap;		/*!< m_Angular_Outのラッパークラス		*/
-	ArmCurrentWrapper m_Current_OutWrap;		/*!< m_Current_Outのラッパークラス		*/
-	FingerStatusWrapper m_Finger_OutWrap;		/*!< m_Finger_Outのラッパークラス		*/
+	struct timeval m_stInfoWriteTime;			/*!< 情報の出力時刻						*/
 
-	struct timeval m_stPoseDeltaReadTime;		/*!< m_PoseDelta_Inの入力時刻			*/
-	struct timeval m_stFingerDeltaReadTime;		/*!< m_FingerDelta_Inの入力時刻			*/
+	std::unique_ptr<KinovaApi> m_spApi;			/*!< KinovaAPIの呼び出し先				*/
+	std::unique_ptr<KinovaBus> m_spBus;			/*!< KinovaAPIの排他制御				*/
+	std::vector<std::unique_ptr<Jaco2Arm>> m_vecArm;	/*!< アーム毎のスレッド			*/
 
-	struct timeval m_stInfoWriteTime;			/*!< 情報の出力時刻						*/
+	JACO2_TELEMETRY_t m_stTelemetry;			/*!< 出力するJaco2アームの状態			*/
 
 };
 
@@ -0,0 +1,439 @@
+#include "Jaco2Arm.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#define ENUM_RETRY_SEC	(1.0)		/*!< デバイス未検出時の再検索の間隔 [s]	*/
+
+Jaco2Arm::Jaco2Arm(KinovaBus &Bus, int iIndex)
+	: m_Bus(Bus)
+	, m_iIndex(iIndex)
+	, m_stDevice()
+	, m_bReady(false)
+	, m_bExit(false)
+	, m_bPosted(false)
+	, m_bPostedHome(false)
+	, m_stPostedPoint()
+	, m_stConfig()
+	, m_stStat()
+	, m_bCommandSent(false)
+	, m_stLastCommand()
+	, m_stTelemetryBuffer()
+	, m_iTelemetryFront(0)
+	, m_uTelemetrySeq(0)
+	, m_uTelemetryReadSeq(0)
+{
+}
+
+Jaco2Arm::~Jaco2Arm()
+{
+	Stop();
+}
+
+bool Jaco2Arm::Start(const KinovaDevice &stDevice, const JACO2_ARM_CONFIG_t &stConfig)
+{
+	char szName[METRICS_NAME_LEN];
+
+	// 多重起動を防止する
+	if(m_spThread != nullptr)
+	{
+		return true;
+	}
+
+	// 性能指標を登録する(登録済みならば同じ指標を使用する)
+	snprintf(szName, sizeof(szName), "jaco2.arm%d.send", m_iIndex + 1);
+	m_SendMetric.Register(szName);
+	snprintf(szName, sizeof(szName), "jaco2.arm%d.get", m_iIndex + 1);
+	m_GetMetric.Register(szName);
+	snprintf(szName, sizeof(szName), "jaco2.arm%d.api_error", m_iIndex + 1);
+	m_ApiErrorMetric.Register(szName);
+
+	// Jaco2アームを初期姿勢に設定する
+	m_stDevice = stDevice;
+	{
+		std::lock_guard<std::mutex> lock(m_Bus.GetMutex());
+		if(!m_Bus.Select(m_stDevice))
+		{
+			printf("arm%d: SetActiveDevice is failed\n", m_iIndex + 1);
+			return false;
+		}
+		m_Bus.GetApi().InitFingers();
+		m_Bus.GetApi().MoveHome();
+	}
+
+	// ダブルバッファを初期化する
+	{
+		std::lock_guard<std::mutex> lock(m_TelemetryMutex);
+		m_uTelemetrySeq = 0;
+		m_uTelemetryReadSeq = 0;
+	}
+
+	// 最初の速度指令は必ず送信する
+	m_bCommandSent = false;
+	m_bReady = true;
+
+	// スレッドを開始する
+	m_bExit = false;
+	m_bPosted = false;
+	m_stConfig = stConfig;
+	m_spThread.reset(new std::thread(&Jaco2Arm::Run, this));
+
+	return true;
+}
+
+void Jaco2Arm::Stop(void)
+{
+	if(m_spThread == nullptr)
+	{
+		return;
+	}
+
+	// スレッドに終了を通知する
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_bExit = true;
+	}
+	m_Cond.notify_all();
+
+	// スレッドの終了を待つ
+	m_spThread->join();
+	m_spThread.reset();
+	m_bReady = false;
+}
+
+void Jaco2Arm::SetConfig(const JACO2_ARM_CONFIG_t &stConfig)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	m_stConfig = stConfig;
+}
+
+void Jaco2Arm::PostCommand(const TrajectoryPoint &stPoint, bool bHome)
+{
+	// 未処理の指令は最新の指令で上書きする
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_stPostedPoint = stPoint;
+		m_bPostedHome = bHome;
+		m_bPosted = true;
+		m_tpPosted = std::chrono::steady_clock::now();
+		m_stStat.uPost++;
+	}
+	m_Cond.notify_one();
+}
+
+bool Jaco2Arm::ReadTelemetry(JACO2_TELEMETRY_t &stTelemetry)
+{
+	std::lock_guard<std::mutex> lock(m_TelemetryMutex);
+
+	// 前回以降に取得した状態がなければ出力しない
+	if(m_uTelemetrySeq == m_uTelemetryReadSeq)
+	{
+		return false;
+	}
+
+	// 読み出し側のバッファをコピーする
+	stTelemetry = m_stTelemetryBuffer[m_iTelemetryFront];
+	m_uTelemetryReadSeq = m_uTelemetrySeq;
+
+	return true;
+}
+
+bool Jaco2Arm::IsReady(void) const
+{
+	return m_bReady;
+}
+
+JACO2_ARM_STAT_t Jaco2Arm::GetStat(void)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return m_stStat;
+}
+
+void Jaco2Arm::Run(void)
+{
+	std::chrono::steady_clock::time_point tpNow, tpTelemetry, tpRetry, tpWait;
+	JACO2_ARM_CONFIG_t stConfig;
+	bool bTelemetry = false;
+	bool bError = false;
+	std::unique_lock<std::mutex> lock(m_Mutex);
+
+	tpTelemetry = std::chrono::steady_clock::now();
+	tpRetry = tpTelemetry;
+	while(!m_bExit)
+	{
+		// 指令を受け取るか、状態の取得(再検索中は再検索)の時刻まで待機する
+		// (再検索中の指令は再検索に成功するまで保持し、指令では起床しない)
+		tpWait = m_bReady ? tpTelemetry : tpRetry;
+		m_Cond.wait_until(lock, tpWait, [this]{ return m_bExit || (m_bReady && m_bPosted); });
+		if(m_bExit)
+		{
+			break;
+		}
+
+		// 設定を取り出す(指令はProcessPostedCommandで取り出す)
+		stConfig = m_stConfig;
+		lock.unlock();
+
+		bTelemetry = false;
+		bError = false;
+
+		tpNow = std::chrono::steady_clock::now();
+		if(!m_bReady)
+		{
+			// 一定周期でデバイスを再検索する
+			if(tpRetry <= tpNow)
+			{
+				tpRetry = tpNow + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(ENUM_RETRY_SEC));
+				if(Reconnect())
+				{
+					printf("arm%d: device is re-enumerated\n", m_iIndex + 1);
+					m_bCommandSent = false;
+					m_bReady = true;
+				}
+			}
+		}
+		else
+		{
+			// 指令を処理する
+			if(!ProcessPostedCommand())
+			{
+				m_bReady = false;
+			}
+
+			// 取得周期が経過していれば状態を取得する(取得中に受け取った指令も処理する)
+			if(m_bReady && (tpTelemetry <= tpNow))
+			{
+				tpTelemetry = tpNow + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(stConfig.dTelemetrySec));
+				bTelemetry = AcquireTelemetry();
+				if(!bTelemetry)
+				{
+					m_bReady = false;
+				}
+			}
+
+			// デバイス異常ならば直ちに再検索する
+			if(!m_bReady)
+			{
+				printf("arm%d: device error\n", m_iIndex + 1);
+				tpRetry = tpNow;
+				bError = true;
+			}
+		}
+
+		// 統計情報を更新する
+		lock.lock();
+		m_stStat.uTelemetry += bTelemetry ? 1 : 0;
+		m_stStat.uError += bError ? 1 : 0;
+	}
+}
+
+bool Jaco2Arm::ProcessCommand(const TrajectoryPoint &stPoint, bool bHome, const JACO2_ARM_CONFIG_t &stConfig, bool &bSent)
+{
+	std::unique_lock<std::mutex> lock(m_Bus.GetMutex(), std::defer_lock);
+	int64_t iStartNs = 0;
+
+	bSent = false;
+
+	// 初期姿勢に戻す場合
+	if(bHome)
+	{
+		// 初期姿勢への移動後は速度指令を必ず送信する
+		m_bCommandSent = false;
+
+		m_Bus.LockCommand(lock);
+		bSent = (m_Bus.Select(m_stDevice) && (m_Bus.GetApi().MoveHome() == NO_ERROR_KINOVA));
+		if(!bSent)
+		{
+			m_ApiErrorMetric.Add();
+		}
+		return bSent;
+	}
+
+	// 前回から変化した場合、または再送周期が経過した場合のみ送信する
+	if(!IsCommandRequired(stPoint, stConfig))
+	{
+		return true;
+	}
+
+	// 手先位置姿勢を設定する(送信に失敗した場合は次の指令で再送する)
+	// (API呼び出し時間はロックの待ち時間を含まない)
+	m_Bus.LockCommand(lock);
+	iStartNs = MetricsRegistry::GetTimeNs();
+	m_bCommandSent = (m_Bus.Select(m_stDevice) && (m_Bus.GetApi().SendBasicTrajectory(stPoint) == NO_ERROR_KINOVA));
+	m_SendMetric.RecordSince(iStartNs);
+	if(!m_bCommandSent)
+	{
+		m_ApiErrorMetric.Add();
+	}
+	bSent = m_bCommandSent;
+
+	return m_bCommandSent;
+}
+
+bool Jaco2Arm::ProcessPostedCommand(void)
+{
+	std::chrono::steady_clock::time_point tpPosted;
+	JACO2_ARM_CONFIG_t stConfig;
+	TrajectoryPoint stPoint;
+	bool bHome = false;
+	bool bSent = false;
+	bool bRet = false;
+	double dLatency = 0.0;
+
+	// 未処理の指令と設定を取り出す
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if(!m_bPosted)
+		{
+			return true;
+		}
+		bHome = m_bPostedHome;
+		stPoint = m_stPostedPoint;
+		tpPosted = m_tpPosted;
+		stConfig = m_stConfig;
+		m_bPosted = false;
+	}
+
+	// 指令を処理する
+	bRet = ProcessCommand(stPoint, bHome, stConfig, bSent);
+
+	// 送信した場合は送信遅延を記録する
+	if(bSent)
+	{
+		dLatency = std::chrono::duration<double>(std::chrono::steady_clock::now() - tpPosted).count();
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_stStat.uSend++;
+		m_stStat.dLatencySum += dLatency;
+		m_stStat.dLatencyMax = std::max(m_stStat.dLatencyMax, dLatency);
+	}
+
+	return bRet;
+}
+
+bool Jaco2Arm::IsCommandRequired(const TrajectoryPoint &stPoint, const JACO2_ARM_CONFIG_t &stConfig)
+{
+	const UserPosition &stNew = stPoint.Position;
+	const UserPosition &stLast = m_stLastCommand.Position;
+	std::chrono::steady_clock::time_point tpNow = std::chrono::steady_clock::now();
+	bool bChanged = false;
+
+	// 手先位置姿勢及び指先の速度が不感帯を超えて変化したか判定する
+	bChanged = (stConfig.dCommandEpsilon < fabs(stNew.CartesianPosition.X - stLast.CartesianPosition.X))
+			|| (stConfig.dCommandEpsilon < fabs(stNew.CartesianPosition.Y - stLast.CartesianPosition.Y))
+			|| (stConfig.dCommandEpsilon < fabs(stNew.CartesianPosition.Z - stLast.CartesianPosition.Z))
+			|| (stConfig.dCommandEpsilon < fabs(stNew.CartesianPosition.ThetaX - stLast.CartesianPosition.ThetaX))
+			|| (stConfig.dCommandEpsilon < fabs(stNew.CartesianPosition.ThetaY - stLast.CartesianPosition.ThetaY))
+			|| (stConfig.dCommandEpsilon < fabs(stNew.CartesianPosition.ThetaZ - stLast.CartesianPosition.ThetaZ))
+			|| (stConfig.dCommandEpsilon < fabs(stNew.Fingers.Finger1 - stLast.Fingers.Finger1))
+			|| (stConfig.dCommandEpsilon < fabs(stNew.Fingers.Finger2 - stLast.Fingers.Finger2))
+			|| (stConfig.dCommandEpsilon < fabs(stNew.Fingers.Finger3 - stLast.Fingers.Finger3));
+
+	// 未送信でなく、変化がなく、再送周期も経過していなければ送信しない
+	if(m_bCommandSent && !bChanged && (std::chrono::duration<double>(tpNow - m_tpCommand).count() < stConfig.dKeepAliveSec))
+	{
+		return false;
+	}
+
+	// 送信する速度指令と時刻を記録する
+	m_stLastCommand = stPoint;
+	m_tpCommand = tpNow;
+
+	return true;
+}
+
+bool Jaco2Arm::AcquireTelemetry(void)
+{
+	JACO2_TELEMETRY_t &stTelemetry = m_stTelemetryBuffer[1 - m_iTelemetryFront];
+	int iResult[3] = {0};
+	int64_t iStartNs = 0;
+
+	// 速度指令を長く待たせないよう、KinovaAPIの呼び出し毎にロックする
+	// 手先位置姿勢を取得する
+	{
+		std::unique_lock<std::mutex> lock(m_Bus.GetMutex(), std::defer_lock);
+		m_Bus.LockTelemetry(lock);
+		if(!m_Bus.Select(m_stDevice))
+		{
+			return false;
+		}
+		iStartNs = MetricsRegistry::GetTimeNs();
+		iResult[0] = m_Bus.GetApi().GetCartesianPosition(stTelemetry.stCartesian);
+		m_GetMetric.RecordSince(iStartNs);
+	}
+
+	// 取得中に受け取った指令を先に送信する
+	if(!ProcessPostedCommand())
+	{
+		return false;
+	}
+
+	// 腕の角度及び指の開閉具合を取得する
+	{
+		std::unique_lock<std::mutex> lock(m_Bus.GetMutex(), std::defer_lock);
+		m_Bus.LockTelemetry(lock);
+		if(!m_Bus.Select(m_stDevice))
+		{
+			return false;
+		}
+		iStartNs = MetricsRegistry::GetTimeNs();
+		iResult[1] = m_Bus.GetApi().GetAngularPosition(stTelemetry.stAngular);
+		m_GetMetric.RecordSince(iStartNs);
+	}
+
+	// 取得中に受け取った指令を先に送信する
+	if(!ProcessPostedCommand())
+	{
+		return false;
+	}
+
+	// モータ負荷を取得する
+	{
+		std::unique_lock<std::mutex> lock(m_Bus.GetMutex(), std::defer_lock);
+		m_Bus.LockTelemetry(lock);
+		if(!m_Bus.Select(m_stDevice))
+		{
+			return false;
+		}
+		iStartNs = MetricsRegistry::GetTimeNs();
+		iResult[2] = m_Bus.GetApi().GetAngularCurrent(stTelemetry.stCurrent);
+		m_GetMetric.RecordSince(iStartNs);
+	}
+
+	if((iResult[0] != NO_ERROR_KINOVA) || (iResult[1] != NO_ERROR_KINOVA) || (iResult[2] != NO_ERROR_KINOVA))
+	{
+		m_ApiErrorMetric.Add();
+		return false;
+	}
+
+	// 取得時刻を設定する
+	gettimeofday(&stTelemetry.stTime, NULL);
+
+	// 読み出し側と書き込み側のバッファを入れ替える(書き込み側の番号はこのスレッドのみが参照する)
+	std::lock_guard<std::mutex> lock(m_TelemetryMutex);
+	m_iTelemetryFront = 1 - m_iTelemetryFront;
+	m_uTelemetrySeq++;
+
+	return true;
+}
+
+bool Jaco2Arm::Reconnect(void)
+{
+	KinovaDevice list[MAX_KINOVA_DEVICE];
+	int iNum = 0;
+
+	std::lock_guard<std::mutex> lock(m_Bus.GetMutex());
+
+	// 同じシリアル番号のデバイスを検索してカレント設定する
+	iNum = m_Bus.Enumerate(list);
+	for(int i = 0; i < iNum; i++)
+	{
+		if(KinovaBus::IsSameDevice(list[i], m_stDevice))
+		{
+			m_stDevice = list[i];
+			return m_Bus.Select(m_stDevice);
+		}
+	}
+
+	return false;
+}
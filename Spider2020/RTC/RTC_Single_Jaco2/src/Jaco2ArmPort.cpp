@@ -0,0 +1,259 @@
+#include "Jaco2ArmPort.h"
+#include <math.h>
+
+#define RAD (M_PI/180)
+
+// timeval構造体の差を計算する(x1-x2)
+#define TIMEVAL_DIFF(x1,x2)	(((double)x1.tv_sec + (double)x1.tv_usec/1000000.0) - ((double)x2.tv_sec + (double)x2.tv_usec/1000000.0))
+
+Jaco2ArmPort::Jaco2ArmPort(const std::string &sPrefix)
+	: m_sPrefix(sPrefix)
+	, m_PoseDelta_InIn((sPrefix + "PoseDelta_In").c_str(), m_PoseDelta_In)
+	, m_FingerDelta_InIn((sPrefix + "FingerDelta_In").c_str(), m_FingerDelta_In)
+	, m_Home_InIn((sPrefix + "Home_In").c_str(), m_Home_In)
+	, m_Pose3D_OutOut((sPrefix + "Pose3D_Out").c_str(), m_Pose3D_Out)
+	, m_Angular_OutOut((sPrefix + "Angular_Out").c_str(), m_Angular_Out)
+	, m_Finger_OutOut((sPrefix + "Finger_Out").c_str(), m_Finger_Out)
+	, m_Current_OutOut((sPrefix + "Current_Out").c_str(), m_Current_Out)
+	, m_FingerDelta_InWrap(m_FingerDelta_In)
+	, m_Angular_OutWrap(m_Angular_Out)
+	, m_Current_OutWrap(m_Current_Out)
+	, m_Finger_OutWrap(m_Finger_Out)
+	, m_PoseDelta_InReader(m_PoseDelta_InIn, m_PoseDelta_In)
+	, m_FingerDelta_InReader(m_FingerDelta_InIn, m_FingerDelta_In)
+	, m_Home_InReader(m_Home_InIn, m_Home_In)
+	, m_stPoseDeltaReadTime({0})
+	, m_stFingerDeltaReadTime({0})
+{
+}
+
+Jaco2ArmPort::~Jaco2ArmPort()
+{
+}
+
+void Jaco2ArmPort::Register(RTC::RTObject_impl &Rtc)
+{
+	// Set InPort buffers
+	Rtc.addInPort((m_sPrefix + "PoseDelta_In").c_str(), m_PoseDelta_InIn);
+	Rtc.addInPort((m_sPrefix + "FingerDelta_In").c_str(), m_FingerDelta_InIn);
+	Rtc.addInPort((m_sPrefix + "Home_In").c_str(), m_Home_InIn);
+
+	// Set OutPort buffer
+	Rtc.addOutPort((m_sPrefix + "Pose3D_Out").c_str(), m_Pose3D_OutOut);
+	Rtc.addOutPort((m_sPrefix + "Angular_Out").c_str(), m_Angular_OutOut);
+	Rtc.addOutPort((m_sPrefix + "Finger_Out").c_str(), m_Finger_OutOut);
+	Rtc.addOutPort((m_sPrefix + "Current_Out").c_str(), m_Current_OutOut);
+}
+
+void Jaco2ArmPort::InitData(void)
+{
+	// 手先位置姿勢の変位速度の入力を初期化する
+	m_PoseDelta_In.data.position.x = 0.0;
+	m_PoseDelta_In.data.position.y = 0.0;
+	m_PoseDelta_In.data.position.z = 0.0;
+	m_PoseDelta_In.data.orientation.r = 0.0;
+	m_PoseDelta_In.data.orientation.p = 0.0;
+	m_PoseDelta_In.data.orientation.y = 0.0;
+
+	// 指の開閉具合の変位速度の入力を初期化する
+	m_FingerDelta_InWrap.InitData();
+
+	// 初期姿勢遷移指令の入力を初期化する
+	m_Home_In.data = 0;
+
+	// 手先位置姿勢の出力を初期化する
+	m_Pose3D_Out.data.position.x = 0.0;
+	m_Pose3D_Out.data.position.y = 0.0;
+	m_Pose3D_Out.data.position.z = 0.0;
+	m_Pose3D_Out.data.orientation.r = 0.0;
+	m_Pose3D_Out.data.orientation.p = 0.0;
+	m_Pose3D_Out.data.orientation.y = 0.0;
+
+	// 腕の角度の出力を初期化する
+	m_Angular_OutWrap.InitData();
+
+	// 指の開閉具合の出力を初期化する
+	m_Finger_OutWrap.InitData();
+
+	// モータ負荷の出力を初期化する
+	m_Current_OutWrap.InitData();
+}
+
+void Jaco2ArmPort::Read(double dFailSafeSec)
+{
+	// 手先位置姿勢の変位速度をポートから読み込む
+	ReadPoseDelta(dFailSafeSec);
+
+	// 指の開閉具合の変位速度をポートから読み込む
+	ReadFingerDelta(dFailSafeSec);
+
+	// 初期姿勢遷移指令をポートから読み込む
+	ReadHome();
+}
+
+bool Jaco2ArmPort::IsHomeRequested(void) const
+{
+	return (m_Home_In.data == 1);
+}
+
+void Jaco2ArmPort::GetCommand(TrajectoryPoint &stPoint)
+{
+	// 手先位置姿勢設定の構造体初期化
+	stPoint.InitStruct();
+
+	// 手先位置姿勢設定の制御方法を速度制御に設定
+	stPoint.Position.Type = CARTESIAN_VELOCITY;
+
+	// 手先位置姿勢設定の手先位置姿勢の速度を設定
+	stPoint.Position.CartesianPosition.X = m_PoseDelta_In.data.position.x;
+	stPoint.Position.CartesianPosition.Y = m_PoseDelta_In.data.position.y;
+	stPoint.Position.CartesianPosition.Z = m_PoseDelta_In.data.position.z;
+	stPoint.Position.CartesianPosition.ThetaX = m_PoseDelta_In.data.orientation.r;
+	stPoint.Position.CartesianPosition.ThetaY = m_PoseDelta_In.data.orientation.p;
+	stPoint.Position.CartesianPosition.ThetaZ = m_PoseDelta_In.data.orientation.y;
+
+	// 手先位置姿勢設定の指先の速度を設定
+	stPoint.Position.Fingers.Finger1 = m_FingerDelta_InWrap.GetThumbDelta();
+	stPoint.Position.Fingers.Finger2 = m_FingerDelta_InWrap.GetIndexFingerDelta();
+	stPoint.Position.Fingers.Finger3 = m_FingerDelta_InWrap.GetMiddleFingerDelta();
+}
+
+void Jaco2ArmPort::Write(const JACO2_TELEMETRY_t &stTelemetry)
+{
+	// 手先位置姿勢ををポートに出力する
+	WritePose3D(stTelemetry);
+
+	// 腕の角度をポートに出力する
+	WriteAngular(stTelemetry);
+
+	// 指の開閉具合をポートに出力する
+	WriteFinger(stTelemetry);
+
+	// モータ負荷をポートに出力する
+	WriteCurrent(stTelemetry);
+}
+
+void Jaco2ArmPort::ReadPoseDelta(double dFailSafeSec)
+{
+	struct timeval ti = {0};
+
+	// 現在の時刻を取得する
+	gettimeofday(&ti, NULL);
+
+	// 手先位置姿勢の変位速度を最新のデータに更新する
+	if(m_PoseDelta_InReader.Read())
+	{
+		// 読み込み時刻を更新する
+		m_stPoseDeltaReadTime = ti;
+	}
+	else
+	{
+		if(dFailSafeSec <= TIMEVAL_DIFF(ti,m_stPoseDeltaReadTime))
+		{
+			// 手先位置姿勢の変位速度の入力を初期化する(暴走回避)
+			m_PoseDelta_In.data.position.x = 0.0;
+			m_PoseDelta_In.data.position.y = 0.0;
+			m_PoseDelta_In.data.position.z = 0.0;
+			m_PoseDelta_In.data.orientation.r = 0.0;
+			m_PoseDelta_In.data.orientation.p = 0.0;
+			m_PoseDelta_In.data.orientation.y = 0.0;
+		}
+	}
+}
+
+void Jaco2ArmPort::ReadFingerDelta(double dFailSafeSec)
+{
+	struct timeval ti = {0};
+
+	// 現在の時刻を取得する
+	gettimeofday(&ti, NULL);
+
+	// 指の開閉具合の変位速度を最新のデータに更新する
+	if(m_FingerDelta_InReader.Read())
+	{
+		// 読み込み時刻を更新する
+		m_stFingerDeltaReadTime = ti;
+	}
+	else
+	{
+		if(dFailSafeSec <= TIMEVAL_DIFF(ti,m_stFingerDeltaReadTime))
+		{
+			// 指の開閉具合の変位速度の入力を初期化する(暴走回避)
+			m_FingerDelta_InWrap.InitData();
+		}
+	}
+}
+
+void Jaco2ArmPort::ReadHome(void)
+{
+	// 初期姿勢遷移指令を最新のデータに更新する
+	m_Home_InReader.Read();
+}
+
+void Jaco2ArmPort::WritePose3D(const JACO2_TELEMETRY_t &stTelemetry)
+{
+	const CartesianPosition &getPosition = stTelemetry.stCartesian;
+
+	// 出力データを更新する
+	m_Pose3D_Out.data.position.x = getPosition.Coordinates.X;
+	m_Pose3D_Out.data.position.y = getPosition.Coordinates.Y;
+	m_Pose3D_Out.data.position.z = getPosition.Coordinates.Z;
+	m_Pose3D_Out.data.orientation.p = getPosition.Coordinates.ThetaX;
+	m_Pose3D_Out.data.orientation.r = getPosition.Coordinates.ThetaY;
+	m_Pose3D_Out.data.orientation.y = getPosition.Coordinates.ThetaZ;
+
+	// ポートに書き込む
+	setTimestamp(m_Pose3D_Out);
+	m_Pose3D_OutOut.write();
+}
+
+void Jaco2ArmPort::WriteAngular(const JACO2_TELEMETRY_t &stTelemetry)
+{
+	const AngularPosition &CurrentData = stTelemetry.stAngular;
+
+	// 腕の角度を更新する
+	m_Angular_OutWrap.SetShoulderAngular(CurrentData.Actuators.Actuator1*RAD);
+	m_Angular_OutWrap.SetArmAngular(CurrentData.Actuators.Actuator2*RAD);
+	m_Angular_OutWrap.SetForearmAngular(CurrentData.Actuators.Actuator3*RAD);
+	m_Angular_OutWrap.SetWrist1Angular(CurrentData.Actuators.Actuator4*RAD);
+	m_Angular_OutWrap.SetWrist2Angular(CurrentData.Actuators.Actuator5*RAD);
+	m_Angular_OutWrap.SetHandAngular(CurrentData.Actuators.Actuator6*RAD);
+
+	// ポートに書き込む
+	m_Angular_OutWrap.SetTimestamp();
+	m_Angular_OutOut.write();
+}
+
+void Jaco2ArmPort::WriteFinger(const JACO2_TELEMETRY_t &stTelemetry)
+{
+	const AngularPosition &CurrentData = stTelemetry.stAngular;
+
+	// 指の開閉具合を更新する
+	m_Finger_OutWrap.SetThumbStatus(CurrentData.Fingers.Finger1);
+	m_Finger_OutWrap.SetIndexFingerStatus(CurrentData.Fingers.Finger2);
+	m_Finger_OutWrap.SetMiddleFingerStatus(CurrentData.Fingers.Finger3);
+
+	// ポートに書き込む
+	m_Finger_OutWrap.SetTimestamp();
+	m_Finger_OutOut.write();
+}
+
+void Jaco2ArmPort::WriteCurrent(const JACO2_TELEMETRY_t &stTelemetry)
+{
+	const AngularPosition &CurrentData = stTelemetry.stCurrent;
+
+	// モータ負荷を更新する
+	m_Current_OutWrap.SetShoulderCurrent(CurrentData.Actuators.Actuator1);
+	m_Current_OutWrap.SetArmCurrent(CurrentData.Actuators.Actuator2);
+	m_Current_OutWrap.SetForearmCurrent(CurrentData.Actuators.Actuator3);
+	m_Current_OutWrap.SetWrist1Current(CurrentData.Actuators.Actuator4);
+	m_Current_OutWrap.SetWrist2Current(CurrentData.Actuators.Actuator5);
+	m_Current_OutWrap.SetHandCurrent(CurrentData.Actuators.Actuator6);
+	m_Current_OutWrap.SetThumbCurrent(CurrentData.Fingers.Finger1);
+	m_Current_OutWrap.SetIndexFingerCurrent(CurrentData.Fingers.Finger2);
+	m_Current_OutWrap.SetMiddleFingerCurrent(CurrentData.Fingers.Finger3);
+
+	// ポートに書き込む
+	m_Current_OutWrap.SetTimestamp();
+	m_Current_OutOut.write();
+}
@@ -0,0 +1,82 @@
+#include "KinovaBus.h"
+#include <cstring>
+
+KinovaBus::KinovaBus(KinovaApi &Api)
+	: m_Api(Api)
+	, m_bSelected(false)
+	, m_stSelected()
+	, m_uSwitchCount(0)
+	, m_iCommandWaiting(0)
+{
+}
+
+KinovaBus::~KinovaBus()
+{
+}
+
+std::mutex &KinovaBus::GetMutex(void)
+{
+	return m_Mutex;
+}
+
+KinovaApi &KinovaBus::GetApi(void)
+{
+	return m_Api;
+}
+
+void KinovaBus::LockCommand(std::unique_lock<std::mutex> &lock)
+{
+	// ロック待ちを登録してからロックする
+	m_iCommandWaiting++;
+	lock.lock();
+
+	// ロック待ちの速度指令がなくなれば状態の取得を再開させる
+	if(--m_iCommandWaiting == 0)
+	{
+		m_CommandCond.notify_all();
+	}
+}
+
+void KinovaBus::LockTelemetry(std::unique_lock<std::mutex> &lock)
+{
+	// ロック待ちの速度指令があればロックを譲る
+	lock.lock();
+	m_CommandCond.wait(lock, [this]{ return m_iCommandWaiting == 0; });
+}
+
+bool KinovaBus::Select(const KinovaDevice &stDevice)
+{
+	// 既にカレント設定済みならば省略する
+	if(m_bSelected && IsSameDevice(m_stSelected, stDevice))
+	{
+		return true;
+	}
+
+	// デバイスをカレント設定する
+	m_bSelected = (m_Api.SetActiveDevice(stDevice) == NO_ERROR_KINOVA);
+	m_stSelected = stDevice;
+	m_uSwitchCount++;
+
+	return m_bSelected;
+}
+
+int KinovaBus::Enumerate(KinovaDevice list[MAX_KINOVA_DEVICE])
+{
+	int iResult = 0;
+
+	// デバイスの一覧を取り直すとカレント設定は不定とする
+	m_bSelected = false;
+
+	return m_Api.GetDevices(list, iResult);
+}
+
+uint64_t KinovaBus::GetSwitchCount(void)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	return m_uSwitchCount;
+}
+
+bool KinovaBus::IsSameDevice(const KinovaDevice &stDevice1, const KinovaDevice &stDevice2)
+{
+	return (strncmp(stDevice1.SerialNumber, stDevice2.SerialNumber, sizeof(stDevice1.SerialNumber)) == 0);
+}
@@ -0,0 +1,305 @@
+#include "KinovaSimApi.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+/*! @name シミュレータの定数 */
+/* @{ */
+#define SIM_ERROR			(0)			/*!< 異常時の戻り値(NO_ERROR_KINOVA以外)	*/
+#define SIM_BASE_HEIGHT		(0.2755)	/*!< 肩の高さ [m]							*/
+#define SIM_LINK1			(0.41)		/*!< 上腕の長さ [m]							*/
+#define SIM_LINK2			(0.41)		/*!< 前腕から手先までの長さ [m]				*/
+#define SIM_FINGER_MAX		(6800.0)	/*!< 指を閉じた位置							*/
+/* @} */
+
+#define RAD_TO_DEG(x)	((180.0/M_PI)*(x))
+
+KinovaSimApi::KinovaSimApi(const KINOVA_SIM_CONFIG_t &stConfig)
+	: m_stConfig(stConfig)
+	, m_iActive(-1)
+	, m_tpStart(std::chrono::steady_clock::now())
+{
+	// アームの数をKinovaAPIの上限までに制限する
+	m_stConfig.iDeviceNum = std::max(0, std::min(m_stConfig.iDeviceNum, MAX_KINOVA_DEVICE));
+	m_vecArm.resize(m_stConfig.iDeviceNum);
+	for(size_t i = 0; i < m_vecArm.size(); i++)
+	{
+		SetHome(m_vecArm[i]);
+	}
+}
+
+KinovaSimApi::~KinovaSimApi()
+{
+}
+
+bool KinovaSimApi::Load(void)
+{
+	// 読み込むライブラリはない
+	return true;
+}
+
+int KinovaSimApi::InitAPI(void)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+
+	// 全てのアームをホームポジションで停止した状態にする
+	Process();
+	for(size_t i = 0; i < m_vecArm.size(); i++)
+	{
+		SetHome(m_vecArm[i]);
+	}
+
+	return NO_ERROR_KINOVA;
+}
+
+int KinovaSimApi::GetDevices(KinovaDevice devices[MAX_KINOVA_DEVICE], int &result)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+
+	// 模擬するアームの一覧を作成する
+	Process();
+	for(int i = 0; i < m_stConfig.iDeviceNum; i++)
+	{
+		memset(&devices[i], 0, sizeof(KinovaDevice));
+		snprintf(devices[i].SerialNumber, sizeof(devices[i].SerialNumber), "SIM%02d", i);
+		snprintf(devices[i].Model, sizeof(devices[i].Model), "JACO2SIM");
+		devices[i].DeviceID = i;
+	}
+
+	result = NO_ERROR_KINOVA;
+	return m_stConfig.iDeviceNum;
+}
+
+int KinovaSimApi::SetActiveDevice(KinovaDevice device)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+
+	// 一覧にないデバイスは設定できない
+	Process();
+	if((device.DeviceID < 0) || (m_stConfig.iDeviceNum <= device.DeviceID))
+	{
+		return SIM_ERROR;
+	}
+
+	m_iActive = device.DeviceID;
+	return NO_ERROR_KINOVA;
+}
+
+int KinovaSimApi::MoveHome(void)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	SIM_ARM_t *pArm = Process();
+
+	if(pArm == NULL)
+	{
+		return SIM_ERROR;
+	}
+
+	// 移動時間は模擬せず、即座にホームポジションにする
+	SetHome(*pArm);
+	return NO_ERROR_KINOVA;
+}
+
+int KinovaSimApi::InitFingers(void)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	SIM_ARM_t *pArm = Process();
+
+	if(pArm == NULL)
+	{
+		return SIM_ERROR;
+	}
+
+	// 指を開く
+	pArm->stFingers.InitStruct();
+	pArm->stFingerVelocity.InitStruct();
+	return NO_ERROR_KINOVA;
+}
+
+int KinovaSimApi::SendBasicTrajectory(TrajectoryPoint command)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	SIM_ARM_t *pArm = Process();
+
+	if(pArm == NULL)
+	{
+		return SIM_ERROR;
+	}
+
+	// 速度指令のみ模擬する
+	if(command.Position.Type != CARTESIAN_VELOCITY)
+	{
+		return SIM_ERROR;
+	}
+
+	// 速度指令を更新する
+	pArm->stVelocity = command.Position.CartesianPosition;
+	pArm->stFingerVelocity = command.Position.Fingers;
+	pArm->tpCommand = pArm->tpUpdate;
+	return NO_ERROR_KINOVA;
+}
+
+int KinovaSimApi::GetCartesianPosition(CartesianPosition &Response)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	SIM_ARM_t *pArm = Process();
+
+	if(pArm == NULL)
+	{
+		return SIM_ERROR;
+	}
+
+	Response.Coordinates = pArm->stPose;
+	Response.Fingers = pArm->stFingers;
+	return NO_ERROR_KINOVA;
+}
+
+int KinovaSimApi::GetAngularPosition(AngularPosition &Response)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	SIM_ARM_t *pArm = Process();
+	double dR, dH, dD, dCos, dElbow, dShoulder;
+
+	if(pArm == NULL)
+	{
+		return SIM_ERROR;
+	}
+
+	// 肩から手先までの距離を届く範囲に制限する
+	dR = std::hypot(pArm->stPose.X, pArm->stPose.Y);
+	dH = pArm->stPose.Z - SIM_BASE_HEIGHT;
+	dD = std::max(1e-3, std::min(std::hypot(dR, dH), SIM_LINK1 + SIM_LINK2));
+
+	// 2リンクの逆運動学で肩と肘の角度を計算する
+	dCos = (dD*dD - SIM_LINK1*SIM_LINK1 - SIM_LINK2*SIM_LINK2)/(2.0*SIM_LINK1*SIM_LINK2);
+	dElbow = std::acos(std::max(-1.0, std::min(dCos, 1.0)));
+	dShoulder = std::atan2(dH, dR) + std::atan2(SIM_LINK2*std::sin(dElbow), SIM_LINK1 + SIM_LINK2*std::cos(dElbow));
+
+	// アクチュエータの角度 [deg] を設定する(手首は手先姿勢をそのまま使う)
+	Response.InitStruct();
+	Response.Actuators.Actuator1 = (float)RAD_TO_DEG(std::atan2(pArm->stPose.Y, pArm->stPose.X) + M_PI);
+	Response.Actuators.Actuator2 = (float)RAD_TO_DEG(M_PI/2 + dShoulder);
+	Response.Actuators.Actuator3 = (float)RAD_TO_DEG(M_PI + dElbow);
+	Response.Actuators.Actuator4 = (float)RAD_TO_DEG(pArm->stPose.ThetaX + M_PI);
+	Response.Actuators.Actuator5 = (float)RAD_TO_DEG(pArm->stPose.ThetaY + M_PI);
+	Response.Actuators.Actuator6 = (float)RAD_TO_DEG(pArm->stPose.ThetaZ + M_PI);
+	Response.Fingers = pArm->stFingers;
+	return NO_ERROR_KINOVA;
+}
+
+int KinovaSimApi::GetAngularCurrent(AngularPosition &Response)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	SIM_ARM_t *pArm = Process();
+	double dLinear, dAngular;
+
+	if(pArm == NULL)
+	{
+		return SIM_ERROR;
+	}
+
+	// 停止中は保持電流のみとする
+	Response.InitStruct();
+	dLinear = 0.0;
+	dAngular = 0.0;
+	if(IsMoving(*pArm, pArm->tpUpdate))
+	{
+		dLinear = std::sqrt(pArm->stVelocity.X*pArm->stVelocity.X + pArm->stVelocity.Y*pArm->stVelocity.Y + pArm->stVelocity.Z*pArm->stVelocity.Z);
+		dAngular = std::sqrt(pArm->stVelocity.ThetaX*pArm->stVelocity.ThetaX + pArm->stVelocity.ThetaY*pArm->stVelocity.ThetaY + pArm->stVelocity.ThetaZ*pArm->stVelocity.ThetaZ);
+		Response.Fingers.Finger1 = (float)(0.0001*std::fabs(pArm->stFingerVelocity.Finger1));
+		Response.Fingers.Finger2 = (float)(0.0001*std::fabs(pArm->stFingerVelocity.Finger2));
+		Response.Fingers.Finger3 = (float)(0.0001*std::fabs(pArm->stFingerVelocity.Finger3));
+	}
+
+	// 保持電流と速度に比例する電流 [A] を設定する
+	Response.Actuators.Actuator1 = (float)(0.2 + 2.0*dLinear);
+	Response.Actuators.Actuator2 = (float)(0.8 + 4.0*dLinear);
+	Response.Actuators.Actuator3 = (float)(0.5 + 3.0*dLinear);
+	Response.Actuators.Actuator4 = (float)(0.1 + 0.5*dAngular);
+	Response.Actuators.Actuator5 = (float)(0.1 + 0.5*dAngular);
+	Response.Actuators.Actuator6 = (float)(0.1 + 0.5*dAngular);
+	return NO_ERROR_KINOVA;
+}
+
+int KinovaSimApi::GetGeneralInformations(GeneralInformations &Response)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	SIM_ARM_t *pArm = Process();
+
+	if(pArm == NULL)
+	{
+		return SIM_ERROR;
+	}
+
+	// 起動からの時間と電源電圧のみ設定する
+	memset(&Response, 0, sizeof(Response));
+	Response.TimeAbsolute = std::chrono::duration<double>(pArm->tpUpdate - m_tpStart).count();
+	Response.SupplyVoltage = 24.0f;
+	return NO_ERROR_KINOVA;
+}
+
+KinovaSimApi::SIM_ARM_t *KinovaSimApi::Process(void)
+{
+	std::chrono::steady_clock::time_point tpNow;
+	SIM_ARM_t *pArm = NULL;
+	double dDt;
+
+	// USB通信の処理時間を模擬する(呼び出し元はロック中のため、呼び出しは順に処理される)
+	if(0.0 < m_stConfig.dLatency)
+	{
+		std::this_thread::sleep_for(std::chrono::duration<double>(m_stConfig.dLatency));
+	}
+
+	// カレントのアームがなければ何もしない
+	if((m_iActive < 0) || ((int)m_vecArm.size() <= m_iActive))
+	{
+		return NULL;
+	}
+	pArm = &m_vecArm[m_iActive];
+
+	// 前回の更新から速度指令が有効な間だけ積分する
+	tpNow = std::chrono::steady_clock::now();
+	if(IsMoving(*pArm, pArm->tpUpdate))
+	{
+		dDt = std::chrono::duration<double>(tpNow - pArm->tpUpdate).count();
+		dDt = std::min(dDt, m_stConfig.dCommandTimeout - std::chrono::duration<double>(pArm->tpUpdate - pArm->tpCommand).count());
+		dDt = std::max(0.0, dDt);
+		pArm->stPose.X += (float)(pArm->stVelocity.X*dDt);
+		pArm->stPose.Y += (float)(pArm->stVelocity.Y*dDt);
+		pArm->stPose.Z += (float)(pArm->stVelocity.Z*dDt);
+		pArm->stPose.ThetaX += (float)(pArm->stVelocity.ThetaX*dDt);
+		pArm->stPose.ThetaY += (float)(pArm->stVelocity.ThetaY*dDt);
+		pArm->stPose.ThetaZ += (float)(pArm->stVelocity.ThetaZ*dDt);
+		pArm->stFingers.Finger1 = (float)std::max(0.0, std::min(pArm->stFingers.Finger1 + pArm->stFingerVelocity.Finger1*dDt, SIM_FINGER_MAX));
+		pArm->stFingers.Finger2 = (float)std::max(0.0, std::min(pArm->stFingers.Finger2 + pArm->stFingerVelocity.Finger2*dDt, SIM_FINGER_MAX));
+		pArm->stFingers.Finger3 = (float)std::max(0.0, std::min(pArm->stFingers.Finger3 + pArm->stFingerVelocity.Finger3*dDt, SIM_FINGER_MAX));
+	}
+	pArm->tpUpdate = tpNow;
+
+	return pArm;
+}
+
+void KinovaSimApi::SetHome(SIM_ARM_t &stArm)
+{
+	// Jaco2のホームポジション付近の手先位置姿勢とする
+	stArm.stPose.X = 0.212f;
+	stArm.stPose.Y = -0.257f;
+	stArm.stPose.Z = 0.509f;
+	stArm.stPose.ThetaX = 1.64f;
+	stArm.stPose.ThetaY = 1.11f;
+	stArm.stPose.ThetaZ = 0.12f;
+	stArm.stFingers.InitStruct();
+
+	// 速度指令を破棄して停止する
+	stArm.stVelocity.InitStruct();
+	stArm.stFingerVelocity.InitStruct();
+	stArm.tpUpdate = std::chrono::steady_clock::now();
+	stArm.tpCommand = stArm.tpUpdate - std::chrono::hours(1);
+}
+
+bool KinovaSimApi::IsMoving(const SIM_ARM_t &stArm, std::chrono::steady_clock::time_point tpNow) const
+{
+	return (std::chrono::duration<double>(tpNow - stArm.tpCommand).count() < m_stConfig.dCommandTimeout);
+}
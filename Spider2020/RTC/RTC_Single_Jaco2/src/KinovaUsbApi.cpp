@@ -0,0 +1,134 @@
+#include "KinovaUsbApi.h"
+#include <cstddef>
+#include <dlfcn.h>
+
+KinovaUsbApi::KinovaUsbApi()
+	: m_pHandle(NULL)
+	, m_pInitAPI(NULL)
+	, m_pGetDevices(NULL)
+	, m_pSetActiveDevice(NULL)
+	, m_pMoveHome(NULL)
+	, m_pInitFingers(NULL)
+	, m_pSendBasicTrajectory(NULL)
+	, m_pGetCartesianPosition(NULL)
+	, m_pGetAngularPosition(NULL)
+	, m_pGetAngularCurrent(NULL)
+	, m_pGetGeneralInformations(NULL)
+{
+}
+
+KinovaUsbApi::~KinovaUsbApi()
+{
+	// KinovaAPIライブラリを解放する
+	if(m_pHandle != NULL)
+	{
+		dlclose(m_pHandle);
+	}
+}
+
+bool KinovaUsbApi::Load(void)
+{
+	// 読み込み済みならば何もしない
+	if(m_pHandle != NULL)
+	{
+		return true;
+	}
+
+	// KinovaAPIライブラリを読み込む
+	m_pHandle = dlopen("Kinova.API.USBCommandLayerUbuntu.so",RTLD_NOW|RTLD_GLOBAL);
+	if(m_pHandle == NULL)
+	{
+		return false;
+	}
+
+	// 初期化APIの関数アドレスを取得する
+	m_pInitAPI = (int (*)()) dlsym(m_pHandle,"InitAPI");
+
+	// ホームポジション移動APIの関数アドレスを取得する
+	m_pMoveHome = (int (*)()) dlsym(m_pHandle,"MoveHome");
+
+	// 角度制御モード設定APIの関数アドレスを取得する
+	m_pInitFingers = (int (*)()) dlsym(m_pHandle,"InitFingers");
+
+	// デバイス一覧取得APIの関数アドレスを取得する
+	m_pGetDevices = (int (*)(KinovaDevice devices[MAX_KINOVA_DEVICE], int &result)) dlsym(m_pHandle,"GetDevices");
+
+	// カレントデバイス設定APIの関数アドレスを取得する
+	m_pSetActiveDevice = (int (*)(KinovaDevice devices)) dlsym(m_pHandle,"SetActiveDevice");
+
+	// 手先位置姿勢設定APIの関数アドレスを取得する
+	m_pSendBasicTrajectory = (int (*)(TrajectoryPoint)) dlsym(m_pHandle,"SendBasicTrajectory");
+
+	// 手先位置姿勢取得APIの関数アドレスを取得する
+	m_pGetCartesianPosition = (int (*)(CartesianPosition &)) dlsym(m_pHandle,"GetCartesianPosition");
+
+	// 全てのアクチュエータの角度取得APIの関数アドレスを取得する
+	m_pGetAngularPosition = (int (*)(AngularPosition &)) dlsym(m_pHandle,"GetAngularPosition");
+
+	// 全てのアクチュエータの負荷取得APIの関数アドレスを取得する
+	m_pGetAngularCurrent = (int (*)(AngularPosition &Response)) dlsym(m_pHandle,"GetAngularCurrent");
+
+	// ロボットアームの汎用情報取得APIの関数アドレスを取得する
+	m_pGetGeneralInformations = (int (*)(GeneralInformations &)) dlsym(m_pHandle,"GetGeneralInformations");
+
+	return ((m_pInitAPI != NULL)
+		 && (m_pMoveHome != NULL)
+		 && (m_pInitFingers != NULL)
+		 && (m_pGetDevices != NULL)
+		 && (m_pSetActiveDevice != NULL)
+		 && (m_pSendBasicTrajectory != NULL)
+		 && (m_pGetCartesianPosition != NULL)
+		 && (m_pGetAngularPosition != NULL)
+		 && (m_pGetAngularCurrent != NULL)
+		 && (m_pGetGeneralInformations != NULL));
+}
+
+int KinovaUsbApi::InitAPI(void)
+{
+	return m_pInitAPI();
+}
+
+int KinovaUsbApi::GetDevices(KinovaDevice devices[MAX_KINOVA_DEVICE], int &result)
+{
+	return m_pGetDevices(devices, result);
+}
+
+int KinovaUsbApi::SetActiveDevice(KinovaDevice device)
+{
+	return m_pSetActiveDevice(device);
+}
+
+int KinovaUsbApi::MoveHome(void)
+{
+	return m_pMoveHome();
+}
+
+int KinovaUsbApi::InitFingers(void)
+{
+	return m_pInitFingers();
+}
+
+int KinovaUsbApi::SendBasicTrajectory(TrajectoryPoint command)
+{
+	return m_pSendBasicTrajectory(command);
+}
+
+int KinovaUsbApi::GetCartesianPosition(CartesianPosition &Response)
+{
+	return m_pGetCartesianPosition(Response);
+}
+
+int KinovaUsbApi::GetAngularPosition(AngularPosition &Response)
+{
+	return m_pGetAngularPosition(Response);
+}
+
+int KinovaUsbApi::GetAngularCurrent(AngularPosition &Response)
+{
+	return m_pGetAngularCurrent(Response);
+}
+
+int KinovaUsbApi::GetGeneralInformations(GeneralInformations &Response)
+{
+	return m_pGetGeneralInformations(Response);
+}
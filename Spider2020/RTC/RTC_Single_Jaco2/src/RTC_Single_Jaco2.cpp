@@ -8,34 +8,19 @@
  */
 
 #include "RTC_Single_Jaco2.h"
-#include <dlfcn.h>
-#include <math.h>
+#include "KinovaUsbApi.h"
+#include "KinovaSimApi.h"
+#include <algorithm>
+#include <cstdlib>
 
 #include </opt/JACO2_SDK/API/Kinova.API.CommLayerUbuntu.h>
 #include </opt/JACO2_SDK/API/KinovaTypes.h>
 
-#define RAD (M_PI/180)
+#define SIM_COMMAND_TIMEOUT	(0.1)	/*!< シミュレータが速度指令の途絶で停止するまでの時間 [s]	*/
 
 // timeval構造体の差を計算する(x1-x2)
 #define TIMEVAL_DIFF(x1,x2)	(((double)x1.tv_sec + (double)x1.tv_usec/1000000.0) - ((double)x2.tv_sec + (double)x2.tv_usec/1000000.0))
 
-int result;
-
-//Handle for the library's command layer.
-void * commandLayer_handle;
-//Function pointers to the functions we need
-int Device_NUM;
-int (*ARM_InitAPI)();
-int (*ARM_SendBasicTrajectory)(TrajectoryPoint command);
-int (*ARM_GetDevices)(KinovaDevice devices[MAX_KINOVA_DEVICE], int &result);
-int (*ARM_SetActiveDevice)(KinovaDevice device);
-int (*ARM_MoveHome)();
-int (*ARM_InitFingers)();
-int (*ARM_GetCartesianPosition)(CartesianPosition &);
-int (*ARM_GetAngularPosition)(AngularPosition &);
-int (*ARM_GetAngularCurrent)(AngularPosition &Response);
-int (*ARM_GetGeneralInformations)(GeneralInformations &);
-
 // Module specification
 // <rtc-template block="module_spec">
 static const char* rtc_single_jaco2_spec[] =
@@ -54,15 +39,33 @@ static const char* rtc_single_jaco2_spec[] =
 
 	// Configuration variables
 	"conf.default.FAILSAFE_SEC", "1.0",
+	"conf.default.ARM_NUM", "1",
 	"conf.default.OUT_SEC", "0.2",
+	"conf.default.TELEMETRY_SEC", "0.2",
+	"conf.default.CMD_EPSILON", "0.0001",
+	"conf.default.KEEPALIVE_SEC", "0.05",
+	"conf.default.API_BACKEND", "usb",
+	"conf.default.SIM_LATENCY", "0.002",
 
 	// Widget
 	"conf.__widget__.FAILSAFE_SEC", "text",
+	"conf.__widget__.ARM_NUM", "text",
 	"conf.__widget__.OUT_SEC", "text",
+	"conf.__widget__.TELEMETRY_SEC", "text",
+	"conf.__widget__.CMD_EPSILON", "text",
+	"conf.__widget__.KEEPALIVE_SEC", "text",
+	"conf.__widget__.API_BACKEND", "text",
+	"conf.__widget__.SIM_LATENCY", "text",
 
 	// Constraints
 	"conf.__type__.FAILSAFE_SEC", "double",
+	"conf.__type__.ARM_NUM", "long",
 	"conf.__type__.OUT_SEC", "double",
+	"conf.__type__.TELEMETRY_SEC", "double",
+	"conf.__type__.CMD_EPSILON", "double",
+	"conf.__type__.KEEPALIVE_SEC", "double",
+	"conf.__type__.API_BACKEND", "string",
+	"conf.__type__.SIM_LATENCY", "double",
 
 	""
 };
@@ -71,22 +74,10 @@ static const char* rtc_single_jaco2_spec[] =
 RTC_Single_Jaco2::RTC_Single_Jaco2(RTC::Manager* manager)
 	// <rtc-template block="initializer">
 	: RTC::DataFlowComponentBase(manager)
-	, m_PoseDelta_InIn("PoseDelta_In", m_PoseDelta_In)
-	, m_FingerDelta_InIn("FingerDelta_In", m_FingerDelta_In)
-	, m_Home_InIn("Home_In", m_Home_In)
-	, m_Pose3D_OutOut("Pose3D_Out", m_Pose3D_Out)
-	, m_Angular_OutOut("Angular_Out", m_Angular_Out)
-	, m_Finger_OutOut("Finger_Out", m_Finger_Out)
-	, m_Current_OutOut("Current_Out", m_Current_Out)
 
 	// </rtc-template>
-	, m_FingerDelta_InWrap(m_FingerDelta_In)
-	, m_Angular_OutWrap(m_Angular_Out)
-	, m_Current_OutWrap(m_Current_Out)
-	, m_Finger_OutWrap(m_Finger_Out)
-	, m_stPoseDeltaReadTime({0})
-	, m_stFingerDeltaReadTime({0})
 	, m_stInfoWriteTime({0})
+	, m_stTelemetry()
 {
 }
 
@@ -96,18 +87,13 @@ RTC_Single_Jaco2::~RTC_Single_Jaco2()
 
 RTC::ReturnCode_t RTC_Single_Jaco2::onInitialize()
 {
+	int iArmNum = 0;
+
 	// Registration: InPort/OutPort/Service
 	// <rtc-template block="registration">
 	// Set InPort buffers
-	addInPort("PoseDelta_In", m_PoseDelta_InIn);
-	addInPort("FingerDelta_In", m_FingerDelta_InIn);
-	addInPort("Home_In", m_Home_InIn);
 
 	// Set OutPort buffer
-	addOutPort("Pose3D_Out", m_Pose3D_OutOut);
-	addOutPort("Angular_Out", m_Angular_OutOut);
-	addOutPort("Finger_Out", m_Finger_OutOut);
-	addOutPort("Current_Out", m_Current_OutOut);
 
 	// Set service provider to Ports
 
@@ -120,39 +106,27 @@ RTC::ReturnCode_t RTC_Single_Jaco2::onInitialize()
 	// <rtc-template block="bind_config">
 	// Bind variables and configuration variable
 	bindParameter("FAILSAFE_SEC", m_FAILSAFE_SEC, "1.0");
+	bindParameter("ARM_NUM", m_ARM_NUM, "1");
 	bindParameter("OUT_SEC", m_OUT_SEC, "0.2");
+	bindParameter("TELEMETRY_SEC", m_TELEMETRY_SEC, "0.2");
+	bindParameter("CMD_EPSILON", m_CMD_EPSILON, "0.0001");
+	bindParameter("KEEPALIVE_SEC", m_KEEPALIVE_SEC, "0.05");
+	bindParameter("API_BACKEND", m_API_BACKEND, "usb");
+	bindParameter("SIM_LATENCY", m_SIM_LATENCY, "0.002");
 	// </rtc-template>
 
-	// 手先位置姿勢の変位速度の入力を初期化する
-	m_PoseDelta_In.data.position.x = 0.0;
-	m_PoseDelta_In.data.position.y = 0.0;
-	m_PoseDelta_In.data.position.z = 0.0;
-	m_PoseDelta_In.data.orientation.r = 0.0;
-	m_PoseDelta_In.data.orientation.p = 0.0;
-	m_PoseDelta_In.data.orientation.y = 0.0;
-
-	// 指の開閉具合の変位速度の入力を初期化する
-	m_FingerDelta_InWrap.InitData();
-
-	// 初期姿勢遷移指令の入力を初期化する
-	m_Home_In.data = 0;
-
-	// 手先位置姿勢の出力を初期化する
-	m_Pose3D_Out.data.position.x = 0.0;
-	m_Pose3D_Out.data.position.y = 0.0;
-	m_Pose3D_Out.data.position.z = 0.0;
-	m_Pose3D_Out.data.orientation.r = 0.0;
-	m_Pose3D_Out.data.orientation.p = 0.0;
-	m_Pose3D_Out.data.orientation.y = 0.0;
-
-	// 腕の角度の出力を初期化する
-	m_Angular_OutWrap.InitData();
-
-	// 指の開閉具合の出力を初期化する
-	m_Finger_OutWrap.InitData();
+	// ポートはアームの本数分生成するため、起動時の設定値を使う
+	iArmNum = atoi(getProperties().getProperty("conf.default.ARM_NUM", "1").c_str());
+	iArmNum = std::max(1, std::min(iArmNum, MAX_KINOVA_DEVICE));
 
-	// モータ負荷の出力を初期化する
-	m_Current_OutWrap.InitData();
+	// アーム毎の入出力ポートを登録し、初期化する(２本目以降はポート名にアームの番号を付ける)
+	m_vecPort.clear();
+	for(int i = 0; i < iArmNum; i++)
+	{
+		m_vecPort.emplace_back(new Jaco2ArmPort((i == 0) ? std::string("") : "Arm" + std::to_string(i + 1)));
+		m_vecPort.back()->Register(*this);
+		m_vecPort.back()->InitData();
+	}
 
 	return RTC::RTC_OK;
 }
@@ -181,136 +155,93 @@ RTC::ReturnCode_t RTC_Single_Jaco2::onShutdown(RTC::UniqueId ec_id)
 
 RTC::ReturnCode_t RTC_Single_Jaco2::onActivated(RTC::UniqueId ec_id)
 {
+	KINOVA_SIM_CONFIG_t stSimConfig;
 	KinovaDevice list[MAX_KINOVA_DEVICE];
+	int iDeviceNum = 0;
 
-	// KinovaAPIライブラリを読み込む
-	commandLayer_handle = dlopen("Kinova.API.USBCommandLayerUbuntu.so",RTLD_NOW|RTLD_GLOBAL);
-
-	// 初期化APIの関数アドレスを取得する
-	ARM_InitAPI = (int (*)()) dlsym(commandLayer_handle,"InitAPI");
-
-	// ホームポジション移動APIの関数アドレスを取得する
-	ARM_MoveHome = (int (*)()) dlsym(commandLayer_handle,"MoveHome");
-
-	// 角度制御モード設定APIの関数アドレスを取得する
-	ARM_InitFingers = (int (*)()) dlsym(commandLayer_handle,"InitFingers");
-
-	// デバイス一覧取得APIの関数アドレスを取得する
-	ARM_GetDevices = (int (*)(KinovaDevice devices[MAX_KINOVA_DEVICE], int &result)) dlsym(commandLayer_handle,"GetDevices");
-
-	// カレントデバイス設定APIの関数アドレスを取得する
-	ARM_SetActiveDevice = (int (*)(KinovaDevice devices)) dlsym(commandLayer_handle,"SetActiveDevice");
-
-	// 手先位置姿勢設定APIの関数アドレスを取得する
-	ARM_SendBasicTrajectory = (int (*)(TrajectoryPoint)) dlsym(commandLayer_handle,"SendBasicTrajectory");
-
-	// 手先位置姿勢取得APIの関数アドレスを取得する
-	ARM_GetCartesianPosition = (int (*)(CartesianPosition &)) dlsym(commandLayer_handle,"GetCartesianPosition");
-
-	// 全てのアクチュエータの角度取得APIの関数アドレスを取得する
-	ARM_GetAngularPosition = (int (*)(AngularPosition &)) dlsym(commandLayer_handle,"GetAngularPosition");
-
-	// 全てのアクチュエータの負荷取得APIの関数アドレスを取得する
-	ARM_GetAngularCurrent = (int (*)(AngularPosition &Response)) dlsym(commandLayer_handle,"GetAngularCurrent");
-
-	// ロボットアームの汎用情報取得APIの関数アドレスを取得する
-	ARM_GetGeneralInformations = (int (*)(GeneralInformations &)) dlsym(commandLayer_handle,"GetGeneralInformations");
+	// KinovaAPIの呼び出し先を生成する
+	if(m_API_BACKEND == "sim")
+	{
+		stSimConfig.iDeviceNum = (int)m_vecPort.size();
+		stSimConfig.dLatency = m_SIM_LATENCY;
+		stSimConfig.dCommandTimeout = SIM_COMMAND_TIMEOUT;
+		m_spApi.reset(new KinovaSimApi(stSimConfig));
+	}
+	else
+	{
+		m_spApi.reset(new KinovaUsbApi());
+	}
 
-	if((ARM_InitAPI == NULL)
-	|| (ARM_MoveHome == NULL)
-	|| (ARM_InitFingers == NULL)
-	|| (ARM_GetDevices == NULL)
-	|| (ARM_SetActiveDevice == NULL)
-	|| (ARM_SendBasicTrajectory == NULL)
-	|| (ARM_GetCartesianPosition == NULL)
-	|| (ARM_GetAngularPosition == NULL)
-	|| (ARM_GetAngularCurrent == NULL)
-	|| (ARM_GetGeneralInformations == NULL))
+	// KinovaAPIを読み込む
+	if(!m_spApi->Load())
 	{
 		std::cout << "Init Fail" << std::endl;
+		m_spApi.reset();
 		return RTC::RTC_ERROR;
 	}
-	else
+	std::cout << "Init" << std::endl;
+	m_spApi->InitAPI();
+	m_spBus.reset(new KinovaBus(*m_spApi));
+
+	// Jaco2アームを検索する(以降の周期では検索しない)
 	{
-		std::cout << "Init" << std::endl;
-		result = ARM_InitAPI();
-		Device_NUM = ARM_GetDevices(list, result);
-		std::cout << "Device NUM: " << Device_NUM << std::endl;
+		std::lock_guard<std::mutex> lock(m_spBus->GetMutex());
+		iDeviceNum = m_spBus->Enumerate(list);
+	}
+	std::cout << "Device NUM: " << iDeviceNum << std::endl;
 
-		// Jaco2アーム未検出の場合、初期化は失敗
-		if(Device_NUM < 1)
+	// Jaco2アームが不足する場合、初期化は失敗
+	if(iDeviceNum < (int)m_vecPort.size())
+	{
+		std::cout << "device is not detected" << std::endl;
+		m_spBus.reset();
+		m_spApi.reset();
+		return RTC::RTC_ERROR;
+	}
+
+	// 検出した順にアームを割り当て、アーム毎のスレッドを開始する
+	m_vecArm.clear();
+	for(size_t i = 0; i < m_vecPort.size(); i++)
+	{
+		m_vecArm.emplace_back(new Jaco2Arm(*m_spBus, (int)i));
+		if(!m_vecArm.back()->Start(list[i], GetArmConfig()))
 		{
-			std::cout << "device is not detected" << std::endl;
+			onDeactivated(ec_id);
 			return RTC::RTC_ERROR;
 		}
 	}
 
-	// Jaco2アームを初期姿勢に設定する
-	ARM_SetActiveDevice(list[0]);
-	ARM_InitFingers();
-	ARM_MoveHome();
-
 	return RTC::RTC_OK;
 }
 
-/*
 RTC::ReturnCode_t RTC_Single_Jaco2::onDeactivated(RTC::UniqueId ec_id)
 {
+	// アーム毎のスレッドを停止する
+	m_vecArm.clear();
+
+	// KinovaAPIを解放する
+	m_spBus.reset();
+	m_spApi.reset();
+
 	return RTC::RTC_OK;
 }
-*/
 
 
 RTC::ReturnCode_t RTC_Single_Jaco2::onExecute(RTC::UniqueId ec_id)
 {
-	KinovaDevice list[MAX_KINOVA_DEVICE];
+	JACO2_ARM_CONFIG_t stConfig = GetArmConfig();
 	TrajectoryPoint TargetPoint;
 	struct timeval ti = {0};
 
-	// 手先位置姿勢の変位速度をポートから読み込む
-	ReadPoseDelta();
-
-	// 指の開閉具合の変位速度をポートから読み込む
-	ReadFingerDelta();
-
-	// 初期姿勢遷移指令をポートから読み込む
-	ReadHome();
-
-	// Jaco2アームのデバイスリストを取得する
-	Device_NUM = ARM_GetDevices(list, result);
-
-	// １本目のJaco2アームをカレント設定する
-	ARM_SetActiveDevice(list[0]);
-
-	// 初期姿勢に戻す場合
-	if(m_Home_In.data == 1)
-	{
-		ARM_MoveHome();
-	}
-	// 姿勢制御を処理する場合
-	else
+	for(size_t i = 0; i < m_vecArm.size(); i++)
 	{
-		// 手先位置姿勢設定の構造体初期化
-		TargetPoint.InitStruct();
-
-		// 手先位置姿勢設定の制御方法を速度制御に設定
-		TargetPoint.Position.Type = CARTESIAN_VELOCITY;
-
-		// 手先位置姿勢設定の手先位置姿勢の速度を設定
-		TargetPoint.Position.CartesianPosition.X = m_PoseDelta_In.data.position.x;
-		TargetPoint.Position.CartesianPosition.Y = m_PoseDelta_In.data.position.y;
-		TargetPoint.Position.CartesianPosition.Z = m_PoseDelta_In.data.position.z;
-		TargetPoint.Position.CartesianPosition.ThetaX = m_PoseDelta_In.data.orientation.r;
-		TargetPoint.Position.CartesianPosition.ThetaY = m_PoseDelta_In.data.orientation.p;
-		TargetPoint.Position.CartesianPosition.ThetaZ = m_PoseDelta_In.data.orientation.y;
-
-		// 手先位置姿勢設定の指先の速度を設定
-		TargetPoint.Position.Fingers.Finger1 = m_FingerDelta_InWrap.GetThumbDelta();
-		TargetPoint.Position.Fingers.Finger2 = m_FingerDelta_InWrap.GetIndexFingerDelta();
-		TargetPoint.Position.Fingers.Finger3 = m_FingerDelta_InWrap.GetMiddleFingerDelta();
-
-		// １本目のJaco2アームの手先位置姿勢を設定する
-		ARM_SendBasicTrajectory(TargetPoint);
+		// 変位速度及び初期姿勢遷移指令をポートから読み込む
+		m_vecPort[i]->Read(m_FAILSAFE_SEC);
+
+		// 速度指令を作成し、アームのスレッドに渡す(送信はアームのスレッドが行う)
+		m_vecPort[i]->GetCommand(TargetPoint);
+		m_vecArm[i]->SetConfig(stConfig);
+		m_vecArm[i]->PostCommand(TargetPoint, m_vecPort[i]->IsHomeRequested());
 	}
 
 	// 現在の時刻を取得する
@@ -322,17 +253,14 @@ RTC::ReturnCode_t RTC_Single_Jaco2::onExecute(RTC::UniqueId ec_id)
 		// 書き込み時刻を更新する
 		m_stInfoWriteTime = ti;
 
-		// 手先位置姿勢ををポートに出力する
-		WritePose3D();
-
-		// 腕の角度をポートに出力する
-		WriteAngular();
-
-		// 指の開閉具合をポートに出力する
-		WriteFinger();
-
-		// モータ負荷をポートに出力する
-		WriteCurrent();
+		// アームのスレッドが取得した最新の状態をポートに出力する
+		for(size_t i = 0; i < m_vecArm.size(); i++)
+		{
+			if(m_vecArm[i]->ReadTelemetry(m_stTelemetry))
+			{
+				m_vecPort[i]->Write(m_stTelemetry);
+			}
+		}
 	}
 
 	return RTC::RTC_OK;
@@ -373,151 +301,16 @@ RTC::ReturnCode_t RTC_Single_Jaco2::onRateChanged(RTC::UniqueId ec_id)
 }
 */
 
-void RTC_Single_Jaco2::ReadPoseDelta(void)
+JACO2_ARM_CONFIG_t RTC_Single_Jaco2::GetArmConfig(void)
 {
-	struct timeval ti = {0};
+	JACO2_ARM_CONFIG_t stConfig;
 
-	// 現在の時刻を取得する
-	gettimeofday(&ti, NULL);
-
-	// 手先位置姿勢の変位速度を更新する
-	if(m_PoseDelta_InIn.isNew())
-	{
-		// 読み込み時刻を更新する
-		m_stPoseDeltaReadTime = ti;
+	// 出力されない状態を取得しないよう、取得周期はOUT_SEC以上とする
+	stConfig.dTelemetrySec = std::max(m_TELEMETRY_SEC, m_OUT_SEC);
+	stConfig.dCommandEpsilon = m_CMD_EPSILON;
+	stConfig.dKeepAliveSec = m_KEEPALIVE_SEC;
 
-		// 次のデータを読み込む
-		m_PoseDelta_InIn.read();
-	}
-	else
-	{
-		if(m_FAILSAFE_SEC <= TIMEVAL_DIFF(ti,m_stPoseDeltaReadTime))
-		{
-			// 手先位置姿勢の変位速度の入力を初期化する(暴走回避)
-			m_PoseDelta_In.data.position.x = 0.0;
-			m_PoseDelta_In.data.position.y = 0.0;
-			m_PoseDelta_In.data.position.z = 0.0;
-			m_PoseDelta_In.data.orientation.r = 0.0;
-			m_PoseDelta_In.data.orientation.p = 0.0;
-			m_PoseDelta_In.data.orientation.y = 0.0;
-		}
-	}
-}
-
-void RTC_Single_Jaco2::ReadFingerDelta(void)
-{
-	struct timeval ti = {0};
-
-	// 現在の時刻を取得する
-	gettimeofday(&ti, NULL);
-
-	// 指の開閉具合の変位速度を更新する
-	if(m_FingerDelta_InIn.isNew())
-	{
-		// 読み込み時刻を更新する
-		m_stFingerDeltaReadTime = ti;
-
-		// 次のデータを読み込む
-		m_FingerDelta_InIn.read();
-	}
-	else
-	{
-		if(m_FAILSAFE_SEC <= TIMEVAL_DIFF(ti,m_stFingerDeltaReadTime))
-		{
-			// 指の開閉具合の変位速度の入力を初期化する(暴走回避)
-			m_FingerDelta_InWrap.InitData();
-		}
-	}
-}
-
-void RTC_Single_Jaco2::ReadHome(void)
-{
-	// 初期姿勢遷移指令を更新する
-	if(m_Home_InIn.isNew())
-	{
-		// 次のデータを読み込む
-		m_Home_InIn.read();
-	}
-}
-
-void RTC_Single_Jaco2::WritePose3D(void)
-{
-	CartesianPosition getPosition;
-
-	// 手先位置姿勢を取得する
-	ARM_GetCartesianPosition(getPosition);
-
-	// 出力データを更新する
-	m_Pose3D_Out.data.position.x = getPosition.Coordinates.X;
-	m_Pose3D_Out.data.position.y = getPosition.Coordinates.Y;
-	m_Pose3D_Out.data.position.z = getPosition.Coordinates.Z;
-	m_Pose3D_Out.data.orientation.p = getPosition.Coordinates.ThetaX;
-	m_Pose3D_Out.data.orientation.r = getPosition.Coordinates.ThetaY;
-	m_Pose3D_Out.data.orientation.y = getPosition.Coordinates.ThetaZ;
-
-	// ポートに書き込む
-	setTimestamp(m_Pose3D_Out);
-	m_Pose3D_OutOut.write();
-}
-
-void RTC_Single_Jaco2::WriteAngular(void)
-{
-	AngularPosition CurrentData;
-
-	// 腕の角度を取得する
-	ARM_GetAngularPosition(CurrentData);
-
-	// 腕の角度を更新する
-	m_Angular_OutWrap.SetShoulderAngular(CurrentData.Actuators.Actuator1*RAD);
-	m_Angular_OutWrap.SetArmAngular(CurrentData.Actuators.Actuator2*RAD);
-	m_Angular_OutWrap.SetForearmAngular(CurrentData.Actuators.Actuator3*RAD);
-	m_Angular_OutWrap.SetWrist1Angular(CurrentData.Actuators.Actuator4*RAD);
-	m_Angular_OutWrap.SetWrist2Angular(CurrentData.Actuators.Actuator5*RAD);
-	m_Angular_OutWrap.SetHandAngular(CurrentData.Actuators.Actuator6*RAD);
-
-	// ポートに書き込む
-	m_Angular_OutWrap.SetTimestamp();
-	m_Angular_OutOut.write();
-}
-
-void RTC_Single_Jaco2::WriteFinger(void)
-{
-	AngularPosition CurrentData;
-
-	// 指の開閉具合を取得する
-	ARM_GetAngularPosition(CurrentData);
-
-	// 指の開閉具合を更新する
-	m_Finger_OutWrap.SetThumbStatus(CurrentData.Fingers.Finger1);
-	m_Finger_OutWrap.SetIndexFingerStatus(CurrentData.Fingers.Finger2);
-	m_Finger_OutWrap.SetMiddleFingerStatus(CurrentData.Fingers.Finger3);
-
-	// ポートに書き込む
-	m_Finger_OutWrap.SetTimestamp();
-	m_Finger_OutOut.write();
-}
-
-void RTC_Single_Jaco2::WriteCurrent(void)
-{
-	AngularPosition CurrentData;
-
-	// モータ負荷を取得する
-	ARM_GetAngularPosition(CurrentData);
-
-	// モータ負荷を更新する
-	m_Current_OutWrap.SetShoulderCurrent(CurrentData.Actuators.Actuator1);
-	m_Current_OutWrap.SetArmCurrent(CurrentData.Actuators.Actuator2);
-	m_Current_OutWrap.SetForearmCurrent(CurrentData.Actuators.Actuator3);
-	m_Current_OutWrap.SetWrist1Current(CurrentData.Actuators.Actuator4);
-	m_Current_OutWrap.SetWrist2Current(CurrentData.Actuators.Actuator5);
-	m_Current_OutWrap.SetHandCurrent(CurrentData.Actuators.Actuator6);
-	m_Current_OutWrap.SetThumbCurrent(CurrentData.Fingers.Finger1);
-	m_Current_OutWrap.SetIndexFingerCurrent(CurrentData.Fingers.Finger2);
-	m_Current_OutWrap.SetMiddleFingerCurrent(CurrentData.Fingers.Finger3);
-
-	// ポートに書き込む
-	m_Current_OutWrap.SetTimestamp();
-	m_Current_OutOut.write();
+	return stConfig;
 }
 
 
@@ -0,0 +1,206 @@
+// -*- C++ -*-
+/*!
+ * @file Jaco2CycleBench.cpp
+ * @brief RTC_Single_Jaco2の制御周期の処理時間の計測
+ * @date 2026/10/19
+ *
+ * RTC_Single_Jaco2のonExecuteと同じ手順でアーム毎のスレッドに速度指令を渡し、
+ * １周期の処理時間と、アーム毎の送信数・送信遅延・状態の取得周期を計測する。
+ *
+ * 使用例:
+ *   Jaco2CycleBench -b sim -l 2 -r 100 -t 10
+ *   Jaco2CycleBench -b sim -l 2 -a 2          (２本のアーム)
+ *   Jaco2CycleBench -b usb -t 10              (実機)
+ * 最終行に結果を key=value 形式で出力する
+ */
+
+#include "Jaco2Arm.h"
+#include "KinovaUsbApi.h"
+#include "KinovaSimApi.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+/*!
+ * 百分位数を取得する
+ * @param  vecValue ソート済みの値
+ * @param  dRate    割合 (0-1)
+ * @return 百分位数
+ */
+static double Percentile(const std::vector<double> &vecValue, double dRate)
+{
+	if(vecValue.empty())
+	{
+		return 0.0;
+	}
+	return vecValue[std::min(vecValue.size() - 1, (size_t)(dRate*vecValue.size()))];
+}
+
+int main(int argc, char *argv[])
+{
+	std::unique_ptr<KinovaApi> spApi;
+	std::unique_ptr<KinovaBus> spBus;
+	std::vector<std::unique_ptr<Jaco2Arm>> vecArm;
+	KINOVA_SIM_CONFIG_t stSimConfig;
+	JACO2_ARM_CONFIG_t stArmConfig;
+	KinovaDevice list[MAX_KINOVA_DEVICE];
+	std::string sBackend = "sim";
+	double dRate = 100.0;
+	double dPeriod = 10.0;
+	int iArmNum = 1;
+	int iOpt, iDeviceNum = 0;
+
+	// 引数を解析する
+	stSimConfig.iDeviceNum = 1;
+	stSimConfig.dLatency = 0.002;
+	stSimConfig.dCommandTimeout = 0.1;
+	stArmConfig.dTelemetrySec = 0.2;
+	stArmConfig.dCommandEpsilon = 0.0001;
+	stArmConfig.dKeepAliveSec = 0.05;
+	while((iOpt = getopt(argc, argv, "b:l:r:t:T:k:a:h")) != -1)
+	{
+		switch(iOpt)
+		{
+		case 'b':
+			sBackend = optarg;
+			break;
+		case 'l':
+			stSimConfig.dLatency = atof(optarg)/1000.0;
+			break;
+		case 'r':
+			dRate = atof(optarg);
+			break;
+		case 't':
+			dPeriod = atof(optarg);
+			break;
+		case 'T':
+			stArmConfig.dTelemetrySec = atof(optarg);
+			break;
+		case 'k':
+			stArmConfig.dKeepAliveSec = atof(optarg);
+			break;
+		case 'a':
+			iArmNum = std::max(1, std::min(atoi(optarg), MAX_KINOVA_DEVICE));
+			break;
+		default:
+			printf("usage: %s [-b usb|sim] [-l sim_latency_ms] [-r rate_hz] [-t sec] [-T telemetry_sec] [-k keepalive_sec] [-a arms]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	// KinovaAPIを初期化し、アームを検索する
+	if(sBackend == "usb")
+	{
+		spApi.reset(new KinovaUsbApi());
+	}
+	else
+	{
+		stSimConfig.iDeviceNum = iArmNum;
+		spApi.reset(new KinovaSimApi(stSimConfig));
+	}
+	if(!spApi->Load())
+	{
+		printf("Load is failed\n");
+		return 1;
+	}
+	spApi->InitAPI();
+	spBus.reset(new KinovaBus(*spApi));
+	{
+		std::lock_guard<std::mutex> lock(spBus->GetMutex());
+		iDeviceNum = spBus->Enumerate(list);
+	}
+	if(iDeviceNum < iArmNum)
+	{
+		printf("device is not detected\n");
+		return 1;
+	}
+
+	// アーム毎のスレッドを開始する
+	for(int i = 0; i < iArmNum; i++)
+	{
+		vecArm.emplace_back(new Jaco2Arm(*spBus, i));
+		if(!vecArm.back()->Start(list[i], stArmConfig))
+		{
+			return 1;
+		}
+	}
+
+	// 実行周期で速度指令を生成してアームのスレッドに渡す
+	std::vector<double> vecCycle;
+	std::chrono::steady_clock::time_point tpStart, tpCycle, tpEnd;
+	TrajectoryPoint TargetPoint;
+	JACO2_TELEMETRY_t stTelemetry;
+	uint64_t uOverrun = 0;
+	double dT;
+
+	vecCycle.reserve((size_t)(dRate*dPeriod) + 1);
+	tpStart = std::chrono::steady_clock::now();
+	for(uint64_t i = 0; ; i++)
+	{
+		tpCycle = tpStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(i/dRate));
+		if(dPeriod <= std::chrono::duration<double>(tpCycle - tpStart).count())
+		{
+			break;
+		}
+		std::this_thread::sleep_until(tpCycle);
+
+		// 0.5秒毎に速度指令を切り替える(停止と移動を繰り返す)
+		dT = i/dRate;
+		for(size_t j = 0; j < vecArm.size(); j++)
+		{
+			TargetPoint.InitStruct();
+			TargetPoint.Position.Type = CARTESIAN_VELOCITY;
+			TargetPoint.Position.CartesianPosition.X = ((int)(dT*2.0)%2 == 0) ? 0.0f : (float)(0.05*std::sin(dT + j));
+			vecArm[j]->PostCommand(TargetPoint, false);
+			vecArm[j]->ReadTelemetry(stTelemetry);
+		}
+
+		// 周期の開始から処理の完了までの時間を記録する
+		tpEnd = std::chrono::steady_clock::now();
+		vecCycle.push_back(std::chrono::duration<double>(tpEnd - tpCycle).count());
+		if(1.0/dRate < vecCycle.back())
+		{
+			uOverrun++;
+		}
+	}
+	dPeriod = std::chrono::duration<double>(std::chrono::steady_clock::now() - tpStart).count();
+
+	// アーム毎のスレッドを停止し、統計情報を出力する
+	uint64_t uError = 0;
+	for(size_t j = 0; j < vecArm.size(); j++)
+	{
+		vecArm[j]->Stop();
+		JACO2_ARM_STAT_t stStat = vecArm[j]->GetStat();
+		printf("arm%zu: post=%llu send=%llu error=%llu latency_mean_ms=%.3f latency_max_ms=%.3f telemetry_hz=%.1f\n",
+			j + 1, (unsigned long long)stStat.uPost, (unsigned long long)stStat.uSend, (unsigned long long)stStat.uError,
+			(stStat.uSend == 0) ? 0.0 : stStat.dLatencySum/stStat.uSend*1000.0,
+			stStat.dLatencyMax*1000.0,
+			stStat.uTelemetry/dPeriod);
+		uError += stStat.uError;
+	}
+
+	double dSum = 0.0;
+	for(size_t i = 0; i < vecCycle.size(); i++)
+	{
+		dSum += vecCycle[i];
+	}
+	std::sort(vecCycle.begin(), vecCycle.end());
+	printf("backend=%s arms=%d rate=%.1f cycles=%zu error=%llu overrun=%llu switch=%llu cycle_mean_ms=%.3f cycle_p50_ms=%.3f cycle_p99_ms=%.3f cycle_max_ms=%.3f\n",
+		sBackend.c_str(), iArmNum, dRate, vecCycle.size(),
+		(unsigned long long)uError, (unsigned long long)uOverrun,
+		(unsigned long long)spBus->GetSwitchCount(),
+		vecCycle.empty() ? 0.0 : dSum/vecCycle.size()*1000.0,
+		Percentile(vecCycle, 0.50)*1000.0,
+		Percentile(vecCycle, 0.99)*1000.0,
+		vecCycle.empty() ? 0.0 : vecCycle.back()*1000.0);
+
+	return (uError == 0) ? 0 : 1;
+}
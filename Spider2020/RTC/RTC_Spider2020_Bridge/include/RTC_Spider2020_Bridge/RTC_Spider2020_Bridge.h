@@ -0,0 +1,523 @@
+﻿// -*- C++ -*-
+/*!
+ * @file  RTC_Spider2020_Bridge.h
+ * @brief 固定長のデータ型と従来の配列のポートを相互に変換する
+ * @date  2026/10/19
+ *
+ * $Id$
+ */
+
+#ifndef RTC_SPIDER2020_BRIDGE_H
+#define RTC_SPIDER2020_BRIDGE_H
+
+#include <rtm/idl/BasicDataTypeSkel.h>
+#include <rtm/idl/ExtendedDataTypesSkel.h>
+#include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
+
+// Service implementation headers
+// <rtc-template block="service_impl_h">
+
+// </rtc-template>
+
+// Service Consumer stub headers
+// <rtc-template block="consumer_stub_h">
+#include "BasicDataTypeStub.h"
+#include "Spider2020Stub.h"
+
+// </rtc-template>
+
+#include <rtm/Manager.h>
+#include <rtm/DataFlowComponentBase.h>
+#include <rtm/CorbaPort.h>
+#include <rtm/DataInPort.h>
+#include <rtm/DataOutPort.h>
+
+#include "SeqConverter.h"
+
+/*!
+ * @class RTC_Spider2020_Bridge
+ * @brief 固定長のデータ型と従来の配列のポートを相互に変換する
+ * @details 固定長のポート(～_In)の受信データを従来の配列(～Seq_Out)に、
+ *          従来の配列のポート(～Seq_In)の受信データを固定長(～_Out)に変換して
+ *          出力する。従来の配列のポートを持つRTC(RTC_Spider2020_Infoなど)を
+ *          固定長のポートを持つRTCと接続する場合に使用する。
+ *
+ */
+class RTC_Spider2020_Bridge
+  : public RTC::DataFlowComponentBase
+{
+public:
+	/*!
+	 * @brief constructor
+	 * @param manager Maneger Object
+	 */
+	RTC_Spider2020_Bridge(RTC::Manager* manager);
+
+	/*!
+	 * @brief destructor
+	 */
+	~RTC_Spider2020_Bridge();
+
+	// <rtc-template block="public_attribute">
+
+	// </rtc-template>
+
+	// <rtc-template block="public_operation">
+
+	// </rtc-template>
+
+	/***
+	 *
+	 * The initialize action (on CREATED->ALIVE transition)
+	 *
+	 * @return RTC::ReturnCode_t
+	 * 
+	 * 
+	 */
+	virtual RTC::ReturnCode_t onInitialize();
+
+	/***
+	 *
+	 * The finalize action (on ALIVE->END transition)
+	 *
+	 * @return RTC::ReturnCode_t
+	 * 
+	 * 
+	 */
+	// virtual RTC::ReturnCode_t onFinalize();
+
+	/***
+	 *
+	 * The startup action when ExecutionContext startup
+	 *
+	 * @param ec_id target ExecutionContext Id
+	 *
+	 * @return RTC::ReturnCode_t
+	 * 
+	 * 
+	 */
+	// virtual RTC::ReturnCode_t onStartup(RTC::UniqueId ec_id);
+
+	/***
+	 *
+	 * The shutdown action when ExecutionContext stop
+	 *
+	 * @param ec_id target ExecutionContext Id
+	 *
+	 * @return RTC::ReturnCode_t
+	 * 
+	 * 
+	 */
+	// virtual RTC::ReturnCode_t onShutdown(RTC::UniqueId ec_id);
+
+	/***
+	 *
+	 * The activated action (Active state entry action)
+	 *
+	 * @param ec_id target ExecutionContext Id
+	 *
+	 * @return RTC::ReturnCode_t
+	 * 
+	 * 
+	 */
+	// virtual RTC::ReturnCode_t onActivated(RTC::UniqueId ec_id);
+
+	/***
+	 *
+	 * The deactivated action (Active state exit action)
+	 *
+	 * @param ec_id target ExecutionContext Id
+	 *
+	 * @return RTC::ReturnCode_t
+	 * 
+	 * 
+	 */
+	// virtual RTC::ReturnCode_t onDeactivated(RTC::UniqueId ec_id);
+
+	/***
+	 *
+	 * The execution action that is invoked periodically
+	 *
+	 * @param ec_id target ExecutionContext Id
+	 *
+	 * @return RTC::ReturnCode_t
+	 * 
+	 * 
+	 */
+	virtual RTC::ReturnCode_t onExecute(RTC::UniqueId ec_id);
+
+	/***
+	 *
+	 * The aborting action when main logic error occurred.
+	 *
+	 * @param ec_id target ExecutionContext Id
+	 *
+	 * @return RTC::ReturnCode_t
+	 * 
+	 * 
+	 */
+	// virtual RTC::ReturnCode_t onAborting(RTC::UniqueId ec_id);
+
+	/***
+	 *
+	 * The error action in ERROR state
+	 *
+	 * @param ec_id target ExecutionContext Id
+	 *
+	 * @return RTC::ReturnCode_t
+	 * 
+	 * 
+	 */
+	// virtual RTC::ReturnCode_t onError(RTC::UniqueId ec_id);
+
+	/***
+	 *
+	 * The reset action that is invoked resetting
+	 *
+	 * @param ec_id target ExecutionContext Id
+	 *
+	 * @return RTC::ReturnCode_t
+	 * 
+	 * 
+	 */
+	// virtual RTC::ReturnCode_t onReset(RTC::UniqueId ec_id);
+
+	/***
+	 *
+	 * The state update action that is invoked after onExecute() action
+	 *
+	 * @param ec_id target ExecutionContext Id
+	 *
+	 * @return RTC::ReturnCode_t
+	 * 
+	 * 
+	 */
+	// virtual RTC::ReturnCode_t onStateUpdate(RTC::UniqueId ec_id);
+
+	/***
+	 *
+	 * The action that is invoked when execution context's rate is changed
+	 *
+	 * @param ec_id target ExecutionContext Id
+	 *
+	 * @return RTC::ReturnCode_t
+	 * 
+	 * 
+	 */
+	// virtual RTC::ReturnCode_t onRateChanged(RTC::UniqueId ec_id);
+
+
+protected:
+	// <rtc-template block="protected_attribute">
+
+	// </rtc-template>
+
+	// <rtc-template block="protected_operation">
+
+	// </rtc-template>
+
+	// Configuration variable declaration
+	// <rtc-template block="config_declare">
+
+	// </rtc-template>
+
+	// DataInPort declaration
+	// <rtc-template block="inport_declare">
+	Spider2020::TimedAxis m_Axis_In;
+	/*!
+	 * DualShock4コントローラの軸キーの入力具合(固定長)
+	 * - Type: Spider2020::TimedAxis
+	 */
+	RTC::InPort<Spider2020::TimedAxis> m_Axis_InIn;
+	RTC::TimedDoubleSeq m_AxisSeq_In;
+	/*!
+	 * DualShock4コントローラの軸キーの入力具合(従来の配列)
+	 * - Type: TimedDoubleSeq
+	 * - Number: 8
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 */
+	RTC::InPort<RTC::TimedDoubleSeq> m_AxisSeq_InIn;
+	Spider2020::TimedMode m_Mode_In;
+	/*!
+	 * 動作指令の状態(固定長)
+	 * - Type: Spider2020::TimedMode
+	 */
+	RTC::InPort<Spider2020::TimedMode> m_Mode_InIn;
+	RTC::TimedLongSeq m_ModeSeq_In;
+	/*!
+	 * 動作指令の状態(従来の配列)
+	 * - Type: TimedLongSeq
+	 * - Number: 6
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 */
+	RTC::InPort<RTC::TimedLongSeq> m_ModeSeq_InIn;
+	Spider2020::TimedFlipperPwm m_FlipperPwm_In;
+	/*!
+	 * フリッパーのPWM指令(固定長)
+	 * - Type: Spider2020::TimedFlipperPwm
+	 */
+	RTC::InPort<Spider2020::TimedFlipperPwm> m_FlipperPwm_InIn;
+	RTC::TimedLongSeq m_FlipperPwmSeq_In;
+	/*!
+	 * フリッパーのPWM指令(従来の配列)
+	 * - Type: TimedLongSeq
+	 * - Number: 4
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 */
+	RTC::InPort<RTC::TimedLongSeq> m_FlipperPwmSeq_InIn;
+	Spider2020::TimedFlipperAngle m_FlipperAngle_In;
+	/*!
+	 * フリッパーの角度(固定長)
+	 * - Type: Spider2020::TimedFlipperAngle
+	 * - Unit: [rad]
+	 */
+	RTC::InPort<Spider2020::TimedFlipperAngle> m_FlipperAngle_InIn;
+	RTC::TimedDoubleSeq m_FlipperAngleSeq_In;
+	/*!
+	 * フリッパーの角度(従来の配列)
+	 * - Type: TimedDoubleSeq
+	 * - Number: 4
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 * - Unit: [rad]
+	 */
+	RTC::InPort<RTC::TimedDoubleSeq> m_FlipperAngleSeq_InIn;
+	Spider2020::TimedMotorLoad m_MotorLoad_In;
+	/*!
+	 * モータの負荷(固定長)
+	 * - Type: Spider2020::TimedMotorLoad
+	 * - Unit: [A]
+	 */
+	RTC::InPort<Spider2020::TimedMotorLoad> m_MotorLoad_InIn;
+	RTC::TimedDoubleSeq m_MotorLoadSeq_In;
+	/*!
+	 * モータの負荷(従来の配列)
+	 * - Type: TimedDoubleSeq
+	 * - Number: 6
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 * - Unit: [A]
+	 */
+	RTC::InPort<RTC::TimedDoubleSeq> m_MotorLoadSeq_InIn;
+	Spider2020::TimedArmAngular m_ArmAngular_In;
+	/*!
+	 * Jaco2アームの腕の角度(固定長)
+	 * - Type: Spider2020::TimedArmAngular
+	 * - Unit: [rad]
+	 */
+	RTC::InPort<Spider2020::TimedArmAngular> m_ArmAngular_InIn;
+	RTC::TimedDoubleSeq m_ArmAngularSeq_In;
+	/*!
+	 * Jaco2アームの腕の角度(従来の配列)
+	 * - Type: TimedDoubleSeq
+	 * - Number: 6
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 * - Unit: [rad]
+	 */
+	RTC::InPort<RTC::TimedDoubleSeq> m_ArmAngularSeq_InIn;
+	Spider2020::TimedArmCurrent m_ArmCurrent_In;
+	/*!
+	 * Jaco2アームのモータ負荷(固定長)
+	 * - Type: Spider2020::TimedArmCurrent
+	 * - Unit: [A]
+	 */
+	RTC::InPort<Spider2020::TimedArmCurrent> m_ArmCurrent_InIn;
+	RTC::TimedDoubleSeq m_ArmCurrentSeq_In;
+	/*!
+	 * Jaco2アームのモータ負荷(従来の配列)
+	 * - Type: TimedDoubleSeq
+	 * - Number: 9
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 * - Unit: [A]
+	 */
+	RTC::InPort<RTC::TimedDoubleSeq> m_ArmCurrentSeq_InIn;
+	Spider2020::TimedFinger m_Finger_In;
+	/*!
+	 * Jaco2アームの指の開閉具合(または変位速度)(固定長)
+	 * - Type: Spider2020::TimedFinger
+	 * - Unit: [u]
+	 */
+	RTC::InPort<Spider2020::TimedFinger> m_Finger_InIn;
+	RTC::TimedLongSeq m_FingerSeq_In;
+	/*!
+	 * Jaco2アームの指の開閉具合(または変位速度)(従来の配列)
+	 * - Type: TimedLongSeq
+	 * - Number: 3
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 * - Unit: [u]
+	 */
+	RTC::InPort<RTC::TimedLongSeq> m_FingerSeq_InIn;
+
+	// </rtc-template>
+
+
+	// DataOutPort declaration
+	// <rtc-template block="outport_declare">
+	RTC::TimedDoubleSeq m_AxisSeq_Out;
+	/*!
+	 * DualShock4コントローラの軸キーの入力具合(従来の配列)
+	 * - Type: TimedDoubleSeq
+	 * - Number: 8
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 */
+	RTC::OutPort<RTC::TimedDoubleSeq> m_AxisSeq_OutOut;
+	Spider2020::TimedAxis m_Axis_Out;
+	/*!
+	 * DualShock4コントローラの軸キーの入力具合(固定長)
+	 * - Type: Spider2020::TimedAxis
+	 */
+	RTC::OutPort<Spider2020::TimedAxis> m_Axis_OutOut;
+	RTC::TimedLongSeq m_ModeSeq_Out;
+	/*!
+	 * 動作指令の状態(従来の配列)
+	 * - Type: TimedLongSeq
+	 * - Number: 6
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 */
+	RTC::OutPort<RTC::TimedLongSeq> m_ModeSeq_OutOut;
+	Spider2020::TimedMode m_Mode_Out;
+	/*!
+	 * 動作指令の状態(固定長)
+	 * - Type: Spider2020::TimedMode
+	 */
+	RTC::OutPort<Spider2020::TimedMode> m_Mode_OutOut;
+	RTC::TimedLongSeq m_FlipperPwmSeq_Out;
+	/*!
+	 * フリッパーのPWM指令(従来の配列)
+	 * - Type: TimedLongSeq
+	 * - Number: 4
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 */
+	RTC::OutPort<RTC::TimedLongSeq> m_FlipperPwmSeq_OutOut;
+	Spider2020::TimedFlipperPwm m_FlipperPwm_Out;
+	/*!
+	 * フリッパーのPWM指令(固定長)
+	 * - Type: Spider2020::TimedFlipperPwm
+	 */
+	RTC::OutPort<Spider2020::TimedFlipperPwm> m_FlipperPwm_OutOut;
+	RTC::TimedDoubleSeq m_FlipperAngleSeq_Out;
+	/*!
+	 * フリッパーの角度(従来の配列)
+	 * - Type: TimedDoubleSeq
+	 * - Number: 4
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 * - Unit: [rad]
+	 */
+	RTC::OutPort<RTC::TimedDoubleSeq> m_FlipperAngleSeq_OutOut;
+	Spider2020::TimedFlipperAngle m_FlipperAngle_Out;
+	/*!
+	 * フリッパーの角度(固定長)
+	 * - Type: Spider2020::TimedFlipperAngle
+	 * - Unit: [rad]
+	 */
+	RTC::OutPort<Spider2020::TimedFlipperAngle> m_FlipperAngle_OutOut;
+	RTC::TimedDoubleSeq m_MotorLoadSeq_Out;
+	/*!
+	 * モータの負荷(従来の配列)
+	 * - Type: TimedDoubleSeq
+	 * - Number: 6
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 * - Unit: [A]
+	 */
+	RTC::OutPort<RTC::TimedDoubleSeq> m_MotorLoadSeq_OutOut;
+	Spider2020::TimedMotorLoad m_MotorLoad_Out;
+	/*!
+	 * モータの負荷(固定長)
+	 * - Type: Spider2020::TimedMotorLoad
+	 * - Unit: [A]
+	 */
+	RTC::OutPort<Spider2020::TimedMotorLoad> m_MotorLoad_OutOut;
+	RTC::TimedDoubleSeq m_ArmAngularSeq_Out;
+	/*!
+	 * Jaco2アームの腕の角度(従来の配列)
+	 * - Type: TimedDoubleSeq
+	 * - Number: 6
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 * - Unit: [rad]
+	 */
+	RTC::OutPort<RTC::TimedDoubleSeq> m_ArmAngularSeq_OutOut;
+	Spider2020::TimedArmAngular m_ArmAngular_Out;
+	/*!
+	 * Jaco2アームの腕の角度(固定長)
+	 * - Type: Spider2020::TimedArmAngular
+	 * - Unit: [rad]
+	 */
+	RTC::OutPort<Spider2020::TimedArmAngular> m_ArmAngular_OutOut;
+	RTC::TimedDoubleSeq m_ArmCurrentSeq_Out;
+	/*!
+	 * Jaco2アームのモータ負荷(従来の配列)
+	 * - Type: TimedDoubleSeq
+	 * - Number: 9
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 * - Unit: [A]
+	 */
+	RTC::OutPort<RTC::TimedDoubleSeq> m_ArmCurrentSeq_OutOut;
+	Spider2020::TimedArmCurrent m_ArmCurrent_Out;
+	/*!
+	 * Jaco2アームのモータ負荷(固定長)
+	 * - Type: Spider2020::TimedArmCurrent
+	 * - Unit: [A]
+	 */
+	RTC::OutPort<Spider2020::TimedArmCurrent> m_ArmCurrent_OutOut;
+	RTC::TimedLongSeq m_FingerSeq_Out;
+	/*!
+	 * Jaco2アームの指の開閉具合(または変位速度)(従来の配列)
+	 * - Type: TimedLongSeq
+	 * - Number: 3
+	 * - Semantics: Spider2020.idlのメンバの並び
+	 * - Unit: [u]
+	 */
+	RTC::OutPort<RTC::TimedLongSeq> m_FingerSeq_OutOut;
+	Spider2020::TimedFinger m_Finger_Out;
+	/*!
+	 * Jaco2アームの指の開閉具合(または変位速度)(固定長)
+	 * - Type: Spider2020::TimedFinger
+	 * - Unit: [u]
+	 */
+	RTC::OutPort<Spider2020::TimedFinger> m_Finger_OutOut;
+
+	// </rtc-template>
+
+	// CORBA Port declaration
+	// <rtc-template block="corbaport_declare">
+
+	// </rtc-template>
+
+	// Service declaration
+	// <rtc-template block="service_declare">
+
+	// </rtc-template>
+
+	// Consumer declaration
+	// <rtc-template block="consumer_declare">
+
+	// </rtc-template>
+
+private:
+	// <rtc-template block="private_attribute">
+
+	// </rtc-template>
+
+	// <rtc-template block="private_operation">
+
+	// </rtc-template>
+
+	/*!
+	 * 入力ポートの受信データを変換して出力ポートに出力する
+	 * @method Relay
+	 * @param  InPort  入力ポート
+	 * @param  stIn    入力ポートの変数
+	 * @param  OutPort 出力ポート
+	 * @param  stOut   出力ポートの変数
+	 * @return なし
+	 */
+	template <class InType, class OutType>
+	void Relay(RTC::InPort<InType> &InPort, InType &stIn, RTC::OutPort<OutType> &OutPort, OutType &stOut);
+};
+
+
+extern "C"
+{
+	DLL_EXPORT void RTC_Spider2020_BridgeInit(RTC::Manager* manager);
+};
+
+#endif // RTC_SPIDER2020_BRIDGE_H
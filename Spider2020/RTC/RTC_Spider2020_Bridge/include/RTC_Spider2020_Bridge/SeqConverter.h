@@ -0,0 +1,175 @@
+// -*- C++ -*-
+/*!
+ * @file SeqConverter.h
+ * @brief 固定長のデータ型と従来の配列の変換
+ * @date 2026/10/19
+ */
+
+#ifndef SEQ_CONVERTER_H
+#define SEQ_CONVERTER_H
+
+#include <rtm/idl/BasicDataTypeSkel.h>
+#include "Spider2020Skel.h"
+
+/*!
+ * 固定長のデータ型と従来の配列の変換
+ * @details 配列の並びはSpider2020.idlのメンバの並び(従来の各ラッパークラスの
+ *          DATA_INDEX_tの並び)とする。タイムスタンプは変換元を引き継ぐ。
+ */
+class SeqConverter
+{
+public:
+	/*!
+	 * 軸キーを従来の配列に変換する
+	 * @method Convert
+	 * @param  stIn  軸キー(固定長)
+	 * @param  [out] stOut 軸キー(従来の配列)
+	 * @retval true 成功
+	 */
+	static bool Convert(const Spider2020::TimedAxis &stIn, RTC::TimedDoubleSeq &stOut);
+
+	/*!
+	 * 従来の配列を軸キーに変換する
+	 * @method Convert
+	 * @param  stIn  軸キー(従来の配列)
+	 * @param  [out] stOut 軸キー(固定長)
+	 * @retval true 成功
+	 * @retval false 配列の長さが不一致
+	 */
+	static bool Convert(const RTC::TimedDoubleSeq &stIn, Spider2020::TimedAxis &stOut);
+
+	/*!
+	 * 動作指令の状態を従来の配列に変換する
+	 * @method Convert
+	 * @param  stIn  動作指令の状態(固定長)
+	 * @param  [out] stOut 動作指令の状態(従来の配列)
+	 * @retval true 成功
+	 */
+	static bool Convert(const Spider2020::TimedMode &stIn, RTC::TimedLongSeq &stOut);
+
+	/*!
+	 * 従来の配列を動作指令の状態に変換する
+	 * @method Convert
+	 * @param  stIn  動作指令の状態(従来の配列)
+	 * @param  [out] stOut 動作指令の状態(固定長)
+	 * @retval true 成功
+	 * @retval false 配列の長さが不一致
+	 */
+	static bool Convert(const RTC::TimedLongSeq &stIn, Spider2020::TimedMode &stOut);
+
+	/*!
+	 * フリッパーのPWM指令を従来の配列に変換する
+	 * @method Convert
+	 * @param  stIn  フリッパーのPWM指令(固定長)
+	 * @param  [out] stOut フリッパーのPWM指令(従来の配列)
+	 * @retval true 成功
+	 */
+	static bool Convert(const Spider2020::TimedFlipperPwm &stIn, RTC::TimedLongSeq &stOut);
+
+	/*!
+	 * 従来の配列をフリッパーのPWM指令に変換する
+	 * @method Convert
+	 * @param  stIn  フリッパーのPWM指令(従来の配列)
+	 * @param  [out] stOut フリッパーのPWM指令(固定長)
+	 * @retval true 成功
+	 * @retval false 配列の長さが不一致
+	 */
+	static bool Convert(const RTC::TimedLongSeq &stIn, Spider2020::TimedFlipperPwm &stOut);
+
+	/*!
+	 * フリッパーの角度を従来の配列に変換する
+	 * @method Convert
+	 * @param  stIn  フリッパーの角度(固定長)
+	 * @param  [out] stOut フリッパーの角度(従来の配列)
+	 * @retval true 成功
+	 */
+	static bool Convert(const Spider2020::TimedFlipperAngle &stIn, RTC::TimedDoubleSeq &stOut);
+
+	/*!
+	 * 従来の配列をフリッパーの角度に変換する
+	 * @method Convert
+	 * @param  stIn  フリッパーの角度(従来の配列)
+	 * @param  [out] stOut フリッパーの角度(固定長)
+	 * @retval true 成功
+	 * @retval false 配列の長さが不一致
+	 */
+	static bool Convert(const RTC::TimedDoubleSeq &stIn, Spider2020::TimedFlipperAngle &stOut);
+
+	/*!
+	 * モータの負荷を従来の配列に変換する
+	 * @method Convert
+	 * @param  stIn  モータの負荷(固定長)
+	 * @param  [out] stOut モータの負荷(従来の配列)
+	 * @retval true 成功
+	 */
+	static bool Convert(const Spider2020::TimedMotorLoad &stIn, RTC::TimedDoubleSeq &stOut);
+
+	/*!
+	 * 従来の配列をモータの負荷に変換する
+	 * @method Convert
+	 * @param  stIn  モータの負荷(従来の配列)
+	 * @param  [out] stOut モータの負荷(固定長)
+	 * @retval true 成功
+	 * @retval false 配列の長さが不一致
+	 */
+	static bool Convert(const RTC::TimedDoubleSeq &stIn, Spider2020::TimedMotorLoad &stOut);
+
+	/*!
+	 * 腕の角度を従来の配列に変換する
+	 * @method Convert
+	 * @param  stIn  腕の角度(固定長)
+	 * @param  [out] stOut 腕の角度(従来の配列)
+	 * @retval true 成功
+	 */
+	static bool Convert(const Spider2020::TimedArmAngular &stIn, RTC::TimedDoubleSeq &stOut);
+
+	/*!
+	 * 従来の配列を腕の角度に変換する
+	 * @method Convert
+	 * @param  stIn  腕の角度(従来の配列)
+	 * @param  [out] stOut 腕の角度(固定長)
+	 * @retval true 成功
+	 * @retval false 配列の長さが不一致
+	 */
+	static bool Convert(const RTC::TimedDoubleSeq &stIn, Spider2020::TimedArmAngular &stOut);
+
+	/*!
+	 * モータ負荷を従来の配列に変換する
+	 * @method Convert
+	 * @param  stIn  モータ負荷(固定長)
+	 * @param  [out] stOut モータ負荷(従来の配列)
+	 * @retval true 成功
+	 */
+	static bool Convert(const Spider2020::TimedArmCurrent &stIn, RTC::TimedDoubleSeq &stOut);
+
+	/*!
+	 * 従来の配列をモータ負荷に変換する
+	 * @method Convert
+	 * @param  stIn  モータ負荷(従来の配列)
+	 * @param  [out] stOut モータ負荷(固定長)
+	 * @retval true 成功
+	 * @retval false 配列の長さが不一致
+	 */
+	static bool Convert(const RTC::TimedDoubleSeq &stIn, Spider2020::TimedArmCurrent &stOut);
+
+	/*!
+	 * 指の開閉具合を従来の配列に変換する
+	 * @method Convert
+	 * @param  stIn  指の開閉具合(固定長)
+	 * @param  [out] stOut 指の開閉具合(従来の配列)
+	 * @retval true 成功
+	 */
+	static bool Convert(const Spider2020::TimedFinger &stIn, RTC::TimedLongSeq &stOut);
+
+	/*!
+	 * 従来の配列を指の開閉具合に変換する
+	 * @method Convert
+	 * @param  stIn  指の開閉具合(従来の配列)
+	 * @param  [out] stOut 指の開閉具合(固定長)
+	 * @retval true 成功
+	 * @retval false 配列の長さが不一致
+	 */
+	static bool Convert(const RTC::TimedLongSeq &stIn, Spider2020::TimedFinger &stOut);
+};
+
+#endif//SEQ_CONVERTER_H
@@ -0,0 +1,271 @@
+﻿// -*- C++ -*-
+/*!
+ * @file  RTC_Spider2020_Bridge.cpp
+ * @brief 固定長のデータ型と従来の配列のポートを相互に変換する
+ * @date $Date$
+ *
+ * $Id$
+ */
+
+#include "RTC_Spider2020_Bridge.h"
+
+// Module specification
+// <rtc-template block="module_spec">
+static const char* rtc_spider2020_bridge_spec[] =
+{
+	"implementation_id", "RTC_Spider2020_Bridge",
+	"type_name",         "RTC_Spider2020_Bridge",
+	"description",       "固定長のデータ型と従来の配列のポートを相互に変換する",
+	"version",           "1.0.0",
+	"vendor",            "AIZUK",
+	"category",          "Converter",
+	"activity_type",     "PERIODIC",
+	"kind",              "DataFlowComponent",
+	"max_instance",      "1",
+	"language",          "C++",
+	"lang_type",         "compile",
+
+	""
+};
+// </rtc-template>
+
+/*!
+ * @brief constructor
+ * @param manager Maneger Object
+ */
+RTC_Spider2020_Bridge::RTC_Spider2020_Bridge(RTC::Manager* manager)
+	// <rtc-template block="initializer">
+	: RTC::DataFlowComponentBase(manager)
+	, m_Axis_InIn("Axis_In", m_Axis_In)
+	, m_AxisSeq_InIn("AxisSeq_In", m_AxisSeq_In)
+	, m_Mode_InIn("Mode_In", m_Mode_In)
+	, m_ModeSeq_InIn("ModeSeq_In", m_ModeSeq_In)
+	, m_FlipperPwm_InIn("FlipperPwm_In", m_FlipperPwm_In)
+	, m_FlipperPwmSeq_InIn("FlipperPwmSeq_In", m_FlipperPwmSeq_In)
+	, m_FlipperAngle_InIn("FlipperAngle_In", m_FlipperAngle_In)
+	, m_FlipperAngleSeq_InIn("FlipperAngleSeq_In", m_FlipperAngleSeq_In)
+	, m_MotorLoad_InIn("MotorLoad_In", m_MotorLoad_In)
+	, m_MotorLoadSeq_InIn("MotorLoadSeq_In", m_MotorLoadSeq_In)
+	, m_ArmAngular_InIn("ArmAngular_In", m_ArmAngular_In)
+	, m_ArmAngularSeq_InIn("ArmAngularSeq_In", m_ArmAngularSeq_In)
+	, m_ArmCurrent_InIn("ArmCurrent_In", m_ArmCurrent_In)
+	, m_ArmCurrentSeq_InIn("ArmCurrentSeq_In", m_ArmCurrentSeq_In)
+	, m_Finger_InIn("Finger_In", m_Finger_In)
+	, m_FingerSeq_InIn("FingerSeq_In", m_FingerSeq_In)
+	, m_AxisSeq_OutOut("AxisSeq_Out", m_AxisSeq_Out)
+	, m_Axis_OutOut("Axis_Out", m_Axis_Out)
+	, m_ModeSeq_OutOut("ModeSeq_Out", m_ModeSeq_Out)
+	, m_Mode_OutOut("Mode_Out", m_Mode_Out)
+	, m_FlipperPwmSeq_OutOut("FlipperPwmSeq_Out", m_FlipperPwmSeq_Out)
+	, m_FlipperPwm_OutOut("FlipperPwm_Out", m_FlipperPwm_Out)
+	, m_FlipperAngleSeq_OutOut("FlipperAngleSeq_Out", m_FlipperAngleSeq_Out)
+	, m_FlipperAngle_OutOut("FlipperAngle_Out", m_FlipperAngle_Out)
+	, m_MotorLoadSeq_OutOut("MotorLoadSeq_Out", m_MotorLoadSeq_Out)
+	, m_MotorLoad_OutOut("MotorLoad_Out", m_MotorLoad_Out)
+	, m_ArmAngularSeq_OutOut("ArmAngularSeq_Out", m_ArmAngularSeq_Out)
+	, m_ArmAngular_OutOut("ArmAngular_Out", m_ArmAngular_Out)
+	, m_ArmCurrentSeq_OutOut("ArmCurrentSeq_Out", m_ArmCurrentSeq_Out)
+	, m_ArmCurrent_OutOut("ArmCurrent_Out", m_ArmCurrent_Out)
+	, m_FingerSeq_OutOut("FingerSeq_Out", m_FingerSeq_Out)
+	, m_Finger_OutOut("Finger_Out", m_Finger_Out)
+
+	// </rtc-template>
+{
+}
+
+/*!
+ * @brief destructor
+ */
+RTC_Spider2020_Bridge::~RTC_Spider2020_Bridge()
+{
+}
+
+RTC::ReturnCode_t RTC_Spider2020_Bridge::onInitialize()
+{
+	// Registration: InPort/OutPort/Service
+	// <rtc-template block="registration">
+	// Set InPort buffers
+	addInPort("Axis_In", m_Axis_InIn);
+	addInPort("AxisSeq_In", m_AxisSeq_InIn);
+	addInPort("Mode_In", m_Mode_InIn);
+	addInPort("ModeSeq_In", m_ModeSeq_InIn);
+	addInPort("FlipperPwm_In", m_FlipperPwm_InIn);
+	addInPort("FlipperPwmSeq_In", m_FlipperPwmSeq_InIn);
+	addInPort("FlipperAngle_In", m_FlipperAngle_InIn);
+	addInPort("FlipperAngleSeq_In", m_FlipperAngleSeq_InIn);
+	addInPort("MotorLoad_In", m_MotorLoad_InIn);
+	addInPort("MotorLoadSeq_In", m_MotorLoadSeq_InIn);
+	addInPort("ArmAngular_In", m_ArmAngular_InIn);
+	addInPort("ArmAngularSeq_In", m_ArmAngularSeq_InIn);
+	addInPort("ArmCurrent_In", m_ArmCurrent_InIn);
+	addInPort("ArmCurrentSeq_In", m_ArmCurrentSeq_InIn);
+	addInPort("Finger_In", m_Finger_InIn);
+	addInPort("FingerSeq_In", m_FingerSeq_InIn);
+
+	// Set OutPort buffer
+	addOutPort("AxisSeq_Out", m_AxisSeq_OutOut);
+	addOutPort("Axis_Out", m_Axis_OutOut);
+	addOutPort("ModeSeq_Out", m_ModeSeq_OutOut);
+	addOutPort("Mode_Out", m_Mode_OutOut);
+	addOutPort("FlipperPwmSeq_Out", m_FlipperPwmSeq_OutOut);
+	addOutPort("FlipperPwm_Out", m_FlipperPwm_OutOut);
+	addOutPort("FlipperAngleSeq_Out", m_FlipperAngleSeq_OutOut);
+	addOutPort("FlipperAngle_Out", m_FlipperAngle_OutOut);
+	addOutPort("MotorLoadSeq_Out", m_MotorLoadSeq_OutOut);
+	addOutPort("MotorLoad_Out", m_MotorLoad_OutOut);
+	addOutPort("ArmAngularSeq_Out", m_ArmAngularSeq_OutOut);
+	addOutPort("ArmAngular_Out", m_ArmAngular_OutOut);
+	addOutPort("ArmCurrentSeq_Out", m_ArmCurrentSeq_OutOut);
+	addOutPort("ArmCurrent_Out", m_ArmCurrent_OutOut);
+	addOutPort("FingerSeq_Out", m_FingerSeq_OutOut);
+	addOutPort("Finger_Out", m_Finger_OutOut);
+
+	// Set service provider to Ports
+
+	// Set service consumers to Ports
+
+	// Set CORBA Service Ports
+
+	// </rtc-template>
+
+	// <rtc-template block="bind_config">
+	// Bind variables and configuration variable
+	// </rtc-template>
+
+	return RTC::RTC_OK;
+}
+
+/*
+RTC::ReturnCode_t RTC_Spider2020_Bridge::onFinalize()
+{
+	return RTC::RTC_OK;
+}
+*/
+
+/*
+RTC::ReturnCode_t RTC_Spider2020_Bridge::onStartup(RTC::UniqueId ec_id)
+{
+	return RTC::RTC_OK;
+}
+*/
+
+/*
+RTC::ReturnCode_t RTC_Spider2020_Bridge::onShutdown(RTC::UniqueId ec_id)
+{
+	return RTC::RTC_OK;
+}
+*/
+
+/*
+RTC::ReturnCode_t RTC_Spider2020_Bridge::onActivated(RTC::UniqueId ec_id)
+{
+	return RTC::RTC_OK;
+}
+*/
+
+/*
+RTC::ReturnCode_t RTC_Spider2020_Bridge::onDeactivated(RTC::UniqueId ec_id)
+{
+	return RTC::RTC_OK;
+}
+*/
+
+RTC::ReturnCode_t RTC_Spider2020_Bridge::onExecute(RTC::UniqueId ec_id)
+{
+	// 軸キーを相互に変換して出力する
+	Relay(m_Axis_InIn, m_Axis_In, m_AxisSeq_OutOut, m_AxisSeq_Out);
+	Relay(m_AxisSeq_InIn, m_AxisSeq_In, m_Axis_OutOut, m_Axis_Out);
+
+	// 動作指令の状態を相互に変換して出力する
+	Relay(m_Mode_InIn, m_Mode_In, m_ModeSeq_OutOut, m_ModeSeq_Out);
+	Relay(m_ModeSeq_InIn, m_ModeSeq_In, m_Mode_OutOut, m_Mode_Out);
+
+	// フリッパーのPWM指令を相互に変換して出力する
+	Relay(m_FlipperPwm_InIn, m_FlipperPwm_In, m_FlipperPwmSeq_OutOut, m_FlipperPwmSeq_Out);
+	Relay(m_FlipperPwmSeq_InIn, m_FlipperPwmSeq_In, m_FlipperPwm_OutOut, m_FlipperPwm_Out);
+
+	// フリッパーの角度を相互に変換して出力する
+	Relay(m_FlipperAngle_InIn, m_FlipperAngle_In, m_FlipperAngleSeq_OutOut, m_FlipperAngleSeq_Out);
+	Relay(m_FlipperAngleSeq_InIn, m_FlipperAngleSeq_In, m_FlipperAngle_OutOut, m_FlipperAngle_Out);
+
+	// モータの負荷を相互に変換して出力する
+	Relay(m_MotorLoad_InIn, m_MotorLoad_In, m_MotorLoadSeq_OutOut, m_MotorLoadSeq_Out);
+	Relay(m_MotorLoadSeq_InIn, m_MotorLoadSeq_In, m_MotorLoad_OutOut, m_MotorLoad_Out);
+
+	// 腕の角度を相互に変換して出力する
+	Relay(m_ArmAngular_InIn, m_ArmAngular_In, m_ArmAngularSeq_OutOut, m_ArmAngularSeq_Out);
+	Relay(m_ArmAngularSeq_InIn, m_ArmAngularSeq_In, m_ArmAngular_OutOut, m_ArmAngular_Out);
+
+	// モータ負荷を相互に変換して出力する
+	Relay(m_ArmCurrent_InIn, m_ArmCurrent_In, m_ArmCurrentSeq_OutOut, m_ArmCurrentSeq_Out);
+	Relay(m_ArmCurrentSeq_InIn, m_ArmCurrentSeq_In, m_ArmCurrent_OutOut, m_ArmCurrent_Out);
+
+	// 指の開閉具合を相互に変換して出力する
+	Relay(m_Finger_InIn, m_Finger_In, m_FingerSeq_OutOut, m_FingerSeq_Out);
+	Relay(m_FingerSeq_InIn, m_FingerSeq_In, m_Finger_OutOut, m_Finger_Out);
+
+	return RTC::RTC_OK;
+}
+
+/*
+RTC::ReturnCode_t RTC_Spider2020_Bridge::onAborting(RTC::UniqueId ec_id)
+{
+	return RTC::RTC_OK;
+}
+*/
+
+/*
+RTC::ReturnCode_t RTC_Spider2020_Bridge::onError(RTC::UniqueId ec_id)
+{
+	return RTC::RTC_OK;
+}
+*/
+
+/*
+RTC::ReturnCode_t RTC_Spider2020_Bridge::onReset(RTC::UniqueId ec_id)
+{
+	return RTC::RTC_OK;
+}
+*/
+
+/*
+RTC::ReturnCode_t RTC_Spider2020_Bridge::onStateUpdate(RTC::UniqueId ec_id)
+{
+	return RTC::RTC_OK;
+}
+*/
+
+/*
+RTC::ReturnCode_t RTC_Spider2020_Bridge::onRateChanged(RTC::UniqueId ec_id)
+{
+	return RTC::RTC_OK;
+}
+*/
+
+template <class InType, class OutType>
+void RTC_Spider2020_Bridge::Relay(RTC::InPort<InType> &InPort, InType &stIn, RTC::OutPort<OutType> &OutPort, OutType &stOut)
+{
+	// 受信したデータを順に変換して出力する(タイムスタンプは入力を引き継ぐ)
+	while(InPort.isNew())
+	{
+		InPort.read();
+
+		// 配列の長さが不一致なら出力しない
+		if(!SeqConverter::Convert(stIn, stOut))
+		{
+			continue;
+		}
+
+		OutPort.write();
+	}
+}
+
+
+extern "C"
+{
+	void RTC_Spider2020_BridgeInit(RTC::Manager* manager)
+	{
+		coil::Properties profile(rtc_spider2020_bridge_spec);
+		manager->registerFactory(profile, RTC::Create<RTC_Spider2020_Bridge>, RTC::Delete<RTC_Spider2020_Bridge>);
+	}
+};
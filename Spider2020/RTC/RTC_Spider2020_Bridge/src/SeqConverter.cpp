@@ -0,0 +1,270 @@
+#include "SeqConverter.h"
+
+#define AXIS_NUM				8	/*!< 軸キーの配列数 */
+#define MODE_NUM				6	/*!< 動作指令の状態の配列数 */
+#define FLIPPER_PWM_NUM			4	/*!< フリッパーのPWM指令の配列数 */
+#define FLIPPER_ANGLE_NUM		4	/*!< フリッパーの角度の配列数 */
+#define MOTOR_LOAD_NUM			6	/*!< モータの負荷の配列数 */
+#define ARM_ANGULAR_NUM			6	/*!< 腕の角度の配列数 */
+#define ARM_CURRENT_NUM			9	/*!< モータ負荷の配列数 */
+#define FINGER_NUM				3	/*!< 指の開閉具合の配列数 */
+
+bool SeqConverter::Convert(const Spider2020::TimedAxis &stIn, RTC::TimedDoubleSeq &stOut)
+{
+	stOut.tm = stIn.tm;
+	stOut.data.length(AXIS_NUM);
+	stOut.data[0] = stIn.data.dir_vertical;
+	stOut.data[1] = stIn.data.dir_horizontal;
+	stOut.data[2] = stIn.data.lstick_vertical;
+	stOut.data[3] = stIn.data.lstick_horizontal;
+	stOut.data[4] = stIn.data.rstick_vertical;
+	stOut.data[5] = stIn.data.rstick_horizontal;
+	stOut.data[6] = stIn.data.l2;
+	stOut.data[7] = stIn.data.r2;
+
+	return true;
+}
+
+bool SeqConverter::Convert(const RTC::TimedDoubleSeq &stIn, Spider2020::TimedAxis &stOut)
+{
+	// 配列の長さが不一致なら変換しない
+	if(stIn.data.length() != AXIS_NUM)
+	{
+		return false;
+	}
+
+	stOut.tm = stIn.tm;
+	stOut.data.dir_vertical = stIn.data[0];
+	stOut.data.dir_horizontal = stIn.data[1];
+	stOut.data.lstick_vertical = stIn.data[2];
+	stOut.data.lstick_horizontal = stIn.data[3];
+	stOut.data.rstick_vertical = stIn.data[4];
+	stOut.data.rstick_horizontal = stIn.data[5];
+	stOut.data.l2 = stIn.data[6];
+	stOut.data.r2 = stIn.data[7];
+
+	return true;
+}
+
+bool SeqConverter::Convert(const Spider2020::TimedMode &stIn, RTC::TimedLongSeq &stOut)
+{
+	stOut.tm = stIn.tm;
+	stOut.data.length(MODE_NUM);
+	stOut.data[0] = stIn.data.control;
+	stOut.data[1] = stIn.data.speed_level;
+	stOut.data[2] = stIn.data.speed_max;
+	stOut.data[3] = stIn.data.flipper_select;
+	stOut.data[4] = stIn.data.flipper_status;
+	stOut.data[5] = stIn.data.crawler_pose_clear;
+
+	return true;
+}
+
+bool SeqConverter::Convert(const RTC::TimedLongSeq &stIn, Spider2020::TimedMode &stOut)
+{
+	// 配列の長さが不一致なら変換しない
+	if(stIn.data.length() != MODE_NUM)
+	{
+		return false;
+	}
+
+	stOut.tm = stIn.tm;
+	stOut.data.control = stIn.data[0];
+	stOut.data.speed_level = stIn.data[1];
+	stOut.data.speed_max = stIn.data[2];
+	stOut.data.flipper_select = stIn.data[3];
+	stOut.data.flipper_status = stIn.data[4];
+	stOut.data.crawler_pose_clear = stIn.data[5];
+
+	return true;
+}
+
+bool SeqConverter::Convert(const Spider2020::TimedFlipperPwm &stIn, RTC::TimedLongSeq &stOut)
+{
+	stOut.tm = stIn.tm;
+	stOut.data.length(FLIPPER_PWM_NUM);
+	stOut.data[0] = stIn.data.front_r;
+	stOut.data[1] = stIn.data.front_l;
+	stOut.data[2] = stIn.data.back_r;
+	stOut.data[3] = stIn.data.back_l;
+
+	return true;
+}
+
+bool SeqConverter::Convert(const RTC::TimedLongSeq &stIn, Spider2020::TimedFlipperPwm &stOut)
+{
+	// 配列の長さが不一致なら変換しない
+	if(stIn.data.length() != FLIPPER_PWM_NUM)
+	{
+		return false;
+	}
+
+	stOut.tm = stIn.tm;
+	stOut.data.front_r = stIn.data[0];
+	stOut.data.front_l = stIn.data[1];
+	stOut.data.back_r = stIn.data[2];
+	stOut.data.back_l = stIn.data[3];
+
+	return true;
+}
+
+bool SeqConverter::Convert(const Spider2020::TimedFlipperAngle &stIn, RTC::TimedDoubleSeq &stOut)
+{
+	stOut.tm = stIn.tm;
+	stOut.data.length(FLIPPER_ANGLE_NUM);
+	stOut.data[0] = stIn.data.front_r;
+	stOut.data[1] = stIn.data.front_l;
+	stOut.data[2] = stIn.data.back_r;
+	stOut.data[3] = stIn.data.back_l;
+
+	return true;
+}
+
+bool SeqConverter::Convert(const RTC::TimedDoubleSeq &stIn, Spider2020::TimedFlipperAngle &stOut)
+{
+	// 配列の長さが不一致なら変換しない
+	if(stIn.data.length() != FLIPPER_ANGLE_NUM)
+	{
+		return false;
+	}
+
+	stOut.tm = stIn.tm;
+	stOut.data.front_r = stIn.data[0];
+	stOut.data.front_l = stIn.data[1];
+	stOut.data.back_r = stIn.data[2];
+	stOut.data.back_l = stIn.data[3];
+
+	return true;
+}
+
+bool SeqConverter::Convert(const Spider2020::TimedMotorLoad &stIn, RTC::TimedDoubleSeq &stOut)
+{
+	stOut.tm = stIn.tm;
+	stOut.data.length(MOTOR_LOAD_NUM);
+	stOut.data[0] = stIn.data.main_r;
+	stOut.data[1] = stIn.data.main_l;
+	stOut.data[2] = stIn.data.sub_fr;
+	stOut.data[3] = stIn.data.sub_fl;
+	stOut.data[4] = stIn.data.sub_br;
+	stOut.data[5] = stIn.data.sub_bl;
+
+	return true;
+}
+
+bool SeqConverter::Convert(const RTC::TimedDoubleSeq &stIn, Spider2020::TimedMotorLoad &stOut)
+{
+	// 配列の長さが不一致なら変換しない
+	if(stIn.data.length() != MOTOR_LOAD_NUM)
+	{
+		return false;
+	}
+
+	stOut.tm = stIn.tm;
+	stOut.data.main_r = stIn.data[0];
+	stOut.data.main_l = stIn.data[1];
+	stOut.data.sub_fr = stIn.data[2];
+	stOut.data.sub_fl = stIn.data[3];
+	stOut.data.sub_br = stIn.data[4];
+	stOut.data.sub_bl = stIn.data[5];
+
+	return true;
+}
+
+bool SeqConverter::Convert(const Spider2020::TimedArmAngular &stIn, RTC::TimedDoubleSeq &stOut)
+{
+	stOut.tm = stIn.tm;
+	stOut.data.length(ARM_ANGULAR_NUM);
+	stOut.data[0] = stIn.data.shoulder;
+	stOut.data[1] = stIn.data.arm;
+	stOut.data[2] = stIn.data.forearm;
+	stOut.data[3] = stIn.data.wrist1;
+	stOut.data[4] = stIn.data.wrist2;
+	stOut.data[5] = stIn.data.hand;
+
+	return true;
+}
+
+bool SeqConverter::Convert(const RTC::TimedDoubleSeq &stIn, Spider2020::TimedArmAngular &stOut)
+{
+	// 配列の長さが不一致なら変換しない
+	if(stIn.data.length() != ARM_ANGULAR_NUM)
+	{
+		return false;
+	}
+
+	stOut.tm = stIn.tm;
+	stOut.data.shoulder = stIn.data[0];
+	stOut.data.arm = stIn.data[1];
+	stOut.data.forearm = stIn.data[2];
+	stOut.data.wrist1 = stIn.data[3];
+	stOut.data.wrist2 = stIn.data[4];
+	stOut.data.hand = stIn.data[5];
+
+	return true;
+}
+
+bool SeqConverter::Convert(const Spider2020::TimedArmCurrent &stIn, RTC::TimedDoubleSeq &stOut)
+{
+	stOut.tm = stIn.tm;
+	stOut.data.length(ARM_CURRENT_NUM);
+	stOut.data[0] = stIn.data.shoulder;
+	stOut.data[1] = stIn.data.arm;
+	stOut.data[2] = stIn.data.forearm;
+	stOut.data[3] = stIn.data.wrist1;
+	stOut.data[4] = stIn.data.wrist2;
+	stOut.data[5] = stIn.data.hand;
+	stOut.data[6] = stIn.data.thumb;
+	stOut.data[7] = stIn.data.index_finger;
+	stOut.data[8] = stIn.data.middle_finger;
+
+	return true;
+}
+
+bool SeqConverter::Convert(const RTC::TimedDoubleSeq &stIn, Spider2020::TimedArmCurrent &stOut)
+{
+	// 配列の長さが不一致なら変換しない
+	if(stIn.data.length() != ARM_CURRENT_NUM)
+	{
+		return false;
+	}
+
+	stOut.tm = stIn.tm;
+	stOut.data.shoulder = stIn.data[0];
+	stOut.data.arm = stIn.data[1];
+	stOut.data.forearm = stIn.data[2];
+	stOut.data.wrist1 = stIn.data[3];
+	stOut.data.wrist2 = stIn.data[4];
+	stOut.data.hand = stIn.data[5];
+	stOut.data.thumb = stIn.data[6];
+	stOut.data.index_finger = stIn.data[7];
+	stOut.data.middle_finger = stIn.data[8];
+
+	return true;
+}
+
+bool SeqConverter::Convert(const Spider2020::TimedFinger &stIn, RTC::TimedLongSeq &stOut)
+{
+	stOut.tm = stIn.tm;
+	stOut.data.length(FINGER_NUM);
+	stOut.data[0] = stIn.data.thumb;
+	stOut.data[1] = stIn.data.index_finger;
+	stOut.data[2] = stIn.data.middle_finger;
+
+	return true;
+}
+
+bool SeqConverter::Convert(const RTC::TimedLongSeq &stIn, Spider2020::TimedFinger &stOut)
+{
+	// 配列の長さが不一致なら変換しない
+	if(stIn.data.length() != FINGER_NUM)
+	{
+		return false;
+	}
+
+	stOut.tm = stIn.tm;
+	stOut.data.thumb = stIn.data[0];
+	stOut.data.index_finger = stIn.data[1];
+	stOut.data.middle_finger = stIn.data[2];
+
+	return true;
+}
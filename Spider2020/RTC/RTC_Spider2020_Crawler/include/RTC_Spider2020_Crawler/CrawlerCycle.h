@@ -0,0 +1,165 @@
+// -*- C++ -*-
+/*!
+ * @file CrawlerCycle.h
+ * @brief 台車制御の実行周期のSHボード操作
+ * @date 2026/10/19
+ */
+
+#ifndef CRAWLER_CYCLE_H
+#define CRAWLER_CYCLE_H
+
+#include <string>
+#include <sys/time.h>
+
+#include "MainMotorProcessor.h"
+#include "SubMotorProcessor.h"
+#include "SHCommunicator.h"
+#include "OrientationInterpolator.h"
+#include "MetricsRegistry.h"
+
+#define SH_BOARD_NUM	(3)		/*!< SHボードの数(SH1:メインモータ、SH2:前方サブモータ、SH3:後方サブモータ) */
+
+/*!
+ * 台車制御の実行周期のSHボード操作
+ * @details RTC_Spider2020_CrawlerのonExecuteが行うSHボードとの通信
+ *          (ポートのオープン、動作コマンドの送信、フィードバックの受信・解析、
+ *          オドメトリ、ポートのクローズ)及び非常停止の停止指令の書き込みを行う。
+ *          OpenRTMに依存しないため、ツール(AllocCheck)からも同じ処理を呼び出す。
+ *          排他制御は呼び出し元で行うこと(RTCではm_MotorMutexをロックして呼び出す)。
+ */
+class CrawlerCycle
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method CrawlerCycle
+	 * @param  MainMotor          メインモータの情報処理クラス
+	 * @param  FrontSubMotor      前方サブモータの情報処理クラス
+	 * @param  BackSubMotor       後方サブモータの情報処理クラス
+	 * @param  OrientationHistory 外部観測した姿勢の履歴
+	 */
+	CrawlerCycle(MainMotorProcessor &MainMotor, SubMotorProcessor &FrontSubMotor, SubMotorProcessor &BackSubMotor, OrientationInterpolator &OrientationHistory);
+
+	/*!
+	 * デストラクタ
+	 * @method ~CrawlerCycle
+	 */
+	virtual ~CrawlerCycle();
+
+	/*!
+	 * 性能指標を登録する
+	 * @method RegisterMetrics
+	 * @param  [in] pPrefix 性能指標の名前の接頭辞("crawler"ならば"crawler.sh1.send"等)
+	 * @return なし
+	 */
+	void RegisterMetrics(const char *pPrefix);
+
+	/*!
+	 * SHボードのデバイスを設定する
+	 * @method SetDevice
+	 * @param  [in] iBoard      SHボードの番号(0:SH1、1:SH2、2:SH3)
+	 * @param  [in] sDeviceName デバイス名
+	 * @param  [in] sBaudrate   通信速度
+	 * @return なし
+	 * @remark 実行周期で文字列を確保しないよう、活性化時に設定する
+	 */
+	void SetDevice(int iBoard, const std::string &sDeviceName, const std::string &sBaudrate);
+
+	/*!
+	 * 外部観測した姿勢及び周回数を初期化する
+	 * @method InitOrientation
+	 * @return なし
+	 */
+	void InitOrientation(void);
+
+	/*!
+	 * 外部観測した姿勢の周回数を初期化する
+	 * @method ClearOrientationCycle
+	 * @return なし
+	 */
+	void ClearOrientationCycle(void);
+
+	/*!
+	 * 外部観測した３次元の姿勢を更新し、周回数を求める
+	 * @method UpdateOrientation3D
+	 * @param  [in] dRoll  ロール角
+	 * @param  [in] dPitch ピッチ角
+	 * @param  [in] dYaw   ヨー角
+	 * @return なし
+	 */
+	void UpdateOrientation3D(double dRoll, double dPitch, double dYaw);
+
+	/*!
+	 * 全SHボードのポートをオープンして動作コマンドを送信する
+	 * @method SendMoveCommand
+	 * @param  [in] dVx        x方向の速度
+	 * @param  [in] dVy        y方向の速度
+	 * @param  [in] dVa        回転速度
+	 * @param  [in] iFrontPwmR 前方右のPWM指令
+	 * @param  [in] iFrontPwmL 前方左のPWM指令
+	 * @param  [in] iBackPwmR  後方右のPWM指令
+	 * @param  [in] iBackPwmL  後方左のPWM指令
+	 * @return なし
+	 * @remark 送信後はRecvFeedbackを呼び出すまでポートをオープンしたままとする
+	 */
+	void SendMoveCommand(double dVx, double dVy, double dVa, int32_t iFrontPwmR, int32_t iFrontPwmL, int32_t iBackPwmR, int32_t iBackPwmL);
+
+	/*!
+	 * 直前のSendMoveCommandで動作コマンドを送信できたか
+	 * @method IsSent
+	 * @param  [in] iBoard SHボードの番号(0:SH1、1:SH2、2:SH3)
+	 * @retval true 送信成功
+	 * @retval false 未送信(オープン失敗、送信失敗)
+	 */
+	bool IsSent(int iBoard) const;
+
+	/*!
+	 * 全SHボードのフィードバックを受信・解析してオドメトリを求め、ポートをクローズする
+	 * @method RecvFeedback
+	 * @param  [in] dFrequency         実行周期 [s]
+	 * @param  [in] dVx                x方向の速度
+	 * @param  [in] dVy                y方向の速度
+	 * @param  [in] dVa                回転速度
+	 * @param  [in] lUseOrientation3D  外部観測した姿勢の使用方法(0:不使用、1:最新値、2:履歴から補間)
+	 * @retval true 成功
+	 * @retval false いずれかのSHボードのフィードバックの解析に失敗
+	 */
+	bool RecvFeedback(double dFrequency, double dVx, double dVy, double dVa, long lUseOrientation3D);
+
+	/*!
+	 * 全SHボードに停止指令を書き込む
+	 * @method SendStopCommand
+	 * @retval true 全SHボードへの書き込みに成功
+	 * @retval false いずれかのSHボードへの書き込みに失敗
+	 * @remark SendMoveCommandからRecvFeedbackまでの間(フィードバック待ち)は
+	 *         オープン中のポートから書き込み、そのSHボードのフィードバックを破棄する
+	 */
+	bool SendStopCommand(void);
+
+private:
+	MainMotorProcessor &m_MainMotor;				/*!< メインモータの情報処理クラス			*/
+	SubMotorProcessor &m_FrontSubMotor;				/*!< 前方サブモータの情報処理クラス			*/
+	SubMotorProcessor &m_BackSubMotor;				/*!< 後方サブモータの情報処理クラス			*/
+	OrientationInterpolator &m_OrientationHistory;	/*!< 外部観測した姿勢の履歴					*/
+
+	SHCommunicator m_SHDevice[SH_BOARD_NUM];		/*!< 実行周期でオープンしたSHボード			*/
+	std::string m_sDeviceName[SH_BOARD_NUM];		/*!< SHボードのデバイス名					*/
+	std::string m_sBaudrate[SH_BOARD_NUM];			/*!< SHボードのボーレート					*/
+	bool m_bSent[SH_BOARD_NUM];						/*!< 動作コマンドを送信できたか				*/
+	bool m_bStopSent[SH_BOARD_NUM];					/*!< フィードバック待ちの間に停止指令を書き込んだか	*/
+	struct timeval m_stFeedbackTime;				/*!< メインモータのフィードバック時刻		*/
+
+	double m_dOrientationR;							/*!< 外部観測した姿勢(ロール)				*/
+	double m_dOrientationP;							/*!< 外部観測した姿勢(ピッチ)				*/
+	double m_dOrientationY;							/*!< 外部観測した姿勢(ヨー)					*/
+	long m_lRollCycle;								/*!< 外部観測した姿勢(ロール)の周回数		*/
+	long m_lPitchCycle;								/*!< 外部観測した姿勢(ピッチ)の周回数		*/
+	long m_lYawCycle;								/*!< 外部観測した姿勢(ヨー)の周回数			*/
+
+	MetricHistogram m_SendMetric[SH_BOARD_NUM];		/*!< SHボード毎の送信時間 [ns]			*/
+	MetricHistogram m_RecvMetric[SH_BOARD_NUM];		/*!< SHボード毎の受信時間 [ns]			*/
+	MetricCounter m_WriteErrorMetric[SH_BOARD_NUM];	/*!< SHボード毎の送信エラー数			*/
+	MetricCounter m_ParseErrorMetric[SH_BOARD_NUM];	/*!< SHボード毎のフィードバックの解析エラー数	*/
+};
+
+#endif//CRAWLER_CYCLE_H
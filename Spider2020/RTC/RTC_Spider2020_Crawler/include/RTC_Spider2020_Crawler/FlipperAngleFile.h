@@ -0,0 +1,79 @@
+// -*- C++ -*-
+/*!
+ * @file FlipperAngleFile.h
+ * @brief フリッパーの角度の保存ファイル
+ * @date 2026/10/19
+ */
+
+#ifndef FLIPPER_ANGLE_FILE_H
+#define FLIPPER_ANGLE_FILE_H
+
+#include <limits.h>
+
+/*!
+ * フリッパーの角度の保存ファイル
+ * @details 書式は"前方右:前方左:後方右:後方左"の１行とする。
+ *          保存(Save)は実行周期から呼び出すため、パスは事前にSetPathで作成し、
+ *          保存時にはヒープを確保しない。
+ */
+class FlipperAngleFile
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method FlipperAngleFile
+	 */
+	FlipperAngleFile();
+
+	/*!
+	 * デストラクタ
+	 * @method ~FlipperAngleFile
+	 */
+	virtual ~FlipperAngleFile();
+
+	/*!
+	 * 保存ファイルのパスを設定する
+	 * @method SetPath
+	 * @param  [in] pDir      保存先のディレクトリ(NULLの場合はカレントディレクトリ)
+	 * @param  [in] pFileName 保存ファイル名
+	 * @retval true 成功
+	 * @retval false 失敗(パスが長すぎる)
+	 */
+	bool SetPath(const char *pDir, const char *pFileName);
+
+	/*!
+	 * 保存ファイルのパスを取得する
+	 * @method GetPath
+	 * @return 保存ファイルのパス
+	 */
+	const char* GetPath(void) const;
+
+	/*!
+	 * フリッパーの角度を読み込む
+	 * @method Load
+	 * @param  [out] dFrontR 前方右の角度
+	 * @param  [out] dFrontL 前方左の角度
+	 * @param  [out] dBackR  後方右の角度
+	 * @param  [out] dBackL  後方左の角度
+	 * @retval true 成功
+	 * @retval false 失敗(保存データなし、書式不正)
+	 */
+	bool Load(double &dFrontR, double &dFrontL, double &dBackR, double &dBackL) const;
+
+	/*!
+	 * フリッパーの角度を保存する
+	 * @method Save
+	 * @param  [in] dFrontR 前方右の角度
+	 * @param  [in] dFrontL 前方左の角度
+	 * @param  [in] dBackR  後方右の角度
+	 * @param  [in] dBackL  後方左の角度
+	 * @retval true 成功
+	 * @retval false 失敗
+	 */
+	bool Save(double dFrontR, double dFrontL, double dBackR, double dBackL) const;
+
+private:
+	char m_szPath[PATH_MAX];	/*!< 保存ファイルのパス	*/
+};
+
+#endif//FLIPPER_ANGLE_FILE_H
@@ -10,6 +10,7 @@
 #define MAIN_MOTOR_PROCESSOR_H
 
 #include "Motor.h"
+#include <stddef.h>
 #include <string>
 
 /*!
@@ -50,16 +51,32 @@ public:
 	 * @param  [in] dVx            目標の２次元の並進速度(X)
 	 * @param  [in] dVy            目標の２次元の並進速度(Y)
 	 * @param  [in] dVa            目標の２次元の回転速度
-	 * @return 動作コマンド
+	 * @param  [out] pCommand      動作コマンドの格納先(NUL終端する)
+	 * @param  [in] sizeCommand    格納先のサイズ
+	 * @return 動作コマンドの長さ(格納先に収まらない場合は0)
 	 */
-	std::string GenMoveCommand(double dVx, double dVy, double dVa);
+	size_t GenMoveCommand(double dVx, double dVy, double dVa, char *pCommand, size_t sizeCommand);
+
+	/*!
+	 * PID速度制御でメインモータのPWMを求める(GenMoveCommandの文字列化の前段)
+	 * @method CalcMovePwm
+	 * @param  [in] dVx            目標の２次元の並進速度(X)
+	 * @param  [in] dVy            目標の２次元の並進速度(Y)
+	 * @param  [in] dVa            目標の２次元の回転速度
+	 * @param  [out] dPwmR         右モータに要求するPWM(回転方向を反映済み)
+	 * @param  [out] dPwmL         左モータに要求するPWM(回転方向を反映済み)
+	 * @return なし
+	 */
+	void CalcMovePwm(double dVx, double dVy, double dVa, double &dPwmR, double &dPwmL);
 
 	/*!
 	 * メインモータの停止の動作コマンドを生成する
 	 * @method GenStopCommand
-	 * @return 動作コマンド
+	 * @param  [out] pCommand      動作コマンドの格納先(NUL終端する)
+	 * @param  [in] sizeCommand    格納先のサイズ
+	 * @return 動作コマンドの長さ(格納先に収まらない場合は0)
 	 */
-	std::string GenStopCommand(void);
+	size_t GenStopCommand(char *pCommand, size_t sizeCommand);
 
 	/*!
 	 * フィードバックを解析する
@@ -68,9 +85,26 @@ public:
 	 * @param  [in] dVx            目標の２次元の並進速度(X)
 	 * @param  [in] dVy            目標の２次元の並進速度(Y)
 	 * @param  [in] dVa            目標の２次元の回転速度
-	 * @param  [in] sFeedback       フィードバック文字列
+	 * @param  [in] pFeedback       フィードバック文字列(NUL終端)
+	 */
+	bool AnalyzeFeedback(double dFrequency, double dVx, double dVy, double dVa, const char *pFeedback);
+
+	/*!
+	 * 解析済みのフィードバックを処理する(AnalyzeFeedbackの解析の後段)
+	 * @method ApplyFeedback
+	 * @param  [in] dFrequency     周期
+	 * @param  [in] dVx            目標の２次元の並進速度(X)
+	 * @param  [in] dVy            目標の２次元の並進速度(Y)
+	 * @param  [in] dVa            目標の２次元の回転速度
+	 * @param  [in] iPulseCountR   右モータのパルスカウント
+	 * @param  [in] iPulseCountL   左モータのパルスカウント
+	 * @param  [in] dVelocityMdR   右モータの回転数
+	 * @param  [in] dLoadR         右モータの負荷電圧
+	 * @param  [in] dVelocityMdL   左モータの回転数
+	 * @param  [in] dLoadL         左モータの負荷電圧
+	 * @return なし
 	 */
-	bool AnalyzeFeedback(double dFrequency, double dVx, double dVy, double dVa, std::string sFeedback);
+	void ApplyFeedback(double dFrequency, double dVx, double dVy, double dVa, int iPulseCountR, int iPulseCountL, double dVelocityMdR, double dLoadR, double dVelocityMdL, double dLoadL);
 
 	/*!
 	 * モータの回転から２次元の位置姿勢を求める
@@ -13,6 +13,7 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 // Service implementation headers
 // <rtc-template block="service_impl_h">
@@ -23,6 +24,7 @@
 // <rtc-template block="consumer_stub_h">
 #include "BasicDataTypeStub.h"
 #include "ExtendedDataTypesStub.h"
+#include "Spider2020Stub.h"
 
 // </rtc-template>
 
@@ -38,9 +40,19 @@
 #include "FlipperPwmWrapper.h"
 #include "ModeWrapper.h"
 #include "MotorLoadWrapper.h"
+#include "OrientationHistoryWrapper.h"
+#include "LatencyTrace.h"
+#include "InputEventListener.h"
+#include "LatestReader.h"
+#include "MetricsRegistry.h"
+
+#include <mutex>
 
 #include "MainMotorProcessor.h"
 #include "SubMotorProcessor.h"
+#include "CrawlerCycle.h"
+#include "FlipperAngleFile.h"
+#include "OrientationInterpolator.h"
 
 /*!
  * @class RTC_Spider2020_Crawler
@@ -231,6 +243,51 @@ public:
 	 */
 	void ReadFlipperPwm(void);
 
+	/*!
+	 * 入力の起点の時刻を記録する
+	 * @method TraceInput
+	 * @param  tm 入力のタイムスタンプ(起点の時刻)
+	 * @return なし
+	 * @remark ２次元の速度とPWM指令は同じ起点の時刻で届くため、新しい起点のみ記録する
+	 */
+	void TraceInput(const RTC::Time &tm);
+
+	/*!
+	 * SHボードへの書き込み完了時刻を記録する
+	 * @method TraceSend
+	 * @param  tm 書き込んだ指令のタイムスタンプ(起点の時刻)
+	 * @return なし
+	 * @remark 新しい起点の最初の書き込みのみ記録する
+	 */
+	void TraceSend(const RTC::Time &tm);
+
+	/*!
+	 * 非常停止の要求を受信した時に呼び出される
+	 * @method OnEmergencyStopReceived
+	 * @param  data 受信した非常停止の要求
+	 * @return なし
+	 * @remark ORBのスレッドから呼び出される
+	 */
+	void OnEmergencyStopReceived(const RTC::TimedBoolean &data);
+
+	/*!
+	 * 非常停止の要求をポートから読み込む
+	 * @method ReadEmergencyStop
+	 * @return なし
+	 * @remark m_MotorMutexをロックして呼び出すこと
+	 */
+	void ReadEmergencyStop(void);
+
+	/*!
+	 * 非常停止の要求を反映する
+	 * @method ApplyEmergencyStop
+	 * @param  data 非常停止の要求
+	 * @return なし
+	 * @remark m_MotorMutexをロックして呼び出すこと
+	 *         最後に反映した要求より古いタイムスタンプの要求は無視する
+	 */
+	void ApplyEmergencyStop(const RTC::TimedBoolean &data);
+
 	/*!
 	 * 外部観測した３次元の姿勢をポートから読み込む
 	 * @method ReadOrientation3D
@@ -238,6 +295,13 @@ public:
 	 */
 	void ReadOrientation3D(void);
 
+	/*!
+	 * 時刻付き３次元の姿勢の履歴をポートから読み込む
+	 * @method ReadOrientation3DHistory
+	 * @return なし
+	 */
+	void ReadOrientation3DHistory(void);
+
 	/*!
 	 * オドメトリによる３次元の位置姿勢をポートに出力する
 	 * @method WritePose3D
@@ -270,7 +334,7 @@ public:
 	 * フリッパーの角度を読み込む
 	 * @method LoadFlipperAngle
 	 * @return なし
-	 * @note 保存先: ~/.FlipperAngle.txt
+	 * @note 保存先: ~/.FlipperAngle.txt (保存先のパスもここで作成する)
 	 */
 	void LoadFlipperAngle(void);
 
@@ -278,7 +342,7 @@ public:
 	 * フリッパーの角度を保存する
 	 * @method SaveFlipperAngle
 	 * @return なし
-	 * @note 保存先: ~/.FlipperAngle.txt
+	 * @note 保存先: ~/.FlipperAngle.txt (実行周期から呼び出すため、ヒープを確保しない)
 	 */
 	void SaveFlipperAngle(void);
 
@@ -474,41 +538,90 @@ protected:
 	/*!
 	 * 0: オドメトリの処理に外部観測した３次元の姿勢を使用しない。
 	 * 1: オドメトリの処理に外部観測した３次元の姿勢を使用する。
+	 * 2: オドメトリの処理に時刻付き３次元の姿勢の履歴から
+	 *    モータのフィードバック時刻の姿勢を補間して使用する。
 	 * - Name: 外部観測した３次元の姿勢 USE_ORIENTATION3D_IN
 	 * - DefaultValue: 0
 	 */
 	long int m_USE_ORIENTATION3D_IN;
+	/*!
+	 * 1: ２次元の速度及びフリッパーのPWM指令のタイムスタンプを起点の
+	 * 時刻とし、入力とSHボードへの書き込み完了の時刻を共有メモリの
+	 * トレースバッファに記録する。
+	 * - Name: 遅延計測のトレースを記録するか TRACE_ENABLE
+	 * - DefaultValue: 0
+	 * - Constraint: 0: 記録しない
+	 *               1: 記録する
+	 */
+	long m_TRACE_ENABLE;
+	/*!
+	 * 実行コンテキストのスレッドの優先度。1～99はSCHED_FIFOの優先度で実行し、
+	 * 0は通常のスケジューリング(SCHED_OTHER)で実行する。
+	 * - Name: 実行コンテキストの優先度 RT_PRIORITY
+	 * - DefaultValue: 0
+	 * - Constraint: 0: SCHED_OTHER
+	 *               1～99: SCHED_FIFOの優先度
+	 */
+	long m_RT_PRIORITY;
+	/*!
+	 * 実行コンテキストのスレッドを割り当てるCPU("0"、"2-3"、"0,2"の形式)。
+	 * ALLは割り当てを変更しない。
+	 * - Name: 実行コンテキストのCPUアフィニティ RT_CPU_AFFINITY
+	 * - DefaultValue: ALL
+	 */
+	std::string m_RT_CPU_AFFINITY;
 
 	// </rtc-template>
 
 	// DataInPort declaration
 	// <rtc-template block="inport_declare">
-	RTC::TimedLongSeq m_Mode_In;
+	Spider2020::TimedMode m_Mode_In;
 	/*!
 	 * 動作指令の状態
-	 * - Type: TimedLongSeq
-	 * - Number: 6
+	 * - Type: Spider2020::TimedMode
 	 */
-	RTC::InPort<RTC::TimedLongSeq> m_Mode_InIn;
+	RTC::InPort<Spider2020::TimedMode> m_Mode_InIn;
 	RTC::TimedVelocity2D m_Velocity2D_In;
 	/*!
 	 * ２次元の速度
 	 * - Type: TimedVelocity2D
 	 */
 	RTC::InPort<RTC::TimedVelocity2D> m_Velocity2D_InIn;
-	RTC::TimedLongSeq m_FlipperPwm_In;
+	Spider2020::TimedFlipperPwm m_FlipperPwm_In;
 	/*!
 	 * フリッパーのPWM指令
-	 * - Type: TimedLongSeq
-	 * - Number: 4
+	 * - Type: Spider2020::TimedFlipperPwm
 	 */
-	RTC::InPort<RTC::TimedLongSeq> m_FlipperPwm_InIn;
+	RTC::InPort<Spider2020::TimedFlipperPwm> m_FlipperPwm_InIn;
 	RTC::TimedOrientation3D m_Orientation3D_In;
 	/*!
 	 * 外部観測した３次元の姿勢
 	 * - Type: TimedOrientation3D
 	 */
 	RTC::InPort<RTC::TimedOrientation3D> m_Orientation3D_InIn;
+	RTC::TimedDoubleSeq m_Orientation3DHistory_In;
+	/*!
+	 * 時刻付き３次元の姿勢の履歴
+	 * - Type: TimedDoubleSeq
+	 * - Number: 4×サンプル数
+	 * - Semantics: [4n+0]: 時刻 [s]
+	 *              [4n+1]: ロール角
+	 *              [4n+2]: ピッチ角
+	 *              [4n+3]: ヨー角
+	 * - Unit: [s,rad]
+	 */
+	RTC::InPort<RTC::TimedDoubleSeq> m_Orientation3DHistory_InIn;
+	RTC::TimedBoolean m_EmergencyStop_In;
+	/*!
+	 * 非常停止の要求
+	 * - Type: TimedBoolean
+	 * - Semantics: true: 非常停止中
+	 *              false: 通常
+	 *              受信時(push型の接続)に直ちに全SHボードに停止指令を書き込み、
+	 *              解除されるまで速度及びPWM指令を０にする。
+	 *              タイムスタンプは要求の起点の時刻。
+	 */
+	RTC::InPort<RTC::TimedBoolean> m_EmergencyStop_InIn;
 
 	// </rtc-template>
 
@@ -528,31 +641,29 @@ protected:
 	 * - Type: TimedVelocity2D
 	 */
 	RTC::OutPort<RTC::TimedVelocity2D> m_Velocity2D_OutOut;
-	RTC::TimedDoubleSeq m_FlipperAngle_Out;
+	Spider2020::TimedFlipperAngle m_FlipperAngle_Out;
 	/*!
 	 * フリッパーの角度
-	 * - Type: TimedDoubleSeq
-	 * - Number: 4
-	 * - Semantics: [0]: 右前
-	 *              [1]: 左前
-	 *              [2]: 右後
-	 *              [3]: 左後
+	 * - Type: Spider2020::TimedFlipperAngle
+	 * - Semantics: front_r: 右前
+	 *              front_l: 左前
+	 *              back_r:  右後
+	 *              back_l:  左後
 	 */
-	RTC::OutPort<RTC::TimedDoubleSeq> m_FlipperAngle_OutOut;
-	RTC::TimedDoubleSeq m_MotorLoad_Out;
+	RTC::OutPort<Spider2020::TimedFlipperAngle> m_FlipperAngle_OutOut;
+	Spider2020::TimedMotorLoad m_MotorLoad_Out;
 	/*!
 	 * 各モータの負荷
-	 * - Type: TimedDoubleSeq
-	 * - Number: 6
-	 * - Semantics: [0]: 右メインモータ
-	 *              [1]: 左メインモータ
-	 *              [2]: 右前方サブモータ
-	 *              [3]: 左前方サブモータ
-	 *              [4]: 右後方サブモータ
-	 *              [5]: 左後方サブモータ
+	 * - Type: Spider2020::TimedMotorLoad
+	 * - Semantics: main_r: 右メインモータ
+	 *              main_l: 左メインモータ
+	 *              sub_fr: 右前方サブモータ
+	 *              sub_fl: 左前方サブモータ
+	 *              sub_br: 右後方サブモータ
+	 *              sub_bl: 左後方サブモータ
 	 * - Unit: [A]
 	 */
-	RTC::OutPort<RTC::TimedDoubleSeq> m_MotorLoad_OutOut;
+	RTC::OutPort<Spider2020::TimedMotorLoad> m_MotorLoad_OutOut;
 
 	// </rtc-template>
 
@@ -584,10 +695,19 @@ private:
 	FlipperPwmWrapper m_FlipperPwm_InWrap;			/*!< m_FlipperPwm_Inのラッパークラス	*/
 	FlipperAngleWrapper m_FlipperAngle_OutWrap;		/*!< m_FlipperAngle_Outのラッパークラス	*/
 	MotorLoadWrapper m_MotorLoad_OutWrap;			/*!< m_MotorLoad_Outのラッパークラス	*/
+	OrientationHistoryWrapper m_Orientation3DHistory_InWrap;	/*!< m_Orientation3DHistory_Inのラッパークラス	*/
+
+	LatestReader<Spider2020::TimedMode> m_Mode_InReader;				/*!< m_Mode_InInの最新データの読み込み			*/
+	LatestReader<RTC::TimedVelocity2D> m_Velocity2D_InReader;			/*!< m_Velocity2D_InInの最新データの読み込み	*/
+	LatestReader<Spider2020::TimedFlipperPwm> m_FlipperPwm_InReader;	/*!< m_FlipperPwm_InInの最新データの読み込み	*/
+	LatestReader<RTC::TimedOrientation3D> m_Orientation3D_InReader;		/*!< m_Orientation3D_InInの最新データの読み込み	*/
 
 	MainMotorProcessor m_MainMotorProcessor;		/*!< メインモータの情報処理クラス		*/
 	SubMotorProcessor m_FrontSubMotorProcessor;		/*!< 前方サブモータの情報処理クラス		*/
 	SubMotorProcessor m_BackSubMotorProcessor;		/*!< 後方サブモータの情報処理クラス		*/
+	OrientationInterpolator m_OrientationHistory;	/*!< 外部観測した姿勢の履歴				*/
+	FlipperAngleFile m_FlipperAngleFile;			/*!< フリッパー角度保存ファイル			*/
+	CrawlerCycle m_CrawlerCycle;					/*!< 実行周期のSHボード操作(m_MotorMutexで保護)	*/
 
 	struct timeval m_stTimeval;						/*!< 実行時刻							*/
 
@@ -595,9 +715,18 @@ private:
 	struct timeval m_stVelocity2DReadTime;			/*!< m_Velocity2D_Inの入力時刻			*/
 	struct timeval m_stFlipperPwmReadTime;			/*!< m_FlipperPwm_Inの入力時刻			*/
 
-	long m_lRollCycle;								/*!< 外部観測した姿勢(ロール)の周回数	*/
-	long m_lPitchCycle;								/*!< 外部観測した姿勢(ピッチ)の周回数	*/
-	long m_lYawCycle;								/*!< 外部観測した姿勢(ヨー)の周回数		*/
+	LatencyTrace m_Trace;							/*!< 遅延計測のトレースバッファ			*/
+	int64_t m_iTraceInputNs;						/*!< 最後に入力を記録した起点の時刻 [ns]	*/
+	int64_t m_iTraceSendNs;							/*!< 最後に書き込みを記録した起点の時刻 [ns]	*/
+
+	MetricHistogram m_CyclePeriodMetric;			/*!< 実行周期 [ns]						*/
+	MetricHistogram m_ExecuteTimeMetric;			/*!< onExecuteの処理時間 [ns]			*/
+
+	std::mutex m_MotorMutex;						/*!< 非常停止と実行周期のSHボード操作の排他制御	*/
+	bool m_bActive;									/*!< アクティブ状態か					*/
+	bool m_bEmergencyStop;							/*!< 非常停止中か						*/
+	int64_t m_iEStopStateNs;						/*!< 最後に反映した非常停止の要求の時刻 [ns]	*/
+	double m_dEStopLatencyMax;						/*!< 非常停止の遅延の最大値 [s]			*/
 
 };
 
@@ -9,11 +9,20 @@
 #ifndef SH_COMMUNICATOR_H
 #define SH_COMMUNICATOR_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string>
 
 typedef uint8_t BYTE;
 
+/*! @name シリアル通信設定
+ *	シリアル通信の文字バッファサイズ
+ */
+/*  @{ */
+#define SEND_BUFF_MAX	(256)		/*!< シリアル通信の送信文字バッファサイズ	*/
+#define RECV_BUFF_MAX	(256)		/*!< シリアル通信の受信文字バッファサイズ	*/
+/* @} */
+
 /*!
  * SHマイコンとの通信クラス
  */
@@ -37,10 +46,13 @@ public:
 	 * @method Open
 	 * @param  sDeviceName デバイス名
 	 * @param  sBaudrate 通信速度
+	 * @param  bFlush 受信バッファをクリアするか
 	 * @retval true 成功
 	 * @retval false 失敗
+	 * @remark 他のインスタンスが応答を待っているポートを開く場合は、
+	 *         応答を破棄しないようbFlushをfalseにする
 	 */
-	bool Open(const std::string &sDeviceName, const std::string &sBaudrate);
+	bool Open(const std::string &sDeviceName, const std::string &sBaudrate, bool bFlush = true);
 
 	/*!
 	 * シリアルポートのオープン状態をチェックする
@@ -60,20 +72,24 @@ public:
 	/*!
 	 * 文字列を送信する
 	 * @method Send
-	 * @param  sData 送信文字列
+	 * @param  pData 送信文字列
+	 * @param  sizeData 送信文字列の長さ
 	 * @retval true 成功
 	 * @retval false 失敗
-	 * @attensition 送信文字列の最大長は256
+	 * @attensition 送信文字列の最大長はSEND_BUFF_MAX-1
 	 */
-	bool Send(const std::string &sData);
+	bool Send(const char *pData, size_t sizeData);
 
 	/*!
 	 * 文字列を受信する
 	 * @method Recv
-	 * @return 受信文字列
-	 * @attensition 受信文字列の最大長は256
+	 * @param  [out] pBuff 受信文字列の格納先(NUL終端する)
+	 * @param  sizeBuff 格納先のサイズ(RECV_BUFF_MAX+1以上とする)
+	 * @return 受信文字列の長さ(NUL文字の手前まで、失敗した場合は0)
+	 * @attensition 受信文字列の最大長はRECV_BUFF_MAX
+	 * @remark 実行周期から呼び出すため、ヒープを確保しない
 	 */
-	std::string Recv(void);
+	size_t Recv(char *pBuff, size_t sizeBuff);
 
 private:
 	int m_fd;		/*!< ファイルディスクリプタ			*/
@@ -10,6 +10,7 @@
 #define SUB_MOTOR_PROCESSOR_H
 
 #include "Motor.h"
+#include <stddef.h>
 #include <string>
 
 /*!
@@ -49,26 +50,44 @@ public:
 	 * @method GetMoveCommand
 	 * @param  [in] iPwmR 右モータのPWM指令値
 	 * @param  [in] iPwmL 左モータのPWM指令値
-	 * @return 動作コマンド
+	 * @param  [out] pCommand 動作コマンドの格納先(NUL終端する)
+	 * @param  [in] sizeCommand 格納先のサイズ
+	 * @return 動作コマンドの長さ(格納先に収まらない場合は0)
 	 */
-	std::string GenMoveCommand(int32_t iPwmR, int32_t iPwmL);
+	size_t GenMoveCommand(int32_t iPwmR, int32_t iPwmL, char *pCommand, size_t sizeCommand);
 
 	/*!
 	 * サブモータの停止の動作コマンドを生成する
 	 * @method GenStopCommand
-	 * @return 動作コマンド
+	 * @param  [out] pCommand 動作コマンドの格納先(NUL終端する)
+	 * @param  [in] sizeCommand 格納先のサイズ
+	 * @return 動作コマンドの長さ(格納先に収まらない場合は0)
 	 */
-	std::string GenStopCommand(void);
+	size_t GenStopCommand(char *pCommand, size_t sizeCommand);
 
 	/*!
 	 * フィードバックを解析する
 	 * @method AnalyzeFeedback
 	 * @param  [in] dFrequency      周期
-	 * @param  [in] sFeedback       フィードバック文字列
+	 * @param  [in] pFeedback       フィードバック文字列(NUL終端)
 	 * @retval true フィードバック解析成功
 	 * @retval false  フィードバック解析失敗
 	 */
-	bool AnalyzeFeedback(double dFrequency, std::string sFeedback);
+	bool AnalyzeFeedback(double dFrequency, const char *pFeedback);
+
+	/*!
+	 * 解析済みのフィードバックを処理する(AnalyzeFeedbackの解析の後段)
+	 * @method ApplyFeedback
+	 * @param  [in] dFrequency      周期
+	 * @param  [in] iPulseCountR    右モータのパルスカウント
+	 * @param  [in] iPulseCountL    左モータのパルスカウント
+	 * @param  [in] dVelocityMdR    右モータの回転数
+	 * @param  [in] dLoadR          右モータの負荷電圧
+	 * @param  [in] dVelocityMdL    左モータの回転数
+	 * @param  [in] dLoadL          左モータの負荷電圧
+	 * @return なし
+	 */
+	void ApplyFeedback(double dFrequency, int iPulseCountR, int iPulseCountL, double dVelocityMdR, double dLoadR, double dVelocityMdL, double dLoadL);
 
 	/*!
 	 * 右サブモータのコンフィグレーションを設定する
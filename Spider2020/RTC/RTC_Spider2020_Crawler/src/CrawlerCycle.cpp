@@ -0,0 +1,300 @@
+#include "CrawlerCycle.h"
+#include <math.h>
+#include <stdio.h>
+
+#define DEG_TO_RAD(x)	((M_PI/180)*(x))
+#define CYCLE_THRESHOLD (DEG_TO_RAD(180))	/*!< 外部観測した姿勢の周回判定閾値 */
+
+CrawlerCycle::CrawlerCycle(MainMotorProcessor &MainMotor, SubMotorProcessor &FrontSubMotor, SubMotorProcessor &BackSubMotor, OrientationInterpolator &OrientationHistory)
+	: m_MainMotor(MainMotor)
+	, m_FrontSubMotor(FrontSubMotor)
+	, m_BackSubMotor(BackSubMotor)
+	, m_OrientationHistory(OrientationHistory)
+	, m_bSent()
+	, m_bStopSent()
+	, m_stFeedbackTime({0})
+	, m_dOrientationR(0.0)
+	, m_dOrientationP(0.0)
+	, m_dOrientationY(0.0)
+	, m_lRollCycle(0)
+	, m_lPitchCycle(0)
+	, m_lYawCycle(0)
+{
+}
+
+CrawlerCycle::~CrawlerCycle()
+{
+}
+
+void CrawlerCycle::RegisterMetrics(const char *pPrefix)
+{
+	char szName[METRICS_NAME_LEN];
+
+	for(int i = 0; i < SH_BOARD_NUM; i++)
+	{
+		snprintf(szName, sizeof(szName), "%s.sh%d.send", pPrefix, i + 1);
+		m_SendMetric[i].Register(szName);
+		snprintf(szName, sizeof(szName), "%s.sh%d.recv", pPrefix, i + 1);
+		m_RecvMetric[i].Register(szName);
+		snprintf(szName, sizeof(szName), "%s.sh%d.write_error", pPrefix, i + 1);
+		m_WriteErrorMetric[i].Register(szName);
+		snprintf(szName, sizeof(szName), "%s.sh%d.parse_error", pPrefix, i + 1);
+		m_ParseErrorMetric[i].Register(szName);
+	}
+}
+
+void CrawlerCycle::SetDevice(int iBoard, const std::string &sDeviceName, const std::string &sBaudrate)
+{
+	if((iBoard < 0) || (SH_BOARD_NUM <= iBoard))
+	{
+		return;
+	}
+	m_sDeviceName[iBoard] = sDeviceName;
+	m_sBaudrate[iBoard] = sBaudrate;
+}
+
+void CrawlerCycle::InitOrientation(void)
+{
+	// 外部観測した姿勢を初期化する
+	m_dOrientationR = 0.0;
+	m_dOrientationP = 0.0;
+	m_dOrientationY = 0.0;
+
+	// 外部観測した姿勢の周回数を初期化する
+	ClearOrientationCycle();
+}
+
+void CrawlerCycle::ClearOrientationCycle(void)
+{
+	m_lRollCycle = 0;
+	m_lPitchCycle = 0;
+	m_lYawCycle = 0;
+}
+
+void CrawlerCycle::UpdateOrientation3D(double dRoll, double dPitch, double dYaw)
+{
+	double dDiffR = 0.0;
+	double dDiffP = 0.0;
+	double dDiffY = 0.0;
+
+	// ロールの周回を更新する
+	dDiffR = dRoll - m_dOrientationR;
+	if(dDiffR < -CYCLE_THRESHOLD)
+	{
+		m_lRollCycle++;
+	}
+	else if(CYCLE_THRESHOLD < dDiffR)
+	{
+		m_lRollCycle--;
+	}
+
+	// ピッチの周回を更新する
+	dDiffP = dPitch - m_dOrientationP;
+	if(dDiffP < -CYCLE_THRESHOLD)
+	{
+		m_lPitchCycle++;
+	}
+	else if(CYCLE_THRESHOLD < dDiffP)
+	{
+		m_lPitchCycle--;
+	}
+
+	// ヨーの周回を更新する
+	dDiffY = dYaw - m_dOrientationY;
+	if(dDiffY < -CYCLE_THRESHOLD)
+	{
+		m_lYawCycle++;
+	}
+	else if(CYCLE_THRESHOLD < dDiffY)
+	{
+		m_lYawCycle--;
+	}
+
+	// 外部観測した３次元の姿勢を更新する
+	m_dOrientationR = dRoll;
+	m_dOrientationP = dPitch;
+	m_dOrientationY = dYaw;
+}
+
+void CrawlerCycle::SendMoveCommand(double dVx, double dVy, double dVa, int32_t iFrontPwmR, int32_t iFrontPwmL, int32_t iBackPwmR, int32_t iBackPwmL)
+{
+	char szCommand[SEND_BUFF_MAX] = {0};
+	size_t sizeCommand = 0;
+	int64_t iStartNs = 0;
+
+	for(int i = 0; i < SH_BOARD_NUM; i++)
+	{
+		// フィードバック待ちの間の停止指令の書き込みを記録し直す
+		m_bSent[i] = false;
+		m_bStopSent[i] = false;
+
+		// ポートをオープンする
+		if(!m_SHDevice[i].Open(m_sDeviceName[i], m_sBaudrate[i]))
+		{
+			continue;
+		}
+
+		// メインモータは指定速度、サブモータは指令PWMで動かす
+		iStartNs = MetricsRegistry::GetTimeNs();
+		if(i == 0)
+		{
+			sizeCommand = m_MainMotor.GenMoveCommand(dVx, dVy, dVa, szCommand, sizeof(szCommand));
+		}
+		else if(i == 1)
+		{
+			sizeCommand = m_FrontSubMotor.GenMoveCommand(iFrontPwmR, iFrontPwmL, szCommand, sizeof(szCommand));
+		}
+		else
+		{
+			sizeCommand = m_BackSubMotor.GenMoveCommand(iBackPwmR, iBackPwmL, szCommand, sizeof(szCommand));
+		}
+		if(!m_SHDevice[i].Send(szCommand, sizeCommand))
+		{
+			printf("SH%d WRITE ERROR!\n", i + 1);
+			m_WriteErrorMetric[i].Add();
+		}
+		else
+		{
+			m_SendMetric[i].RecordSince(iStartNs);
+			m_bSent[i] = true;
+		}
+
+		// フィードバック時刻を記録する(モータは動作コマンド受信時のパルス数を返す)
+		if(i == 0)
+		{
+			gettimeofday(&m_stFeedbackTime, NULL);
+		}
+	}
+}
+
+bool CrawlerCycle::IsSent(int iBoard) const
+{
+	if((iBoard < 0) || (SH_BOARD_NUM <= iBoard))
+	{
+		return false;
+	}
+	return m_bSent[iBoard];
+}
+
+bool CrawlerCycle::RecvFeedback(double dFrequency, double dVx, double dVy, double dVa, long lUseOrientation3D)
+{
+	char szFeedback[RECV_BUFF_MAX + 1] = {0};
+	double dRoll = 0.0;
+	double dPitch = 0.0;
+	double dYaw = 0.0;
+	int64_t iStartNs = 0;
+	bool bParsed = false;
+	bool bRet = true;
+
+	for(int i = 0; i < SH_BOARD_NUM; i++)
+	{
+		if(!m_SHDevice[i].IsOpen())
+		{
+			continue;
+		}
+
+		// フィードバック待ちの間に停止指令を書き込んだSHボードは、応答が２つ返り得るため
+		// どちらの指令の応答か判別できない(パルスカウントは積算値のため次の周期で反映される)
+		// 残った応答は次の周期のオープン時に破棄される
+		if(m_bStopSent[i])
+		{
+			printf("SH%d FEEDBACK IS DISCARDED BY EMERGENCY STOP\n", i + 1);
+			m_SHDevice[i].Close();
+			continue;
+		}
+
+		// フィードバックを受信する
+		iStartNs = MetricsRegistry::GetTimeNs();
+		m_SHDevice[i].Recv(szFeedback, sizeof(szFeedback));
+		m_RecvMetric[i].RecordSince(iStartNs);
+
+		// フィードバックを解析する
+		if(i == 0)
+		{
+			bParsed = m_MainMotor.AnalyzeFeedback(dFrequency, dVx, dVy, dVa, szFeedback);
+			if(bParsed)
+			{
+				if(lUseOrientation3D)
+				{
+					// フィードバック時刻の姿勢を履歴から補間する
+					if((lUseOrientation3D == 2) && m_OrientationHistory.Interpolate((double)m_stFeedbackTime.tv_sec + (double)m_stFeedbackTime.tv_usec/1000000.0, dRoll, dPitch, dYaw))
+					{
+						UpdateOrientation3D(dRoll, dPitch, dYaw);
+					}
+
+					// モータの回転及びIMUの姿勢から３次元の位置姿勢を求める
+					m_MainMotor.CalcOdometry(m_dOrientationR + DEG_TO_RAD(360)*m_lRollCycle, m_dOrientationP + DEG_TO_RAD(360)*m_lPitchCycle, m_dOrientationY + DEG_TO_RAD(360)*m_lYawCycle, dFrequency);
+				}
+				else
+				{
+					// モータの回転から２次元の位置姿勢を求める
+					m_MainMotor.CalcOdometry(dFrequency);
+				}
+			}
+		}
+		else if(i == 1)
+		{
+			bParsed = m_FrontSubMotor.AnalyzeFeedback(dFrequency, szFeedback);
+		}
+		else
+		{
+			bParsed = m_BackSubMotor.AnalyzeFeedback(dFrequency, szFeedback);
+		}
+		if(!bParsed)
+		{
+			printf("SH%d READ ERROR!\n", i + 1);
+			m_ParseErrorMetric[i].Add();
+			bRet = false;
+		}
+
+		// 次の周期までは非常停止が自身でオープンするため、ロック中にクローズする
+		m_SHDevice[i].Close();
+	}
+
+	return bRet;
+}
+
+bool CrawlerCycle::SendStopCommand(void)
+{
+	SHCommunicator Device;
+	char szCommand[SEND_BUFF_MAX] = {0};
+	size_t sizeCommand = 0;
+	bool bRet = true;
+
+	for(int i = 0; i < SH_BOARD_NUM; i++)
+	{
+		// 停止指令を生成する
+		if(i == 0)
+		{
+			sizeCommand = m_MainMotor.GenStopCommand(szCommand, sizeof(szCommand));
+		}
+		else if(i == 1)
+		{
+			sizeCommand = m_FrontSubMotor.GenStopCommand(szCommand, sizeof(szCommand));
+		}
+		else
+		{
+			sizeCommand = m_BackSubMotor.GenStopCommand(szCommand, sizeof(szCommand));
+		}
+
+		// フィードバック待ちの実行周期がオープン中ならば同じポートから書き込む
+		if(m_SHDevice[i].IsOpen())
+		{
+			m_bStopSent[i] = true;
+			if(!m_SHDevice[i].Send(szCommand, sizeCommand))
+			{
+				bRet = false;
+			}
+			continue;
+		}
+
+		// 実行周期の外ではポートを開いて書き込む(他の応答を破棄しないようクリアしない)
+		if(!Device.Open(m_sDeviceName[i], m_sBaudrate[i], false) || !Device.Send(szCommand, sizeCommand))
+		{
+			bRet = false;
+		}
+		Device.Close();
+	}
+
+	return bRet;
+}
@@ -0,0 +1,81 @@
+#include "FlipperAngleFile.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+FlipperAngleFile::FlipperAngleFile()
+	: m_szPath()
+{
+}
+
+FlipperAngleFile::~FlipperAngleFile()
+{
+}
+
+bool FlipperAngleFile::SetPath(const char *pDir, const char *pFileName)
+{
+	int iLength = 0;
+
+	iLength = snprintf(m_szPath, sizeof(m_szPath), "%s/%s", (pDir != NULL) ? pDir : ".", pFileName);
+	if((iLength <= 0) || (sizeof(m_szPath) <= (size_t)iLength))
+	{
+		printf("flipper angle file path is too long\n");
+		m_szPath[0] = '\0';
+		return false;
+	}
+
+	return true;
+}
+
+const char* FlipperAngleFile::GetPath(void) const
+{
+	return m_szPath;
+}
+
+bool FlipperAngleFile::Load(double &dFrontR, double &dFrontL, double &dBackR, double &dBackL) const
+{
+	char buff[256 + 1] = {0};
+	bool bRet = false;
+	FILE *fp = NULL;
+
+	fp = fopen(m_szPath, "r");
+	if(fp == NULL)
+	{
+		printf("サブクローラ角度の保存データなし\n");
+		return false;
+	}
+
+	// 先頭行を書式通りに読み込む
+	if(fgets(buff, sizeof(buff), fp) != NULL)
+	{
+		bRet = (sscanf(buff, "%lf:%lf:%lf:%lf", &dFrontR, &dFrontL, &dBackR, &dBackL) == 4);
+	}
+	fclose(fp);
+
+	return bRet;
+}
+
+bool FlipperAngleFile::Save(double dFrontR, double dFrontL, double dBackR, double dBackL) const
+{
+	char buff[256 + 1] = {0};
+	int iLength = 0;
+	int iFd = -1;
+	bool bRet = false;
+
+	// ファイルストリームはヒープを確保するため、スタックの文字バッファに書式化して書き込む
+	iLength = snprintf(buff, sizeof(buff), "%g:%g:%g:%g\n", dFrontR, dFrontL, dBackR, dBackL);
+	if((iLength <= 0) || (sizeof(buff) <= (size_t)iLength))
+	{
+		return false;
+	}
+
+	iFd = open(m_szPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if(iFd < 0)
+	{
+		return false;
+	}
+	bRet = (write(iFd, buff, iLength) == iLength);
+	close(iFd);
+
+	return bRet;
+}
@@ -96,14 +96,26 @@ void MainMotorProcessor::InitFeedbackData(void)
 	m_MotorL.InitFeedbackData();
 }
 
-std::string MainMotorProcessor::GenMoveCommand(double dVx, double dVy, double dVa)
+size_t MainMotorProcessor::GenMoveCommand(double dVx, double dVy, double dVa, char *pCommand, size_t sizeCommand)
 {
-	char sCommand[256 + 1] = {0};
-	double dVelocityR = 0.0;
-	double dVelocityL = 0.0;
+	int iLength = 0;
 	double dPwmR = 0.0;
 	double dPwmL = 0.0;
 
+	// PID速度制御でPWMを求める
+	CalcMovePwm(dVx, dVy, dVa, dPwmR, dPwmL);
+
+	// 動作コマンド書式の文字列を生成する
+	iLength = snprintf(pCommand, sizeCommand, "s[%.2f:%.2f]e", dPwmR, dPwmL);
+
+	return ((0 < iLength) && ((size_t)iLength < sizeCommand)) ? (size_t)iLength : 0;
+}
+
+void MainMotorProcessor::CalcMovePwm(double dVx, double dVy, double dVa, double &dPwmR, double &dPwmL)
+{
+	double dVelocityR = 0.0;
+	double dVelocityL = 0.0;
+
 	// ２次元の速度から右モータの速度を求める
 	dVelocityR = dVx + dVa*GetTurningRadius();
 
@@ -200,46 +212,34 @@ std::string MainMotorProcessor::GenMoveCommand(double dVx, double dVy, double dV
 		}
 	}
 
-	// 動作コマンド書式の文字列を生成する(モータの回転方向に合わせて正負を反転して要求する)
-	snprintf(sCommand, (sizeof(sCommand)/sizeof(sCommand[0])) - 1, "s[%.2f:%.2f]e", dPwmR*m_MotorR.GetDirection(), dPwmL*m_MotorL.GetDirection());
-
-	return sCommand;
+	// モータの回転方向に合わせて正負を反転して要求する
+	dPwmR *= m_MotorR.GetDirection();
+	dPwmL *= m_MotorL.GetDirection();
 }
 
-std::string MainMotorProcessor::GenStopCommand(void)
+size_t MainMotorProcessor::GenStopCommand(char *pCommand, size_t sizeCommand)
 {
-	return GenMoveCommand(0.0, 0.0, 0.0);
+	return GenMoveCommand(0.0, 0.0, 0.0, pCommand, sizeCommand);
 }
 
-bool MainMotorProcessor::AnalyzeFeedback(double dFrequency, double dVx, double dVy, double dVa, std::string sFeedback)
+bool MainMotorProcessor::AnalyzeFeedback(double dFrequency, double dVx, double dVy, double dVa, const char *pFeedback)
 {
 	int iPulseCountR = 0;
 	int iPulseCountL = 0;
-	double dVelocityR = 0.0;
-	double dVelocityL = 0.0;
 	double dVelocityMdR = 0.0;
 	double dVelocityMdL = 0.0;
 	double dLoadR = 0.0;
 	double dLoadL = 0.0;
 	int iRet = 0;
 
-	if(0 < sFeedback.length())
+	if((pFeedback != NULL) && (pFeedback[0] != '\0'))
 	{
 		// フィードバック書式通りに６つのパラメータがあるかチェックする
-		iRet = sscanf(sFeedback.c_str(), "s[%X:%X][%lf:%lf][%lf:%lf]e", &iPulseCountR, &iPulseCountL, &dVelocityMdR, &dLoadR, &dVelocityMdL, &dLoadL);
+		iRet = sscanf(pFeedback, "s[%X:%X][%lf:%lf][%lf:%lf]e", &iPulseCountR, &iPulseCountL, &dVelocityMdR, &dLoadR, &dVelocityMdL, &dLoadL);
 		if(iRet == 6)
 		{
 			// モータのフィードバックを処理する
-			m_MotorR.CalcFeedback(dFrequency, iPulseCountR, dVelocityMdR, dLoadR);
-			m_MotorL.CalcFeedback(dFrequency, iPulseCountL, dVelocityMdL, dLoadL);
-
-			// ２次元の速度からモータの速度を求める
-			dVelocityR = dVx + dVa*GetTurningRadius();
-			dVelocityL = dVx - dVa*GetTurningRadius();
-
-			// PID速度制御の積分項を求める
-			SetIntegralR(GetIntegralR() + (dVelocityR - m_MotorR.GetVelocity()*GetVxGain())*dFrequency);
-			SetIntegralL(GetIntegralL() + (dVelocityL - m_MotorL.GetVelocity()*GetVxGain())*dFrequency);
+			ApplyFeedback(dFrequency, dVx, dVy, dVa, iPulseCountR, iPulseCountL, dVelocityMdR, dLoadR, dVelocityMdL, dLoadL);
 
 			// 解析成功
 			return true;
@@ -250,6 +250,24 @@ bool MainMotorProcessor::AnalyzeFeedback(double dFrequency, double dVx, double d
 	return false;
 }
 
+void MainMotorProcessor::ApplyFeedback(double dFrequency, double dVx, double dVy, double dVa, int iPulseCountR, int iPulseCountL, double dVelocityMdR, double dLoadR, double dVelocityMdL, double dLoadL)
+{
+	double dVelocityR = 0.0;
+	double dVelocityL = 0.0;
+
+	// モータのフィードバックを処理する
+	m_MotorR.CalcFeedback(dFrequency, iPulseCountR, dVelocityMdR, dLoadR);
+	m_MotorL.CalcFeedback(dFrequency, iPulseCountL, dVelocityMdL, dLoadL);
+
+	// ２次元の速度からモータの速度を求める
+	dVelocityR = dVx + dVa*GetTurningRadius();
+	dVelocityL = dVx - dVa*GetTurningRadius();
+
+	// PID速度制御の積分項を求める
+	SetIntegralR(GetIntegralR() + (dVelocityR - m_MotorR.GetVelocity()*GetVxGain())*dFrequency);
+	SetIntegralL(GetIntegralL() + (dVelocityL - m_MotorL.GetVelocity()*GetVxGain())*dFrequency);
+}
+
 void MainMotorProcessor::CalcOdometry(double dFrequency)
 {
 	// モータの回転から２次元の並進速度及び回転速度を求める
@@ -9,6 +9,7 @@
 
 #include "RTC_Spider2020_Crawler.h"
 #include "SHCommunicator.h"
+#include "RealtimeSetup.h"
 #include <math.h>
 
 #define DEG_TO_RAD(x)	((M_PI/180)*(x))
@@ -19,8 +20,6 @@
 
 #define MOTOR_FEEDBACK_TIME (40000)		/*!< モータのフィードバックの待ち時間 */
 
-#define CYCLE_THRESHOLD (DEG_TO_RAD(180))	/*!< 外部観測した姿勢の周回判定閾値 */
-
 // timeval構造体の差を計算する(x1-x2)
 #define TIMEVAL_DIFF(x1,x2)	(((double)x1.tv_sec + (double)x1.tv_usec/1000000.0) - ((double)x2.tv_sec + (double)x2.tv_usec/1000000.0))
 
@@ -71,6 +70,9 @@ static const char* rtc_spider2020_crawler_spec[] =
 	"conf.default.SUB_MOTOR_LOAD_BASE", "2.0",
 	"conf.default.FAILSAFE_SEC", "1.0",
 	"conf.default.USE_ORIENTATION3D_IN", "0",
+	"conf.default.TRACE_ENABLE", "0",
+	"conf.default.RT_PRIORITY", "0",
+	"conf.default.RT_CPU_AFFINITY", "ALL",
 
 	// Widget
 	"conf.__widget__.WHEEL_RADIUS", "text",
@@ -103,6 +105,9 @@ static const char* rtc_spider2020_crawler_spec[] =
 	"conf.__widget__.SUB_MOTOR_LOAD_BASE", "text",
 	"conf.__widget__.FAILSAFE_SEC", "text",
 	"conf.__widget__.USE_ORIENTATION3D_IN", "text",
+	"conf.__widget__.TRACE_ENABLE", "text",
+	"conf.__widget__.RT_PRIORITY", "text",
+	"conf.__widget__.RT_CPU_AFFINITY", "text",
 
 	// Constraints
 	"conf.__type__.WHEEL_RADIUS", "double",
@@ -135,6 +140,9 @@ static const char* rtc_spider2020_crawler_spec[] =
 	"conf.__type__.SUB_MOTOR_LOAD_BASE", "double",
 	"conf.__type__.FAILSAFE_SEC", "double",
 	"conf.__type__.USE_ORIENTATION3D_IN", "long",
+	"conf.__type__.TRACE_ENABLE", "long",
+	"conf.__type__.RT_PRIORITY", "long",
+	"conf.__type__.RT_CPU_AFFINITY", "string",
 
 	""
 };
@@ -151,6 +159,8 @@ RTC_Spider2020_Crawler::RTC_Spider2020_Crawler(RTC::Manager* manager)
 	, m_Velocity2D_InIn("Velocity2D_In", m_Velocity2D_In)
 	, m_FlipperPwm_InIn("FlipperPwm_In", m_FlipperPwm_In)
 	, m_Orientation3D_InIn("Orientation3D_In", m_Orientation3D_In)
+	, m_Orientation3DHistory_InIn("Orientation3DHistory_In", m_Orientation3DHistory_In)
+	, m_EmergencyStop_InIn("EmergencyStop_In", m_EmergencyStop_In)
 	, m_Pose3D_OutOut("Pose3D_Out", m_Pose3D_Out)
 	, m_Velocity2D_OutOut("Velocity2D_Out", m_Velocity2D_Out)
 	, m_FlipperAngle_OutOut("FlipperAngle_Out", m_FlipperAngle_Out)
@@ -161,10 +171,22 @@ RTC_Spider2020_Crawler::RTC_Spider2020_Crawler(RTC::Manager* manager)
 	, m_FlipperPwm_InWrap(m_FlipperPwm_In)
 	, m_FlipperAngle_OutWrap(m_FlipperAngle_Out)
 	, m_MotorLoad_OutWrap(m_MotorLoad_Out)
+	, m_Orientation3DHistory_InWrap(m_Orientation3DHistory_In)
+	, m_Mode_InReader(m_Mode_InIn, m_Mode_In)
+	, m_Velocity2D_InReader(m_Velocity2D_InIn, m_Velocity2D_In)
+	, m_FlipperPwm_InReader(m_FlipperPwm_InIn, m_FlipperPwm_In)
+	, m_Orientation3D_InReader(m_Orientation3D_InIn, m_Orientation3D_In)
+	, m_CrawlerCycle(m_MainMotorProcessor, m_FrontSubMotorProcessor, m_BackSubMotorProcessor, m_OrientationHistory)
 	, m_stTimeval({0})
 	, m_stModeReadTime({0})
 	, m_stVelocity2DReadTime({0})
 	, m_stFlipperPwmReadTime({0})
+	, m_iTraceInputNs(0)
+	, m_iTraceSendNs(0)
+	, m_bActive(false)
+	, m_bEmergencyStop(false)
+	, m_iEStopStateNs(0)
+	, m_dEStopLatencyMax(0.0)
 {
 }
 
@@ -184,6 +206,8 @@ RTC::ReturnCode_t RTC_Spider2020_Crawler::onInitialize()
 	addInPort("Velocity2D_In", m_Velocity2D_InIn);
 	addInPort("FlipperPwm_In", m_FlipperPwm_InIn);
 	addInPort("Orientation3D_In", m_Orientation3D_InIn);
+	addInPort("Orientation3DHistory_In", m_Orientation3DHistory_InIn);
+	addInPort("EmergencyStop_In", m_EmergencyStop_InIn);
 
 	// Set OutPort buffer
 	addOutPort("Pose3D_Out", m_Pose3D_OutOut);
@@ -231,8 +255,15 @@ RTC::ReturnCode_t RTC_Spider2020_Crawler::onInitialize()
 	bindParameter("SUB_MOTOR_LOAD_BASE", m_SUB_MOTOR_LOAD_BASE, "2.0");
 	bindParameter("FAILSAFE_SEC", m_FAILSAFE_SEC, "1.0");
 	bindParameter("USE_ORIENTATION3D_IN", m_USE_ORIENTATION3D_IN, "0");
+	bindParameter("TRACE_ENABLE", m_TRACE_ENABLE, "0");
+	bindParameter("RT_PRIORITY", m_RT_PRIORITY, "0");
+	bindParameter("RT_CPU_AFFINITY", m_RT_CPU_AFFINITY, "ALL");
 	// </rtc-template>
 
+	// 非常停止の要求は受信時に直ちに反映する
+	m_EmergencyStop_InIn.addConnectorDataListener(RTC::ON_RECEIVED,
+		new InputEventListener<RTC::TimedBoolean>([this](const RTC::TimedBoolean &data){ OnEmergencyStopReceived(data); }));
+
 	// 動作指令の状態の入力を初期化する
 	m_Mode_InWrap.InitData();
 
@@ -244,11 +275,18 @@ RTC::ReturnCode_t RTC_Spider2020_Crawler::onInitialize()
 	// フリッパーのPWM指令を初期化する
 	m_FlipperPwm_InWrap.InitData();
 
+	// 非常停止の要求を初期化する
+	m_EmergencyStop_In.data = false;
+
 	// 外部観測した３次元の姿勢を初期化する
 	m_Orientation3D_In.data.r = 0.0;
 	m_Orientation3D_In.data.p = 0.0;
 	m_Orientation3D_In.data.y = 0.0;
 
+	// 時刻付き３次元の姿勢の履歴を初期化する
+	m_Orientation3DHistory_InWrap.InitData();
+	m_OrientationHistory.Clear();
+
 	// オドメトリによる３次元の位置・姿勢の出力を初期化する
 	m_Pose3D_Out.data.position.x = 0.0;
 	m_Pose3D_Out.data.position.y = 0.0;
@@ -285,10 +323,13 @@ RTC::ReturnCode_t RTC_Spider2020_Crawler::onInitialize()
 	// 後方サブモータのデータを初期化する
 	m_BackSubMotorProcessor.InitData();
 
-	// 外部観測した姿勢の周回数を初期化する
-	m_lRollCycle = 0;
-	m_lPitchCycle = 0;
-	m_lYawCycle = 0;
+	// 外部観測した姿勢及び周回数を初期化する
+	m_CrawlerCycle.InitOrientation();
+
+	// 性能指標を登録する
+	m_CyclePeriodMetric.Register("crawler.cycle_period");
+	m_ExecuteTimeMetric.Register("crawler.execute");
+	m_CrawlerCycle.RegisterMetrics("crawler");
 
 	return RTC::RTC_OK;
 }
@@ -316,6 +357,9 @@ RTC::ReturnCode_t RTC_Spider2020_Crawler::onShutdown(RTC::UniqueId ec_id)
 
 RTC::ReturnCode_t RTC_Spider2020_Crawler::onActivated(RTC::UniqueId ec_id)
 {
+	// 実行コンテキストのスレッドの優先度とCPUアフィニティを設定する
+	RealtimeSetup::SetupThread((int)m_RT_PRIORITY, m_RT_CPU_AFFINITY, "crawler.ec");
+
 	// メインモータのコンフィグレーションを設定する
 	m_MainMotorProcessor.SetConfig(m_TURNING_RADIUS, m_MAIN_MOTOR_KP, m_MAIN_MOTOR_KI, m_MAIN_MOTOR_KD, m_VX_GAIN, m_VA_GAIN);
 	m_MainMotorProcessor.SetConfigR(m_R_MAIN_MOTOR_DIRECTION, m_MAIN_MOTOR_PULSE, m_WHEEL_RADIUS, m_MAIN_MOTOR_GEAR_RATIO, m_MAIN_MOTOR_LOAD_GAIN, m_MAIN_MOTOR_LOAD_BASE);
@@ -344,6 +388,26 @@ RTC::ReturnCode_t RTC_Spider2020_Crawler::onActivated(RTC::UniqueId ec_id)
 	// フリッパーの角度を復元する
 	LoadFlipperAngle();
 
+	// 遅延計測のトレースバッファを開く
+	m_iTraceInputNs = 0;
+	m_iTraceSendNs = 0;
+	if(m_TRACE_ENABLE)
+	{
+		m_Trace.Open();
+	}
+
+	// 実行周期と非常停止で使用するSHボードの設定を複写し、非常停止を解除する
+	{
+		std::lock_guard<std::mutex> lock(m_MotorMutex);
+		m_CrawlerCycle.SetDevice(0, m_SH1_DEVICE_NAME, m_SH1_BAUDRATE);
+		m_CrawlerCycle.SetDevice(1, m_SH2_DEVICE_NAME, m_SH2_BAUDRATE);
+		m_CrawlerCycle.SetDevice(2, m_SH3_DEVICE_NAME, m_SH3_BAUDRATE);
+		m_bEmergencyStop = false;
+		m_iEStopStateNs = 0;
+		m_dEStopLatencyMax = 0.0;
+		m_bActive = true;
+	}
+
 	return RTC::RTC_OK;
 }
 
@@ -352,6 +416,18 @@ RTC::ReturnCode_t RTC_Spider2020_Crawler::onDeactivated(RTC::UniqueId ec_id)
 	SHCommunicator SH1Device;
 	SHCommunicator SH2Device;
 	SHCommunicator SH3Device;
+	char szCommand[SEND_BUFF_MAX] = {0};
+	char szFeedback[RECV_BUFF_MAX + 1] = {0};
+	std::lock_guard<std::mutex> lock(m_MotorMutex);
+
+	// 非常停止の受信を止める
+	m_bActive = false;
+
+	// 読み捨てた古い入力を表示する
+	m_Mode_InReader.PrintStatistics("Mode_In");
+	m_Velocity2D_InReader.PrintStatistics("Velocity2D_In");
+	m_FlipperPwm_InReader.PrintStatistics("FlipperPwm_In");
+	m_Orientation3D_InReader.PrintStatistics("Orientation3D_In");
 
 	// メインモータのフィードバックデータを初期化する
 	m_MainMotorProcessor.InitFeedbackData();
@@ -365,19 +441,19 @@ RTC::ReturnCode_t RTC_Spider2020_Crawler::onDeactivated(RTC::UniqueId ec_id)
 	// メインモータを停止する
 	if(SH1Device.Open(m_SH1_DEVICE_NAME, m_SH1_BAUDRATE))
 	{
-		SH1Device.Send(m_MainMotorProcessor.GenStopCommand());
+		SH1Device.Send(szCommand, m_MainMotorProcessor.GenStopCommand(szCommand, sizeof(szCommand)));
 	}
 
 	// 前方サブモータを停止する
 	if(SH2Device.Open(m_SH2_DEVICE_NAME, m_SH2_BAUDRATE))
 	{
-		SH2Device.Send(m_FrontSubMotorProcessor.GenStopCommand());
+		SH2Device.Send(szCommand, m_FrontSubMotorProcessor.GenStopCommand(szCommand, sizeof(szCommand)));
 	}
 
 	// 後方サブモータを停止する
 	if(SH3Device.Open(m_SH3_DEVICE_NAME, m_SH3_BAUDRATE))
 	{
-		SH3Device.Send(m_BackSubMotorProcessor.GenStopCommand());
+		SH3Device.Send(szCommand, m_BackSubMotorProcessor.GenStopCommand(szCommand, sizeof(szCommand)));
 	}
 
 	// モータのフィードバックを待つ
@@ -386,36 +462,38 @@ RTC::ReturnCode_t RTC_Spider2020_Crawler::onDeactivated(RTC::UniqueId ec_id)
 	// メインモータのフィードバックを受信して破棄する
 	if(SH1Device.IsOpen())
 	{
-		SH1Device.Recv();
+		SH1Device.Recv(szFeedback, sizeof(szFeedback));
 	}
 
 	// 前方サブモータのフィードバックを受信して破棄する
 	if(SH2Device.IsOpen())
 	{
-		SH2Device.Recv();
+		SH2Device.Recv(szFeedback, sizeof(szFeedback));
 	}
 
 	// 後方サブモータのフィードバックを受信して破棄する
 	if(SH3Device.IsOpen())
 	{
-		SH3Device.Recv();
+		SH3Device.Recv(szFeedback, sizeof(szFeedback));
 	}
 
+	// 遅延計測のトレースバッファを閉じる
+	m_Trace.Close();
+
 	return RTC::RTC_OK;
 }
 
 RTC::ReturnCode_t RTC_Spider2020_Crawler::onExecute(RTC::UniqueId ec_id)
 {
-	SHCommunicator SH1Device;
-	SHCommunicator SH2Device;
-	SHCommunicator SH3Device;
 	struct timeval ti = {0};
 	double dFrequency = 0.0;
+	int64_t iExecuteStartNs = MetricsRegistry::GetTimeNs();
 
 	// 実行周期を取得する
 	gettimeofday(&ti, NULL);
 	dFrequency = ((double)ti.tv_sec + (double)(ti.tv_usec/1000000.0)) - ((double)m_stTimeval.tv_sec + (double)(m_stTimeval.tv_usec/1000000.0));
 	m_stTimeval = ti;
+	m_CyclePeriodMetric.Record((int64_t)(dFrequency*1000000000.0));
 
 	// 動作状態をポートから読み込む
 	ReadMode();
@@ -429,6 +507,24 @@ RTC::ReturnCode_t RTC_Spider2020_Crawler::onExecute(RTC::UniqueId ec_id)
 	// 外部観測した３次元の姿勢をポートから読み込む
 	ReadOrientation3D();
 
+	// 時刻付き３次元の姿勢の履歴をポートから読み込む
+	ReadOrientation3DHistory();
+
+	// 非常停止とSHボードの操作が重ならないようにロックする
+	std::unique_lock<std::mutex> lock(m_MotorMutex);
+
+	// 非常停止の要求をポートから読み込む
+	ReadEmergencyStop();
+
+	// 非常停止中ならば速度及びPWM指令を０にする
+	if(m_bEmergencyStop)
+	{
+		m_Velocity2D_In.data.vx = 0.0;
+		m_Velocity2D_In.data.vy = 0.0;
+		m_Velocity2D_In.data.va = 0.0;
+		m_FlipperPwm_InWrap.InitData();
+	}
+
 	// ３次元の位置姿勢及びフリッパーの角度の初期化ＯＮならば初期化する
 	if(m_Mode_InWrap.GetCrawlerPoseClear() == ModeWrapper::CRAWLER_POSE_CLEAR_ON)
 	{
@@ -447,81 +543,29 @@ RTC::ReturnCode_t RTC_Spider2020_Crawler::onExecute(RTC::UniqueId ec_id)
 		m_BackSubMotorProcessor.SetAngleL(FLIPPER_ANGLE_DEFAULT);
 
 		// 外部観測した姿勢の周回数を初期化する
-		m_lRollCycle = 0;
-		m_lPitchCycle = 0;
-		m_lYawCycle = 0;
+		m_CrawlerCycle.ClearOrientationCycle();
 	}
 
-	// メインモータを指定速度で動かす
-	if(SH1Device.Open(m_SH1_DEVICE_NAME, m_SH1_BAUDRATE))
+	// メインモータを指定速度、サブモータを指令PWMで動かす
+	m_CrawlerCycle.SendMoveCommand(m_Velocity2D_In.data.vx, m_Velocity2D_In.data.vy, m_Velocity2D_In.data.va,
+		m_FlipperPwm_InWrap.GetFrontRightPwm(), m_FlipperPwm_InWrap.GetFrontLeftPwm(), m_FlipperPwm_InWrap.GetBackRightPwm(), m_FlipperPwm_InWrap.GetBackLeftPwm());
+	if(m_CrawlerCycle.IsSent(0))
 	{
-		if(!SH1Device.Send(m_MainMotorProcessor.GenMoveCommand(m_Velocity2D_In.data.vx, m_Velocity2D_In.data.vy, m_Velocity2D_In.data.va)))
-		{
-			printf("SH1 WRITE_ERROR!\n");
-		}
+		TraceSend(m_Velocity2D_In.tm);
 	}
-
-	// 前方サブモータを指令PWMで動かす
-	if(SH2Device.Open(m_SH2_DEVICE_NAME, m_SH2_BAUDRATE))
+	if(m_CrawlerCycle.IsSent(2))
 	{
-		if(!SH2Device.Send(m_FrontSubMotorProcessor.GenMoveCommand(m_FlipperPwm_InWrap.GetFrontRightPwm(),m_FlipperPwm_InWrap.GetFrontLeftPwm())))
-		{
-			printf("SH2 WRITE ERROR!\n");
-		}
+		TraceSend(m_FlipperPwm_In.tm);
 	}
 
-	// 後方サブモータを指令PWMで動かす
-	if(SH3Device.Open(m_SH3_DEVICE_NAME, m_SH3_BAUDRATE))
-	{
-		if(!SH3Device.Send(m_BackSubMotorProcessor.GenMoveCommand(m_FlipperPwm_InWrap.GetBackRightPwm(),m_FlipperPwm_InWrap.GetBackLeftPwm())))
-		{
-			printf("SH3 WRITE ERROR!\n");
-		}
-	}
-
-	// モータのフィードバックを待つ
+	// モータのフィードバックを待つ(待つ間は非常停止を受け付ける)
+	lock.unlock();
 	usleep(MOTOR_FEEDBACK_TIME);
+	lock.lock();
 
-	// メインモータのフィードバックを受信する
-	if(SH1Device.IsOpen())
-	{
-		// フィードバックを解析する
-		if(!m_MainMotorProcessor.AnalyzeFeedback(dFrequency, m_Velocity2D_In.data.vx, m_Velocity2D_In.data.vy, m_Velocity2D_In.data.va, SH1Device.Recv()))
-		{
-			printf("SH1 READ ERROR!\n");
-		}
-		else
-		{
-			if(m_USE_ORIENTATION3D_IN)
-			{
-				// モータの回転及びIMUの姿勢から３次元の位置姿勢を求める
-				m_MainMotorProcessor.CalcOdometry(m_Orientation3D_In.data.r + DEG_TO_RAD(360)*m_lRollCycle, m_Orientation3D_In.data.p + DEG_TO_RAD(360)*m_lPitchCycle, m_Orientation3D_In.data.y + DEG_TO_RAD(360)*m_lYawCycle, dFrequency);
-			}
-			else
-			{
-				// モータの回転から２次元の位置姿勢を求める
-				m_MainMotorProcessor.CalcOdometry(dFrequency);
-			}
-		}
-	}
-
-	if(SH2Device.IsOpen())
-	{
-		// フィードバックを解析する
-		if(!m_FrontSubMotorProcessor.AnalyzeFeedback(dFrequency, SH2Device.Recv()))
-		{
-			printf("SH2 READ ERROR!\n");
-		}
-	}
-
-	if(SH3Device.IsOpen())
-	{
-		// フィードバックを解析する
-		if(!m_BackSubMotorProcessor.AnalyzeFeedback(dFrequency, SH3Device.Recv()))
-		{
-			printf("SH3 READ ERROR!\n");
-		}
-	}
+	// フィードバックを受信・解析してオドメトリを求める(解析エラーは表示・計数済み)
+	m_CrawlerCycle.RecvFeedback(dFrequency, m_Velocity2D_In.data.vx, m_Velocity2D_In.data.vy, m_Velocity2D_In.data.va, m_USE_ORIENTATION3D_IN);
+	lock.unlock();
 
 	// オドメトリによる３次元の位置姿勢をポートに出力する
 	WritePose3D();
@@ -538,6 +582,8 @@ RTC::ReturnCode_t RTC_Spider2020_Crawler::onExecute(RTC::UniqueId ec_id)
 	// モータの負荷をポートに出力する
 	WriteMotorLoad();
 
+	m_ExecuteTimeMetric.RecordSince(iExecuteStartNs);
+
 	return RTC::RTC_OK;
 }
 
@@ -583,14 +629,11 @@ void RTC_Spider2020_Crawler::ReadMode(void)
 	// 現在の時刻を取得する
 	gettimeofday(&ti, NULL);
 
-	// 動作状態を更新する
-	if(m_Mode_InIn.isNew())
+	// 動作状態を最新のデータに更新する
+	if(m_Mode_InReader.Read())
 	{
 		// 読み込み時刻を更新する
 		m_stModeReadTime = ti;
-
-		// 次のデータを読み込む
-		m_Mode_InIn.read();
 	}
 	else
 	{
@@ -609,14 +652,12 @@ void RTC_Spider2020_Crawler::ReadVelocity2D(void)
 	// 現在の時刻を取得する
 	gettimeofday(&ti, NULL);
 
-	// ２次元の速度を更新する
-	if(m_Velocity2D_InIn.isNew())
+	// ２次元の速度を最新のデータに更新する
+	if(m_Velocity2D_InReader.Read())
 	{
 		// 読み込み時刻を更新する
 		m_stVelocity2DReadTime = ti;
-
-		// 次のデータを読み込む
-		m_Velocity2D_InIn.read();
+		TraceInput(m_Velocity2D_In.tm);
 	}
 	else
 	{
@@ -637,14 +678,12 @@ void RTC_Spider2020_Crawler::ReadFlipperPwm(void)
 	// 現在の時刻を取得する
 	gettimeofday(&ti, NULL);
 
-	// フリッパーのPWM指令を更新する
-	if(m_FlipperPwm_InIn.isNew())
+	// フリッパーのPWM指令を最新のデータに更新する
+	if(m_FlipperPwm_InReader.Read())
 	{
 		// 読み込み時刻を更新する
 		m_stFlipperPwmReadTime = ti;
-
-		// 次のデータを読み込む
-		m_FlipperPwm_InIn.read();
+		TraceInput(m_FlipperPwm_In.tm);
 	}
 	else
 	{
@@ -656,58 +695,129 @@ void RTC_Spider2020_Crawler::ReadFlipperPwm(void)
 	}
 }
 
-void RTC_Spider2020_Crawler::ReadOrientation3D(void)
+void RTC_Spider2020_Crawler::TraceInput(const RTC::Time &tm)
+{
+	int64_t iOriginNs = LatencyTrace::ToNs(tm);
+
+	// 記録しない場合、または既に記録した起点ならば何もしない
+	if(!m_TRACE_ENABLE || (iOriginNs <= m_iTraceInputNs))
+	{
+		return;
+	}
+
+	// 新しい起点の入力時刻を記録する
+	m_iTraceInputNs = iOriginNs;
+	m_Trace.Record(TRACE_CRAWLER_INPUT, iOriginNs);
+}
+
+void RTC_Spider2020_Crawler::TraceSend(const RTC::Time &tm)
+{
+	int64_t iOriginNs = LatencyTrace::ToNs(tm);
+
+	// 記録しない場合、または既に記録した起点ならば何もしない
+	if(!m_TRACE_ENABLE || (iOriginNs <= m_iTraceSendNs))
+	{
+		return;
+	}
+
+	// 新しい起点の書き込み完了時刻を記録する
+	m_iTraceSendNs = iOriginNs;
+	m_Trace.Record(TRACE_CRAWLER_SEND, iOriginNs);
+}
+
+void RTC_Spider2020_Crawler::OnEmergencyStopReceived(const RTC::TimedBoolean &data)
 {
-	double dOldR = 0.0;
-	double dOldP = 0.0;
-	double dOldY = 0.0;
-	double dDiffR = 0.0;
-	double dDiffP = 0.0;
-	double dDiffY = 0.0;
+	std::lock_guard<std::mutex> lock(m_MotorMutex);
+
+	// 非アクティブ状態ならば何もしない(停止はonDeactivatedで実施済み)
+	if(!m_bActive)
+	{
+		return;
+	}
 
+	// 受信したデータを直ちに反映する(ポートのバッファにはまだ書き込まれていない)
+	ApplyEmergencyStop(data);
+}
+
+void RTC_Spider2020_Crawler::ReadEmergencyStop(void)
+{
+	// 非常停止の要求を更新する(push型では受信時に反映済みのため古い要求として無視される)
+	// 状態の変化を取りこぼさないよう、最新のデータまで読み飛ばさずに全て反映する
+	while(m_EmergencyStop_InIn.isNew())
+	{
+		m_EmergencyStop_InIn.read();
+		ApplyEmergencyStop(m_EmergencyStop_In);
+	}
+}
+
+void RTC_Spider2020_Crawler::ApplyEmergencyStop(const RTC::TimedBoolean &data)
+{
+	int64_t iOriginNs = LatencyTrace::ToNs(data.tm);
+	double dLatency = 0.0;
+
+	// 最後に反映した要求より古い要求、または状態が変わらない要求は無視する
+	if((iOriginNs < m_iEStopStateNs) || (data.data == m_bEmergencyStop))
+	{
+		return;
+	}
+	m_iEStopStateNs = iOriginNs;
+	m_bEmergencyStop = data.data;
+
+	// 非常停止が解除された
+	if(!m_bEmergencyStop)
+	{
+		printf("emergency stop is released\n");
+		return;
+	}
+
+	// 全SHボードに停止指令を書き込む
+	if(!m_CrawlerCycle.SendStopCommand())
+	{
+		printf("EMERGENCY STOP WRITE ERROR!\n");
+	}
+
+	// 要求の起点から書き込み完了までの遅延を求める
+	dLatency = (double)(LatencyTrace::GetTimeNs() - iOriginNs)/1000000000.0;
+	if(m_dEStopLatencyMax < dLatency)
+	{
+		m_dEStopLatencyMax = dLatency;
+	}
+	printf("EMERGENCY STOP: latency %.3f ms (max %.3f ms)\n", dLatency*1000.0, m_dEStopLatencyMax*1000.0);
+	if(m_TRACE_ENABLE)
+	{
+		m_Trace.Record(TRACE_ESTOP_SEND, iOriginNs);
+	}
+}
+
+void RTC_Spider2020_Crawler::ReadOrientation3D(void)
+{
 	// 外部観測した３次元の姿勢を更新する
-	if(m_USE_ORIENTATION3D_IN)
+	if(m_USE_ORIENTATION3D_IN == 1)
 	{
-		if(m_Orientation3D_InIn.isNew())
+		// 最新のデータまで読み込む
+		if(m_Orientation3D_InReader.Read())
 		{
-			dOldR = m_Orientation3D_In.data.r;
-			dOldP = m_Orientation3D_In.data.p;
-			dOldY = m_Orientation3D_In.data.y;
+			// 周回数を更新する
+			m_CrawlerCycle.UpdateOrientation3D(m_Orientation3D_In.data.r, m_Orientation3D_In.data.p, m_Orientation3D_In.data.y);
+		}
+	}
+}
 
+void RTC_Spider2020_Crawler::ReadOrientation3DHistory(void)
+{
+	// 時刻付き３次元の姿勢の履歴を更新する
+	if(m_USE_ORIENTATION3D_IN == 2)
+	{
+		// 履歴は全て必要なため、最新のデータまで読み飛ばさずに全て読み込む
+		while(m_Orientation3DHistory_InIn.isNew())
+		{
 			// 次のデータを読み込む
-			m_Orientation3D_InIn.read();
-
-			// ロールの周回を更新する
-			dDiffR = m_Orientation3D_In.data.r - dOldR;
-			if(dDiffR < -CYCLE_THRESHOLD)
-			{
-				m_lRollCycle++;
-			}
-			else if(CYCLE_THRESHOLD < dDiffR)
-			{
-				m_lRollCycle--;
-			}
-
-			// ピッチの周回を更新する
-			dDiffP = m_Orientation3D_In.data.p - dOldP;
-			if(dDiffP < -CYCLE_THRESHOLD)
-			{
-				m_lPitchCycle++;
-			}
-			else if(CYCLE_THRESHOLD < dDiffP)
-			{
-				m_lPitchCycle--;
-			}
+			m_Orientation3DHistory_InIn.read();
 
-			// ヨーの周回を更新する
-			dDiffY = m_Orientation3D_In.data.y - dOldY;
-			if(dDiffY < -CYCLE_THRESHOLD)
+			// 姿勢の履歴に追加する
+			for(uint32_t i = 0; i < m_Orientation3DHistory_InWrap.GetNumber(); i++)
 			{
-				m_lYawCycle++;
-			}
-			else if(CYCLE_THRESHOLD < dDiffY)
-			{
-				m_lYawCycle--;
+				m_OrientationHistory.Push(m_Orientation3DHistory_InWrap.GetTime(i), m_Orientation3DHistory_InWrap.GetRoll(i), m_Orientation3DHistory_InWrap.GetPitch(i), m_Orientation3DHistory_InWrap.GetYaw(i));
 			}
 		}
 	}
@@ -770,30 +880,21 @@ void RTC_Spider2020_Crawler::WriteMotorLoad(void)
 
 void RTC_Spider2020_Crawler::LoadFlipperAngle(void)
 {
-	std::ifstream ifs(getenv("HOME") + std::string("/") + std::string(FLIPPER_ANGLE_FILE));
-	char buff[256 + 1] = {0};
 	double dFrontR = 0.0;
 	double dFrontL = 0.0;
 	double dBackR = 0.0;
 	double dBackL = 0.0;
 
-	if(ifs.good())
-	{
-		if(ifs.getline(buff, (sizeof(buff)/sizeof(buff[0])) - 1))
-		{
-			if(sscanf(buff, "%lf:%lf:%lf:%lf", &dFrontR, &dFrontL, &dBackR, &dBackL) == 4)
-			{
-				m_FrontSubMotorProcessor.SetAngleR(dFrontR);
-				m_FrontSubMotorProcessor.SetAngleL(dFrontL);
-				m_BackSubMotorProcessor.SetAngleR(dBackR);
-				m_BackSubMotorProcessor.SetAngleL(dBackL);
-				return;
-			}
-		}
-	}
-	else
+	// 保存ファイルのパスを作成する(実行周期の保存で文字列を確保しないよう、活性化時に作成する)
+	m_FlipperAngleFile.SetPath(getenv("HOME"), FLIPPER_ANGLE_FILE);
+
+	if(m_FlipperAngleFile.Load(dFrontR, dFrontL, dBackR, dBackL))
 	{
-		printf("サブクローラ角度の保存データなし\n");
+		m_FrontSubMotorProcessor.SetAngleR(dFrontR);
+		m_FrontSubMotorProcessor.SetAngleL(dFrontL);
+		m_BackSubMotorProcessor.SetAngleR(dBackR);
+		m_BackSubMotorProcessor.SetAngleL(dBackL);
+		return;
 	}
 
 	m_FrontSubMotorProcessor.SetAngleR(FLIPPER_ANGLE_DEFAULT);
@@ -804,19 +905,7 @@ void RTC_Spider2020_Crawler::LoadFlipperAngle(void)
 
 void RTC_Spider2020_Crawler::SaveFlipperAngle(void)
 {
-	std::ofstream ofs(getenv("HOME") + std::string("/") + std::string(FLIPPER_ANGLE_FILE), std::ios::trunc);
-
-	if(ofs.good())
-	{
-		ofs << 	m_FrontSubMotorProcessor.GetAngleR()
-			<< ":"
-			<< m_FrontSubMotorProcessor.GetAngleL()
-			<< ":"
-			<< m_BackSubMotorProcessor.GetAngleR()
-			<< ":"
-			<< m_BackSubMotorProcessor.GetAngleL()
-			<< std::endl;
-	}
+	m_FlipperAngleFile.Save(m_FrontSubMotorProcessor.GetAngleR(), m_FrontSubMotorProcessor.GetAngleL(), m_BackSubMotorProcessor.GetAngleR(), m_BackSubMotorProcessor.GetAngleL());
 }
 
 
@@ -1,17 +1,10 @@
 #include "SHCommunicator.h"
 #include <fcntl.h>
 #include <stdio.h>
+#include <string.h>
 #include <termios.h>
 #include <unistd.h>
 
-/*! @name シリアル通信設定
- *	シリアル通信の文字バッファサイズ
- */
-/*  @{ */
-#define SEND_BUFF_MAX	(256)		/*!< シリアル通信の送信文字バッファサイズ	*/
-#define RECV_BUFF_MAX	(256)		/*!< シリアル通信の受信文字バッファサイズ	*/
-/* @} */
-
 SHCommunicator::SHCommunicator()
 	: m_fd(-1)
 {
@@ -23,7 +16,7 @@ SHCommunicator::~SHCommunicator()
 	Close();
 }
 
-bool SHCommunicator::Open(const std::string &sDeviceName, const std::string &sBaudrate)
+bool SHCommunicator::Open(const std::string &sDeviceName, const std::string &sBaudrate, bool bFlush)
 {
 	termios stTermios = {0};
 	int iRet = 0;
@@ -77,11 +70,14 @@ bool SHCommunicator::Open(const std::string &sDeviceName, const std::string &sBa
 		stTermios.c_iflag |= ICRNL;		// キャリッジリターンを無視
 
 		// シリアル通信の入出力バッファをクリアする
-		iRet = tcflush(m_fd, TCIFLUSH);
-		if(iRet == -1)
+		if(bFlush)
 		{
-			printf("tcflush is failed\n");
-			break;
+			iRet = tcflush(m_fd, TCIFLUSH);
+			if(iRet == -1)
+			{
+				printf("tcflush is failed\n");
+				break;
+			}
 		}
 
 		// シリアル通信の属性を設定する
@@ -119,9 +115,9 @@ void SHCommunicator::Close()
 	}
 }
 
-bool SHCommunicator::Send(const std::string &sData)
+bool SHCommunicator::Send(const char *pData, size_t sizeData)
 {
-	int iSize = 0;
+	ssize_t iSize = 0;
 
 	// シリアルポートのオープン状態をチェックする
 	if(!IsOpen())
@@ -131,15 +127,15 @@ bool SHCommunicator::Send(const std::string &sData)
 	}
 
 	// データ長をチェックする
-	if(SEND_BUFF_MAX <= sData.length())
+	if(SEND_BUFF_MAX <= sizeData)
 	{
 		printf("data length is too long\n");
 		return false;
 	}
 
 	// 文字列を送信する
-	iSize = write(m_fd, (void*)sData.c_str(), sData.length());
-	if(iSize != sData.length())
+	iSize = write(m_fd, pData, sizeData);
+	if((iSize < 0) || ((size_t)iSize != sizeData))
 	{
 		printf("write is failed\n");
 		return false;
@@ -149,26 +145,32 @@ bool SHCommunicator::Send(const std::string &sData)
 	return true;
 }
 
-std::string SHCommunicator::Recv(void)
+size_t SHCommunicator::Recv(char *pBuff, size_t sizeBuff)
 {
-	std::string sData;
-	int iSize = 0;
+	ssize_t iSize = 0;
+
+	if(sizeBuff == 0)
+	{
+		return 0;
+	}
+	pBuff[0] = '\0';
 
 	// シリアルポートのオープン状態をチェックする
 	if(!IsOpen())
 	{
 		printf("device is not opened\n");
-		return sData;
+		return 0;
 	}
 
-	// 受信文字列格納バッファを確保する
-	sData.resize(RECV_BUFF_MAX, '\0');
-
-	// 応答を受信する
-	iSize = read(m_fd, (void*)sData.c_str(), sData.length());
+	// 応答を受信する(格納先に収まる長さまで)
+	iSize = read(m_fd, pBuff, ((sizeBuff - 1) < RECV_BUFF_MAX) ? (sizeBuff - 1) : RECV_BUFF_MAX);
+	if(iSize < 0)
+	{
+		iSize = 0;
+	}
 
-	// NULL終端までで文字列を再構成する
-	sData = sData.c_str();
+	// NUL終端までを文字列とする
+	pBuff[iSize] = '\0';
 
-	return sData;
+	return strlen(pBuff);
 }
@@ -23,22 +23,22 @@ void SubMotorProcessor::InitFeedbackData(void)
 	m_MotorL.InitFeedbackData();
 }
 
-std::string SubMotorProcessor::GenMoveCommand(int32_t iPwmR, int32_t iPwmL)
+size_t SubMotorProcessor::GenMoveCommand(int32_t iPwmR, int32_t iPwmL, char *pCommand, size_t sizeCommand)
 {
-	char sCommand[256 + 1] = {0};
+	int iLength = 0;
 
 	// 動作コマンド書式の文字列を生成する(モータの回転方向に合わせて正負を反転して要求する)
-	snprintf(sCommand, (sizeof(sCommand)/sizeof(sCommand[0])) - 1, "s[%d:%d]e", iPwmR*m_MotorR.GetDirection(), iPwmL*m_MotorL.GetDirection());
+	iLength = snprintf(pCommand, sizeCommand, "s[%d:%d]e", iPwmR*m_MotorR.GetDirection(), iPwmL*m_MotorL.GetDirection());
 
-	return sCommand;
+	return ((0 < iLength) && ((size_t)iLength < sizeCommand)) ? (size_t)iLength : 0;
 }
 
-std::string SubMotorProcessor::GenStopCommand(void)
+size_t SubMotorProcessor::GenStopCommand(char *pCommand, size_t sizeCommand)
 {
-	return GenMoveCommand(0, 0);
+	return GenMoveCommand(0, 0, pCommand, sizeCommand);
 }
 
-bool SubMotorProcessor::AnalyzeFeedback(double dFrequency, std::string sFeedback)
+bool SubMotorProcessor::AnalyzeFeedback(double dFrequency, const char *pFeedback)
 {
 	int iPulseCountR = 0;
 	int iPulseCountL = 0;
@@ -48,15 +48,14 @@ bool SubMotorProcessor::AnalyzeFeedback(double dFrequency, std::string sFeedback
 	double dLoadL = 0.0;
 	int iRet = 0;
 
-	if(0 < sFeedback.length())
+	if((pFeedback != NULL) && (pFeedback[0] != '\0'))
 	{
 		// フィードバック書式通りに６つのパラメータがあるかチェックする
-		iRet = sscanf(sFeedback.c_str(), "s[%X:%X][%lf:%lf][%lf:%lf]e", &iPulseCountR, &iPulseCountL, &dVelocityMdR, &dLoadR, &dVelocityMdL, &dLoadL);
+		iRet = sscanf(pFeedback, "s[%X:%X][%lf:%lf][%lf:%lf]e", &iPulseCountR, &iPulseCountL, &dVelocityMdR, &dLoadR, &dVelocityMdL, &dLoadL);
 		if(iRet == 6)
 		{
 			// モータのフィードバックを処理する
-			m_MotorR.CalcFeedback(dFrequency, iPulseCountR, dVelocityMdR, dLoadR);
-			m_MotorL.CalcFeedback(dFrequency, iPulseCountL, dVelocityMdL, dLoadL);
+			ApplyFeedback(dFrequency, iPulseCountR, iPulseCountL, dVelocityMdR, dLoadR, dVelocityMdL, dLoadL);
 
 			// 解析成功
 			return true;
@@ -67,6 +66,13 @@ bool SubMotorProcessor::AnalyzeFeedback(double dFrequency, std::string sFeedback
 	return false;
 }
 
+void SubMotorProcessor::ApplyFeedback(double dFrequency, int iPulseCountR, int iPulseCountL, double dVelocityMdR, double dLoadR, double dVelocityMdL, double dLoadL)
+{
+	// モータのフィードバックを処理する
+	m_MotorR.CalcFeedback(dFrequency, iPulseCountR, dVelocityMdR, dLoadR);
+	m_MotorL.CalcFeedback(dFrequency, iPulseCountL, dVelocityMdL, dLoadL);
+}
+
 void SubMotorProcessor::SetConfigR(int8_t iDirection, int32_t iPulseNumber, double dRadius, double dGearRatio, double dLoadGain, double dLoadBase)
 {
 	// モータの回転方向を設定する
@@ -0,0 +1,426 @@
+// -*- C++ -*-
+/*!
+ * @file AllocCheck.cpp
+ * @brief 台車制御の実行周期がヒープを確保しないことを確認する
+ * @date 2026/10/19
+ *
+ * RTC_Spider2020_CrawlerのonExecuteが呼び出すSHボード操作(CrawlerCycle:
+ * ポートのオープン、動作コマンドの送信、フィードバックの受信・解析、
+ * オドメトリ、ポートのクローズ)と非常停止の停止指令の書き込みを
+ * そのまま呼び出し、その間のヒープの確保(operator new、malloc、calloc、
+ * realloc)を数える。SHボードは疑似端末(pty)で代用し、マスタ側で動作
+ * コマンドを読み込んでフィードバックを返す。
+ * 外部観測した姿勢の使用方法(0:不使用、1:最新値、2:履歴から補間)は周期毎に
+ * 切り替え、ヨーは周回させる。一定周期毎に不正なフィードバック(解析エラーの
+ * 表示)と、フィードバック待ちの間及び周期の外の非常停止を発生させる。
+ * 活性化に相当する初期化と最初の周期(printfのバッファ確保など)は数えない。
+ * OpenRTMのポートの読み書きは対象外とする(RTCの外部の実装のため)。
+ *
+ * 使用例:
+ *   AllocCheck                 (1000周期を確認する)
+ *   AllocCheck -n 100000 -v    (確保があれば呼び出し元を表示する)
+ * 最終行に結果を key=value 形式で出力する(確保があれば終了コード1)
+ */
+
+#include "MainMotorProcessor.h"
+#include "SubMotorProcessor.h"
+#include "CrawlerCycle.h"
+#include "FlipperAngleFile.h"
+#include "OrientationInterpolator.h"
+#include "MetricsRegistry.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <math.h>
+#include <new>
+#include <string>
+#include <sys/time.h>
+#include <unistd.h>
+
+#define CYCLE_PERIOD		(0.05)		/*!< 模擬する実行周期 [s]					*/
+#define PULSE_PER_CYCLE		(40)		/*!< フィードバックで返す周期毎のパルス数	*/
+#define BACKTRACE_DEPTH		(16)		/*!< 表示する呼び出し元の深さ				*/
+#define PARSE_ERROR_INTERVAL	(50)	/*!< 不正なフィードバックを返す周期の間隔	*/
+#define ESTOP_INTERVAL		(70)		/*!< 非常停止を発生させる周期の間隔			*/
+
+extern "C"
+{
+	void* __libc_malloc(size_t size);
+	void* __libc_calloc(size_t nmemb, size_t size);
+	void* __libc_realloc(void *ptr, size_t size);
+	void __libc_free(void *ptr);
+}
+
+static std::atomic<bool> s_bArmed(false);			/*!< 確保を数えるか							*/
+static std::atomic<uint64_t> s_uAllocCount(0);		/*!< 数えた確保の回数						*/
+static bool s_bVerbose = false;						/*!< 確保の呼び出し元を表示するか			*/
+static __thread bool s_bInHook = false;				/*!< 確保の記録中か(記録中の確保を数えない)	*/
+
+/*!
+ * ヒープの確保を記録する
+ * @param  pFunc 確保した関数名
+ * @param  size  確保したサイズ
+ * @return なし
+ */
+static void RecordAlloc(const char *pFunc, size_t size)
+{
+	void *pFrame[BACKTRACE_DEPTH];
+	int iDepth = 0;
+
+	if(!s_bArmed.load(std::memory_order_relaxed) || s_bInHook)
+	{
+		return;
+	}
+	s_uAllocCount.fetch_add(1, std::memory_order_relaxed);
+
+	if(s_bVerbose)
+	{
+		// 呼び出し元を表示する(表示中の確保は数えない)
+		s_bInHook = true;
+		fprintf(stderr, "%s(%zu)\n", pFunc, size);
+		iDepth = backtrace(pFrame, BACKTRACE_DEPTH);
+		backtrace_symbols_fd(pFrame, iDepth, STDERR_FILENO);
+		s_bInHook = false;
+	}
+}
+
+extern "C"
+{
+	void* malloc(size_t size)
+	{
+		RecordAlloc("malloc", size);
+		return __libc_malloc(size);
+	}
+
+	void* calloc(size_t nmemb, size_t size)
+	{
+		RecordAlloc("calloc", nmemb*size);
+		return __libc_calloc(nmemb, size);
+	}
+
+	void* realloc(void *ptr, size_t size)
+	{
+		RecordAlloc("realloc", size);
+		return __libc_realloc(ptr, size);
+	}
+
+	void free(void *ptr)
+	{
+		__libc_free(ptr);
+	}
+}
+
+void* operator new(size_t size)
+{
+	void *ptr = NULL;
+
+	RecordAlloc("operator new", size);
+	ptr = __libc_malloc((0 < size) ? size : 1);
+	if(ptr == NULL)
+	{
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void* operator new[](size_t size)
+{
+	void *ptr = NULL;
+
+	RecordAlloc("operator new[]", size);
+	ptr = __libc_malloc((0 < size) ? size : 1);
+	if(ptr == NULL)
+	{
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	RecordAlloc("operator new", size);
+	return __libc_malloc((0 < size) ? size : 1);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	RecordAlloc("operator new[]", size);
+	return __libc_malloc((0 < size) ? size : 1);
+}
+
+void operator delete(void *ptr) noexcept
+{
+	__libc_free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+	__libc_free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+	__libc_free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+	__libc_free(ptr);
+}
+
+/*!
+ * SHボードを代用する疑似端末
+ */
+struct PSEUDO_BOARD_t
+{
+	int iMaster;						/*!< マスタ側のファイルディスクリプタ		*/
+	std::string sSlaveName;				/*!< スレーブ側のデバイス名(RTCが開く)		*/
+	uint32_t uPulseCountR;				/*!< 右モータの累積パルス数					*/
+	uint32_t uPulseCountL;				/*!< 左モータの累積パルス数					*/
+};
+
+/*!
+ * 疑似端末を開く
+ * @param  [out] stBoard 疑似端末
+ * @retval true 成功
+ * @retval false 失敗
+ */
+static bool OpenBoard(PSEUDO_BOARD_t &stBoard)
+{
+	stBoard.iMaster = posix_openpt(O_RDWR | O_NOCTTY);
+	if(stBoard.iMaster < 0)
+	{
+		perror("posix_openpt");
+		return false;
+	}
+	if((grantpt(stBoard.iMaster) != 0) || (unlockpt(stBoard.iMaster) != 0) || (ptsname(stBoard.iMaster) == NULL))
+	{
+		perror("grantpt/unlockpt");
+		close(stBoard.iMaster);
+		return false;
+	}
+	stBoard.sSlaveName = ptsname(stBoard.iMaster);
+	stBoard.uPulseCountR = 0;
+	stBoard.uPulseCountL = 0;
+
+	return true;
+}
+
+/*!
+ * 動作コマンドを読み込んでフィードバックを返す(SHボードの応答を模擬する)
+ * @param  stBoard  疑似端末
+ * @param  bCorrupt 不正なフィードバックを返すか
+ * @retval true 成功
+ * @retval false 失敗(動作コマンドの書式不正)
+ * @remark 停止指令が続けて書き込まれていた場合は、先頭の指令に応答する
+ */
+static bool ReplyBoard(PSEUDO_BOARD_t &stBoard, bool bCorrupt)
+{
+	char szCommand[SEND_BUFF_MAX + 1] = {0};
+	char szFeedback[RECV_BUFF_MAX] = {0};
+	double dPwmR = 0.0;
+	double dPwmL = 0.0;
+	ssize_t iSize = 0;
+	int iLength = 0;
+
+	iSize = read(stBoard.iMaster, szCommand, SEND_BUFF_MAX);
+	if(iSize <= 0)
+	{
+		return false;
+	}
+	szCommand[iSize] = '\0';
+	if(sscanf(szCommand, "s[%lf:%lf]e", &dPwmR, &dPwmL) != 2)
+	{
+		printf("invalid command: %s\n", szCommand);
+		return false;
+	}
+
+	// 指令の向きにパルス数を進めて返す
+	stBoard.uPulseCountR += (0.0 <= dPwmR) ? PULSE_PER_CYCLE : -PULSE_PER_CYCLE;
+	stBoard.uPulseCountL += (0.0 <= dPwmL) ? PULSE_PER_CYCLE : -PULSE_PER_CYCLE;
+	if(bCorrupt)
+	{
+		iLength = snprintf(szFeedback, sizeof(szFeedback), "s[%X]e", stBoard.uPulseCountR);
+	}
+	else
+	{
+		iLength = snprintf(szFeedback, sizeof(szFeedback), "s[%X:%X][%.2f:%.2f][%.2f:%.2f]e", stBoard.uPulseCountR, stBoard.uPulseCountL, dPwmR, 1.0, dPwmL, 1.0);
+	}
+
+	return (write(stBoard.iMaster, szFeedback, iLength) == iLength);
+}
+
+
+/*!
+ * 現在時刻を取得する(CrawlerCycleが記録するフィードバック時刻と同じ時計)
+ * @return 現在時刻 [s]
+ */
+static double GetTime(void)
+{
+	struct timeval ti = {0};
+
+	gettimeofday(&ti, NULL);
+	return (double)ti.tv_sec + (double)ti.tv_usec/1000000.0;
+}
+
+int main(int argc, char *argv[])
+{
+	MainMotorProcessor MainMotor;
+	SubMotorProcessor FrontSubMotor;
+	SubMotorProcessor BackSubMotor;
+	OrientationInterpolator OrientationHistory;
+	CrawlerCycle Cycle(MainMotor, FrontSubMotor, BackSubMotor, OrientationHistory);
+	FlipperAngleFile AngleFile;
+	MetricHistogram ExecuteTimeMetric;
+	PSEUDO_BOARD_t stBoard[SH_BOARD_NUM];
+	const std::string sBaudrate("B57600");
+	char szTempDir[] = "/tmp/AllocCheck.XXXXXX";
+	unsigned long ulCycles = 1000;
+	unsigned long ulParseError = 0;
+	unsigned long ulParseErrorExpected = 0;
+	unsigned long ulEStop = 0;
+	uint64_t uSelfCheck = 0;
+	uint64_t uAllocations = 0;
+	bool bPass = false;
+	int iOpt = 0;
+
+	while((iOpt = getopt(argc, argv, "n:vh")) != -1)
+	{
+		switch(iOpt)
+		{
+		case 'n':
+			ulCycles = strtoul(optarg, NULL, 10);
+			break;
+		case 'v':
+			s_bVerbose = true;
+			break;
+		default:
+			printf("usage: %s [-n cycles] [-v]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	// 確保を数えられることを確認する(最適化で消されないようvolatileで受ける)
+	s_bArmed = true;
+	int *volatile pCheck = new int(0);
+	delete pCheck;
+	s_bArmed = false;
+	uSelfCheck = s_uAllocCount.exchange(0);
+	if(uSelfCheck == 0)
+	{
+		printf("allocation hook is not working\n");
+		printf("cycles=0 allocations=0 result=FAIL\n");
+		return 1;
+	}
+
+	// 活性化に相当する初期化を行う
+	for(int i = 0; i < SH_BOARD_NUM; i++)
+	{
+		if(!OpenBoard(stBoard[i]))
+		{
+			return 1;
+		}
+		Cycle.SetDevice(i, stBoard[i].sSlaveName, sBaudrate);
+	}
+	if(mkdtemp(szTempDir) == NULL)
+	{
+		perror("mkdtemp");
+		return 1;
+	}
+	AngleFile.SetPath(szTempDir, ".FlipperAngle.txt");
+	ExecuteTimeMetric.Register("alloccheck.execute");
+	Cycle.RegisterMetrics("alloccheck");
+	Cycle.InitOrientation();
+
+	// コンフィグレーションの既定値(RTC_Spider2020_Crawler.cpp)を設定する
+	MainMotor.SetConfig(0.0938, 0.42, 4.00, 0.02, 1.0, 1.0);
+	MainMotor.SetConfigR(1, 1000, 0.0769, 243.0, 7.5, 2.0);
+	MainMotor.SetConfigL(1, 1000, 0.0769, 243.0, 7.5, 2.0);
+	FrontSubMotor.SetConfigR(1, 512, 0.0486, 1080.0, 7.5, 2.0);
+	FrontSubMotor.SetConfigL(1, 512, 0.0486, 1080.0, 7.5, 2.0);
+	BackSubMotor.SetConfigR(1, 512, 0.0486, 1080.0, 7.5, 2.0);
+	BackSubMotor.SetConfigL(1, 512, 0.0486, 1080.0, 7.5, 2.0);
+
+	// 最初の周期(printfなどの初回のバッファ確保を含む)の後から数える
+	for(unsigned long ulCycle = 0; ulCycle <= ulCycles; ulCycle++)
+	{
+		long lUseOrientation3D = (long)(ulCycle % 3);
+		double dVa = ((ulCycle/100) % 2 == 0) ? 0.1 : -0.1;
+		double dYaw = remainder(0.2*ulCycle, 2.0*M_PI);
+		int iCorruptBoard = ((ulCycle % PARSE_ERROR_INTERVAL) == 0) ? (int)((ulCycle/PARSE_ERROR_INTERVAL) % SH_BOARD_NUM) : -1;
+		bool bEStop = ((ulCycle % ESTOP_INTERVAL) == 0);
+		int64_t iExecuteStartNs = 0;
+
+		if(ulCycle == 1)
+		{
+			s_bArmed = true;
+		}
+		iExecuteStartNs = MetricsRegistry::GetTimeNs();
+
+		// 外部観測した姿勢を更新する(最新値はポートの受信時、履歴は送信の前後の時刻で追加する)
+		if(lUseOrientation3D == 1)
+		{
+			Cycle.UpdateOrientation3D(0.01, 0.0, dYaw);
+		}
+		OrientationHistory.Push(GetTime(), 0.01, 0.0, dYaw);
+
+		// 動作コマンドを送信する
+		Cycle.SendMoveCommand(0.2, 0.0, dVa, 30, -30, 30, -30);
+
+		// フィードバック待ちの間の非常停止を模擬する
+		if(bEStop)
+		{
+			Cycle.SendStopCommand();
+			ulEStop++;
+		}
+
+		// SHボードの応答を模擬する
+		for(int i = 0; i < SH_BOARD_NUM; i++)
+		{
+			ReplyBoard(stBoard[i], (i == iCorruptBoard));
+		}
+		OrientationHistory.Push(GetTime(), 0.01, 0.0, dYaw);
+
+		// フィードバックを受信・解析してオドメトリを求める
+		if(!Cycle.RecvFeedback(CYCLE_PERIOD, 0.2, 0.0, dVa, lUseOrientation3D))
+		{
+			ulParseError++;
+		}
+		if((0 <= iCorruptBoard) && !bEStop)
+		{
+			ulParseErrorExpected++;
+		}
+
+		// 周期の外の非常停止を模擬する(次の周期のオープンで応答が破棄される)
+		if(bEStop)
+		{
+			Cycle.SendStopCommand();
+		}
+
+		// フリッパーの角度を保存する
+		AngleFile.Save(FrontSubMotor.GetAngleR(), FrontSubMotor.GetAngleL(), BackSubMotor.GetAngleR(), BackSubMotor.GetAngleL());
+
+		ExecuteTimeMetric.RecordSince(iExecuteStartNs);
+	}
+	s_bArmed = false;
+	uAllocations = s_uAllocCount.load();
+	bPass = ((uAllocations == 0) && (ulParseError == ulParseErrorExpected));
+
+	// 後片付けをする
+	unlink(AngleFile.GetPath());
+	rmdir(szTempDir);
+	for(int i = 0; i < SH_BOARD_NUM; i++)
+	{
+		close(stBoard[i].iMaster);
+	}
+
+	printf("cycles: %lu, parse errors: %lu (expected %lu), emergency stops: %lu, allocations: %llu\n", ulCycles, ulParseError, ulParseErrorExpected, ulEStop, (unsigned long long)uAllocations);
+	printf("position: x=%.3f y=%.3f yaw=%.3f\n", MainMotor.GetPositionX(), MainMotor.GetPositionY(), MainMotor.GetOrientationY());
+	printf("cycles=%lu parse_errors=%lu estops=%lu allocations=%llu result=%s\n", ulCycles, ulParseError, ulEStop, (unsigned long long)uAllocations, bPass ? "PASS" : "FAIL");
+
+	return bPass ? 0 : 1;
+}
@@ -0,0 +1,518 @@
+// -*- C++ -*-
+/*!
+ * @file MotorLoopSim.cpp
+ * @brief 台車制御の閉ループを仮想時間で実行して制御性能を評価する
+ * @date 2026/10/19
+ *
+ * RTC_Spider2020_CrawlerのMainMotorProcessor(PID速度制御、オドメトリ)と
+ * SubMotorProcessor(フリッパーの角度)を、SHボードの物理モデル
+ * (SHBoardModel)と同一プロセス内で接続し、仮想時間で実行する。
+ * シリアル通信、待ち時間、OpenRTMを含まないため、実時間(20Hz)より
+ * 十分に速く実行できる。動作コマンドとフィードバックは実機と同じ
+ * 文字列を経由する(GenMoveCommand、AnalyzeFeedbackの解析を含む)。
+ * -dを指定すると文字列を経由せず、PID速度制御とフィードバックの処理
+ * (CalcMovePwm、ApplyFeedback)を直接接続する。処理時間の大半を占める
+ * 文字列の生成・解析を省くため高速だが、書式による丸めを含まない。
+ *
+ * 車体の真値(TrackBodyModel)はオドメトリとは独立に円弧で積分し、
+ * 既定でクローラの滑り(-s)と旋回の滑り(-t)を与える。オドメトリは
+ * 滑りを観測できないため、既定値では drift、yaw_err は０にならない。
+ * オドメトリ単体の誤差は -s 0 -t 0 で評価する。
+ *
+ * シナリオ毎に以下を出力する。
+ *   track_rms   左右のクローラの目標速度と実速度の誤差(RMS) [m/s]
+ *   overshoot   ステップ応答の行き過ぎ量 [%]
+ *   settle      ステップ応答の整定時間(目標の±5%) [s]
+ *   drift       オドメトリと真値の位置の誤差 [m] (走行距離に対する割合 [%])
+ *   yaw_err     オドメトリと真値の姿勢(Yaw)の誤差 [deg]
+ *   flipper_err フリッパーの角度と真値の誤差の最大値 [deg]
+ *
+ * 使用例:
+ *   MotorLoopSim                               (既定値のコンフィグレーション)
+ *   MotorLoopSim -f ../RTC_Spider2020_Crawler.conf -s 0.05   (クローラの滑り5%)
+ *   MotorLoopSim -s 0 -t 0                     (滑りなしでオドメトリ単体の誤差を評価する)
+ *   MotorLoopSim -n 1000 -q                    (1000回繰り返して処理速度を計測する)
+ *   MotorLoopSim -n 1000 -q -d -k 1            (文字列を経由せずに処理速度を計測する)
+ *   MotorLoopSim -p 0.05 -j 0.2                (実行周期50ms±20%)
+ * 最終行に集計を key=value 形式で出力する。
+ */
+
+#include "MainMotorProcessor.h"
+#include "SubMotorProcessor.h"
+#include "SHCommunicator.h"
+#include "SHBoardModel.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SETTLE_BAND			(0.05)		/*!< 整定とみなす目標との誤差の割合		*/
+#define MIN_DISTANCE		(0.01)		/*!< 走行距離に対する割合を求める最小の走行距離 [m]	*/
+#define DEFAULT_SLIP		(0.03)		/*!< クローラの滑り率の既定値				*/
+#define DEFAULT_TURN_SLIP	(0.1)		/*!< 旋回の滑り率の既定値					*/
+
+/*!
+ * 制御周期毎の指令
+ */
+struct LOOP_INPUT_t
+{
+	double dVx;				/*!< ２次元の並進速度 [m/s]					*/
+	double dVa;				/*!< ２次元の回転速度 [rad/s]				*/
+	int32_t iFlipperPwm;	/*!< フリッパーのPWM(４つ共通) [%]			*/
+};
+
+/*!
+ * シナリオ
+ */
+struct LOOP_SCENARIO_t
+{
+	const char *pName;						/*!< シナリオ名									*/
+	double dDuration;						/*!< 実行時間 [s]								*/
+	double dStepEnd;						/*!< ステップ応答を評価する区間の終了時刻 [s]	*/
+	double dStepVx;							/*!< ステップ応答の目標並進速度(0は評価しない)	*/
+	double dStepVa;							/*!< ステップ応答の目標回転速度(0は評価しない)	*/
+	void (*pfnInput)(double dTime, LOOP_INPUT_t &stInput);	/*!< 指令を求める関数		*/
+};
+
+/*!
+ * シナリオの評価結果
+ */
+struct LOOP_RESULT_t
+{
+	unsigned long ulSteps;		/*!< 制御周期の数								*/
+	unsigned long ulParseErrors;/*!< フィードバックの解析失敗数					*/
+	double dTrackRms;			/*!< 目標速度と実速度の誤差(RMS) [m/s]			*/
+	double dOvershoot;			/*!< ステップ応答の行き過ぎ量 [%] (負は評価なし)	*/
+	double dSettle;				/*!< ステップ応答の整定時間 [s] (負は評価なし)		*/
+	double dDrift;				/*!< オドメトリの位置の誤差 [m]					*/
+	double dDistance;			/*!< 走行距離(真値) [m]							*/
+	double dYawError;			/*!< オドメトリの姿勢の誤差 [rad]				*/
+	double dFlipperError;		/*!< フリッパーの角度の誤差の最大値 [rad]		*/
+};
+
+/*!
+ * シミュレーションの設定
+ */
+struct LOOP_CONFIG_t
+{
+	CRAWLER_SIM_CONF_t stConf;	/*!< RTC_Spider2020_Crawlerのコンフィグレーション	*/
+	double dSlip;				/*!< クローラの滑り率							*/
+	double dTurnSlip;			/*!< 旋回の滑り率								*/
+	double dPeriod;				/*!< 実行周期 [s]								*/
+	double dJitter;				/*!< 実行周期の揺らぎ(実行周期に対する割合)		*/
+	int iSubSteps;				/*!< 実行周期あたりの物理モデルの積分回数		*/
+	bool bDirect;				/*!< 文字列を経由せずに接続するか				*/
+};
+
+// 前進のステップ応答
+static void InputForward(double dTime, LOOP_INPUT_t &stInput)
+{
+	stInput.dVx = (dTime < 5.0) ? 0.1 : 0.0;
+	stInput.dVa = 0.0;
+	stInput.iFlipperPwm = 10;
+}
+
+// 後退のステップ応答
+static void InputBackward(double dTime, LOOP_INPUT_t &stInput)
+{
+	stInput.dVx = (dTime < 5.0) ? -0.1 : 0.0;
+	stInput.dVa = 0.0;
+	stInput.iFlipperPwm = 10;
+}
+
+// 超信地旋回のステップ応答
+static void InputSpin(double dTime, LOOP_INPUT_t &stInput)
+{
+	stInput.dVx = 0.0;
+	stInput.dVa = (dTime < 5.0) ? 0.5 : 0.0;
+	stInput.iFlipperPwm = 10;
+}
+
+// 円弧の走行
+static void InputArc(double dTime, LOOP_INPUT_t &stInput)
+{
+	stInput.dVx = (dTime < 10.0) ? 0.1 : 0.0;
+	stInput.dVa = (dTime < 10.0) ? 0.3 : 0.0;
+	stInput.iFlipperPwm = 10;
+}
+
+// 操縦を模擬した速度の変化(Motionの最大速度0.15m/s、0.785rad/s以内)
+static void InputSlalom(double dTime, LOOP_INPUT_t &stInput)
+{
+	stInput.dVx = (dTime < 20.0) ? 0.12 + 0.03*sin(2.0*M_PI*dTime/7.0) : 0.0;
+	stInput.dVa = (dTime < 20.0) ? 0.6*sin(2.0*M_PI*dTime/5.0) : 0.0;
+	stInput.iFlipperPwm = 10;
+}
+
+// フリッパーの上昇・下降
+static void InputFlipper(double dTime, LOOP_INPUT_t &stInput)
+{
+	stInput.dVx = 0.0;
+	stInput.dVa = 0.0;
+	stInput.iFlipperPwm = (dTime < 2.0) ? 90 : ((dTime < 4.0) ? -90 : 10);
+}
+
+static const LOOP_SCENARIO_t s_stScenario[] =
+{
+	{"forward",		7.0,	5.0,	0.1,	0.0,	InputForward},
+	{"backward",	7.0,	5.0,	-0.1,	0.0,	InputBackward},
+	{"spin",		7.0,	5.0,	0.0,	0.5,	InputSpin},
+	{"arc",			12.0,	0.0,	0.0,	0.0,	InputArc},
+	{"slalom",		22.0,	0.0,	0.0,	0.0,	InputSlalom},
+	{"flipper",		5.0,	0.0,	0.0,	0.0,	InputFlipper},
+};
+
+/*!
+ * 単調増加時刻を取得する
+ * @return 時刻 [s]
+ */
+static double GetTime(void)
+{
+	struct timespec stTime = {0};
+
+	clock_gettime(CLOCK_MONOTONIC, &stTime);
+
+	return (double)stTime.tv_sec + (double)stTime.tv_nsec/1000000000.0;
+}
+
+/*!
+ * 角度を-π～πに正規化する
+ * @param  dAngle 角度 [rad]
+ * @return 正規化した角度 [rad]
+ */
+static double NormalizeAngle(double dAngle)
+{
+	return atan2(sin(dAngle), cos(dAngle));
+}
+
+/*!
+ * シナリオを仮想時間で実行する
+ * @param  stScenario シナリオ
+ * @param  stConfig シミュレーションの設定
+ * @param  [out] stResult 評価結果
+ * @return なし
+ */
+static void RunScenario(const LOOP_SCENARIO_t &stScenario, const LOOP_CONFIG_t &stConfig, LOOP_RESULT_t &stResult)
+{
+	const CRAWLER_SIM_CONF_t &stConf = stConfig.stConf;
+	MainMotorProcessor MainMotor;
+	SubMotorProcessor FrontSubMotor;
+	SubMotorProcessor BackSubMotor;
+	SHBoardModel MainBoard;
+	SHBoardModel FrontBoard;
+	SHBoardModel BackBoard;
+	TrackBodyModel Body;
+	SH_MOTOR_MODEL_t stMainModel = {0};
+	SH_MOTOR_MODEL_t stSubModel = {0};
+	LOOP_INPUT_t stInput = {0};
+	char szCommand[SEND_BUFF_MAX] = {0};
+	char szFeedback[RECV_BUFF_MAX + 1] = {0};
+	int iPulseR = 0;
+	int iPulseL = 0;
+	double dRpmR = 0.0;
+	double dRpmL = 0.0;
+	double dLoadR = 0.0;
+	double dLoadL = 0.0;
+	double dPwmR = 0.0;
+	double dPwmL = 0.0;
+	double dTime = 0.0;
+	double dPeriod = stConfig.dPeriod;
+	double dLastPeriod = stConfig.dPeriod;
+	double dTargetR = 0.0;
+	double dTargetL = 0.0;
+	double dErrorSum = 0.0;
+	double dPeak = 0.0;
+	double dTarget = 0.0;
+	double dActual = 0.0;
+	double dLastOutside = 0.0;
+	double dDt = 0.0;
+	bool bInside = false;
+
+	memset(&stResult, 0, sizeof(stResult));
+	stResult.dOvershoot = -1.0;
+	stResult.dSettle = -1.0;
+
+	// 活性化と同じ順序でコンフィグレーションを設定する
+	MainMotor.SetConfig(stConf.dTurningRadius, stConf.dKP, stConf.dKI, stConf.dKD, stConf.dVxGain, stConf.dVaGain);
+	MainMotor.SetConfigR(stConf.iMainDirectionR, stConf.iMainPulse, stConf.dWheelRadius, stConf.dMainGearRatio, stConf.dMainLoadGain, stConf.dMainLoadBase);
+	MainMotor.SetConfigL(stConf.iMainDirectionL, stConf.iMainPulse, stConf.dWheelRadius, stConf.dMainGearRatio, stConf.dMainLoadGain, stConf.dMainLoadBase);
+	FrontSubMotor.SetConfigR(stConf.iFrontDirectionR, stConf.iSubPulse, stConf.dPulleyRadius, stConf.dSubGearRatio, stConf.dSubLoadGain, stConf.dSubLoadBase);
+	FrontSubMotor.SetConfigL(stConf.iFrontDirectionL, stConf.iSubPulse, stConf.dPulleyRadius, stConf.dSubGearRatio, stConf.dSubLoadGain, stConf.dSubLoadBase);
+	BackSubMotor.SetConfigR(stConf.iBackDirectionR, stConf.iSubPulse, stConf.dPulleyRadius, stConf.dSubGearRatio, stConf.dSubLoadGain, stConf.dSubLoadBase);
+	BackSubMotor.SetConfigL(stConf.iBackDirectionL, stConf.iSubPulse, stConf.dPulleyRadius, stConf.dSubGearRatio, stConf.dSubLoadGain, stConf.dSubLoadBase);
+	MakeMainMotorModel(stConf, stConfig.dSlip, stMainModel);
+	MakeSubMotorModel(stConf, stSubModel);
+	MainBoard.SetModel(stMainModel);
+	FrontBoard.SetModel(stSubModel);
+	BackBoard.SetModel(stSubModel);
+	Body.SetTurnSlip(stConfig.dTurnSlip);
+
+	while(dTime < stScenario.dDuration)
+	{
+		stScenario.pfnInput(dTime, stInput);
+
+		if(stConfig.bDirect)
+		{
+			// 動作コマンドのPWMを直接与える(SHボードは受信時点のフィードバックを確定する)
+			MainMotor.CalcMovePwm(stInput.dVx, 0.0, stInput.dVa, dPwmR, dPwmL);
+			MainBoard.SetCommand(dPwmR, dPwmL);
+			FrontBoard.SetCommand(stInput.iFlipperPwm*stConf.iFrontDirectionR, stInput.iFlipperPwm*stConf.iFrontDirectionL);
+			BackBoard.SetCommand(stInput.iFlipperPwm*stConf.iBackDirectionR, stInput.iFlipperPwm*stConf.iBackDirectionL);
+
+			// フィードバックを直接処理する(前回からの経過時間で処理する)
+			MainBoard.GetFeedback(SH_SIDE_R, iPulseR, dRpmR, dLoadR);
+			MainBoard.GetFeedback(SH_SIDE_L, iPulseL, dRpmL, dLoadL);
+			MainMotor.ApplyFeedback(dLastPeriod, stInput.dVx, 0.0, stInput.dVa, iPulseR, iPulseL, dRpmR, dLoadR, dRpmL, dLoadL);
+			MainMotor.CalcOdometry(dLastPeriod);
+			FrontBoard.GetFeedback(SH_SIDE_R, iPulseR, dRpmR, dLoadR);
+			FrontBoard.GetFeedback(SH_SIDE_L, iPulseL, dRpmL, dLoadL);
+			FrontSubMotor.ApplyFeedback(dLastPeriod, iPulseR, iPulseL, dRpmR, dLoadR, dRpmL, dLoadL);
+			BackBoard.GetFeedback(SH_SIDE_R, iPulseR, dRpmR, dLoadR);
+			BackBoard.GetFeedback(SH_SIDE_L, iPulseL, dRpmL, dLoadL);
+			BackSubMotor.ApplyFeedback(dLastPeriod, iPulseR, iPulseL, dRpmR, dLoadR, dRpmL, dLoadL);
+		}
+		else
+		{
+			// 動作コマンドを送信する(SHボードは受信時点のフィードバックを確定する)
+			if(MainMotor.GenMoveCommand(stInput.dVx, 0.0, stInput.dVa, szCommand, sizeof(szCommand)) == 0 || !MainBoard.ParseCommand(szCommand))
+			{
+				stResult.ulParseErrors++;
+			}
+			if(FrontSubMotor.GenMoveCommand(stInput.iFlipperPwm, stInput.iFlipperPwm, szCommand, sizeof(szCommand)) == 0 || !FrontBoard.ParseCommand(szCommand))
+			{
+				stResult.ulParseErrors++;
+			}
+			if(BackSubMotor.GenMoveCommand(stInput.iFlipperPwm, stInput.iFlipperPwm, szCommand, sizeof(szCommand)) == 0 || !BackBoard.ParseCommand(szCommand))
+			{
+				stResult.ulParseErrors++;
+			}
+
+			// フィードバックを受信して解析する(前回からの経過時間で処理する)
+			MainBoard.GenFeedback(szFeedback, sizeof(szFeedback));
+			if(MainMotor.AnalyzeFeedback(dLastPeriod, stInput.dVx, 0.0, stInput.dVa, szFeedback))
+			{
+				MainMotor.CalcOdometry(dLastPeriod);
+			}
+			else
+			{
+				stResult.ulParseErrors++;
+			}
+			FrontBoard.GenFeedback(szFeedback, sizeof(szFeedback));
+			if(!FrontSubMotor.AnalyzeFeedback(dLastPeriod, szFeedback))
+			{
+				stResult.ulParseErrors++;
+			}
+			BackBoard.GenFeedback(szFeedback, sizeof(szFeedback));
+			if(!BackSubMotor.AnalyzeFeedback(dLastPeriod, szFeedback))
+			{
+				stResult.ulParseErrors++;
+			}
+		}
+
+		// 次の周期までの経過時間を求める
+		dPeriod = stConfig.dPeriod;
+		if(0.0 < stConfig.dJitter)
+		{
+			dPeriod *= 1.0 + stConfig.dJitter*(2.0*((double)rand()/((double)RAND_MAX + 1.0)) - 1.0);
+		}
+
+		// 物理モデルと車体の真値を積分する
+		dDt = dPeriod/stConfig.iSubSteps;
+		for(int i = 0; i < stConfig.iSubSteps; i++)
+		{
+			MainBoard.Step(dDt);
+			FrontBoard.Step(dDt);
+			BackBoard.Step(dDt);
+			Body.Step(MainBoard.GetGroundVelocity(SH_SIDE_R)*stConf.iMainDirectionR, MainBoard.GetGroundVelocity(SH_SIDE_L)*stConf.iMainDirectionL, stConf.dTurningRadius, dDt);
+			stResult.dDistance += fabs(Body.m_dVx)*dDt;
+		}
+		dTime += dPeriod;
+		dLastPeriod = dPeriod;
+		stResult.ulSteps++;
+
+		// 左右のクローラの目標速度と実速度(滑りを含まない周速度)の誤差を積算する
+		dTargetR = stInput.dVx + stInput.dVa*stConf.dTurningRadius;
+		dTargetL = stInput.dVx - stInput.dVa*stConf.dTurningRadius;
+		dErrorSum += pow(dTargetR - MainBoard.GetWheelVelocity(SH_SIDE_R)*stConf.iMainDirectionR, 2.0);
+		dErrorSum += pow(dTargetL - MainBoard.GetWheelVelocity(SH_SIDE_L)*stConf.iMainDirectionL, 2.0);
+
+		// ステップ応答の行き過ぎ量と整定時間を求める
+		if(dTime <= stScenario.dStepEnd)
+		{
+			dTarget = (stScenario.dStepVx != 0.0) ? stScenario.dStepVx : stScenario.dStepVa;
+			dActual = (stScenario.dStepVx != 0.0) ? Body.m_dVx : Body.m_dVa;
+			if(dTarget != 0.0)
+			{
+				dPeak = fmax(dPeak, dActual/dTarget);
+				bInside = (fabs(dActual/dTarget - 1.0) <= SETTLE_BAND);
+				if(!bInside)
+				{
+					dLastOutside = dTime;
+				}
+			}
+		}
+	}
+
+	// 評価結果をまとめる
+	stResult.dTrackRms = sqrt(dErrorSum/(2.0*stResult.ulSteps));
+	if((stScenario.dStepVx != 0.0) || (stScenario.dStepVa != 0.0))
+	{
+		stResult.dOvershoot = fmax(0.0, (dPeak - 1.0)*100.0);
+		stResult.dSettle = bInside ? dLastOutside : -1.0;
+	}
+	stResult.dDrift = hypot(MainMotor.GetPositionX() - Body.m_dX, MainMotor.GetPositionY() - Body.m_dY);
+	stResult.dYawError = NormalizeAngle(MainMotor.GetOrientationY() - Body.m_dYaw);
+	stResult.dFlipperError = fmax(fmax(fabs(FrontSubMotor.GetAngleR() - FrontBoard.GetWheelAngle(SH_SIDE_R)*stConf.iFrontDirectionR),
+									   fabs(FrontSubMotor.GetAngleL() - FrontBoard.GetWheelAngle(SH_SIDE_L)*stConf.iFrontDirectionL)),
+								  fmax(fabs(BackSubMotor.GetAngleR() - BackBoard.GetWheelAngle(SH_SIDE_R)*stConf.iBackDirectionR),
+									   fabs(BackSubMotor.GetAngleL() - BackBoard.GetWheelAngle(SH_SIDE_L)*stConf.iBackDirectionL)));
+}
+
+int main(int argc, char *argv[])
+{
+	const size_t sizeScenario = sizeof(s_stScenario)/sizeof(s_stScenario[0]);
+	LOOP_CONFIG_t stConfig;
+	LOOP_RESULT_t stResult[sizeof(s_stScenario)/sizeof(s_stScenario[0])];
+	const char *pFilter = NULL;
+	unsigned long ulRepeat = 1;
+	unsigned long ulSteps = 0;
+	unsigned long ulParseErrors = 0;
+	double dStart = 0.0;
+	double dElapsed = 0.0;
+	double dMaxTrackRms = 0.0;
+	double dMaxOvershoot = 0.0;
+	double dMaxDrift = 0.0;
+	double dMaxYawError = 0.0;
+	double dMaxFlipperError = 0.0;
+	bool bQuiet = false;
+	int iOpt = 0;
+
+	InitCrawlerSimConf(stConfig.stConf);
+	stConfig.dSlip = DEFAULT_SLIP;
+	stConfig.dTurnSlip = DEFAULT_TURN_SLIP;
+	stConfig.dPeriod = 0.05;
+	stConfig.dJitter = 0.0;
+	stConfig.iSubSteps = 5;
+	stConfig.bDirect = false;
+
+	while((iOpt = getopt(argc, argv, "f:s:t:p:j:k:n:o:dqh")) != -1)
+	{
+		switch(iOpt)
+		{
+		case 'f':
+			if(!LoadCrawlerSimConf(optarg, stConfig.stConf))
+			{
+				return 1;
+			}
+			break;
+		case 's':
+			stConfig.dSlip = strtod(optarg, NULL);
+			break;
+		case 't':
+			stConfig.dTurnSlip = strtod(optarg, NULL);
+			break;
+		case 'p':
+			stConfig.dPeriod = strtod(optarg, NULL);
+			break;
+		case 'j':
+			stConfig.dJitter = strtod(optarg, NULL);
+			break;
+		case 'k':
+			stConfig.iSubSteps = atoi(optarg);
+			break;
+		case 'n':
+			ulRepeat = strtoul(optarg, NULL, 10);
+			break;
+		case 'o':
+			pFilter = optarg;
+			break;
+		case 'd':
+			stConfig.bDirect = true;
+			break;
+		case 'q':
+			bQuiet = true;
+			break;
+		default:
+			printf("usage: %s [-f crawler_conf] [-s slip] [-t turn_slip] [-p period_sec] [-j jitter_ratio]\n"
+				   "          [-k substeps] [-n repeat] [-o scenario] [-d] [-q]\n", argv[0]);
+			return 2;
+		}
+	}
+	if((stConfig.dPeriod <= 0.0) || (stConfig.iSubSteps <= 0) || (ulRepeat == 0))
+	{
+		printf("invalid period, substeps or repeat\n");
+		return 2;
+	}
+	srand(1);
+
+	// 全てのシナリオを指定回数だけ繰り返す(評価結果は最後の実行とする)
+	dStart = GetTime();
+	for(unsigned long ulRun = 0; ulRun < ulRepeat; ulRun++)
+	{
+		for(size_t i = 0; i < sizeScenario; i++)
+		{
+			if((pFilter != NULL) && (strcmp(pFilter, s_stScenario[i].pName) != 0))
+			{
+				stResult[i].ulSteps = 0;
+				continue;
+			}
+			RunScenario(s_stScenario[i], stConfig, stResult[i]);
+			ulSteps += stResult[i].ulSteps;
+			ulParseErrors += stResult[i].ulParseErrors;
+		}
+	}
+	dElapsed = GetTime() - dStart;
+
+	// シナリオ毎の評価結果を表示する
+	if(!bQuiet)
+	{
+		printf("%-10s %8s %10s %10s %8s %18s %8s %11s\n", "scenario", "steps", "track_rms", "overshoot", "settle", "drift", "yaw_err", "flipper_err");
+	}
+	for(size_t i = 0; i < sizeScenario; i++)
+	{
+		if(stResult[i].ulSteps == 0)
+		{
+			continue;
+		}
+		if(!bQuiet)
+		{
+			char szOvershoot[16] = "-";
+			char szSettle[16] = "-";
+			char szDrift[16] = "";
+
+			if(0.0 <= stResult[i].dOvershoot)
+			{
+				snprintf(szOvershoot, sizeof(szOvershoot), "%.1f%%", stResult[i].dOvershoot);
+			}
+			if(0.0 <= stResult[i].dSettle)
+			{
+				snprintf(szSettle, sizeof(szSettle), "%.2fs", stResult[i].dSettle);
+			}
+			else if(0.0 <= stResult[i].dOvershoot)
+			{
+				snprintf(szSettle, sizeof(szSettle), ">%.1fs", s_stScenario[i].dStepEnd);
+			}
+			if(MIN_DISTANCE <= stResult[i].dDistance)
+			{
+				snprintf(szDrift, sizeof(szDrift), " (%4.1f%%)", stResult[i].dDrift/stResult[i].dDistance*100.0);
+			}
+			printf("%-10s %8lu %10.4f %10s %8s %9.4fm%-8s %7.2fd %10.3fd\n",
+				   s_stScenario[i].pName, stResult[i].ulSteps, stResult[i].dTrackRms, szOvershoot, szSettle,
+				   stResult[i].dDrift, szDrift, stResult[i].dYawError*180.0/M_PI, stResult[i].dFlipperError*180.0/M_PI);
+		}
+		dMaxTrackRms = fmax(dMaxTrackRms, stResult[i].dTrackRms);
+		dMaxOvershoot = fmax(dMaxOvershoot, stResult[i].dOvershoot);
+		dMaxDrift = fmax(dMaxDrift, stResult[i].dDrift);
+		dMaxYawError = fmax(dMaxYawError, fabs(stResult[i].dYawError));
+		dMaxFlipperError = fmax(dMaxFlipperError, stResult[i].dFlipperError);
+	}
+
+	printf("steps=%lu parse_errors=%lu steps_per_sec=%.0f speedup=%.0f max_track_rms=%.4f max_overshoot=%.1f max_drift=%.4f max_yaw_err=%.3f max_flipper_err=%.3f\n",
+		   ulSteps, ulParseErrors, (0.0 < dElapsed) ? ulSteps/dElapsed : 0.0, (0.0 < dElapsed) ? ulSteps*stConfig.dPeriod/dElapsed : 0.0,
+		   dMaxTrackRms, dMaxOvershoot, dMaxDrift, dMaxYawError*180.0/M_PI, dMaxFlipperError*180.0/M_PI);
+
+	return (ulParseErrors == 0) ? 0 : 1;
+}
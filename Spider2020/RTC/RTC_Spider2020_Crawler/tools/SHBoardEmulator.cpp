@@ -0,0 +1,503 @@
+// -*- C++ -*-
+/*!
+ * @file SHBoardEmulator.cpp
+ * @brief 疑似端末(pty)でSHボード３台を模擬する
+ * @date 2026/10/19
+ *
+ * SHボード(メインモータ、前方サブモータ、後方サブモータ)の代わりに
+ * 疑似端末を３つ作成し、RTC_Spider2020_Crawlerの動作コマンド s[pwmR:pwmL]e
+ * を受信して、モータ・減速機・クローラの物理モデル(SHBoardModel)で
+ * 求めたフィードバック s[%X:%X][%lf:%lf][%lf:%lf]e を返す。
+ * パルスカウントは実機と同じく16bitで周回し、動作コマンドを受信した
+ * 時点の値を返す。応答の遅延・揺らぎ、応答の破損・欠落を指定できる。
+ * モータの特性はRTC_Spider2020_Crawler.confの減速比、パルス数、半径、
+ * 負荷の変換を使用する(-fで指定したファイルを読み込む)。
+ *
+ * 疑似端末のスレーブ側のデバイスへのシンボリックリンクを作成するため、
+ * RTCのSH1～3_DEVICE_NAMEにリンク名を指定して起動する。
+ *   SHBoardEmulator -f ../RTC_Spider2020_Crawler.conf -p /tmp/ttySH
+ *   (SH1_DEVICE_NAME: /tmp/ttySH1 ... SH3_DEVICE_NAME: /tmp/ttySH3)
+ *
+ * 使用例:
+ *   SHBoardEmulator -l 8 -j 4           (応答遅延8ms±4ms)
+ *   SHBoardEmulator -c 0.01 -x 0.01     (1%の応答を破損、1%の応答を欠落)
+ *   SHBoardEmulator -w 0xFF00 -t 60     (パルスカウントの周回を早めに発生させ、60秒で終了)
+ * 1秒毎に車体の位置姿勢(真値)とフリッパーの角度を表示し(-qで抑止)、
+ * 終了時の最終行に集計を key=value 形式で出力する。
+ */
+
+#include "SHBoardModel.h"
+#include "SHCommunicator.h"
+
+#include <fcntl.h>
+#include <math.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BOARD_NUM			(3)			/*!< SHボードの数							*/
+#define PENDING_MAX			(8)			/*!< SHボード毎の送信待ちの応答の数			*/
+#define STEP_MAX			(0.001)		/*!< 物理モデルの積分の最大刻み [s]			*/
+#define REPORT_PERIOD		(1.0)		/*!< 状態の表示周期 [s]						*/
+
+/*!
+ * 送信待ちの応答
+ */
+struct PENDING_REPLY_t
+{
+	double dSendTime;					/*!< 送信する時刻 [s]						*/
+	size_t sizeData;					/*!< 応答の長さ								*/
+	char szData[RECV_BUFF_MAX];			/*!< 応答									*/
+};
+
+/*!
+ * 疑似端末で模擬するSHボード
+ */
+struct EMULATED_BOARD_t
+{
+	int iMaster;						/*!< マスタ側のファイルディスクリプタ		*/
+	int iSlave;							/*!< スレーブ側(切断を防ぐため保持する)		*/
+	std::string sSlaveName;				/*!< スレーブ側のデバイス名					*/
+	std::string sLinkName;				/*!< シンボリックリンク名					*/
+	SHBoardModel Model;					/*!< 物理モデル								*/
+	char szRecv[SEND_BUFF_MAX*2];		/*!< 受信中の動作コマンド					*/
+	size_t sizeRecv;					/*!< 受信中の動作コマンドの長さ				*/
+	PENDING_REPLY_t stPending[PENDING_MAX];	/*!< 送信待ちの応答(リングバッファ)		*/
+	size_t sizePendingHead;				/*!< 次に送信する応答の位置					*/
+	size_t sizePendingCount;			/*!< 送信待ちの応答の数						*/
+	unsigned long ulCommands;			/*!< 受信した動作コマンドの数				*/
+	unsigned long ulCommandErrors;		/*!< 書式不正の動作コマンドの数				*/
+	unsigned long ulReplies;			/*!< 送信した応答の数						*/
+	unsigned long ulCorrupted;			/*!< 破損させた応答の数						*/
+	unsigned long ulDropped;			/*!< 欠落させた応答の数						*/
+};
+
+/*!
+ * 応答の遅延と障害の設定
+ */
+struct FAULT_CONFIG_t
+{
+	double dLatency;					/*!< 応答遅延 [s]							*/
+	double dJitter;						/*!< 応答遅延の揺らぎ(±) [s]				*/
+	double dCorruptRate;				/*!< 応答を破損させる割合(0～1)				*/
+	double dDropRate;					/*!< 応答を欠落させる割合(0～1)				*/
+};
+
+static volatile sig_atomic_t s_bExit = 0;	/*!< 終了要求							*/
+
+/*!
+ * 終了要求を受け付ける
+ * @param  iSignal シグナル番号
+ * @return なし
+ */
+static void OnSignal(int iSignal)
+{
+	(void)iSignal;
+	s_bExit = 1;
+}
+
+/*!
+ * 単調増加時刻を取得する
+ * @return 時刻 [s]
+ */
+static double GetTime(void)
+{
+	struct timespec stTime = {0};
+
+	clock_gettime(CLOCK_MONOTONIC, &stTime);
+
+	return (double)stTime.tv_sec + (double)stTime.tv_nsec/1000000000.0;
+}
+
+/*!
+ * 0以上1未満の乱数を取得する
+ * @return 乱数
+ */
+static double Random(void)
+{
+	return (double)rand()/((double)RAND_MAX + 1.0);
+}
+
+/*!
+ * 疑似端末を開いてシンボリックリンクを作成する
+ * @param  [out] stBoard SHボード
+ * @param  sLinkName シンボリックリンク名
+ * @retval true 成功
+ * @retval false 失敗
+ */
+static bool OpenBoard(EMULATED_BOARD_t &stBoard, const std::string &sLinkName)
+{
+	struct termios stTermios = {0};
+
+	stBoard.iMaster = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+	if(stBoard.iMaster < 0)
+	{
+		perror("posix_openpt");
+		return false;
+	}
+	if((grantpt(stBoard.iMaster) != 0) || (unlockpt(stBoard.iMaster) != 0) || (ptsname(stBoard.iMaster) == NULL))
+	{
+		perror("grantpt/unlockpt");
+		close(stBoard.iMaster);
+		return false;
+	}
+	stBoard.sSlaveName = ptsname(stBoard.iMaster);
+
+	// RTCが閉じてもマスタ側が切断されないよう、スレーブ側を無加工モードで開いておく
+	stBoard.iSlave = open(stBoard.sSlaveName.c_str(), O_RDWR | O_NOCTTY);
+	if(stBoard.iSlave < 0)
+	{
+		perror(stBoard.sSlaveName.c_str());
+		close(stBoard.iMaster);
+		return false;
+	}
+	tcgetattr(stBoard.iSlave, &stTermios);
+	cfmakeraw(&stTermios);
+	tcsetattr(stBoard.iSlave, TCSANOW, &stTermios);
+
+	// シンボリックリンクを作成する(既存のリンクは置き換える)
+	stBoard.sLinkName = sLinkName;
+	unlink(sLinkName.c_str());
+	if(symlink(stBoard.sSlaveName.c_str(), sLinkName.c_str()) != 0)
+	{
+		perror(sLinkName.c_str());
+		close(stBoard.iSlave);
+		close(stBoard.iMaster);
+		return false;
+	}
+
+	stBoard.sizeRecv = 0;
+	stBoard.sizePendingHead = 0;
+	stBoard.sizePendingCount = 0;
+	stBoard.ulCommands = 0;
+	stBoard.ulCommandErrors = 0;
+	stBoard.ulReplies = 0;
+	stBoard.ulCorrupted = 0;
+	stBoard.ulDropped = 0;
+
+	return true;
+}
+
+/*!
+ * 疑似端末を閉じてシンボリックリンクを削除する
+ * @param  stBoard SHボード
+ * @return なし
+ */
+static void CloseBoard(EMULATED_BOARD_t &stBoard)
+{
+	unlink(stBoard.sLinkName.c_str());
+	close(stBoard.iSlave);
+	close(stBoard.iMaster);
+}
+
+/*!
+ * 応答を破損させる(１文字の置き換え、または途中で切断する)
+ * @param  [in,out] stReply 応答
+ * @return なし
+ */
+static void CorruptReply(PENDING_REPLY_t &stReply)
+{
+	static const char szNoise[] = "0123456789ABCDEF[]:.-se\r\n";
+	size_t sizePos = (size_t)(Random()*stReply.sizeData);
+
+	if(Random() < 0.5)
+	{
+		stReply.szData[sizePos] = szNoise[(size_t)(Random()*(sizeof(szNoise) - 1))];
+	}
+	else
+	{
+		stReply.sizeData = sizePos;
+	}
+}
+
+/*!
+ * 受信した動作コマンドを処理し、応答を送信待ちにする
+ * @param  stBoard SHボード
+ * @param  stFault 応答の遅延と障害の設定
+ * @param  dNow 現在時刻 [s]
+ * @return なし
+ */
+static void ReceiveCommand(EMULATED_BOARD_t &stBoard, const FAULT_CONFIG_t &stFault, double dNow)
+{
+	PENDING_REPLY_t *pReply = NULL;
+	char szCommand[SEND_BUFF_MAX] = {0};
+	size_t sizeCommand = 0;
+	ssize_t iSize = 0;
+	char *pStart = NULL;
+	char *pEnd = NULL;
+	double dDelay = 0.0;
+	bool bValid = false;
+
+	// 受信できるだけ読み込む
+	while(stBoard.sizeRecv < sizeof(stBoard.szRecv) - 1)
+	{
+		iSize = read(stBoard.iMaster, stBoard.szRecv + stBoard.sizeRecv, sizeof(stBoard.szRecv) - 1 - stBoard.sizeRecv);
+		if(iSize <= 0)
+		{
+			break;
+		}
+		stBoard.sizeRecv += (size_t)iSize;
+	}
+	stBoard.szRecv[stBoard.sizeRecv] = '\0';
+
+	// 's'から'e'までを１つの動作コマンドとして処理する
+	while((pStart = strchr(stBoard.szRecv, 's')) != NULL)
+	{
+		pEnd = strchr(pStart, 'e');
+		if(pEnd == NULL)
+		{
+			break;
+		}
+		sizeCommand = (size_t)(pEnd + 1 - pStart);
+		stBoard.ulCommands++;
+
+		// 動作コマンドを解析する
+		bValid = false;
+		if(sizeCommand < sizeof(szCommand))
+		{
+			memcpy(szCommand, pStart, sizeCommand);
+			szCommand[sizeCommand] = '\0';
+			bValid = stBoard.Model.ParseCommand(szCommand);
+		}
+		if(!bValid)
+		{
+			printf("%s: invalid command: %.*s\n", stBoard.sLinkName.c_str(), (int)sizeCommand, pStart);
+			stBoard.ulCommandErrors++;
+		}
+		else if(stBoard.sizePendingCount < PENDING_MAX)
+		{
+			// 受信時点のフィードバックを遅延させて送信する
+			pReply = &stBoard.stPending[(stBoard.sizePendingHead + stBoard.sizePendingCount) % PENDING_MAX];
+			pReply->sizeData = stBoard.Model.GenFeedback(pReply->szData, sizeof(pReply->szData));
+			dDelay = stFault.dLatency + (Random()*2.0 - 1.0)*stFault.dJitter;
+			pReply->dSendTime = dNow + ((0.0 < dDelay) ? dDelay : 0.0);
+			stBoard.sizePendingCount++;
+		}
+
+		// 処理した動作コマンドを取り除く
+		stBoard.sizeRecv -= (size_t)(pEnd + 1 - stBoard.szRecv);
+		memmove(stBoard.szRecv, pEnd + 1, stBoard.sizeRecv + 1);
+	}
+
+	// 動作コマンドの先頭がなければ破棄する(バッファが溢れる場合も破棄する)
+	if((strchr(stBoard.szRecv, 's') == NULL) || (sizeof(stBoard.szRecv) - 1 <= stBoard.sizeRecv))
+	{
+		stBoard.sizeRecv = 0;
+		stBoard.szRecv[0] = '\0';
+	}
+}
+
+/*!
+ * 送信時刻になった応答を送信する
+ * @param  stBoard SHボード
+ * @param  stFault 応答の遅延と障害の設定
+ * @param  dNow 現在時刻 [s]
+ * @return なし
+ */
+static void SendReply(EMULATED_BOARD_t &stBoard, const FAULT_CONFIG_t &stFault, double dNow)
+{
+	PENDING_REPLY_t *pReply = NULL;
+
+	while(0 < stBoard.sizePendingCount)
+	{
+		pReply = &stBoard.stPending[stBoard.sizePendingHead];
+		if(dNow < pReply->dSendTime)
+		{
+			break;
+		}
+		stBoard.sizePendingHead = (stBoard.sizePendingHead + 1) % PENDING_MAX;
+		stBoard.sizePendingCount--;
+
+		if(Random() < stFault.dDropRate)
+		{
+			stBoard.ulDropped++;
+			continue;
+		}
+		if(Random() < stFault.dCorruptRate)
+		{
+			CorruptReply(*pReply);
+			stBoard.ulCorrupted++;
+		}
+		if(write(stBoard.iMaster, pReply->szData, pReply->sizeData) == (ssize_t)pReply->sizeData)
+		{
+			stBoard.ulReplies++;
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	static const char *szRole[BOARD_NUM] = {"main", "front", "back"};
+	EMULATED_BOARD_t stBoard[BOARD_NUM];
+	struct pollfd stPoll[BOARD_NUM];
+	FAULT_CONFIG_t stFault = {0.008, 0.0, 0.0, 0.0};
+	CRAWLER_SIM_CONF_t stConf;
+	SH_MOTOR_MODEL_t stMainModel = {0};
+	SH_MOTOR_MODEL_t stSubModel = {0};
+	TrackBodyModel Body;
+	std::string sLinkPrefix("/tmp/ttySH");
+	double dSlip = 0.0;
+	double dDuration = 0.0;
+	double dStart = 0.0;
+	double dLast = 0.0;
+	double dNow = 0.0;
+	double dNextReport = 0.0;
+	double dWait = 0.0;
+	double dDt = 0.0;
+	unsigned long ulPulseOffset = 0;
+	unsigned long ulSeed = 1;
+	unsigned long ulCommands = 0;
+	unsigned long ulCommandErrors = 0;
+	unsigned long ulReplies = 0;
+	unsigned long ulCorrupted = 0;
+	unsigned long ulDropped = 0;
+	bool bQuiet = false;
+	int iOpt = 0;
+
+	InitCrawlerSimConf(stConf);
+	while((iOpt = getopt(argc, argv, "f:p:l:j:c:x:s:w:r:t:qh")) != -1)
+	{
+		switch(iOpt)
+		{
+		case 'f':
+			if(!LoadCrawlerSimConf(optarg, stConf))
+			{
+				return 1;
+			}
+			break;
+		case 'p':
+			sLinkPrefix = optarg;
+			break;
+		case 'l':
+			stFault.dLatency = strtod(optarg, NULL)/1000.0;
+			break;
+		case 'j':
+			stFault.dJitter = strtod(optarg, NULL)/1000.0;
+			break;
+		case 'c':
+			stFault.dCorruptRate = strtod(optarg, NULL);
+			break;
+		case 'x':
+			stFault.dDropRate = strtod(optarg, NULL);
+			break;
+		case 's':
+			dSlip = strtod(optarg, NULL);
+			break;
+		case 'w':
+			ulPulseOffset = strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			ulSeed = strtoul(optarg, NULL, 10);
+			break;
+		case 't':
+			dDuration = strtod(optarg, NULL);
+			break;
+		case 'q':
+			bQuiet = true;
+			break;
+		default:
+			printf("usage: %s [-f crawler_conf] [-p link_prefix] [-l latency_ms] [-j jitter_ms]\n"
+				   "          [-c corrupt_rate] [-x drop_rate] [-s slip] [-w pulse_offset] [-r seed] [-t sec] [-q]\n", argv[0]);
+			return 2;
+		}
+	}
+	srand((unsigned int)ulSeed);
+
+	// SHボードの物理モデルを設定する(SH1: メインモータ、SH2: 前方サブモータ、SH3: 後方サブモータ)
+	MakeMainMotorModel(stConf, dSlip, stMainModel);
+	MakeSubMotorModel(stConf, stSubModel);
+	for(int i = 0; i < BOARD_NUM; i++)
+	{
+		if(!OpenBoard(stBoard[i], sLinkPrefix + std::to_string(i + 1)))
+		{
+			for(int j = 0; j < i; j++)
+			{
+				CloseBoard(stBoard[j]);
+			}
+			return 1;
+		}
+		stBoard[i].Model.SetModel((i == 0) ? stMainModel : stSubModel, (uint16_t)ulPulseOffset);
+		stPoll[i].fd = stBoard[i].iMaster;
+		stPoll[i].events = POLLIN;
+		printf("SH%d (%s): %s -> %s\n", i + 1, szRole[i], stBoard[i].sLinkName.c_str(), stBoard[i].sSlaveName.c_str());
+	}
+	printf("latency %.1f ms, jitter %.1f ms, corrupt %.3f, drop %.3f, slip %.3f\n", stFault.dLatency*1000.0, stFault.dJitter*1000.0, stFault.dCorruptRate, stFault.dDropRate, dSlip);
+	fflush(stdout);
+
+	signal(SIGINT, OnSignal);
+	signal(SIGTERM, OnSignal);
+
+	dStart = GetTime();
+	dLast = dStart;
+	dNextReport = dStart + REPORT_PERIOD;
+	while(!s_bExit && ((dDuration <= 0.0) || (GetTime() - dStart < dDuration)))
+	{
+		// 次の応答の送信時刻まで(最大で積分の刻みまで)受信を待つ
+		dWait = STEP_MAX;
+		for(int i = 0; i < BOARD_NUM; i++)
+		{
+			if(0 < stBoard[i].sizePendingCount)
+			{
+				dWait = fmin(dWait, stBoard[i].stPending[stBoard[i].sizePendingHead].dSendTime - GetTime());
+			}
+		}
+		poll(stPoll, BOARD_NUM, (0.0 < dWait) ? (int)ceil(dWait*1000.0) : 0);
+
+		// 経過時間だけ物理モデルを積分する
+		dNow = GetTime();
+		while(dLast < dNow)
+		{
+			dDt = fmin(dNow - dLast, STEP_MAX);
+			for(int i = 0; i < BOARD_NUM; i++)
+			{
+				stBoard[i].Model.Step(dDt);
+			}
+			Body.Step(stBoard[0].Model.GetGroundVelocity(SH_SIDE_R)*stConf.iMainDirectionR, stBoard[0].Model.GetGroundVelocity(SH_SIDE_L)*stConf.iMainDirectionL, stConf.dTurningRadius, dDt);
+			dLast += dDt;
+		}
+
+		// 動作コマンドを受信し、送信時刻になった応答を送信する
+		for(int i = 0; i < BOARD_NUM; i++)
+		{
+			if(stPoll[i].revents & POLLIN)
+			{
+				ReceiveCommand(stBoard[i], stFault, dNow);
+			}
+			SendReply(stBoard[i], stFault, dNow);
+		}
+
+		// 状態を表示する
+		if(!bQuiet && (dNextReport <= dNow))
+		{
+			printf("t=%.0f x=%.3f y=%.3f yaw=%.1f vx=%.3f va=%.3f front=%.1f/%.1f back=%.1f/%.1f [deg] commands=%lu/%lu/%lu\n",
+				   dNow - dStart, Body.m_dX, Body.m_dY, Body.m_dYaw*180.0/M_PI, Body.m_dVx, Body.m_dVa,
+				   stBoard[1].Model.GetWheelAngle(SH_SIDE_R)*180.0/M_PI, stBoard[1].Model.GetWheelAngle(SH_SIDE_L)*180.0/M_PI,
+				   stBoard[2].Model.GetWheelAngle(SH_SIDE_R)*180.0/M_PI, stBoard[2].Model.GetWheelAngle(SH_SIDE_L)*180.0/M_PI,
+				   stBoard[0].ulCommands, stBoard[1].ulCommands, stBoard[2].ulCommands);
+			fflush(stdout);
+			dNextReport += REPORT_PERIOD;
+		}
+	}
+
+	// 集計して後片付けをする
+	for(int i = 0; i < BOARD_NUM; i++)
+	{
+		ulCommands += stBoard[i].ulCommands;
+		ulCommandErrors += stBoard[i].ulCommandErrors;
+		ulReplies += stBoard[i].ulReplies;
+		ulCorrupted += stBoard[i].ulCorrupted;
+		ulDropped += stBoard[i].ulDropped;
+		CloseBoard(stBoard[i]);
+	}
+
+	printf("commands=%lu command_errors=%lu replies=%lu corrupted=%lu dropped=%lu x=%.4f y=%.4f yaw=%.4f\n",
+		   ulCommands, ulCommandErrors, ulReplies, ulCorrupted, ulDropped, Body.m_dX, Body.m_dY, Body.m_dYaw);
+
+	return 0;
+}
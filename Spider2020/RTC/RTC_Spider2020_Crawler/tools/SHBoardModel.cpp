@@ -0,0 +1,344 @@
+#include "SHBoardModel.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*! @name コンフィグレーションにないモータの特性(標準値)
+ *	メインモータの無負荷回転数は、Motor::CalcFeedbackが想定する
+ *	5000[パルス/周期](1000パルス、50ms周期)から求めた
+ */
+/*  @{ */
+#define MAIN_NO_LOAD_RPM		(6000.0)	/*!< メインモータの無負荷回転数 [rpm]		*/
+#define MAIN_TIME_CONSTANT		(0.08)		/*!< メインモータの機械的時定数 [s]			*/
+#define MAIN_STALL_CURRENT		(5.0)		/*!< メインモータの拘束電流 [A]				*/
+#define SUB_NO_LOAD_RPM			(4000.0)	/*!< サブモータの無負荷回転数 [rpm]			*/
+#define SUB_TIME_CONSTANT		(0.03)		/*!< サブモータの機械的時定数 [s]			*/
+#define SUB_STALL_CURRENT		(3.0)		/*!< サブモータの拘束電流 [A]				*/
+#define PWM_DEADBAND			(10.0)		/*!< 回転しないPWMの範囲(±) [%]			*/
+/* @} */
+
+void InitCrawlerSimConf(CRAWLER_SIM_CONF_t &stConf)
+{
+	stConf.dWheelRadius = 0.0769;
+	stConf.dPulleyRadius = 0.0486;
+	stConf.dTurningRadius = 0.0938;
+	stConf.dKP = 0.42;
+	stConf.dKI = 4.00;
+	stConf.dKD = 0.02;
+	stConf.dVxGain = 1.0;
+	stConf.dVaGain = 1.0;
+	stConf.iMainPulse = 1000;
+	stConf.dMainGearRatio = 243.0;
+	stConf.iSubPulse = 512;
+	stConf.dSubGearRatio = 1080.0;
+	stConf.iMainDirectionR = 1;
+	stConf.iMainDirectionL = 1;
+	stConf.iFrontDirectionR = 1;
+	stConf.iFrontDirectionL = 1;
+	stConf.iBackDirectionR = 1;
+	stConf.iBackDirectionL = 1;
+	stConf.dMainLoadGain = 7.5;
+	stConf.dMainLoadBase = 2.0;
+	stConf.dSubLoadGain = 7.5;
+	stConf.dSubLoadBase = 2.0;
+}
+
+bool LoadCrawlerSimConf(const char *pPath, CRAWLER_SIM_CONF_t &stConf)
+{
+	static const char szPrefix[] = "conf.default.";
+	const struct
+	{
+		const char *pKey;		/* コンフィグレーション名				*/
+		double *pDouble;		/* 格納先(実数)							*/
+		int32_t *pInt;			/* 格納先(整数)							*/
+		int8_t *pDirection;		/* 格納先(回転方向)						*/
+	} stItem[] =
+	{
+		{"WHEEL_RADIUS",			&stConf.dWheelRadius,	NULL,					NULL},
+		{"PULLEY_RADIUS",			&stConf.dPulleyRadius,	NULL,					NULL},
+		{"TURNING_RADIUS",			&stConf.dTurningRadius,	NULL,					NULL},
+		{"MAIN_MOTOR_KP",			&stConf.dKP,			NULL,					NULL},
+		{"MAIN_MOTOR_KI",			&stConf.dKI,			NULL,					NULL},
+		{"MAIN_MOTOR_KD",			&stConf.dKD,			NULL,					NULL},
+		{"VX_GAIN",					&stConf.dVxGain,		NULL,					NULL},
+		{"VA_GAIN",					&stConf.dVaGain,		NULL,					NULL},
+		{"MAIN_MOTOR_PULSE",		NULL,					&stConf.iMainPulse,		NULL},
+		{"MAIN_MOTOR_GEAR_RATIO",	&stConf.dMainGearRatio,	NULL,					NULL},
+		{"SUB_MOTOR_PULSE",			NULL,					&stConf.iSubPulse,		NULL},
+		{"SUB_MOTOR_GEAR_RATIO",	&stConf.dSubGearRatio,	NULL,					NULL},
+		{"R_MAIN_MOTOR_DIRECTION",	NULL,					NULL,					&stConf.iMainDirectionR},
+		{"L_MAIN_MOTOR_DIRECTION",	NULL,					NULL,					&stConf.iMainDirectionL},
+		{"R_FRONT_SUB_MOTOR_DIRECTION",	NULL,				NULL,					&stConf.iFrontDirectionR},
+		{"L_FRONT_SUB_MOTOR_DIRECTION",	NULL,				NULL,					&stConf.iFrontDirectionL},
+		{"R_BACK_SUB_MOTOR_DIRECTION",	NULL,				NULL,					&stConf.iBackDirectionR},
+		{"L_BACK_SUB_MOTOR_DIRECTION",	NULL,				NULL,					&stConf.iBackDirectionL},
+		{"MAIN_MOTOR_LOAD_GAIN",	&stConf.dMainLoadGain,	NULL,					NULL},
+		{"MAIN_MOTOR_LOAD_BASE",	&stConf.dMainLoadBase,	NULL,					NULL},
+		{"SUB_MOTOR_LOAD_GAIN",		&stConf.dSubLoadGain,	NULL,					NULL},
+		{"SUB_MOTOR_LOAD_BASE",		&stConf.dSubLoadBase,	NULL,					NULL},
+	};
+	FILE *fp = NULL;
+	char szLine[256] = {0};
+	char *pKey = NULL;
+	char *pValue = NULL;
+	char *pEnd = NULL;
+	size_t sizeKey = 0;
+	double dValue = 0.0;
+
+	fp = fopen(pPath, "r");
+	if(fp == NULL)
+	{
+		printf("%s is not found\n", pPath);
+		return false;
+	}
+
+	while(fgets(szLine, sizeof(szLine), fp) != NULL)
+	{
+		// "conf.default.名前: 値"の行のみ読み込む(コメントは除く)
+		pKey = szLine + strspn(szLine, " \t");
+		if(strncmp(pKey, szPrefix, sizeof(szPrefix) - 1) != 0)
+		{
+			continue;
+		}
+		pKey += sizeof(szPrefix) - 1;
+		pValue = strchr(pKey, ':');
+		if(pValue == NULL)
+		{
+			continue;
+		}
+		sizeKey = pValue - pKey;
+		dValue = strtod(pValue + 1, &pEnd);
+		if(pEnd == pValue + 1)
+		{
+			continue;
+		}
+
+		// 該当するコンフィグレーションを更新する
+		for(size_t i = 0; i < sizeof(stItem)/sizeof(stItem[0]); i++)
+		{
+			if((strlen(stItem[i].pKey) != sizeKey) || (strncmp(stItem[i].pKey, pKey, sizeKey) != 0))
+			{
+				continue;
+			}
+			if(stItem[i].pDouble != NULL)
+			{
+				*stItem[i].pDouble = dValue;
+			}
+			else if(stItem[i].pInt != NULL)
+			{
+				*stItem[i].pInt = (int32_t)dValue;
+			}
+			else
+			{
+				*stItem[i].pDirection = (int8_t)dValue;
+			}
+		}
+	}
+	fclose(fp);
+
+	return true;
+}
+
+void MakeMainMotorModel(const CRAWLER_SIM_CONF_t &stConf, double dSlip, SH_MOTOR_MODEL_t &stModel)
+{
+	stModel.iPulseNumber = stConf.iMainPulse;
+	stModel.dGearRatio = stConf.dMainGearRatio;
+	stModel.dRadius = stConf.dWheelRadius;
+	stModel.dNoLoadRpm = MAIN_NO_LOAD_RPM;
+	stModel.dTimeConstant = MAIN_TIME_CONSTANT;
+	stModel.dDeadband = PWM_DEADBAND;
+	stModel.dStallCurrent = MAIN_STALL_CURRENT;
+	stModel.dLoadGain = stConf.dMainLoadGain;
+	stModel.dLoadBase = stConf.dMainLoadBase;
+	stModel.dSlip = dSlip;
+}
+
+void MakeSubMotorModel(const CRAWLER_SIM_CONF_t &stConf, SH_MOTOR_MODEL_t &stModel)
+{
+	stModel.iPulseNumber = stConf.iSubPulse;
+	stModel.dGearRatio = stConf.dSubGearRatio;
+	stModel.dRadius = stConf.dPulleyRadius;
+	stModel.dNoLoadRpm = SUB_NO_LOAD_RPM;
+	stModel.dTimeConstant = SUB_TIME_CONSTANT;
+	stModel.dDeadband = PWM_DEADBAND;
+	stModel.dStallCurrent = SUB_STALL_CURRENT;
+	stModel.dLoadGain = stConf.dSubLoadGain;
+	stModel.dLoadBase = stConf.dSubLoadBase;
+	stModel.dSlip = 0.0;
+}
+
+SHBoardModel::SHBoardModel()
+{
+	SH_MOTOR_MODEL_t stModel = {0};
+	CRAWLER_SIM_CONF_t stConf;
+
+	InitCrawlerSimConf(stConf);
+	MakeMainMotorModel(stConf, 0.0, stModel);
+	SetModel(stModel);
+}
+
+void SHBoardModel::SetModel(const SH_MOTOR_MODEL_t &stModel, uint16_t uPulseOffset)
+{
+	m_stModel = stModel;
+
+	for(int i = 0; i < SH_SIDE_NUM; i++)
+	{
+		m_dPwm[i] = 0.0;
+		m_dMotorSpeed[i] = 0.0;
+		m_dPulse[i] = (double)uPulseOffset;
+		m_dCurrent[i] = 0.0;
+		m_dWheelAngle[i] = 0.0;
+		m_uFeedbackPulse[i] = uPulseOffset;
+		m_dFeedbackRpm[i] = 0.0;
+		m_dFeedbackLoad[i] = m_stModel.dLoadBase;
+	}
+}
+
+bool SHBoardModel::ParseCommand(const char *pCommand)
+{
+	double dPwmR = 0.0;
+	double dPwmL = 0.0;
+	char cEnd = '\0';
+
+	// 動作コマンド書式(メインモータは小数、サブモータは整数)をチェックする
+	if(sscanf(pCommand, "s[%lf:%lf]%c", &dPwmR, &dPwmL, &cEnd) != 3 || (cEnd != 'e'))
+	{
+		return false;
+	}
+	if(!isfinite(dPwmR) || !isfinite(dPwmL))
+	{
+		return false;
+	}
+
+	SetCommand(dPwmR, dPwmL);
+
+	return true;
+}
+
+void SHBoardModel::SetCommand(double dPwmR, double dPwmL)
+{
+	m_dPwm[SH_SIDE_R] = dPwmR;
+	m_dPwm[SH_SIDE_L] = dPwmL;
+
+	// 動作コマンドを受け付けた時点のフィードバックを確定する
+	for(int i = 0; i < SH_SIDE_NUM; i++)
+	{
+		m_uFeedbackPulse[i] = (uint16_t)((int64_t)floor(m_dPulse[i]) & 0xFFFF);
+		m_dFeedbackRpm[i] = m_dMotorSpeed[i]*60.0/(2.0*M_PI);
+		m_dFeedbackLoad[i] = m_stModel.dLoadBase + m_dCurrent[i]/m_stModel.dLoadGain;
+	}
+}
+
+size_t SHBoardModel::GenFeedback(char *pFeedback, size_t sizeFeedback)
+{
+	int iLength = 0;
+
+	iLength = snprintf(pFeedback, sizeFeedback, "s[%X:%X][%.1f:%.3f][%.1f:%.3f]e",
+					   m_uFeedbackPulse[SH_SIDE_R], m_uFeedbackPulse[SH_SIDE_L],
+					   m_dFeedbackRpm[SH_SIDE_R], m_dFeedbackLoad[SH_SIDE_R],
+					   m_dFeedbackRpm[SH_SIDE_L], m_dFeedbackLoad[SH_SIDE_L]);
+
+	return ((0 < iLength) && ((size_t)iLength < sizeFeedback)) ? (size_t)iLength : 0;
+}
+
+void SHBoardModel::GetFeedback(int iSide, int &iPulse, double &dRpm, double &dLoad) const
+{
+	iPulse = m_uFeedbackPulse[iSide];
+	dRpm = m_dFeedbackRpm[iSide];
+	dLoad = m_dFeedbackLoad[iSide];
+}
+
+void SHBoardModel::Step(double dDt)
+{
+	double dNoLoadSpeed = m_stModel.dNoLoadRpm*2.0*M_PI/60.0;
+	double dDrive = 0.0;
+	double dSpeed = 0.0;
+
+	for(int i = 0; i < SH_SIDE_NUM; i++)
+	{
+		// 不感帯を除いたPWMを駆動率(-1～1)に変換する(不感帯ではブレーキ)
+		dDrive = 0.0;
+		if(m_stModel.dDeadband < fabs(m_dPwm[i]))
+		{
+			dDrive = (fabs(m_dPwm[i]) - m_stModel.dDeadband)/(100.0 - m_stModel.dDeadband);
+			dDrive = (1.0 < dDrive) ? 1.0 : dDrive;
+			dDrive = (m_dPwm[i] < 0.0) ? -dDrive : dDrive;
+		}
+
+		// １次遅れで駆動率に比例した回転数に近づける(厳密解で離散化する)
+		dSpeed = m_dMotorSpeed[i];
+		m_dMotorSpeed[i] += (dDrive*dNoLoadSpeed - dSpeed)*(1.0 - exp(-dDt/m_stModel.dTimeConstant));
+
+		// 逆起電力を差し引いた電流を求める
+		m_dCurrent[i] = m_stModel.dStallCurrent*(dDrive - m_dMotorSpeed[i]/dNoLoadSpeed);
+
+		// 平均の角速度でパルス数と車輪の角度を積分する
+		dSpeed = (dSpeed + m_dMotorSpeed[i])/2.0;
+		m_dPulse[i] += dSpeed/(2.0*M_PI)*m_stModel.iPulseNumber*dDt;
+		m_dWheelAngle[i] += dSpeed/m_stModel.dGearRatio*dDt;
+	}
+}
+
+double SHBoardModel::GetWheelVelocity(int iSide) const
+{
+	return m_dMotorSpeed[iSide]/m_stModel.dGearRatio*m_stModel.dRadius;
+}
+
+double SHBoardModel::GetGroundVelocity(int iSide) const
+{
+	return GetWheelVelocity(iSide)*(1.0 - m_stModel.dSlip);
+}
+
+double SHBoardModel::GetWheelAngle(int iSide) const
+{
+	return m_dWheelAngle[iSide];
+}
+
+double SHBoardModel::GetCurrent(int iSide) const
+{
+	return m_dCurrent[iSide];
+}
+
+TrackBodyModel::TrackBodyModel()
+	: m_dTurnSlip(0.0)
+{
+	Reset();
+}
+
+void TrackBodyModel::Reset(void)
+{
+	m_dX = 0.0;
+	m_dY = 0.0;
+	m_dYaw = 0.0;
+	m_dVx = 0.0;
+	m_dVa = 0.0;
+}
+
+void TrackBodyModel::Step(double dVelocityR, double dVelocityL, double dTurningRadius, double dDt)
+{
+	double dYaw = 0.0;
+
+	// 左右のクローラの速度から並進速度と回転速度を求める(旋回時は横滑りの分だけ遅れる)
+	m_dVx = (dVelocityR + dVelocityL)/2.0;
+	m_dVa = (dVelocityR - dVelocityL)/(2.0*dTurningRadius*(1.0 + m_dTurnSlip));
+
+	// 瞬間回転中心まわりの円弧で積分する(回転がほぼない場合は直進とする)
+	dYaw = m_dYaw + m_dVa*dDt;
+	if(fabs(m_dVa*dDt) < 1e-9)
+	{
+		m_dX += m_dVx*dDt*cos(m_dYaw);
+		m_dY += m_dVx*dDt*sin(m_dYaw);
+	}
+	else
+	{
+		m_dX += m_dVx/m_dVa*(sin(dYaw) - sin(m_dYaw));
+		m_dY -= m_dVx/m_dVa*(cos(dYaw) - cos(m_dYaw));
+	}
+	m_dYaw = dYaw;
+}
+
+void TrackBodyModel::SetTurnSlip(double dTurnSlip)
+{
+	m_dTurnSlip = dTurnSlip;
+}
@@ -0,0 +1,271 @@
+// -*- C++ -*-
+/*!
+ * @file SHBoardModel.h
+ * @brief SHボードとモータ・減速機・クローラの物理モデル(ツール用)
+ * @date 2026/10/19
+ */
+
+#ifndef SH_BOARD_MODEL_H
+#define SH_BOARD_MODEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*! @name モータの左右 */
+/*  @{ */
+#define SH_SIDE_R		(0)		/*!< 右モータ	*/
+#define SH_SIDE_L		(1)		/*!< 左モータ	*/
+#define SH_SIDE_NUM		(2)		/*!< モータ数	*/
+/* @} */
+
+/*!
+ * モータ・減速機・クローラ(プーリ)のパラメータ
+ */
+struct SH_MOTOR_MODEL_t
+{
+	int32_t iPulseNumber;		/*!< モータ１回転あたりのパルス数				*/
+	double dGearRatio;			/*!< モータと車輪の減速比						*/
+	double dRadius;				/*!< 車輪(プーリ)の半径 [m]						*/
+	double dNoLoadRpm;			/*!< PWM100%の無負荷回転数 [rpm]				*/
+	double dTimeConstant;		/*!< 機械的時定数(負荷の慣性を含む) [s]			*/
+	double dDeadband;			/*!< 回転しないPWMの範囲(±) [%]				*/
+	double dStallCurrent;		/*!< PWM100%の拘束電流 [A]						*/
+	double dLoadGain;			/*!< 電圧値をモータ負荷に変換するゲイン			*/
+	double dLoadBase;			/*!< モータ負荷の基準電圧 [V]					*/
+	double dSlip;				/*!< クローラの滑り率(0～1)						*/
+};
+
+/*!
+ * RTC_Spider2020_Crawlerのコンフィグレーション(ツールで使用する項目)
+ */
+struct CRAWLER_SIM_CONF_t
+{
+	double dWheelRadius;		/*!< WHEEL_RADIUS			*/
+	double dPulleyRadius;		/*!< PULLEY_RADIUS			*/
+	double dTurningRadius;		/*!< TURNING_RADIUS			*/
+	double dKP;					/*!< MAIN_MOTOR_KP			*/
+	double dKI;					/*!< MAIN_MOTOR_KI			*/
+	double dKD;					/*!< MAIN_MOTOR_KD			*/
+	double dVxGain;				/*!< VX_GAIN				*/
+	double dVaGain;				/*!< VA_GAIN				*/
+	int32_t iMainPulse;			/*!< MAIN_MOTOR_PULSE		*/
+	double dMainGearRatio;		/*!< MAIN_MOTOR_GEAR_RATIO	*/
+	int32_t iSubPulse;			/*!< SUB_MOTOR_PULSE		*/
+	double dSubGearRatio;		/*!< SUB_MOTOR_GEAR_RATIO	*/
+	int8_t iMainDirectionR;		/*!< R_MAIN_MOTOR_DIRECTION	*/
+	int8_t iMainDirectionL;		/*!< L_MAIN_MOTOR_DIRECTION	*/
+	int8_t iFrontDirectionR;	/*!< R_FRONT_SUB_MOTOR_DIRECTION	*/
+	int8_t iFrontDirectionL;	/*!< L_FRONT_SUB_MOTOR_DIRECTION	*/
+	int8_t iBackDirectionR;		/*!< R_BACK_SUB_MOTOR_DIRECTION		*/
+	int8_t iBackDirectionL;		/*!< L_BACK_SUB_MOTOR_DIRECTION		*/
+	double dMainLoadGain;		/*!< MAIN_MOTOR_LOAD_GAIN	*/
+	double dMainLoadBase;		/*!< MAIN_MOTOR_LOAD_BASE	*/
+	double dSubLoadGain;		/*!< SUB_MOTOR_LOAD_GAIN	*/
+	double dSubLoadBase;		/*!< SUB_MOTOR_LOAD_BASE	*/
+};
+
+/*!
+ * コンフィグレーションを既定値(RTC_Spider2020_Crawler.cpp)で初期化する
+ * @param  [out] stConf コンフィグレーション
+ * @return なし
+ */
+void InitCrawlerSimConf(CRAWLER_SIM_CONF_t &stConf);
+
+/*!
+ * コンフィグレーションファイルを読み込む
+ * @param  pPath ファイル名(RTC_Spider2020_Crawler.conf)
+ * @param  [in,out] stConf コンフィグレーション(conf.default.*の指定がある項目のみ更新する)
+ * @retval true 成功
+ * @retval false ファイルを開けない
+ */
+bool LoadCrawlerSimConf(const char *pPath, CRAWLER_SIM_CONF_t &stConf);
+
+/*!
+ * メインモータ(クローラ)のモデルを求める
+ * @param  stConf コンフィグレーション
+ * @param  dSlip クローラの滑り率
+ * @param  [out] stModel モータのモデル
+ * @return なし
+ * @remark 減速比、パルス数、半径、負荷の変換はコンフィグレーションと一致させ、
+ *         コンフィグレーションにないモータの特性は標準値とする。
+ */
+void MakeMainMotorModel(const CRAWLER_SIM_CONF_t &stConf, double dSlip, SH_MOTOR_MODEL_t &stModel);
+
+/*!
+ * サブモータ(フリッパー)のモデルを求める
+ * @param  stConf コンフィグレーション
+ * @param  [out] stModel モータのモデル
+ * @return なし
+ */
+void MakeSubMotorModel(const CRAWLER_SIM_CONF_t &stConf, SH_MOTOR_MODEL_t &stModel);
+
+/*!
+ * SHボード(左右２つのモータ)の物理モデル
+ * @details 動作コマンド s[pwmR:pwmL]e のPWM [%]でモータを駆動し、
+ *          １次遅れのDCモータ、減速機、クローラ(プーリ)の回転を積分する。
+ *          動作コマンドを受け付けた時点のパルスカウント(16bitで周回)、
+ *          回転数、負荷電圧を s[%X:%X][%lf:%lf][%lf:%lf]e で返す。
+ *          ±dDeadband以内のPWMは停止(ブレーキ)とする。
+ */
+class SHBoardModel
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method SHBoardModel
+	 */
+	SHBoardModel();
+
+	/*!
+	 * モータのモデルを設定し、状態を初期化する
+	 * @method SetModel
+	 * @param  stModel モータのモデル(左右共通)
+	 * @param  uPulseOffset パルスカウントの初期値
+	 * @return なし
+	 */
+	void SetModel(const SH_MOTOR_MODEL_t &stModel, uint16_t uPulseOffset = 0);
+
+	/*!
+	 * 動作コマンドを解析してPWMを更新し、フィードバックを確定する
+	 * @method ParseCommand
+	 * @param  pCommand 動作コマンド(NUL終端)
+	 * @retval true 成功
+	 * @retval false 書式不正(PWMとフィードバックは更新しない)
+	 */
+	bool ParseCommand(const char *pCommand);
+
+	/*!
+	 * PWMを更新し、フィードバックを確定する
+	 * @method SetCommand
+	 * @param  dPwmR 右モータのPWM [%]
+	 * @param  dPwmL 左モータのPWM [%]
+	 * @return なし
+	 */
+	void SetCommand(double dPwmR, double dPwmL);
+
+	/*!
+	 * 確定したフィードバックの文字列を生成する
+	 * @method GenFeedback
+	 * @param  [out] pFeedback 格納先
+	 * @param  sizeFeedback 格納先のサイズ
+	 * @return 文字列の長さ(収まらない場合は0)
+	 */
+	size_t GenFeedback(char *pFeedback, size_t sizeFeedback);
+
+	/*!
+	 * 確定したフィードバックを文字列を経由せずに取得する
+	 * @method GetFeedback
+	 * @param  iSide SH_SIDE_RまたはSH_SIDE_L
+	 * @param  [out] iPulse パルスカウント
+	 * @param  [out] dRpm モータの回転数 [rpm]
+	 * @param  [out] dLoad 負荷電圧 [V]
+	 * @return なし
+	 * @remark GenFeedbackの書式による丸め(%.1f、%.3f)を含まない
+	 */
+	void GetFeedback(int iSide, int &iPulse, double &dRpm, double &dLoad) const;
+
+	/*!
+	 * モータの回転を積分する
+	 * @method Step
+	 * @param  dDt 経過時間 [s]
+	 * @return なし
+	 */
+	void Step(double dDt);
+
+	/*!
+	 * 車輪(プーリ)の周速度を取得する
+	 * @method GetWheelVelocity
+	 * @param  iSide SH_SIDE_RまたはSH_SIDE_L
+	 * @return 周速度 [m/s] (正のPWMの回転方向を正とする)
+	 */
+	double GetWheelVelocity(int iSide) const;
+
+	/*!
+	 * 滑りを除いた接地面の速度を取得する
+	 * @method GetGroundVelocity
+	 * @param  iSide SH_SIDE_RまたはSH_SIDE_L
+	 * @return 速度 [m/s] (正のPWMの回転方向を正とする)
+	 */
+	double GetGroundVelocity(int iSide) const;
+
+	/*!
+	 * 車輪(プーリ)の角度を取得する
+	 * @method GetWheelAngle
+	 * @param  iSide SH_SIDE_RまたはSH_SIDE_L
+	 * @return 角度 [rad] (SetModelからの回転量)
+	 */
+	double GetWheelAngle(int iSide) const;
+
+	/*!
+	 * モータの電流を取得する
+	 * @method GetCurrent
+	 * @param  iSide SH_SIDE_RまたはSH_SIDE_L
+	 * @return 電流 [A]
+	 */
+	double GetCurrent(int iSide) const;
+
+private:
+	SH_MOTOR_MODEL_t m_stModel;				/*!< モータのモデル							*/
+	double m_dPwm[SH_SIDE_NUM];				/*!< 指令PWM [%]							*/
+	double m_dMotorSpeed[SH_SIDE_NUM];		/*!< モータの角速度 [rad/s]					*/
+	double m_dPulse[SH_SIDE_NUM];			/*!< 累積パルス数(小数部を含む)				*/
+	double m_dCurrent[SH_SIDE_NUM];			/*!< モータの電流 [A]						*/
+	double m_dWheelAngle[SH_SIDE_NUM];		/*!< 車輪の角度 [rad]						*/
+	uint16_t m_uFeedbackPulse[SH_SIDE_NUM];	/*!< 確定したパルスカウント					*/
+	double m_dFeedbackRpm[SH_SIDE_NUM];		/*!< 確定したモータの回転数 [rpm]			*/
+	double m_dFeedbackLoad[SH_SIDE_NUM];	/*!< 確定した負荷電圧 [V]					*/
+};
+
+/*!
+ * 左右のクローラの速度から車体の位置姿勢を積分するモデル(真値)
+ * @details オドメトリ(MainMotorProcessor::CalcOdometry)の回帰を検出できるよう、
+ *          オドメトリとは独立に、瞬間回転中心まわりの円弧(厳密解)で積分する。
+ *          スキッドステアの旋回時の横滑りは、旋回に効くクローラの間隔が
+ *          (1 + 旋回の滑り率)倍に広がるものとして回転速度を求める。
+ */
+class TrackBodyModel
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method TrackBodyModel
+	 */
+	TrackBodyModel();
+
+	/*!
+	 * 位置姿勢を初期化する
+	 * @method Reset
+	 * @return なし
+	 */
+	void Reset(void);
+
+	/*!
+	 * 位置姿勢を積分する
+	 * @method Step
+	 * @param  dVelocityR 右クローラの前進速度 [m/s]
+	 * @param  dVelocityL 左クローラの前進速度 [m/s]
+	 * @param  dTurningRadius 旋回半径(左右のクローラの間隔の半分) [m]
+	 * @param  dDt 経過時間 [s]
+	 * @return なし
+	 */
+	void Step(double dVelocityR, double dVelocityL, double dTurningRadius, double dDt);
+
+	/*!
+	 * 旋回の滑り率を設定する
+	 * @method SetTurnSlip
+	 * @param  dTurnSlip 旋回の滑り率(0は滑りなし)
+	 * @return なし
+	 */
+	void SetTurnSlip(double dTurnSlip);
+
+	double m_dX;		/*!< 位置(X) [m]			*/
+	double m_dY;		/*!< 位置(Y) [m]			*/
+	double m_dYaw;		/*!< 姿勢(Yaw) [rad]		*/
+	double m_dVx;		/*!< 並進速度 [m/s]			*/
+	double m_dVa;		/*!< 回転速度 [rad/s]		*/
+
+private:
+	double m_dTurnSlip;	/*!< 旋回の滑り率			*/
+};
+
+#endif//SH_BOARD_MODEL_H
@@ -0,0 +1,346 @@
+// -*- C++ -*-
+/*!
+ * @file TraceLatency.cpp
+ * @brief 遅延計測のトレースから区間毎の遅延のヒストグラムを求める
+ * @date 2026/10/19
+ *
+ * RTC_DS4_Controller、RTC_Spider2020_Motion、RTC_Spider2020_Crawlerの
+ * TRACE_ENABLEを1にして実行中に起動し、共有メモリのトレースバッファから
+ * 記録を収集する。記録を起点の時刻で束ね、計測点毎の最初の時刻から
+ * 区間毎及び全体(キー入力からSHボードへの書き込み完了まで)の遅延を求める。
+ * 非常停止(ボタンの検出から全SHボードへの停止指令の書き込み完了まで)の
+ * 遅延も別の区間として求める。RTCが別のホストで動作する場合は、
+ * ホスト間の時刻を同期すること。
+ *
+ * 使用例:
+ *   TraceLatency -t 30               (30秒間収集する)
+ *   TraceLatency -a -t 0             (バッファに残っている記録のみ集計する)
+ *   TraceLatency -t 10 -c trace.csv  (起点毎の時刻をCSVに出力する)
+ *   TraceLatency -g 100 -t 5         (疑似的な記録を生成して動作を確認する)
+ * 最終行に全体及び非常停止の遅延を key=value 形式で出力する
+ */
+
+#include "LatencyTrace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#define POLL_INTERVAL_MS	(10)		/*!< トレースバッファの読み出し周期 [ms]	*/
+#define HISTOGRAM_BAR		(40)		/*!< ヒストグラムの棒の最大長				*/
+#define ESTOP_INTERVAL		(50)		/*!< 疑似的な非常停止を生成する間隔(キー入力の数)	*/
+
+/*!
+ * 起点毎の計測点の時刻
+ */
+struct TRACE_ORIGIN_t
+{
+	uint32_t uSeq;						/*!< 起点の通番							*/
+	int64_t iTimeNs[TRACE_POINT_NUM];	/*!< 計測点毎の最初の時刻(未記録は0) [ns]	*/
+};
+
+/*!
+ * 遅延を求める区間
+ */
+struct TRACE_HOP_t
+{
+	const char *pName;					/*!< 区間の名前		*/
+	TRACE_POINT_t eFrom;				/*!< 区間の始点		*/
+	TRACE_POINT_t eTo;					/*!< 区間の終点		*/
+};
+
+static const TRACE_HOP_t s_stHop[] =
+{
+	{"ds4",              TRACE_DS4_INPUT,     TRACE_DS4_OUTPUT},
+	{"ds4->motion",      TRACE_DS4_OUTPUT,    TRACE_MOTION_INPUT},
+	{"motion",           TRACE_MOTION_INPUT,  TRACE_MOTION_OUTPUT},
+	{"motion->crawler",  TRACE_MOTION_OUTPUT, TRACE_CRAWLER_INPUT},
+	{"crawler",          TRACE_CRAWLER_INPUT, TRACE_CRAWLER_SEND},
+	{"end_to_end",       TRACE_DS4_INPUT,     TRACE_CRAWLER_SEND},
+	{"estop",            TRACE_ESTOP_INPUT,   TRACE_ESTOP_SEND},
+};
+
+#define HOP_END_TO_END		(5)			/*!< s_stHopの全体の区間の位置				*/
+#define HOP_ESTOP			(6)			/*!< s_stHopの非常停止の区間の位置			*/
+
+/*! ヒストグラムの区切り [ms] */
+static const double s_dBucket[] = {0.05, 0.1, 0.2, 0.5, 1.0, 2.0, 5.0, 10.0, 20.0, 50.0, 100.0, 200.0};
+
+/*!
+ * 百分位数を取得する
+ * @param  vecValue ソート済みの値
+ * @param  dRate    割合 (0-1)
+ * @return 百分位数
+ */
+static double Percentile(const std::vector<double> &vecValue, double dRate)
+{
+	if(vecValue.empty())
+	{
+		return 0.0;
+	}
+	return vecValue[std::min(vecValue.size() - 1, (size_t)(dRate*vecValue.size()))];
+}
+
+/*!
+ * 区間の遅延のヒストグラムを出力する
+ * @param  pName    区間の名前
+ * @param  vecValue ソート済みの遅延 [ms]
+ * @return なし
+ */
+static void PrintHistogram(const char *pName, const std::vector<double> &vecValue)
+{
+	const size_t sizeBucket = sizeof(s_dBucket)/sizeof(s_dBucket[0]);
+	std::vector<size_t> vecCount(sizeBucket + 1, 0);
+	size_t sizeMax = 0;
+	double dSum = 0.0;
+
+	for(size_t i = 0; i < vecValue.size(); i++)
+	{
+		vecCount[std::upper_bound(s_dBucket, s_dBucket + sizeBucket, vecValue[i]) - s_dBucket]++;
+		dSum += vecValue[i];
+	}
+	for(size_t i = 0; i < vecCount.size(); i++)
+	{
+		sizeMax = std::max(sizeMax, vecCount[i]);
+	}
+
+	printf("[%s] n=%zu mean_ms=%.3f p50_ms=%.3f p90_ms=%.3f p99_ms=%.3f max_ms=%.3f\n",
+		pName, vecValue.size(),
+		vecValue.empty() ? 0.0 : dSum/vecValue.size(),
+		Percentile(vecValue, 0.50), Percentile(vecValue, 0.90), Percentile(vecValue, 0.99),
+		vecValue.empty() ? 0.0 : vecValue.back());
+	if(vecValue.empty())
+	{
+		return;
+	}
+	for(size_t i = 0; i < vecCount.size(); i++)
+	{
+		if(i < sizeBucket)
+		{
+			printf("  < %7.2f ms %8zu ", s_dBucket[i], vecCount[i]);
+		}
+		else
+		{
+			printf("  >=%7.2f ms %8zu ", s_dBucket[sizeBucket - 1], vecCount[i]);
+		}
+		printf("%s\n", std::string((sizeMax == 0) ? 0 : vecCount[i]*HISTOGRAM_BAR/sizeMax, '#').c_str());
+	}
+}
+
+/*!
+ * 疑似的なパイプラインの記録を生成する(動作確認用)
+ * @param  Trace  トレースバッファ
+ * @param  dRate  キー入力の頻度 [Hz]
+ * @param  dPeriod 生成する時間 [s]
+ * @return なし
+ * @remark 各RTCの実行周期(DS4: 100Hz、Motion: 200Hz、Crawler: 20Hz相当)の
+ *         待ちを乱数で模擬する
+ *         非常停止はキー入力ESTOP_INTERVAL回毎に、実行周期を経由せず生成する
+ */
+static void Generate(LatencyTrace &Trace, double dRate, double dPeriod)
+{
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<double> dist(0.0, 1.0);
+	std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+	uint32_t uSeq = 0;
+
+	while(std::chrono::duration<double>(std::chrono::steady_clock::now() - tpStart).count() < dPeriod)
+	{
+		int64_t iOrigin = LatencyTrace::GetTimeNs();
+		int64_t iTime = iOrigin;
+
+		uSeq++;
+		Trace.RecordAt(TRACE_DS4_INPUT, iOrigin, iTime, uSeq);
+		iTime += (int64_t)(dist(rng)*10.0e6);
+		Trace.RecordAt(TRACE_DS4_OUTPUT, iOrigin, iTime);
+		iTime += (int64_t)(0.2e6 + dist(rng)*0.3e6);
+		Trace.RecordAt(TRACE_MOTION_INPUT, iOrigin, iTime);
+		iTime += (int64_t)(dist(rng)*0.1e6);
+		Trace.RecordAt(TRACE_MOTION_OUTPUT, iOrigin, iTime);
+		iTime += (int64_t)(0.2e6 + dist(rng)*50.0e6);
+		Trace.RecordAt(TRACE_CRAWLER_INPUT, iOrigin, iTime);
+		iTime += (int64_t)(0.1e6 + dist(rng)*0.2e6);
+		Trace.RecordAt(TRACE_CRAWLER_SEND, iOrigin, iTime);
+
+		if((uSeq%ESTOP_INTERVAL) == 0)
+		{
+			iOrigin = LatencyTrace::GetTimeNs() + 1;
+			Trace.RecordAt(TRACE_ESTOP_INPUT, iOrigin, iOrigin);
+			Trace.RecordAt(TRACE_ESTOP_SEND, iOrigin, iOrigin + (int64_t)(0.3e6 + dist(rng)*1.2e6));
+		}
+
+		std::this_thread::sleep_for(std::chrono::duration<double>(1.0/dRate));
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	LatencyTrace Trace;
+	std::map<int64_t, TRACE_ORIGIN_t> mapOrigin;
+	std::string sCsv;
+	double dPeriod = 10.0;
+	double dGenerateRate = 0.0;
+	bool bAll = false;
+	int iOpt;
+
+	// 引数を解析する
+	while((iOpt = getopt(argc, argv, "t:ac:g:h")) != -1)
+	{
+		switch(iOpt)
+		{
+		case 't':
+			dPeriod = atof(optarg);
+			break;
+		case 'a':
+			bAll = true;
+			break;
+		case 'c':
+			sCsv = optarg;
+			break;
+		case 'g':
+			dGenerateRate = atof(optarg);
+			break;
+		default:
+			printf("usage: %s [-t sec] [-a] [-c csv_file] [-g generate_rate_hz]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	// トレースバッファを開く
+	if(!Trace.Open())
+	{
+		return 1;
+	}
+
+	// 読み出しの開始位置を決める(-aならばバッファに残っている記録から)
+	uint64_t uNext = Trace.GetHead();
+	if(bAll)
+	{
+		uNext = (TRACE_CAPACITY < uNext) ? uNext - TRACE_CAPACITY : 0;
+	}
+
+	// 疑似的な記録を生成する
+	std::thread thGenerate;
+	if(0.0 < dGenerateRate)
+	{
+		thGenerate = std::thread(Generate, std::ref(Trace), dGenerateRate, dPeriod);
+	}
+
+	// 収集期間が終わるまで記録を読み出し、起点毎に束ねる
+	std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+	uint64_t uRead = 0;
+	uint64_t uLost = 0;
+	bool bLast = false;
+	while(!bLast)
+	{
+		bLast = (dPeriod <= std::chrono::duration<double>(std::chrono::steady_clock::now() - tpStart).count());
+
+		uint64_t uHead = Trace.GetHead();
+		if(TRACE_CAPACITY < uHead - uNext)
+		{
+			// 読み出しが追いつかずに上書きされた
+			uLost += uHead - uNext - TRACE_CAPACITY;
+			uNext = uHead - TRACE_CAPACITY;
+		}
+		for(; uNext < uHead; uNext++)
+		{
+			TRACE_EVENT_t stEvent;
+			if(!Trace.Read(uNext, stEvent) || (TRACE_POINT_NUM <= stEvent.uPoint))
+			{
+				uLost++;
+				continue;
+			}
+			uRead++;
+
+			std::map<int64_t, TRACE_ORIGIN_t>::iterator it = mapOrigin.find(stEvent.iOriginNs);
+			if(it == mapOrigin.end())
+			{
+				TRACE_ORIGIN_t stOrigin = {0};
+				it = mapOrigin.insert(std::make_pair(stEvent.iOriginNs, stOrigin)).first;
+			}
+			if(stEvent.uSeq != 0)
+			{
+				it->second.uSeq = stEvent.uSeq;
+			}
+			if((it->second.iTimeNs[stEvent.uPoint] == 0) || (stEvent.iTimeNs < it->second.iTimeNs[stEvent.uPoint]))
+			{
+				it->second.iTimeNs[stEvent.uPoint] = stEvent.iTimeNs;
+			}
+		}
+
+		if(!bLast)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(POLL_INTERVAL_MS));
+		}
+	}
+	if(thGenerate.joinable())
+	{
+		thGenerate.join();
+	}
+
+	// 起点毎の時刻をCSVに出力する
+	if(!sCsv.empty())
+	{
+		FILE *fp = fopen(sCsv.c_str(), "w");
+		if(fp == NULL)
+		{
+			printf("fopen(%s) is failed\n", sCsv.c_str());
+			return 1;
+		}
+		fprintf(fp, "seq,origin_ns,ds4_input,ds4_output,motion_input,motion_output,crawler_input,crawler_send,estop_input,estop_send\n");
+		for(std::map<int64_t, TRACE_ORIGIN_t>::const_iterator it = mapOrigin.begin(); it != mapOrigin.end(); ++it)
+		{
+			fprintf(fp, "%u,%lld", it->second.uSeq, (long long)it->first);
+			for(int i = 0; i < TRACE_POINT_NUM; i++)
+			{
+				fprintf(fp, ",%lld", (long long)it->second.iTimeNs[i]);
+			}
+			fprintf(fp, "\n");
+		}
+		fclose(fp);
+	}
+
+	// 区間毎の遅延を求めてヒストグラムを出力する
+	const size_t sizeHop = sizeof(s_stHop)/sizeof(s_stHop[0]);
+	std::vector<std::vector<double>> vecLatency(sizeHop);
+	uint64_t uComplete = 0;
+	for(std::map<int64_t, TRACE_ORIGIN_t>::const_iterator it = mapOrigin.begin(); it != mapOrigin.end(); ++it)
+	{
+		for(size_t i = 0; i < sizeHop; i++)
+		{
+			int64_t iFrom = it->second.iTimeNs[s_stHop[i].eFrom];
+			int64_t iTo = it->second.iTimeNs[s_stHop[i].eTo];
+			if((iFrom != 0) && (iTo != 0))
+			{
+				vecLatency[i].push_back((iTo - iFrom)/1.0e6);
+			}
+		}
+		if(it->second.iTimeNs[TRACE_CRAWLER_SEND] != 0)
+		{
+			uComplete++;
+		}
+	}
+	for(size_t i = 0; i < sizeHop; i++)
+	{
+		std::sort(vecLatency[i].begin(), vecLatency[i].end());
+		PrintHistogram(s_stHop[i].pName, vecLatency[i]);
+	}
+
+	// 後段の実行周期までに新しい入力で上書きされた起点はSHボードに届かない
+	const std::vector<double> &vecEndToEnd = vecLatency[HOP_END_TO_END];
+	const std::vector<double> &vecEStop = vecLatency[HOP_ESTOP];
+	printf("records=%llu lost=%llu origins=%zu complete=%llu e2e_p50_ms=%.3f e2e_p99_ms=%.3f e2e_max_ms=%.3f estop_n=%zu estop_max_ms=%.3f\n",
+		(unsigned long long)uRead, (unsigned long long)uLost, mapOrigin.size(), (unsigned long long)uComplete,
+		Percentile(vecEndToEnd, 0.50), Percentile(vecEndToEnd, 0.99),
+		vecEndToEnd.empty() ? 0.0 : vecEndToEnd.back(),
+		vecEStop.size(), vecEStop.empty() ? 0.0 : vecEStop.back());
+
+	return 0;
+}
@@ -13,6 +13,7 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 // Service implementation headers
 // <rtc-template block="service_impl_h">
@@ -23,6 +24,7 @@
 // <rtc-template block="consumer_stub_h">
 #include "ExtendedDataTypesStub.h"
 #include "BasicDataTypeStub.h"
+#include "Spider2020Stub.h"
 
 // </rtc-template>
 
@@ -40,6 +42,8 @@
 #include "FlipperAngleWrapper.h"
 #include "ModeWrapper.h"
 #include "MotorLoadWrapper.h"
+#include "LatestReader.h"
+#include "MetricsRegistry.h"
 
 /*!
  * @class RTC_Spider2020_Log
@@ -555,32 +559,30 @@ protected:
 	 * - Unit: [m,rad]
 	 */
 	RTC::InPort<RTC::TimedPose3D> m_Pose3D_InIn;
-	RTC::TimedDoubleSeq m_MotorLoad_In;
+	Spider2020::TimedMotorLoad m_MotorLoad_In;
 	/*!
 	 * モータの負荷
-	 * - Type: TimedDoubleSeq
-	 * - Number: 6
-	 * - Semantics: [0]: 右メインモータ
-	 *              [1]: 左メインモータ
-	 *              [2]: 右前方サブモータ
-	 *              [3]: 左前方サブモータ
-	 *              [4]: 右後方サブモータ
-	 *              [5]: 左後方サブモータ
+	 * - Type: Spider2020::TimedMotorLoad
+	 * - Semantics: main_r: 右メインモータ
+	 *              main_l: 左メインモータ
+	 *              sub_fr: 右前方サブモータ
+	 *              sub_fl: 左前方サブモータ
+	 *              sub_br: 右後方サブモータ
+	 *              sub_bl: 左後方サブモータ
 	 * - Unit: [A]
 	 */
-	RTC::InPort<RTC::TimedDoubleSeq> m_MotorLoad_InIn;
-	RTC::TimedDoubleSeq m_FlipperAngle_In;
+	RTC::InPort<Spider2020::TimedMotorLoad> m_MotorLoad_InIn;
+	Spider2020::TimedFlipperAngle m_FlipperAngle_In;
 	/*!
 	 * フリッパーの角度
-	 * - Type: TimedDoubleSeq
-	 * - Number: 4
-	 * - Semantics: [0]: 右前方フリッパー
-	 *              [1]: 左前方フリッパー
-	 *              [2]: 右後方フリッパー
-	 *              [3]: 左後方フリッパー
+	 * - Type: Spider2020::TimedFlipperAngle
+	 * - Semantics: front_r: 右前方フリッパー
+	 *              front_l: 左前方フリッパー
+	 *              back_r:  右後方フリッパー
+	 *              back_l:  左後方フリッパー
 	 * - Unit: [rad]
 	 */
-	RTC::InPort<RTC::TimedDoubleSeq> m_FlipperAngle_InIn;
+	RTC::InPort<Spider2020::TimedFlipperAngle> m_FlipperAngle_InIn;
 	RTC::TimedOrientation3D m_IMU_Orientation3D_In;
 	/*!
 	 * ３次元の姿勢
@@ -605,12 +607,12 @@ protected:
 	 * - Unit: [%]
 	 */
 	RTC::InPort<RTC::TimedDouble> m_GCCapacityRatio_InIn;
-	RTC::TimedDoubleSeq m_GCAxis_In;
+	Spider2020::TimedAxis m_GCAxis_In;
 	/*!
 	 * DualShock4コントローラの軸キーの入力具合
-	 * - Type: TimedDoubleSeq
+	 * - Type: Spider2020::TimedAxis
 	 */
-	RTC::InPort<RTC::TimedDoubleSeq> m_GCAxis_InIn;
+	RTC::InPort<Spider2020::TimedAxis> m_GCAxis_InIn;
 	RTC::TimedULong m_GCButton_In;
 	/*!
 	 * DualShock4コントローラのボタンの押下状態
@@ -624,13 +626,12 @@ protected:
 	 * - Unit: [%]
 	 */
 	RTC::InPort<RTC::TimedDouble> m_MainCapacityRatio_InIn;
-	RTC::TimedLongSeq m_Mode_In;
+	Spider2020::TimedMode m_Mode_In;
 	/*!
 	 * 動作指令の状態
-	 * - Type: TimedLongSeq
-	 * - Number: 6
+	 * - Type: Spider2020::TimedMode
 	 */
-	RTC::InPort<RTC::TimedLongSeq> m_Mode_InIn;
+	RTC::InPort<Spider2020::TimedMode> m_Mode_InIn;
 	RTC::TimedPose3D m_Arm1Pose3D_In;
 	/*!
 	 * Arm1の位置姿勢
@@ -640,48 +641,45 @@ protected:
 	 * - Unit: [m,rad]
 	 */
 	RTC::InPort<RTC::TimedPose3D> m_Arm1Pose3D_InIn;
-	RTC::TimedDoubleSeq m_Arm1Angular_In;
+	Spider2020::TimedArmAngular m_Arm1Angular_In;
 	/*!
 	 * Arm1の腕の角度
-	 * - Type: TimedDoubleSeq
-	 * - Number: 6
-	 * - Semantics: [0]: 1軸目
-	 *              [1]: 2軸目
-	 *              [2]: 3軸目
-	 *              [3]: 4軸目
-	 *              [4]: 5軸目
-	 *              [5]: 6軸目
+	 * - Type: Spider2020::TimedArmAngular
+	 * - Semantics: shoulder: 1軸目
+	 *              arm:      2軸目
+	 *              forearm:  3軸目
+	 *              wrist1:   4軸目
+	 *              wrist2:   5軸目
+	 *              hand:     6軸目
 	 * - Unit: [rad]
 	 */
-	RTC::InPort<RTC::TimedDoubleSeq> m_Arm1Angular_InIn;
-	RTC::TimedLongSeq m_Arm1Finger_In;
+	RTC::InPort<Spider2020::TimedArmAngular> m_Arm1Angular_InIn;
+	Spider2020::TimedFinger m_Arm1Finger_In;
 	/*!
 	 * Arm1の指の開閉具合
-	 * - Type: TimedLongSeq
-	 * - Number: 3
-	 * - Semantics: [0]: 親指
-	 *              [1]: 差指
-	 *              [2]: 中指
+	 * - Type: Spider2020::TimedFinger
+	 * - Semantics: thumb:         親指
+	 *              index_finger:  差指
+	 *              middle_finger: 中指
 	 * - Unit: [u]
 	 */
-	RTC::InPort<RTC::TimedLongSeq> m_Arm1Finger_InIn;
-	RTC::TimedDoubleSeq m_Arm1Current_In;
+	RTC::InPort<Spider2020::TimedFinger> m_Arm1Finger_InIn;
+	Spider2020::TimedArmCurrent m_Arm1Current_In;
 	/*!
 	 * Arm1のモータ負荷
-	 * - Type: TimedDoubleSeq
-	 * - Number: 9
-	 * - Semantics: [0]: 腕の1軸目
-	 *              [1]: 腕の2軸目
-	 *              [2]: 腕の3軸目
-	 *              [3]: 腕の4軸目
-	 *              [4]: 腕の5軸目
-	 *              [5]: 腕の6軸目
-	 *              [6]: 親指
-	 *              [7]: 差指
-	 *              [8]: 中指
+	 * - Type: Spider2020::TimedArmCurrent
+	 * - Semantics: shoulder:      腕の1軸目
+	 *              arm:           腕の2軸目
+	 *              forearm:       腕の3軸目
+	 *              wrist1:        腕の4軸目
+	 *              wrist2:        腕の5軸目
+	 *              hand:          腕の6軸目
+	 *              thumb:         親指
+	 *              index_finger:  差指
+	 *              middle_finger: 中指
 	 * - Unit: [A]
 	 */
-	RTC::InPort<RTC::TimedDoubleSeq> m_Arm1Current_InIn;
+	RTC::InPort<Spider2020::TimedArmCurrent> m_Arm1Current_InIn;
 
 	// </rtc-template>
 
@@ -703,32 +701,30 @@ protected:
 	 * - Unit: [m,rad]
 	 */
 	RTC::OutPort<RTC::TimedPose3D> m_Pose3D_OutOut;
-	RTC::TimedDoubleSeq m_MotorLoad_Out;
+	Spider2020::TimedMotorLoad m_MotorLoad_Out;
 	/*!
 	 * モータの負荷
-	 * - Type: TimedDoubleSeq
-	 * - Number: 6
-	 * - Semantics: [0]: 右メインモータ
-	 *              [1]: 左メインモータ
-	 *              [2]: 右前方サブモータ
-	 *              [3]: 左前方サブモータ
-	 *              [4]: 右後方サブモータ
-	 *              [5]: 左後方サブモータ
+	 * - Type: Spider2020::TimedMotorLoad
+	 * - Semantics: main_r: 右メインモータ
+	 *              main_l: 左メインモータ
+	 *              sub_fr: 右前方サブモータ
+	 *              sub_fl: 左前方サブモータ
+	 *              sub_br: 右後方サブモータ
+	 *              sub_bl: 左後方サブモータ
 	 * - Unit: [A]
 	 */
-	RTC::OutPort<RTC::TimedDoubleSeq> m_MotorLoad_OutOut;
-	RTC::TimedDoubleSeq m_FlipperAngle_Out;
+	RTC::OutPort<Spider2020::TimedMotorLoad> m_MotorLoad_OutOut;
+	Spider2020::TimedFlipperAngle m_FlipperAngle_Out;
 	/*!
 	 * フリッパーの角度
-	 * - Type: TimedDoubleSeq
-	 * - Number: 4
-	 * - Semantics: [0]: 右前方サブモータ
-	 *              [1]: 左前方サブモータ
-	 *              [2]: 右後方サブモータ
-	 *              [3]: 左後方サブモータ
+	 * - Type: Spider2020::TimedFlipperAngle
+	 * - Semantics: front_r: 右前方サブモータ
+	 *              front_l: 左前方サブモータ
+	 *              back_r:  右後方サブモータ
+	 *              back_l:  左後方サブモータ
 	 * - Unit: [rad]
 	 */
-	RTC::OutPort<RTC::TimedDoubleSeq> m_FlipperAngle_OutOut;
+	RTC::OutPort<Spider2020::TimedFlipperAngle> m_FlipperAngle_OutOut;
 	RTC::TimedOrientation3D m_IMU_Orientation3D_Out;
 	/*!
 	 * ３次元の姿勢
@@ -753,12 +749,12 @@ protected:
 	 * - Unit: [%]
 	 */
 	RTC::OutPort<RTC::TimedDouble> m_GCCapacityRatio_OutOut;
-	RTC::TimedDoubleSeq m_GCAxis_Out;
+	Spider2020::TimedAxis m_GCAxis_Out;
 	/*!
 	 * DualShock4コントローラの軸キーの入力具合
-	 * - Type: TimedDoubleSeq
+	 * - Type: Spider2020::TimedAxis
 	 */
-	RTC::OutPort<RTC::TimedDoubleSeq> m_GCAxis_OutOut;
+	RTC::OutPort<Spider2020::TimedAxis> m_GCAxis_OutOut;
 	RTC::TimedULong m_GCButton_Out;
 	/*!
 	 * DualShock4コントローラのボタンの押下状態
@@ -772,13 +768,12 @@ protected:
 	 * - Unit: [%]
 	 */
 	RTC::OutPort<RTC::TimedDouble> m_MainCapacityRatio_OutOut;
-	RTC::TimedLongSeq m_Mode_Out;
+	Spider2020::TimedMode m_Mode_Out;
 	/*!
 	 * 動作指令の状態
-	 * - Type: TimedLongSeq
-	 * - Number: 6
+	 * - Type: Spider2020::TimedMode
 	 */
-	RTC::OutPort<RTC::TimedLongSeq> m_Mode_OutOut;
+	RTC::OutPort<Spider2020::TimedMode> m_Mode_OutOut;
 	RTC::TimedPose3D m_Arm1Pose3D_Out;
 	/*!
 	 * Arm1の位置姿勢
@@ -788,48 +783,45 @@ protected:
 	 * - Unit: [m,rad]
 	 */
 	RTC::OutPort<RTC::TimedPose3D> m_Arm1Pose3D_OutOut;
-	RTC::TimedDoubleSeq m_Arm1Angular_Out;
+	Spider2020::TimedArmAngular m_Arm1Angular_Out;
 	/*!
 	 * Arm1の腕の角度
-	 * - Type: TimedDoubleSeq
-	 * - Number: 6
-	 * - Semantics: [0]: 1軸目
-	 *              [1]: 2軸目
-	 *              [2]: 3軸目
-	 *              [3]: 4軸目
-	 *              [4]: 5軸目
-	 *              [5]: 6軸目
+	 * - Type: Spider2020::TimedArmAngular
+	 * - Semantics: shoulder: 1軸目
+	 *              arm:      2軸目
+	 *              forearm:  3軸目
+	 *              wrist1:   4軸目
+	 *              wrist2:   5軸目
+	 *              hand:     6軸目
 	 * - Unit: [rad]
 	 */
-	RTC::OutPort<RTC::TimedDoubleSeq> m_Arm1Angular_OutOut;
-	RTC::TimedLongSeq m_Arm1Finger_Out;
+	RTC::OutPort<Spider2020::TimedArmAngular> m_Arm1Angular_OutOut;
+	Spider2020::TimedFinger m_Arm1Finger_Out;
 	/*!
 	 * Arm1の指の開閉具合
-	 * - Type: TimedLongSeq
-	 * - Number: 3
-	 * - Semantics: [0]: 親指
-	 *              [1]: 差指
-	 *              [2]: 中指
+	 * - Type: Spider2020::TimedFinger
+	 * - Semantics: thumb:         親指
+	 *              index_finger:  差指
+	 *              middle_finger: 中指
 	 * - Unit: [u]
 	 */
-	RTC::OutPort<RTC::TimedLongSeq> m_Arm1Finger_OutOut;
-	RTC::TimedDoubleSeq m_Arm1Current_Out;
+	RTC::OutPort<Spider2020::TimedFinger> m_Arm1Finger_OutOut;
+	Spider2020::TimedArmCurrent m_Arm1Current_Out;
 	/*!
 	 * Arm1のモータ負荷
-	 * - Type: TimedDoubleSeq
-	 * - Number: 9
-	 * - Semantics: [0]: 腕の1軸目
-	 *              [1]: 腕の2軸目
-	 *              [2]: 腕の3軸目
-	 *              [3]: 腕の4軸目
-	 *              [4]: 腕の5軸目
-	 *              [5]: 腕の6軸目
-	 *              [6]: 親指
-	 *              [7]: 差指
-	 *              [8]: 中指
+	 * - Type: Spider2020::TimedArmCurrent
+	 * - Semantics: shoulder:      腕の1軸目
+	 *              arm:           腕の2軸目
+	 *              forearm:       腕の3軸目
+	 *              wrist1:        腕の4軸目
+	 *              wrist2:        腕の5軸目
+	 *              hand:          腕の6軸目
+	 *              thumb:         親指
+	 *              index_finger:  差指
+	 *              middle_finger: 中指
 	 * - Unit: [A]
 	 */
-	RTC::OutPort<RTC::TimedDoubleSeq> m_Arm1Current_OutOut;
+	RTC::OutPort<Spider2020::TimedArmCurrent> m_Arm1Current_OutOut;
 
 	// </rtc-template>
 
@@ -875,8 +867,26 @@ private:
 	FingerStatusWrapper m_Arm1Finger_OutWrap;		/*!< m_Arm1Finger_Outのラッパークラス	*/
 	ArmCurrentWrapper m_Arm1Current_OutWrap;		/*!< m_Arm1Current_Outのラッパークラス	*/
 
+	LatestReader<RTC::TimedPose3D> m_Pose3D_InReader;						/*!< m_Pose3D_InInの最新データの読み込み	*/
+	LatestReader<Spider2020::TimedMotorLoad> m_MotorLoad_InReader;			/*!< m_MotorLoad_InInの最新データの読み込み	*/
+	LatestReader<Spider2020::TimedFlipperAngle> m_FlipperAngle_InReader;	/*!< m_FlipperAngle_InInの最新データの読み込み	*/
+	LatestReader<RTC::TimedOrientation3D> m_IMU_Orientation3D_InReader;		/*!< m_IMU_Orientation3D_InInの最新データの読み込み	*/
+	LatestReader<RTC::TimedVelocity2D> m_Velocity2D_InReader;				/*!< m_Velocity2D_InInの最新データの読み込み	*/
+	LatestReader<RTC::TimedDouble> m_GCCapacityRatio_InReader;				/*!< m_GCCapacityRatio_InInの最新データの読み込み	*/
+	LatestReader<Spider2020::TimedAxis> m_GCAxis_InReader;					/*!< m_GCAxis_InInの最新データの読み込み	*/
+	LatestReader<RTC::TimedULong> m_GCButton_InReader;						/*!< m_GCButton_InInの最新データの読み込み	*/
+	LatestReader<RTC::TimedDouble> m_MainCapacityRatio_InReader;			/*!< m_MainCapacityRatio_InInの最新データの読み込み	*/
+	LatestReader<Spider2020::TimedMode> m_Mode_InReader;					/*!< m_Mode_InInの最新データの読み込み	*/
+	LatestReader<RTC::TimedPose3D> m_Arm1Pose3D_InReader;					/*!< m_Arm1Pose3D_InInの最新データの読み込み	*/
+	LatestReader<Spider2020::TimedArmAngular> m_Arm1Angular_InReader;		/*!< m_Arm1Angular_InInの最新データの読み込み	*/
+	LatestReader<Spider2020::TimedFinger> m_Arm1Finger_InReader;			/*!< m_Arm1Finger_InInの最新データの読み込み	*/
+	LatestReader<Spider2020::TimedArmCurrent> m_Arm1Current_InReader;		/*!< m_Arm1Current_InInの最新データの読み込み	*/
+
 	std::ofstream m_Logout_Robot;					/*!< ロボットログファイル出力用			*/
 
+	MetricCounter m_BytesWrittenMetric;				/*!< ログファイルに書き込んだバイト数	*/
+	MetricHistogram m_WriteTimeMetric;				/*!< １周期分の書き込み時間 [ns]		*/
+
 };
 
 
@@ -108,6 +108,20 @@ RTC_Spider2020_Log::RTC_Spider2020_Log(RTC::Manager* manager)
 	, m_Arm1Angular_OutWrap(m_Arm1Angular_Out)
 	, m_Arm1Finger_OutWrap(m_Arm1Finger_Out)
 	, m_Arm1Current_OutWrap(m_Arm1Current_Out)
+	, m_Pose3D_InReader(m_Pose3D_InIn, m_Pose3D_In)
+	, m_MotorLoad_InReader(m_MotorLoad_InIn, m_MotorLoad_In)
+	, m_FlipperAngle_InReader(m_FlipperAngle_InIn, m_FlipperAngle_In)
+	, m_IMU_Orientation3D_InReader(m_IMU_Orientation3D_InIn, m_IMU_Orientation3D_In)
+	, m_Velocity2D_InReader(m_Velocity2D_InIn, m_Velocity2D_In)
+	, m_GCCapacityRatio_InReader(m_GCCapacityRatio_InIn, m_GCCapacityRatio_In)
+	, m_GCAxis_InReader(m_GCAxis_InIn, m_GCAxis_In)
+	, m_GCButton_InReader(m_GCButton_InIn, m_GCButton_In)
+	, m_MainCapacityRatio_InReader(m_MainCapacityRatio_InIn, m_MainCapacityRatio_In)
+	, m_Mode_InReader(m_Mode_InIn, m_Mode_In)
+	, m_Arm1Pose3D_InReader(m_Arm1Pose3D_InIn, m_Arm1Pose3D_In)
+	, m_Arm1Angular_InReader(m_Arm1Angular_InIn, m_Arm1Angular_In)
+	, m_Arm1Finger_InReader(m_Arm1Finger_InIn, m_Arm1Finger_In)
+	, m_Arm1Current_InReader(m_Arm1Current_InIn, m_Arm1Current_In)
 {
 }
 
@@ -216,6 +230,10 @@ RTC::ReturnCode_t RTC_Spider2020_Log::onInitialize()
 	// Jaco2アーム(１本目)のモータ負荷の出力を初期化する
 	m_Arm1Current_OutWrap.InitData();
 
+	// 性能指標を登録する
+	m_BytesWrittenMetric.Register("log.bytes_written");
+	m_WriteTimeMetric.Register("log.write");
+
 	return RTC::RTC_OK;
 }
 
@@ -245,7 +263,6 @@ RTC::ReturnCode_t RTC_Spider2020_Log::onActivated(RTC::UniqueId ec_id)
 	struct timeval myTime;
 	struct tm *time_st = NULL;
 	char str[512] = {0};
-	int i = 0;
 
 	// ログファイル出力ディレクトリを作成する
 	mkdir(LOG_DIR, LOG_DIR_MODE);
@@ -327,16 +344,18 @@ RTC::ReturnCode_t RTC_Spider2020_Log::onActivated(RTC::UniqueId ec_id)
 	m_Pose3D_In.data.orientation.y = DUMMY_DBL_VALUE;
 
 	// モータの負荷の入力値を初期化する
-	for(i = 0; i < m_MotorLoad_In.data.length(); i++)
-	{
-		m_MotorLoad_In.data[i] = DUMMY_DBL_VALUE;
-	}
+	m_MotorLoad_In.data.main_r = DUMMY_DBL_VALUE;
+	m_MotorLoad_In.data.main_l = DUMMY_DBL_VALUE;
+	m_MotorLoad_In.data.sub_fr = DUMMY_DBL_VALUE;
+	m_MotorLoad_In.data.sub_fl = DUMMY_DBL_VALUE;
+	m_MotorLoad_In.data.sub_br = DUMMY_DBL_VALUE;
+	m_MotorLoad_In.data.sub_bl = DUMMY_DBL_VALUE;
 
 	// フリッパーの角度の入力値を初期化する
-	for(i = 0; i < m_FlipperAngle_In.data.length(); i++)
-	{
-		m_FlipperAngle_In.data[i] = DUMMY_DBL_VALUE;
-	}
+	m_FlipperAngle_In.data.front_r = DUMMY_DBL_VALUE;
+	m_FlipperAngle_In.data.front_l = DUMMY_DBL_VALUE;
+	m_FlipperAngle_In.data.back_r = DUMMY_DBL_VALUE;
+	m_FlipperAngle_In.data.back_l = DUMMY_DBL_VALUE;
 
 	// ３次元の姿勢(IMU)の入力値を初期化する
 	m_IMU_Orientation3D_In.data.r = DUMMY_DBL_VALUE;
@@ -352,10 +371,14 @@ RTC::ReturnCode_t RTC_Spider2020_Log::onActivated(RTC::UniqueId ec_id)
 	m_GCCapacityRatio_In.data = DUMMY_DBL_VALUE;
 
 	// ゲームコントローラの軸キーの入力具合のヘッダーをログファイルに出力する
-	for(i = 0; i < m_GCAxis_In.data.length(); i++)
-	{
-		m_GCAxis_In.data[i] = DUMMY_DBL_VALUE;
-	}
+	m_GCAxis_In.data.dir_vertical = DUMMY_DBL_VALUE;
+	m_GCAxis_In.data.dir_horizontal = DUMMY_DBL_VALUE;
+	m_GCAxis_In.data.lstick_vertical = DUMMY_DBL_VALUE;
+	m_GCAxis_In.data.lstick_horizontal = DUMMY_DBL_VALUE;
+	m_GCAxis_In.data.rstick_vertical = DUMMY_DBL_VALUE;
+	m_GCAxis_In.data.rstick_horizontal = DUMMY_DBL_VALUE;
+	m_GCAxis_In.data.l2 = DUMMY_DBL_VALUE;
+	m_GCAxis_In.data.r2 = DUMMY_DBL_VALUE;
 
 	// ゲームコントローラのボタンの押下状態のヘッダーをログファイルに出力する
 	m_GCButton_In.data = DUMMY_LONG_VALUE;
@@ -364,10 +387,12 @@ RTC::ReturnCode_t RTC_Spider2020_Log::onActivated(RTC::UniqueId ec_id)
 	m_MainCapacityRatio_In.data = DUMMY_DBL_VALUE;
 
 	// 動作指令の状態の入力値を初期化する
-	for(i = 0; i < m_Mode_In.data.length(); i++)
-	{
-		m_Mode_In.data[i] = DUMMY_LONG_VALUE;
-	}
+	m_Mode_In.data.control = DUMMY_LONG_VALUE;
+	m_Mode_In.data.speed_level = DUMMY_LONG_VALUE;
+	m_Mode_In.data.speed_max = DUMMY_LONG_VALUE;
+	m_Mode_In.data.flipper_select = DUMMY_LONG_VALUE;
+	m_Mode_In.data.flipper_status = DUMMY_LONG_VALUE;
+	m_Mode_In.data.crawler_pose_clear = DUMMY_LONG_VALUE;
 
 	// Jaco2アーム(１本目)の３次元の位置姿勢の入力値を初期化する
 	m_Arm1Pose3D_In.data.position.x = DUMMY_DBL_VALUE;
@@ -378,22 +403,28 @@ RTC::ReturnCode_t RTC_Spider2020_Log::onActivated(RTC::UniqueId ec_id)
 	m_Arm1Pose3D_In.data.orientation.y = DUMMY_DBL_VALUE;
 
 	// Jaco2アーム(１本目)の腕の角度の入力値を初期化する
-	for(i = 0; i < m_Arm1Angular_In.data.length(); i++)
-	{
-		m_Arm1Angular_In.data[i] = DUMMY_DBL_VALUE;
-	}
+	m_Arm1Angular_In.data.shoulder = DUMMY_DBL_VALUE;
+	m_Arm1Angular_In.data.arm = DUMMY_DBL_VALUE;
+	m_Arm1Angular_In.data.forearm = DUMMY_DBL_VALUE;
+	m_Arm1Angular_In.data.wrist1 = DUMMY_DBL_VALUE;
+	m_Arm1Angular_In.data.wrist2 = DUMMY_DBL_VALUE;
+	m_Arm1Angular_In.data.hand = DUMMY_DBL_VALUE;
 
 	// Jaco2アーム(１本目)の指の開閉具合の入力値を初期化する
-	for(i = 0; i < m_Arm1Finger_In.data.length(); i++)
-	{
-		m_Arm1Finger_In.data[i] = DUMMY_LONG_VALUE;
-	}
+	m_Arm1Finger_In.data.thumb = DUMMY_LONG_VALUE;
+	m_Arm1Finger_In.data.index_finger = DUMMY_LONG_VALUE;
+	m_Arm1Finger_In.data.middle_finger = DUMMY_LONG_VALUE;
 
 	// Jaco2アーム(１本目)のモータ負荷の入力値を初期化する
-	for(i = 0; i < m_Arm1Current_In.data.length(); i++)
-	{
-		m_Arm1Current_In.data[i] = DUMMY_DBL_VALUE;
-	}
+	m_Arm1Current_In.data.shoulder = DUMMY_DBL_VALUE;
+	m_Arm1Current_In.data.arm = DUMMY_DBL_VALUE;
+	m_Arm1Current_In.data.forearm = DUMMY_DBL_VALUE;
+	m_Arm1Current_In.data.wrist1 = DUMMY_DBL_VALUE;
+	m_Arm1Current_In.data.wrist2 = DUMMY_DBL_VALUE;
+	m_Arm1Current_In.data.hand = DUMMY_DBL_VALUE;
+	m_Arm1Current_In.data.thumb = DUMMY_DBL_VALUE;
+	m_Arm1Current_In.data.index_finger = DUMMY_DBL_VALUE;
+	m_Arm1Current_In.data.middle_finger = DUMMY_DBL_VALUE;
 
 	return RTC::RTC_OK;
 }
@@ -408,6 +439,9 @@ RTC::ReturnCode_t RTC_Spider2020_Log::onDeactivated(RTC::UniqueId ec_id)
 
 RTC::ReturnCode_t RTC_Spider2020_Log::onExecute(RTC::UniqueId ec_id)
 {
+	int64_t iStartNs = 0;
+	std::streampos posStart;
+
 	// ３次元の位置姿勢をポートから読み込む
 	ReadPose3D();
 
@@ -450,6 +484,10 @@ RTC::ReturnCode_t RTC_Spider2020_Log::onExecute(RTC::UniqueId ec_id)
 	// Jaco2アーム(１本目)のモータ負荷をポートから読み込む
 	ReadArm1Current();
 
+	// 書き込みの開始時刻と位置を記録する
+	iStartNs = MetricsRegistry::GetTimeNs();
+	posStart = m_Logout_Robot.tellp();
+
 	// ロボット識別子をログファイルとポートに書き込む
 	WriteRobotID();
 
@@ -498,6 +536,17 @@ RTC::ReturnCode_t RTC_Spider2020_Log::onExecute(RTC::UniqueId ec_id)
 	// ログファイルに改行を出力する
 	m_Logout_Robot << std::endl;
 
+	// 書き込んだバイト数と書き込み時間を記録する
+	m_WriteTimeMetric.RecordSince(iStartNs);
+	if(posStart != std::streampos(-1))
+	{
+		std::streampos posEnd = m_Logout_Robot.tellp();
+		if(posStart < posEnd)
+		{
+			m_BytesWrittenMetric.Add((uint64_t)(posEnd - posStart));
+		}
+	}
+
 	return RTC::RTC_OK;
 }
 
@@ -587,12 +636,8 @@ void RTC_Spider2020_Log::OutputPose3DHeaders(void)
 
 void RTC_Spider2020_Log::ReadPose3D(void)
 {
-	// ３次元の位置姿勢を更新する
-	if(m_Pose3D_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_Pose3D_InIn.read();
-	}
+	// ３次元の位置姿勢を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_Pose3D_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WritePose3D(void)
@@ -629,12 +674,8 @@ void RTC_Spider2020_Log::OutputMotorLoadHeaders(void)
 
 void RTC_Spider2020_Log::ReadMotorLoad(void)
 {
-	// モータの負荷を更新する
-	if(m_MotorLoad_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_MotorLoad_InIn.read();
-	}
+	// モータの負荷を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_MotorLoad_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteMotorLoad(void)
@@ -669,12 +710,8 @@ void RTC_Spider2020_Log::OutputFlipperAngleHeaders(void)
 
 void RTC_Spider2020_Log::ReadFlipperAngle(void)
 {
-	// フリッパーの角度を更新する
-	if(m_FlipperAngle_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_FlipperAngle_InIn.read();
-	}
+	// フリッパーの角度を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_FlipperAngle_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteFlipperAngle(void)
@@ -706,12 +743,8 @@ void RTC_Spider2020_Log::OutputIMUOrientation3DHeaders(void)
 
 void RTC_Spider2020_Log::ReadIMUOrientation3D(void)
 {
-	// ３次元の姿勢(IMU)を更新する
-	if(m_IMU_Orientation3D_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_IMU_Orientation3D_InIn.read();
-	}
+	// ３次元の姿勢(IMU)を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_IMU_Orientation3D_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteIMUOrientation3D(void)
@@ -742,12 +775,8 @@ void RTC_Spider2020_Log::OutputVelocity2DHeaders(void)
 
 void RTC_Spider2020_Log::ReadVelocity2D(void)
 {
-	// メインクローラの速度を更新する
-	if(m_Velocity2D_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_Velocity2D_InIn.read();
-	}
+	// メインクローラの速度を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_Velocity2D_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteVelocity2D(void)
@@ -776,12 +805,8 @@ void RTC_Spider2020_Log::OutputGCCapacityRatioHeaders(void)
 
 void RTC_Spider2020_Log::ReadGCCapacityRatio(void)
 {
-	// ゲームコントローラのバッテリ残容量比を更新する
-	if(m_GCCapacityRatio_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_GCCapacityRatio_InIn.read();
-	}
+	// ゲームコントローラのバッテリ残容量比を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_GCCapacityRatio_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteGCCapacityRatio(void)
@@ -815,12 +840,8 @@ void RTC_Spider2020_Log::OutputGCAxisHeaders(void)
 
 void RTC_Spider2020_Log::ReadGCAxis(void)
 {
-	// ゲームコントローラの軸キーの入力具合を更新する
-	if(m_GCAxis_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_GCAxis_InIn.read();
-	}
+	// ゲームコントローラの軸キーの入力具合を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_GCAxis_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteGCAxis(void)
@@ -867,12 +888,8 @@ void RTC_Spider2020_Log::OutputGCButtonHeaders(void)
 
 void RTC_Spider2020_Log::ReadGCButton(void)
 {
-	// ゲームコントローラのボタンの押下状態を更新する
-	if(m_GCButton_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_GCButton_InIn.read();
-	}
+	// ゲームコントローラのボタンの押下状態を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_GCButton_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteGCButton(void)
@@ -915,12 +932,8 @@ void RTC_Spider2020_Log::OutputMainCapacityRatioHeaders(void)
 
 void RTC_Spider2020_Log::ReadMainCapacityRatio(void)
 {
-	// メインバッテリのバッテリ残容量比を更新する
-	if(m_MainCapacityRatio_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_MainCapacityRatio_InIn.read();
-	}
+	// メインバッテリのバッテリ残容量比を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_MainCapacityRatio_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteMainCapacityRatio(void)
@@ -955,12 +968,8 @@ void RTC_Spider2020_Log::OutputModeHeaders(void)
 
 void RTC_Spider2020_Log::ReadMode(void)
 {
-	// 動作指令の状態を更新する
-	if(m_Mode_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_Mode_InIn.read();
-	}
+	// 動作指令の状態を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_Mode_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteMode(void)
@@ -1000,12 +1009,8 @@ void RTC_Spider2020_Log::OutputArm1Pose3DHeaders(void)
 
 void RTC_Spider2020_Log::ReadArm1Pose3D(void)
 {
-	// Arm1の位置姿勢（ロボット座標系）を更新する
-	if(m_Arm1Pose3D_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_Arm1Pose3D_InIn.read();
-	}
+	// Arm1の位置姿勢（ロボット座標系）を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_Arm1Pose3D_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteArm1Pose3D(void)
@@ -1042,12 +1047,8 @@ void RTC_Spider2020_Log::OutputArm1AngularHeaders(void)
 
 void RTC_Spider2020_Log::ReadArm1Angular(void)
 {
-	// Arm1の腕の角度を更新する
-	if(m_Arm1Angular_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_Arm1Angular_InIn.read();
-	}
+	// Arm1の腕の角度を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_Arm1Angular_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteArm1Angular(void)
@@ -1081,12 +1082,8 @@ void RTC_Spider2020_Log::OutputArm1FingerHeaders(void)
 
 void RTC_Spider2020_Log::ReadArm1Finger(void)
 {
-	// Arm1の指の開閉具合を更新する
-	if(m_Arm1Finger_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_Arm1Finger_InIn.read();
-	}
+	// Arm1の指の開閉具合を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_Arm1Finger_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteArm1Finger(void)
@@ -1123,12 +1120,8 @@ void RTC_Spider2020_Log::OutputArm1CurrentHeaders(void)
 
 void RTC_Spider2020_Log::ReadArm1Current(void)
 {
-	// Arm1のモータ負荷を更新する
-	if(m_Arm1Current_InIn.isNew())
-	{
-		// 入力データを読み込む
-		m_Arm1Current_InIn.read();
-	}
+	// Arm1のモータ負荷を最新のデータに更新する(溜まった古いデータは読み捨てる)
+	m_Arm1Current_InReader.Read();
 }
 
 void RTC_Spider2020_Log::WriteArm1Current(void)
@@ -0,0 +1,160 @@
+// -*- C++ -*-
+/*!
+ * @file InputState.h
+ * @brief コントローラの入力状態(ボタンのビットマスクと軸キーの配列)
+ * @date 2026/10/19
+ */
+
+#ifndef INPUT_STATE_H
+#define INPUT_STATE_H
+
+#include "Spider2020Skel.h"
+#include "ButtonWrapper.h"
+
+#include <sys/time.h>
+#include <cstdint>
+
+/*!
+ * コントローラの入力状態
+ * @details ボタンの押下状態をビットマスク、軸キーの入力具合を固定長の配列で保持する。
+ *          入力を反映する毎に前回の押下状態との差分から、全ボタンの押下(立ち上がり)、
+ *          解放(立ち下がり)、ダブルクリックをまとめて判定する。
+ *          ポートのデータ型を複写せずに前回の状態との比較ができる(PODのみで構成する)。
+ */
+class InputState
+{
+public:
+	/*!
+	 * @enum 列挙子
+	 * 軸キーの並び(Spider2020::Axisのメンバの並び)
+	 */
+	enum AXIS_t
+	{
+		AXIS_DIR_VERTICAL,			/*!< 十字ボタン(上下)		*/
+		AXIS_DIR_HORIZONTAL,		/*!< 十字ボタン(左右)		*/
+		AXIS_LSTICK_VERTICAL,		/*!< 左スティック(上下)		*/
+		AXIS_LSTICK_HORIZONTAL,		/*!< 左スティック(左右)		*/
+		AXIS_RSTICK_VERTICAL,		/*!< 右スティック(上下)		*/
+		AXIS_RSTICK_HORIZONTAL,		/*!< 右スティック(左右)		*/
+		AXIS_L2,					/*!< L2ボタン				*/
+		AXIS_R2,					/*!< R2ボタン				*/
+		AXIS_NUM,					/*!< 軸キーの数				*/
+	};
+
+	/*!
+	 * @enum 列挙子
+	 * ボタンのビットマスク(組み合わせはビット和で指定する)
+	 */
+	enum BUTTON_t
+	{
+		BUTTON_SQUARE	= (1 << ButtonWrapper::DATA_BIT_POS_SQUARE),	/*!< SQUAREボタン	*/
+		BUTTON_CROSS	= (1 << ButtonWrapper::DATA_BIT_POS_CROSS),		/*!< CROSSボタン	*/
+		BUTTON_CIRCLE	= (1 << ButtonWrapper::DATA_BIT_POS_CIRCLE),	/*!< CIRCLEボタン	*/
+		BUTTON_TRIANGLE	= (1 << ButtonWrapper::DATA_BIT_POS_TRIANGLE),	/*!< TRIANGLEボタン	*/
+		BUTTON_L1		= (1 << ButtonWrapper::DATA_BIT_POS_L1),		/*!< L1ボタン		*/
+		BUTTON_R1		= (1 << ButtonWrapper::DATA_BIT_POS_R1),		/*!< R1ボタン		*/
+		BUTTON_L2		= (1 << ButtonWrapper::DATA_BIT_POS_L2),		/*!< L2ボタン		*/
+		BUTTON_R2		= (1 << ButtonWrapper::DATA_BIT_POS_R2),		/*!< R2ボタン		*/
+		BUTTON_SHARE	= (1 << ButtonWrapper::DATA_BIT_POS_SHARE),		/*!< SHAREボタン	*/
+		BUTTON_OPTIONS	= (1 << ButtonWrapper::DATA_BIT_POS_OPTIONS),	/*!< OPTIONSボタン	*/
+		BUTTON_L3		= (1 << ButtonWrapper::DATA_BIT_POS_L3),		/*!< L3ボタン		*/
+		BUTTON_R3		= (1 << ButtonWrapper::DATA_BIT_POS_R3),		/*!< R3ボタン		*/
+		BUTTON_PS		= (1 << ButtonWrapper::DATA_BIT_POS_PS),		/*!< PSボタン		*/
+		BUTTON_TOUCH	= (1 << ButtonWrapper::DATA_BIT_POS_TOUCH),		/*!< TOUCHボタン	*/
+	};
+
+	/*!
+	 * コンストラクタ
+	 * @method InputState
+	 * @param  dDoublePressSec ダブルクリックと判定する押下の間隔 [s]
+	 */
+	explicit InputState(double dDoublePressSec = 0.3);
+
+	/*!
+	 * 入力状態を初期化する(ボタンは全て解放、軸キーは中立)
+	 * @method Init
+	 * @return なし
+	 */
+	void Init(void);
+
+	/*!
+	 * 入力を反映して、前回の入力からの変化を判定する
+	 * @method Update
+	 * @param  [in] stAxis    軸キーの入力具合
+	 * @param  [in] uButtons  ボタンの押下状態(ビット毎)
+	 * @param  [in] ti        入力を反映する時刻
+	 * @return なし
+	 * @remark 入力が変化していない場合も呼び出すこと(押下・解放の判定が解除される)
+	 */
+	void Update(const Spider2020::Axis &stAxis, uint32_t uButtons, const struct timeval &ti);
+
+	/*!
+	 * 指定したボタンが全て押下されているか
+	 * @method IsHeld
+	 * @param  uMask ボタンのビットマスク
+	 * @retval true 全て押下されている
+	 * @retval false 押下されていないボタンがある
+	 */
+	bool IsHeld(uint32_t uMask) const
+	{
+		return ((m_uButtons & uMask) == uMask);
+	}
+
+	/*!
+	 * 指定したボタンが今回の入力で押下されたか(組み合わせの場合は最後の１つが押下された時)
+	 * @method IsPressed
+	 * @param  uMask ボタンのビットマスク
+	 * @retval true 押下された
+	 * @retval false 上記以外
+	 */
+	bool IsPressed(uint32_t uMask) const
+	{
+		return (IsHeld(uMask) && ((m_uPressed & uMask) != 0));
+	}
+
+	/*!
+	 * 指定したボタンのいずれかが今回の入力で解放されたか
+	 * @method IsReleased
+	 * @param  uMask ボタンのビットマスク
+	 * @retval true 解放された
+	 * @retval false 上記以外
+	 */
+	bool IsReleased(uint32_t uMask) const
+	{
+		return ((m_uReleased & uMask) != 0);
+	}
+
+	/*!
+	 * 指定したボタンのいずれかが今回の入力でダブルクリックされたか
+	 * @method IsDoublePressed
+	 * @param  uMask ボタンのビットマスク
+	 * @retval true ダブルクリックされた
+	 * @retval false 上記以外
+	 */
+	bool IsDoublePressed(uint32_t uMask) const
+	{
+		return ((m_uDoublePressed & uMask) != 0);
+	}
+
+	/*!
+	 * 軸キーの入力具合を取得する
+	 * @method GetAxis
+	 * @param  eAxis 軸キー
+	 * @return 入力具合 (-1.0～1.0)
+	 */
+	float GetAxis(AXIS_t eAxis) const
+	{
+		return m_fAxis[eAxis];
+	}
+
+private:
+	uint32_t m_uButtons;					/*!< ボタンの押下状態					*/
+	uint32_t m_uPressed;					/*!< 今回の入力で押下されたボタン		*/
+	uint32_t m_uReleased;					/*!< 今回の入力で解放されたボタン		*/
+	uint32_t m_uDoublePressed;				/*!< 今回の入力でダブルクリックされたボタン	*/
+	float m_fAxis[AXIS_NUM];				/*!< 軸キーの入力具合					*/
+	double m_dPressTime[ButtonWrapper::DATA_BIT_POS_NUM];	/*!< ボタン毎の最後に押下された時刻 [s]	*/
+	double m_dDoublePressSec;				/*!< ダブルクリックと判定する押下の間隔 [s]	*/
+};
+
+#endif//INPUT_STATE_H
@@ -13,6 +13,7 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 // Service implementation headers
 // <rtc-template block="service_impl_h">
@@ -23,6 +24,7 @@
 // <rtc-template block="consumer_stub_h">
 #include "BasicDataTypeStub.h"
 #include "ExtendedDataTypesStub.h"
+#include "Spider2020Stub.h"
 
 // </rtc-template>
 
@@ -37,6 +39,23 @@
 #include "FingerDeltaWrapper.h"
 #include "FlipperPwmWrapper.h"
 #include "ModeWrapper.h"
+#include "InputState.h"
+#include "InputEventListener.h"
+#include "LatestReader.h"
+#include "LatencyTrace.h"
+
+#include <mutex>
+
+/*!
+ * 入力イベントと実行周期で共有する設定
+ */
+struct MOTION_CONFIG_t
+{
+	double dVelocityGain;		/*!< 並進ゲイン							*/
+	double dOmegaGain;			/*!< 旋回ゲイン							*/
+	bool bEventMode;			/*!< 入力イベントで動作指令を生成するか	*/
+	bool bTrace;				/*!< 遅延計測のトレースを記録するか		*/
+};
 
 /*!
  * @class RTC_Spider2020_Motion
@@ -120,7 +139,7 @@ public:
 	 *
 	 *
 	 */
-	// virtual RTC::ReturnCode_t onActivated(RTC::UniqueId ec_id);
+	virtual RTC::ReturnCode_t onActivated(RTC::UniqueId ec_id);
 
 	/***
 	 *
@@ -132,7 +151,7 @@ public:
 	 *
 	 *
 	 */
-	// virtual RTC::ReturnCode_t onDeactivated(RTC::UniqueId ec_id);
+	virtual RTC::ReturnCode_t onDeactivated(RTC::UniqueId ec_id);
 
 	/***
 	 *
@@ -221,6 +240,46 @@ public:
 	 */
 	void ReadButton(void);
 
+	/*!
+	 * 軸キーとボタンの入力を入力状態に反映する
+	 * @method UpdateInput
+	 * @return なし
+	 * @remark 前回の反映からの押下・解放はここで１度だけ判定する
+	 */
+	void UpdateInput(void);
+
+	/*!
+	 * 軸キーの入力具合の受信を処理する(入力イベント)
+	 * @method OnAxisReceived
+	 * @param  data 受信した軸キーの入力具合
+	 * @return なし
+	 */
+	void OnAxisReceived(const Spider2020::TimedAxis &data);
+
+	/*!
+	 * ボタンの押下状態の受信を処理する(入力イベント)
+	 * @method OnButtonReceived
+	 * @param  data 受信したボタンの押下状態
+	 * @return なし
+	 */
+	void OnButtonReceived(const RTC::TimedULong &data);
+
+	/*!
+	 * 入力の起点の時刻を記録する
+	 * @method TraceInput
+	 * @param  tm 入力のタイムスタンプ(起点の時刻)
+	 * @return なし
+	 * @remark 軸キーとボタンは同じ起点の時刻で届くため、新しい起点のみ記録する
+	 */
+	void TraceInput(const RTC::Time &tm);
+
+	/*!
+	 * 全ての動作指令を生成してポートに出力する
+	 * @method WriteMotion
+	 * @return なし
+	 */
+	void WriteMotion(void);
+
 	/*!
 	 * 動作指令の状態を更新してポートに出力する
 	 * @method WriteMode
@@ -280,18 +339,55 @@ protected:
 	 * - DefaultValue: 1.0
 	 */
 	double m_FAILSAFE_SEC;
+	/*!
+	 * 入力ポートの受信時(ON_RECEIVED)に直ちに動作指令を生成して
+	 * 出力し、操作の遅延を実行周期１回分短縮する。
+	 * push型の接続のみ有効で、実行周期でもフェイルセーフの判定と
+	 * 出力を継続する。
+	 * - Name: 入力イベントで動作指令を生成するか EVENT_MODE
+	 * - DefaultValue: 1
+	 * - Constraint: 0: 実行周期でのみ生成する
+	 *               1: 入力ポートの受信時にも生成する
+	 */
+	long m_EVENT_MODE;
+	/*!
+	 * 1: 軸キー及びボタンのタイムスタンプを起点の時刻とし、入力と
+	 * 出力の時刻を共有メモリのトレースバッファに記録する。
+	 * ２次元の速度及びフリッパーのPWM指令のタイムスタンプには、
+	 * 反映した最新の入力の起点の時刻を設定して後段に伝搬する。
+	 * - Name: 遅延計測のトレースを記録するか TRACE_ENABLE
+	 * - DefaultValue: 0
+	 * - Constraint: 0: 記録しない
+	 *               1: 記録する
+	 */
+	long m_TRACE_ENABLE;
+	/*!
+	 * 実行コンテキストのスレッドの優先度。1～99はSCHED_FIFOの優先度で実行し、
+	 * 0は通常のスケジューリング(SCHED_OTHER)で実行する。
+	 * - Name: 実行コンテキストの優先度 RT_PRIORITY
+	 * - DefaultValue: 0
+	 * - Constraint: 0: SCHED_OTHER
+	 *               1～99: SCHED_FIFOの優先度
+	 */
+	long m_RT_PRIORITY;
+	/*!
+	 * 実行コンテキストのスレッドを割り当てるCPU("0"、"2-3"、"0,2"の形式)。
+	 * ALLは割り当てを変更しない。
+	 * - Name: 実行コンテキストのCPUアフィニティ RT_CPU_AFFINITY
+	 * - DefaultValue: ALL
+	 */
+	std::string m_RT_CPU_AFFINITY;
 
 	// </rtc-template>
 
 	// DataInPort declaration
 	// <rtc-template block="inport_declare">
-	RTC::TimedDoubleSeq m_Axis_In;
+	Spider2020::TimedAxis m_Axis_In;
 	/*!
 	 * DualShock4コントローラの軸キーの入力具合
-	 * - Type: TimedDoubleSeq
-	 * - Number: 8
+	 * - Type: Spider2020::TimedAxis
 	 */
-	RTC::InPort<RTC::TimedDoubleSeq> m_Axis_InIn;
+	RTC::InPort<Spider2020::TimedAxis> m_Axis_InIn;
 	RTC::TimedULong m_Button_In;
 	/*!
 	 * DualShock4コントローラのボタンの押下状態
@@ -305,26 +401,24 @@ protected:
 
 	// DataOutPort declaration
 	// <rtc-template block="outport_declare">
-	RTC::TimedLongSeq m_Mode_Out;
+	Spider2020::TimedMode m_Mode_Out;
 	/*!
 	 * 動作指令の状態
-	 * - Type: TimedLongSeq
-	 * - Number: 9
+	 * - Type: Spider2020::TimedMode
 	 */
-	RTC::OutPort<RTC::TimedLongSeq> m_Mode_OutOut;
+	RTC::OutPort<Spider2020::TimedMode> m_Mode_OutOut;
 	RTC::TimedVelocity2D m_Velocity2D_Out;
 	/*!
 	 * ２次元の速度
 	 * - Type: TimedVelocity2D
 	 */
 	RTC::OutPort<RTC::TimedVelocity2D> m_Velocity2D_OutOut;
-	RTC::TimedLongSeq m_FlipperPwm_Out;
+	Spider2020::TimedFlipperPwm m_FlipperPwm_Out;
 	/*!
 	 * フリッパーのPWM指令
-	 * - Type: TimedLongSeq
-	 * - Number: 4
+	 * - Type: Spider2020::TimedFlipperPwm
 	 */
-	RTC::OutPort<RTC::TimedLongSeq> m_FlipperPwm_OutOut;
+	RTC::OutPort<Spider2020::TimedFlipperPwm> m_FlipperPwm_OutOut;
 	RTC::TimedLong m_ResetIMU_Out;
 	/*!
 	 * IMUのフィルタリセット指令
@@ -341,12 +435,12 @@ protected:
 	 * - Type: TimedPose3D
 	 */
 	RTC::OutPort<RTC::TimedPose3D> m_Arm1PoseDelta_OutOut;
-	RTC::TimedLongSeq m_Arm1FingerDelta_Out;
+	Spider2020::TimedFinger m_Arm1FingerDelta_Out;
 	/*!
 	 * Jaco2アーム（１本目）の指の開閉具合の変位速度
-	 * - Type: TimedLongSeq
+	 * - Type: Spider2020::TimedFinger
 	 */
-	RTC::OutPort<RTC::TimedLongSeq> m_Arm1FingerDelta_OutOut;
+	RTC::OutPort<Spider2020::TimedFinger> m_Arm1FingerDelta_OutOut;
 	RTC::TimedLong m_Arm1Home_Out;
 	/*!
 	 * Jaco2アーム（１本目）の初期姿勢遷移指令
@@ -381,20 +475,29 @@ private:
 
 	// </rtc-template>
 
-	RTC::TimedDoubleSeq m_OldAxis_In;					/*!< 前回の軸キーの入力具合				*/
-	RTC::TimedULong m_OldButton_In;						/*!< 前回のボタンの押下状態				*/
-
 	AxisWrapper m_Axis_InWrap;							/*!< m_Axis_Inのラッパークラス			*/
-	AxisWrapper m_OldAxis_InWrap;						/*!< m_OldAxis_Inのラッパークラス		*/
 	ButtonWrapper m_Button_InWrap;						/*!< m_Button_Inのラッパークラス		*/
-	ButtonWrapper m_OldButton_InWrap;					/*!< m_OldButton_Inのラッパークラス		*/
+	LatestReader<Spider2020::TimedAxis> m_Axis_InReader;	/*!< m_Axis_InInの最新データの読み込み	*/
+	LatestReader<RTC::TimedULong> m_Button_InReader;	/*!< m_Button_InInの最新データの読み込み	*/
 	ModeWrapper m_Mode_OutWrap;							/*!< m_Mode_Outのラッパークラス			*/
 	FlipperPwmWrapper m_FlipperPwm_OutWrap;				/*!< m_FlipperPwm_Outのラッパークラス	*/
 	FingerDeltaWrapper m_Arm1FingerDelta_OutWrap;		/*!< m_FingerDelta_Outのラッパークラス	*/
 
+	InputState m_Input;									/*!< 動作指令の生成に使用する入力状態	*/
+
 	struct timeval m_stAxisReadTime;					/*!< m_Axis_Inの入力時刻				*/
 	struct timeval m_stButtonReadTime;					/*!< m_Button_Inの入力時刻				*/
 
+	std::mutex m_Mutex;									/*!< 入力イベントと実行周期の排他制御	*/
+	MOTION_CONFIG_t m_stConfig;							/*!< 入力イベントと共有する設定			*/
+	bool m_bActive;										/*!< アクティブ状態か					*/
+	bool m_bAxisReceived;								/*!< 入力イベントでm_Axis_Inを更新したか	*/
+	bool m_bButtonReceived;								/*!< 入力イベントでm_Button_Inを更新したか	*/
+
+	LatencyTrace m_Trace;								/*!< 遅延計測のトレースバッファ			*/
+	int64_t m_iTraceOriginNs;							/*!< 反映した最新の入力の起点の時刻 [ns]	*/
+	int64_t m_iTraceOutputNs;							/*!< 最後に出力を記録した起点の時刻 [ns]	*/
+
 };
 
 
@@ -0,0 +1,70 @@
+#include "InputState.h"
+
+InputState::InputState(double dDoublePressSec)
+	: m_dDoublePressSec(dDoublePressSec)
+{
+	Init();
+}
+
+void InputState::Init(void)
+{
+	int i = 0;
+
+	// ボタンを全て解放する
+	m_uButtons = 0;
+	m_uPressed = 0;
+	m_uReleased = 0;
+	m_uDoublePressed = 0;
+	for(i = 0; i < ButtonWrapper::DATA_BIT_POS_NUM; i++)
+	{
+		m_dPressTime[i] = 0.0;
+	}
+
+	// 軸キーを中立にする(L2,R2ボタンは解放時に-1.0)
+	for(i = 0; i < AXIS_NUM; i++)
+	{
+		m_fAxis[i] = 0.0f;
+	}
+	m_fAxis[AXIS_L2] = -1.0f;
+	m_fAxis[AXIS_R2] = -1.0f;
+}
+
+void InputState::Update(const Spider2020::Axis &stAxis, uint32_t uButtons, const struct timeval &ti)
+{
+	double dTime = (double)ti.tv_sec + (double)ti.tv_usec/1000000.0;
+	int i = 0;
+
+	// 前回の押下状態との差分から、全ボタンの押下・解放をまとめて判定する
+	m_uPressed = uButtons & ~m_uButtons;
+	m_uReleased = ~uButtons & m_uButtons;
+	m_uButtons = uButtons;
+
+	// 押下されたボタンのみ、前回の押下からの間隔でダブルクリックを判定する
+	m_uDoublePressed = 0;
+	for(i = 0; (i < ButtonWrapper::DATA_BIT_POS_NUM) && (m_uPressed >> i); i++)
+	{
+		if((m_uPressed >> i) & 1)
+		{
+			// ３回目の押下を再びダブルクリックと判定しないよう、判定後は押下時刻を消去する
+			if((0.0 < m_dPressTime[i]) && (dTime - m_dPressTime[i] <= m_dDoublePressSec))
+			{
+				m_uDoublePressed |= (1 << i);
+				m_dPressTime[i] = 0.0;
+			}
+			else
+			{
+				m_dPressTime[i] = dTime;
+			}
+		}
+	}
+
+	// 軸キーの入力具合を反映する
+	m_fAxis[AXIS_DIR_VERTICAL] = (float)stAxis.dir_vertical;
+	m_fAxis[AXIS_DIR_HORIZONTAL] = (float)stAxis.dir_horizontal;
+	m_fAxis[AXIS_LSTICK_VERTICAL] = (float)stAxis.lstick_vertical;
+	m_fAxis[AXIS_LSTICK_HORIZONTAL] = (float)stAxis.lstick_horizontal;
+	m_fAxis[AXIS_RSTICK_VERTICAL] = (float)stAxis.rstick_vertical;
+	m_fAxis[AXIS_RSTICK_HORIZONTAL] = (float)stAxis.rstick_horizontal;
+	m_fAxis[AXIS_L2] = (float)stAxis.l2;
+	m_fAxis[AXIS_R2] = (float)stAxis.r2;
+}
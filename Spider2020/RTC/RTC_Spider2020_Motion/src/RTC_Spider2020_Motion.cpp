@@ -8,11 +8,62 @@
  */
 
 #include "RTC_Spider2020_Motion.h"
+#include "RealtimeSetup.h"
 #include <math.h>
 
 // timeval構造体の差を計算する(x1-x2)
 #define TIMEVAL_DIFF(x1,x2)	(((double)x1.tv_sec + (double)x1.tv_usec/1000000.0) - ((double)x2.tv_sec + (double)x2.tv_usec/1000000.0))
 
+// 台車の位置姿勢のクリア(IMUのフィルタリセット)の同時押しボタン
+#define POSE_CLEAR_BUTTONS	(InputState::BUTTON_SHARE | InputState::BUTTON_OPTIONS)
+
+/*!
+ * 操作モードの切り替え順(TOUCHボタン押下毎)
+ */
+static const int32_t s_iNextControl[ModeWrapper::CONTROL_NUM] =
+{
+	ModeWrapper::CONTROL_ARM,			/*!< 台車からアーム		*/
+	ModeWrapper::CONTROL_DRIVE,			/*!< アームから台車		*/
+};
+
+/*!
+ * 速度レベルの切り替え順(CIRCLEボタン押下毎)
+ */
+static const int32_t s_iNextSpeedLevel[ModeWrapper::SPEED_LEVEL_NUM] =
+{
+	ModeWrapper::SPEED_LEVEL_MID,		/*!< 低速から中速		*/
+	ModeWrapper::SPEED_LEVEL_HIGH,		/*!< 中速から高速		*/
+	ModeWrapper::SPEED_LEVEL_LOW,		/*!< 高速から低速		*/
+};
+
+/*!
+ * 走行モードでフリッパーを選択するボタン(押下中は選択する)
+ */
+static const struct
+{
+	uint32_t uButton;								/*!< ボタン				*/
+	void (ModeWrapper::*pfnSelect)(const int32_t);	/*!< 選択状態の設定		*/
+} s_FlipperSelectButton[] =
+{
+	{InputState::BUTTON_R1, &ModeWrapper::SetFrontRightFlipperSelect},	/*!< 右前方フリッパー	*/
+	{InputState::BUTTON_L1, &ModeWrapper::SetFrontLeftFlipperSelect},	/*!< 左前方フリッパー	*/
+	{InputState::BUTTON_R2, &ModeWrapper::SetBackRightFlipperSelect},	/*!< 右後方フリッパー	*/
+	{InputState::BUTTON_L2, &ModeWrapper::SetBackLeftFlipperSelect},	/*!< 左後方フリッパー	*/
+};
+
+/*!
+ * 走行モードでフリッパーの動作状態を決めるボタン(先頭から優先、いずれも押下されていなければ現状維持)
+ */
+static const struct
+{
+	uint32_t uButton;		/*!< ボタン				*/
+	int32_t iStatus;		/*!< フリッパーの動作状態	*/
+} s_FlipperStatusButton[] =
+{
+	{InputState::BUTTON_TRIANGLE, ModeWrapper::FLIPPER_STATUS_UP},		/*!< 上昇	*/
+	{InputState::BUTTON_CROSS, ModeWrapper::FLIPPER_STATUS_DOWN},		/*!< 下降	*/
+};
+
 // Module specification
 // <rtc-template block="module_spec">
 static const char* rtc_spider2020_motion_spec[] =
@@ -33,16 +84,28 @@ static const char* rtc_spider2020_motion_spec[] =
 	"conf.default.VELOCITY_GAIN", "0.15",
 	"conf.default.OMEGA_GAIN", "0.785",
 	"conf.default.FAILSAFE_SEC", "1.0",
+	"conf.default.EVENT_MODE", "1",
+	"conf.default.TRACE_ENABLE", "0",
+	"conf.default.RT_PRIORITY", "0",
+	"conf.default.RT_CPU_AFFINITY", "ALL",
 
 	// Widget
 	"conf.__widget__.VELOCITY_GAIN", "text",
 	"conf.__widget__.OMEGA_GAIN", "text",
 	"conf.__widget__.FAILSAFE_SEC", "text",
+	"conf.__widget__.EVENT_MODE", "text",
+	"conf.__widget__.TRACE_ENABLE", "text",
+	"conf.__widget__.RT_PRIORITY", "text",
+	"conf.__widget__.RT_CPU_AFFINITY", "text",
 
 	// Constraints
 	"conf.__type__.VELOCITY_GAIN", "double",
 	"conf.__type__.OMEGA_GAIN", "double",
 	"conf.__type__.FAILSAFE_SEC", "double",
+	"conf.__type__.EVENT_MODE", "long",
+	"conf.__type__.TRACE_ENABLE", "long",
+	"conf.__type__.RT_PRIORITY", "long",
+	"conf.__type__.RT_CPU_AFFINITY", "string",
 
 	""
 };
@@ -67,14 +130,21 @@ RTC_Spider2020_Motion::RTC_Spider2020_Motion(RTC::Manager* manager)
 
 	// </rtc-template>
 	, m_Axis_InWrap(m_Axis_In)
-	, m_OldAxis_InWrap(m_OldAxis_In)
 	, m_Button_InWrap(m_Button_In)
-	, m_OldButton_InWrap(m_OldButton_In)
+	, m_Axis_InReader(m_Axis_InIn, m_Axis_In)
+	, m_Button_InReader(m_Button_InIn, m_Button_In)
 	, m_Mode_OutWrap(m_Mode_Out)
 	, m_FlipperPwm_OutWrap(m_FlipperPwm_Out)
 	, m_Arm1FingerDelta_OutWrap(m_Arm1FingerDelta_Out)
+	, m_Input()
 	, m_stAxisReadTime({0})
 	, m_stButtonReadTime({0})
+	, m_stConfig()
+	, m_bActive(false)
+	, m_bAxisReceived(false)
+	, m_bButtonReceived(false)
+	, m_iTraceOriginNs(0)
+	, m_iTraceOutputNs(0)
 {
 }
 
@@ -115,19 +185,26 @@ RTC::ReturnCode_t RTC_Spider2020_Motion::onInitialize()
 	bindParameter("VELOCITY_GAIN", m_VELOCITY_GAIN, "0.15");
 	bindParameter("OMEGA_GAIN", m_OMEGA_GAIN, "0.785");
 	bindParameter("FAILSAFE_SEC", m_FAILSAFE_SEC, "1.0");
+	bindParameter("EVENT_MODE", m_EVENT_MODE, "1");
+	bindParameter("TRACE_ENABLE", m_TRACE_ENABLE, "0");
+	bindParameter("RT_PRIORITY", m_RT_PRIORITY, "0");
+	bindParameter("RT_CPU_AFFINITY", m_RT_CPU_AFFINITY, "ALL");
 	// </rtc-template>
 
+	// 受信時に動作指令を生成するリスナを登録する(リスナはポートが解放する)
+	m_Axis_InIn.addConnectorDataListener(RTC::ON_RECEIVED,
+		new InputEventListener<Spider2020::TimedAxis>([this](const Spider2020::TimedAxis &data){ OnAxisReceived(data); }));
+	m_Button_InIn.addConnectorDataListener(RTC::ON_RECEIVED,
+		new InputEventListener<RTC::TimedULong>([this](const RTC::TimedULong &data){ OnButtonReceived(data); }));
+
 	// 軸キーの出力を初期化する
 	m_Axis_InWrap.InitData();
 
-	// 前回の軸キーの出力を初期化する
-	m_OldAxis_InWrap.InitData();
-
 	// ボタンの出力を初期化する
 	m_Button_InWrap.InitData();
 
-	// 前回のボタンの出力を初期化する
-	m_OldButton_InWrap.InitData();
+	// 入力状態を初期化する
+	m_Input.Init();
 
 	// 動作指令の状態の出力を初期化する
 	m_Mode_OutWrap.InitData();
@@ -181,39 +258,73 @@ RTC::ReturnCode_t RTC_Spider2020_Motion::onShutdown(RTC::UniqueId ec_id)
 }
 */
 
-/*
 RTC::ReturnCode_t RTC_Spider2020_Motion::onActivated(RTC::UniqueId ec_id)
 {
+	std::lock_guard<std::mutex> lock(m_Mutex);
+
+	// 実行コンテキストのスレッドの優先度とCPUアフィニティを設定する
+	RealtimeSetup::SetupThread((int)m_RT_PRIORITY, m_RT_CPU_AFFINITY, "motion.ec");
+
+	// 入力イベントと共有する設定を更新する
+	m_stConfig.dVelocityGain = m_VELOCITY_GAIN;
+	m_stConfig.dOmegaGain = m_OMEGA_GAIN;
+	m_stConfig.bEventMode = (m_EVENT_MODE != 0);
+	m_stConfig.bTrace = (m_TRACE_ENABLE != 0);
+
+	// 遅延計測のトレースバッファを開く
+	m_iTraceOriginNs = 0;
+	m_iTraceOutputNs = 0;
+	if(m_stConfig.bTrace)
+	{
+		m_Trace.Open();
+	}
+
+	// 入力イベントの処理を開始する
+	m_bAxisReceived = false;
+	m_bButtonReceived = false;
+	m_bActive = true;
+
 	return RTC::RTC_OK;
 }
-*/
 
-/*
 RTC::ReturnCode_t RTC_Spider2020_Motion::onDeactivated(RTC::UniqueId ec_id)
 {
+	std::lock_guard<std::mutex> lock(m_Mutex);
+
+	// 入力イベントの処理を停止する
+	m_bActive = false;
+
+	// 読み捨てた古い入力を表示する
+	m_Axis_InReader.PrintStatistics("Axis_In");
+	m_Button_InReader.PrintStatistics("Button_In");
+
+	// 遅延計測のトレースバッファを閉じる
+	m_Trace.Close();
+
 	return RTC::RTC_OK;
 }
-*/
 
 RTC::ReturnCode_t RTC_Spider2020_Motion::onExecute(RTC::UniqueId ec_id)
 {
+	std::lock_guard<std::mutex> lock(m_Mutex);
+
+	// 入力イベントと共有する設定を更新する(設定の更新は実行周期のスレッドで行われる)
+	m_stConfig.dVelocityGain = m_VELOCITY_GAIN;
+	m_stConfig.dOmegaGain = m_OMEGA_GAIN;
+	m_stConfig.bEventMode = (m_EVENT_MODE != 0);
+	m_stConfig.bTrace = (m_TRACE_ENABLE != 0);
+
 	// 軸キーの入力具合をポートから読み込む
 	ReadAxis();
 
 	// ボタンの入力具合をポートから読み込む
 	ReadButton();
 
-	// 動作指令の状態を更新してポートに出力する
-	WriteMode();
-
-	// 走行モードの動作指令を生成してポートに出力する
-	WriteCrawlerMotion();
-
-	// IMUのフィルタリセット指令の状態を更新してポートに出力する
-	WriteResetIMU();
+	// 入力状態を更新する(新しい入力がなければ押下・解放の判定を解除する)
+	UpdateInput();
 
-	// アームモードの動作指令を生成してポートに出力する
-	WriteArmMotion();
+	// 全ての動作指令を生成してポートに出力する(入力が途絶えた場合もフェイルセーフ後の指令を出力する)
+	WriteMotion();
 
 	return RTC::RTC_OK;
 }
@@ -260,17 +371,25 @@ void RTC_Spider2020_Motion::ReadAxis(void)
 	// 現在の時刻を取得する
 	gettimeofday(&ti, NULL);
 
-	// 前回の軸キーの入力具合を更新する
-	m_OldAxis_InWrap = m_Axis_InWrap;
-
 	// 軸キーの入力具合を更新する
 	if(m_Axis_InIn.isNew())
 	{
 		// 読み込み時刻を更新する
 		m_stAxisReadTime = ti;
 
-		// 次のデータを読み込む
-		m_Axis_InIn.read();
+		// 入力イベントで反映済みならば、古いデータで戻さないよう読み捨てる
+		if(m_stConfig.bEventMode && m_bAxisReceived)
+		{
+			Spider2020::TimedAxis stApplied = m_Axis_In;
+			m_Axis_InReader.Read();
+			m_Axis_In = stApplied;
+		}
+		else
+		{
+			// 最新のデータまで読み込む(溜まった古いデータは読み捨てる)
+			m_Axis_InReader.Read();
+			TraceInput(m_Axis_In.tm);
+		}
 	}
 	else
 	{
@@ -280,6 +399,7 @@ void RTC_Spider2020_Motion::ReadAxis(void)
 			m_Axis_InWrap.InitData();
 		}
 	}
+	m_bAxisReceived = false;
 }
 
 void RTC_Spider2020_Motion::ReadButton(void)
@@ -289,17 +409,25 @@ void RTC_Spider2020_Motion::ReadButton(void)
 	// 現在の時刻を取得する
 	gettimeofday(&ti, NULL);
 
-	// 前回のボタンの入力具合を更新する
-	m_OldButton_InWrap = m_Button_InWrap;
-
 	// ボタンの入力具合を更新する
 	if(m_Button_InIn.isNew())
 	{
 		// 読み込み時刻を更新する
 		m_stButtonReadTime = ti;
 
-		// 次のデータを読み込む
-		m_Button_InIn.read();
+		// 入力イベントで反映済みならば、古いデータで戻さないよう読み捨てる
+		if(m_stConfig.bEventMode && m_bButtonReceived)
+		{
+			RTC::TimedULong stApplied = m_Button_In;
+			m_Button_InReader.Read();
+			m_Button_In = stApplied;
+		}
+		else
+		{
+			// 最新のデータまで読み込む(溜まった古いデータは読み捨てる)
+			m_Button_InReader.Read();
+			TraceInput(m_Button_In.tm);
+		}
 	}
 	else
 	{
@@ -309,143 +437,155 @@ void RTC_Spider2020_Motion::ReadButton(void)
 			m_Button_InWrap.InitData();
 		}
 	}
+	m_bButtonReceived = false;
 }
 
-void RTC_Spider2020_Motion::WriteMode(void)
+void RTC_Spider2020_Motion::UpdateInput(void)
 {
-	// TOUCHボタン押下で速度レベルを変更する
-	if(m_Button_InWrap.GetTouch() && !m_OldButton_InWrap.GetTouch())
+	struct timeval ti = {0};
+
+	// 現在の時刻を取得する
+	gettimeofday(&ti, NULL);
+
+	// 軸キーとボタンの入力を反映して、前回からの押下・解放を判定する
+	m_Input.Update(m_Axis_In.data, m_Button_In.data, ti);
+}
+
+void RTC_Spider2020_Motion::OnAxisReceived(const Spider2020::TimedAxis &data)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+
+	// 非アクティブ、または入力イベントを使用しない場合は実行周期で読み込む
+	if(!m_bActive || !m_stConfig.bEventMode)
 	{
-		switch(m_Mode_OutWrap.GetControl())
-		{
-			// 動作指令の操作モードを台車からアームに変更する
-			case ModeWrapper::CONTROL_DRIVE:
-				m_Mode_OutWrap.SetControl(ModeWrapper::CONTROL_ARM);
-				break;
-			// 動作指令の操作モードをアームから台車に変更する
-			case ModeWrapper::CONTROL_ARM:
-				m_Mode_OutWrap.SetControl(ModeWrapper::CONTROL_DRIVE);
-				break;
-			default:
-				m_Mode_OutWrap.SetControl(ModeWrapper::CONTROL_DRIVE);
-				break;
-		}
+		return;
 	}
 
-	// 走行モード
-	if(m_Mode_OutWrap.GetControl() == ModeWrapper::CONTROL_DRIVE)
+	// 受信した軸キーの入力具合を反映する(ポートのバッファへの書き込み前のため、ポートは読み込まない)
+	m_Axis_In = data;
+	gettimeofday(&m_stAxisReadTime, NULL);
+	m_bAxisReceived = true;
+	TraceInput(data.tm);
+
+	// 入力状態を更新する
+	UpdateInput();
+
+	// 全ての動作指令を生成してポートに出力する
+	WriteMotion();
+}
+
+void RTC_Spider2020_Motion::OnButtonReceived(const RTC::TimedULong &data)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+
+	// 非アクティブ、または入力イベントを使用しない場合は実行周期で読み込む
+	if(!m_bActive || !m_stConfig.bEventMode)
 	{
-		// SHAREボタン及びOPTIONSボタンを同時押しなら台車の位置姿勢のクリアを設定する
-		if(m_Button_InWrap.GetShare() && m_Button_InWrap.GetOptions())
-		{
-			// 台車の位置姿勢のクリアをONする
-			m_Mode_OutWrap.SetCrawlerPoseClear(ModeWrapper::CRAWLER_POSE_CLEAR_ON);
-		}
-		else
-		{
-			// 台車の位置姿勢のクリアをOFFする
-			m_Mode_OutWrap.SetCrawlerPoseClear(ModeWrapper::CRAWLER_POSE_CLEAR_OFF);
-		}
+		return;
+	}
 
-		// CIRCLEボタン押下で速度レベルを変更する
-		if(m_Button_InWrap.GetCircle() && !m_OldButton_InWrap.GetCircle())
-		{
-			switch(m_Mode_OutWrap.GetSpeedLevel())
-			{
-				// 台車の速度を低速から中速に変更する
-				case ModeWrapper::SPEED_LEVEL_LOW:
-					m_Mode_OutWrap.SetSpeedLevel(ModeWrapper::SPEED_LEVEL_MID);
-					break;
-				// 台車の速度を中速から高速に変更する
-				case ModeWrapper::SPEED_LEVEL_MID:
-					m_Mode_OutWrap.SetSpeedLevel(ModeWrapper::SPEED_LEVEL_HIGH);
-					break;
-				// 台車の速度を高速から低速に変更する
-				case ModeWrapper::SPEED_LEVEL_HIGH:
-					m_Mode_OutWrap.SetSpeedLevel(ModeWrapper::SPEED_LEVEL_LOW);
-					break;
-				default:
-					m_Mode_OutWrap.SetSpeedLevel(ModeWrapper::SPEED_LEVEL_LOW);
-					break;
-			}
-		}
+	// 受信したボタンの押下状態を反映する(ポートのバッファへの書き込み前のため、ポートは読み込まない)
+	m_Button_In = data;
+	gettimeofday(&m_stButtonReadTime, NULL);
+	m_bButtonReceived = true;
+	TraceInput(data.tm);
 
-		// L3ボタン押下で最大速度フラグを変更する
-		if(m_Button_InWrap.GetL3())
-		{
-			// 最大速度フラグをONする
-			m_Mode_OutWrap.SetSpeedMax(ModeWrapper::SPEED_MAX_ON);
-		}
-		else
-		{
-			// 最大速度フラグをOFFする
-			m_Mode_OutWrap.SetSpeedMax(ModeWrapper::SPEED_MAX_OFF);
-		}
+	// 入力状態を更新する
+	UpdateInput();
 
-		// R1ボタン押下で右前方フリッパーの選択状態を変更する
-		if(m_Button_InWrap.GetR1())
-		{
-			// 右前方フリッパーを選択する
-			m_Mode_OutWrap.SetFrontRightFlipperSelect(ModeWrapper::FLIPPER_SELECT_ON);
-		}
-		else
-		{
-			// 右前方フリッパーを選択解除する
-			m_Mode_OutWrap.SetFrontRightFlipperSelect(ModeWrapper::FLIPPER_SELECT_OFF);
-		}
+	// 全ての動作指令を生成してポートに出力する
+	WriteMotion();
+}
 
-		// L1ボタン押下で左前方フリッパーの選択状態を変更する
-		if(m_Button_InWrap.GetL1())
-		{
-			// 左前方フリッパーを選択する
-			m_Mode_OutWrap.SetFrontLeftFlipperSelect(ModeWrapper::FLIPPER_SELECT_ON);
-		}
-		else
-		{
-			// 左前方フリッパーを選択解除する
-			m_Mode_OutWrap.SetFrontLeftFlipperSelect(ModeWrapper::FLIPPER_SELECT_OFF);
-		}
+void RTC_Spider2020_Motion::TraceInput(const RTC::Time &tm)
+{
+	int64_t iOriginNs = LatencyTrace::ToNs(tm);
+
+	// 記録しない場合、または既に記録した起点ならば何もしない
+	if(!m_stConfig.bTrace || (iOriginNs <= m_iTraceOriginNs))
+	{
+		return;
+	}
+
+	// 新しい起点の入力時刻を記録する
+	m_iTraceOriginNs = iOriginNs;
+	m_Trace.Record(TRACE_MOTION_INPUT, iOriginNs);
+}
+
+void RTC_Spider2020_Motion::WriteMotion(void)
+{
+	// 動作指令の状態を更新してポートに出力する
+	WriteMode();
+
+	// 走行モードの動作指令を生成してポートに出力する
+	WriteCrawlerMotion();
+
+	// IMUのフィルタリセット指令の状態を更新してポートに出力する
+	WriteResetIMU();
+
+	// アームモードの動作指令を生成してポートに出力する
+	WriteArmMotion();
+}
+
+void RTC_Spider2020_Motion::WriteMode(void)
+{
+	int32_t iControl = m_Mode_OutWrap.GetControl();
+	int32_t iSpeedLevel = 0;
+	int32_t iFlipperStatus = ModeWrapper::FLIPPER_STATUS_STAY;
+	size_t i = 0;
 
-		// R2ボタン押下で右後方フリッパーの選択状態を変更する
-		if(m_Button_InWrap.GetR2())
+	// TOUCHボタン押下で操作モードを切り替える
+	if(m_Input.IsPressed(InputState::BUTTON_TOUCH))
+	{
+		if((0 <= iControl) && (iControl < ModeWrapper::CONTROL_NUM))
 		{
-			// 右後方フリッパーを選択する
-			m_Mode_OutWrap.SetBackRightFlipperSelect(ModeWrapper::FLIPPER_SELECT_ON);
+			m_Mode_OutWrap.SetControl(s_iNextControl[iControl]);
 		}
 		else
 		{
-			// 右後方フリッパーを選択解除する
-			m_Mode_OutWrap.SetBackRightFlipperSelect(ModeWrapper::FLIPPER_SELECT_OFF);
+			m_Mode_OutWrap.SetControl(ModeWrapper::CONTROL_DRIVE);
 		}
+	}
+
+	// 走行モード
+	if(m_Mode_OutWrap.GetControl() == ModeWrapper::CONTROL_DRIVE)
+	{
+		// SHAREボタン及びOPTIONSボタンを同時押しなら台車の位置姿勢のクリアをONする
+		m_Mode_OutWrap.SetCrawlerPoseClear(m_Input.IsHeld(POSE_CLEAR_BUTTONS) ? ModeWrapper::CRAWLER_POSE_CLEAR_ON : ModeWrapper::CRAWLER_POSE_CLEAR_OFF);
 
-		// L2ボタン押下で左後方フリッパーの選択状態を変更する
-		if(m_Button_InWrap.GetL2())
+		// CIRCLEボタン押下で速度レベルを変更する(低速→中速→高速→低速)
+		if(m_Input.IsPressed(InputState::BUTTON_CIRCLE))
 		{
-			// 左後方フリッパーを選択する
-			m_Mode_OutWrap.SetBackLeftFlipperSelect(ModeWrapper::FLIPPER_SELECT_ON);
+			iSpeedLevel = m_Mode_OutWrap.GetSpeedLevel();
+			if((0 <= iSpeedLevel) && (iSpeedLevel < ModeWrapper::SPEED_LEVEL_NUM))
+			{
+				m_Mode_OutWrap.SetSpeedLevel(s_iNextSpeedLevel[iSpeedLevel]);
+			}
+			else
+			{
+				m_Mode_OutWrap.SetSpeedLevel(ModeWrapper::SPEED_LEVEL_LOW);
+			}
 		}
-		else
+
+		// L3ボタン押下中は最大速度フラグをONする
+		m_Mode_OutWrap.SetSpeedMax(m_Input.IsHeld(InputState::BUTTON_L3) ? ModeWrapper::SPEED_MAX_ON : ModeWrapper::SPEED_MAX_OFF);
+
+		// R1,L1,R2,L2ボタン押下中は対応するフリッパーを選択する
+		for(i = 0; i < sizeof(s_FlipperSelectButton)/sizeof(s_FlipperSelectButton[0]); i++)
 		{
-			// 左後方フリッパーを選択解除する
-			m_Mode_OutWrap.SetBackLeftFlipperSelect(ModeWrapper::FLIPPER_SELECT_OFF);
+			(m_Mode_OutWrap.*s_FlipperSelectButton[i].pfnSelect)(m_Input.IsHeld(s_FlipperSelectButton[i].uButton) ? ModeWrapper::FLIPPER_SELECT_ON : ModeWrapper::FLIPPER_SELECT_OFF);
 		}
 
 		// TRIANGLEボタンまたはCROSSボタン押下でフリッパーの動作状態を変更する
-		if(m_Button_InWrap.GetTriangle())
-		{
-			// 選択フリッパーを上昇する
-			m_Mode_OutWrap.SetFlipperStatus(ModeWrapper::FLIPPER_STATUS_UP);
-		}
-		else if(m_Button_InWrap.GetCross())
+		for(i = 0; i < sizeof(s_FlipperStatusButton)/sizeof(s_FlipperStatusButton[0]); i++)
 		{
-			// 選択フリッパーを下降する
-			m_Mode_OutWrap.SetFlipperStatus(ModeWrapper::FLIPPER_STATUS_DOWN);
-		}
-		else
-		{
-			// 選択フリッパーを現状維持する
-			m_Mode_OutWrap.SetFlipperStatus(ModeWrapper::FLIPPER_STATUS_STAY);
+			if(m_Input.IsHeld(s_FlipperStatusButton[i].uButton))
+			{
+				iFlipperStatus = s_FlipperStatusButton[i].iStatus;
+				break;
+			}
 		}
+		m_Mode_OutWrap.SetFlipperStatus(iFlipperStatus);
 	}
 	// 上記以外
 	else
@@ -457,10 +597,10 @@ void RTC_Spider2020_Motion::WriteMode(void)
 		m_Mode_OutWrap.SetSpeedMax(ModeWrapper::SPEED_MAX_OFF);
 
 		// 全てのフリッパーの選択状態を解除する
-		m_Mode_OutWrap.SetFrontRightFlipperSelect(ModeWrapper::FLIPPER_SELECT_OFF);
-		m_Mode_OutWrap.SetFrontLeftFlipperSelect(ModeWrapper::FLIPPER_SELECT_OFF);
-		m_Mode_OutWrap.SetBackRightFlipperSelect(ModeWrapper::FLIPPER_SELECT_OFF);
-		m_Mode_OutWrap.SetBackLeftFlipperSelect(ModeWrapper::FLIPPER_SELECT_OFF);
+		for(i = 0; i < sizeof(s_FlipperSelectButton)/sizeof(s_FlipperSelectButton[0]); i++)
+		{
+			(m_Mode_OutWrap.*s_FlipperSelectButton[i].pfnSelect)(ModeWrapper::FLIPPER_SELECT_OFF);
+		}
 
 		// 選択フリッパーを現状維持する
 		m_Mode_OutWrap.SetFlipperStatus(ModeWrapper::FLIPPER_STATUS_STAY);
@@ -482,8 +622,8 @@ void RTC_Spider2020_Motion::WriteCrawlerMotion(void)
 	if(m_Mode_OutWrap.GetControl() == ModeWrapper::CONTROL_DRIVE)
 	{
 		// 左スティック操作を速度に変換する
-		dLStickVertical = m_Axis_InWrap.GetLStickVertical()*-1.0;
-		dLStickHorizontal = m_Axis_InWrap.GetLStickHorizontal();
+		dLStickVertical = m_Input.GetAxis(InputState::AXIS_LSTICK_VERTICAL)*-1.0;
+		dLStickHorizontal = m_Input.GetAxis(InputState::AXIS_LSTICK_HORIZONTAL);
 		dLStickLength = sqrt(pow(dLStickVertical,2.0) + pow(dLStickHorizontal,2.0));
 		dLStickLength = std::min(std::max(dLStickLength, -1.0), 1.0);
 		dOmega = atan2(dLStickVertical,dLStickHorizontal);
@@ -514,9 +654,9 @@ void RTC_Spider2020_Motion::WriteCrawlerMotion(void)
 		}
 
 		// ２次元の速度を求める
-		m_Velocity2D_Out.data.vx = dLStickLength*sin(dOmega)*m_VELOCITY_GAIN;
+		m_Velocity2D_Out.data.vx = dLStickLength*sin(dOmega)*m_stConfig.dVelocityGain;
 		m_Velocity2D_Out.data.vy = 0.0;
-		m_Velocity2D_Out.data.va = dLStickLength*cos(dOmega)*m_OMEGA_GAIN*-1.0;
+		m_Velocity2D_Out.data.va = dLStickLength*cos(dOmega)*m_stConfig.dOmegaGain*-1.0;
 
 		// フリッパーの動作状態が上昇
 		if(m_Mode_OutWrap.GetFlipperStatus() == ModeWrapper::FLIPPER_STATUS_UP)
@@ -639,12 +779,26 @@ void RTC_Spider2020_Motion::WriteCrawlerMotion(void)
 		m_FlipperPwm_OutWrap.InitData();
 	}
 
-	// ２次元の速度をポートに出力する
+	// タイムスタンプを設定する(トレースを記録する場合は起点の時刻とする)
 	setTimestamp(m_Velocity2D_Out);
+	m_FlipperPwm_OutWrap.SetTimestamp();
+	if(m_stConfig.bTrace && (m_iTraceOriginNs != 0))
+	{
+		LatencyTrace::FromNs(m_iTraceOriginNs, m_Velocity2D_Out.tm);
+		LatencyTrace::FromNs(m_iTraceOriginNs, m_FlipperPwm_Out.tm);
+
+		// 新しい起点を反映した最初の出力時刻を記録する
+		if(m_iTraceOutputNs != m_iTraceOriginNs)
+		{
+			m_iTraceOutputNs = m_iTraceOriginNs;
+			m_Trace.Record(TRACE_MOTION_OUTPUT, m_iTraceOriginNs);
+		}
+	}
+
+	// ２次元の速度をポートに出力する
 	m_Velocity2D_OutOut.write();
 
 	// フリッパーのPWM指令をポートに出力する
-	m_FlipperPwm_OutWrap.SetTimestamp();
 	m_FlipperPwm_OutOut.write();
 }
 
@@ -654,7 +808,7 @@ void RTC_Spider2020_Motion::WriteResetIMU(void)
 	if(m_Mode_OutWrap.GetControl() == ModeWrapper::CONTROL_DRIVE)
 	{
 		// SHAREボタン及びOPTIONSボタンを同時押しなら台車の位置姿勢のクリアを設定する
-		if(m_Button_InWrap.GetShare() && m_Button_InWrap.GetOptions())
+		if(m_Input.IsHeld(POSE_CLEAR_BUTTONS))
 		{
 			// IMUのフィルタをリセットをONする
 			m_ResetIMU_Out.data = 1;
@@ -693,29 +847,29 @@ void RTC_Spider2020_Motion::WriteArmMotion(void)
 		m_Arm1FingerDelta_OutWrap.SetMiddleFingerDelta(0);
 
 		// 十字ボタン(上)
-		if(m_Axis_InWrap.GetDirVertical() == -1.0)
+		if(m_Input.GetAxis(InputState::AXIS_DIR_VERTICAL) == -1.0)
 		{
 			// 手先をロール軸で回転する
-			m_Arm1PoseDelta_Out.data.orientation.r = m_Axis_InWrap.GetLStickVertical()*-1.0;
+			m_Arm1PoseDelta_Out.data.orientation.r = m_Input.GetAxis(InputState::AXIS_LSTICK_VERTICAL)*-1.0;
 		}
 		// 十字ボタン(下)
-		else if(m_Axis_InWrap.GetDirHorizontal() == 1.0)
+		else if(m_Input.GetAxis(InputState::AXIS_DIR_HORIZONTAL) == 1.0)
 		{
 			// 手先をピッチ軸で回転する
-			m_Arm1PoseDelta_Out.data.orientation.p = m_Axis_InWrap.GetLStickVertical();
+			m_Arm1PoseDelta_Out.data.orientation.p = m_Input.GetAxis(InputState::AXIS_LSTICK_VERTICAL);
 		}
 		// 十字ボタン(右)
-		else if(m_Axis_InWrap.GetDirVertical() == 1.0)
+		else if(m_Input.GetAxis(InputState::AXIS_DIR_VERTICAL) == 1.0)
 		{
 			// 手先をヨー軸で回転する
-			m_Arm1PoseDelta_Out.data.orientation.y = m_Axis_InWrap.GetLStickVertical();
+			m_Arm1PoseDelta_Out.data.orientation.y = m_Input.GetAxis(InputState::AXIS_LSTICK_VERTICAL);
 		}
 		// 十字ボタン(左)
-		else if(m_Axis_InWrap.GetDirHorizontal() == -1.0)
+		else if(m_Input.GetAxis(InputState::AXIS_DIR_HORIZONTAL) == -1.0)
 		{
-			if(0.2 < fabs(m_Axis_InWrap.GetLStickVertical()))
+			if(0.2 < fabs(m_Input.GetAxis(InputState::AXIS_LSTICK_VERTICAL)))
 			{
-				if(0.0 < m_Axis_InWrap.GetLStickVertical())
+				if(0.0 < m_Input.GetAxis(InputState::AXIS_LSTICK_VERTICAL))
 				{
 					// 指を閉じる
 					m_Arm1FingerDelta_OutWrap.SetThumbDelta(3000);
@@ -734,13 +888,13 @@ void RTC_Spider2020_Motion::WriteArmMotion(void)
 		else
 		{
 			// 手先をXYZ座標で動かす
-			m_Arm1PoseDelta_Out.data.position.x = (m_Axis_InWrap.GetLStickHorizontal()/10.0)*-1.0;
-			m_Arm1PoseDelta_Out.data.position.y = (m_Axis_InWrap.GetLStickVertical()/10.0);
-			m_Arm1PoseDelta_Out.data.position.z = (m_Button_InWrap.GetL1() - m_Button_InWrap.GetL2())/10.0;
+			m_Arm1PoseDelta_Out.data.position.x = (m_Input.GetAxis(InputState::AXIS_LSTICK_HORIZONTAL)/10.0)*-1.0;
+			m_Arm1PoseDelta_Out.data.position.y = (m_Input.GetAxis(InputState::AXIS_LSTICK_VERTICAL)/10.0);
+			m_Arm1PoseDelta_Out.data.position.z = ((int)m_Input.IsHeld(InputState::BUTTON_L1) - (int)m_Input.IsHeld(InputState::BUTTON_L2))/10.0;
 		}
 
 		// SHAREボタン
-		if(m_Button_InWrap.GetShare())
+		if(m_Input.IsHeld(InputState::BUTTON_SHARE))
 		{
 			// 初期姿勢遷移ON
 			m_Arm1Home_Out.data = 1;
@@ -0,0 +1,45 @@
+# Spider2020の各RTCで共有するソースの定義
+#
+# 利用するRTCのsrc/CMakeLists.txtで次のように読み込む。
+#   include(${PROJECT_SOURCE_DIR}/../Spider2020_Common/Spider2020_Common.cmake)
+#   set(comp_srcs ${comp_srcs} ${SPIDER2020_COMMON_SRCS})
+#   include_directories(${SPIDER2020_COMMON_INCLUDE_DIRS})
+#   target_link_libraries(... ${SPIDER2020_COMMON_LIBS})
+# 遅延計測のトレースのみを使用する場合は、SPIDER2020_COMMON_SRCSの代わりに
+# SPIDER2020_TRACE_SRCSを追加する(Eigenが不要になる)。
+# 性能指標(MetricsRegistry)のみを使用する場合は、SPIDER2020_METRICS_SRCSを
+# 追加する(SPIDER2020_COMMON_SRCSには含まれる)。
+# 実時間設定(RealtimeSetup)のみを使用する場合は、SPIDER2020_REALTIME_SRCSを
+# 追加する(OpenRTMのcoilが必要、SPIDER2020_COMMON_SRCSには含まれる)。
+# 入出力のラッパークラス(io_wrapper)はヘッダーのみで構成するため、
+# SPIDER2020_COMMON_INCLUDE_DIRSを追加するだけで使用できる。
+
+set(SPIDER2020_COMMON_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+set(SPIDER2020_COMMON_INCLUDE_DIRS
+    ${SPIDER2020_COMMON_DIR}/include/Spider2020_Common
+    ${SPIDER2020_COMMON_DIR}/include/Spider2020_Common/io_wrapper
+    )
+
+set(SPIDER2020_TRACE_SRCS
+    ${SPIDER2020_COMMON_DIR}/src/LatencyTrace.cpp
+    )
+
+set(SPIDER2020_METRICS_SRCS
+    ${SPIDER2020_COMMON_DIR}/src/MetricsRegistry.cpp
+    )
+
+set(SPIDER2020_REALTIME_SRCS
+    ${SPIDER2020_COMMON_DIR}/src/RealtimeSetup.cpp
+    )
+
+set(SPIDER2020_COMMON_SRCS
+    ${SPIDER2020_COMMON_DIR}/src/OrientationInterpolator.cpp
+    ${SPIDER2020_COMMON_DIR}/src/OrientationHistoryWrapper.cpp
+    ${SPIDER2020_TRACE_SRCS}
+    ${SPIDER2020_METRICS_SRCS}
+    ${SPIDER2020_REALTIME_SRCS}
+    )
+
+# 共有メモリ(shm_open)
+set(SPIDER2020_COMMON_LIBS rt)
@@ -0,0 +1,78 @@
+// -*- C++ -*-
+/*!
+ * @file InputEventListener.h
+ * @brief 入力ポートの受信を通知するリスナ
+ * @date 2026/10/19
+ */
+
+#ifndef INPUT_EVENT_LISTENER_H
+#define INPUT_EVENT_LISTENER_H
+
+#include <rtm/ConnectorListener.h>
+
+#include <functional>
+
+/*!
+ * 入力ポートの受信を通知するリスナ
+ * @details ON_RECEIVEDに登録し、受信したデータを通知先の関数に渡す。
+ *          ON_RECEIVEDはバッファへの書き込み前に呼び出されるため、
+ *          通知先ではポートを読み込まず、渡されたデータを使用すること。
+ *          通知はORBのスレッドから行われる。
+ */
+template <class DataType>
+class InputEventListener
+  : public RTC::ConnectorDataListenerT<DataType>
+{
+public:
+	typedef std::function<void(const DataType&)> Callback_t;	/*!< 通知先の関数	*/
+
+	/*!
+	 * コンストラクタ
+	 * @method InputEventListener
+	 * @param  fnCallback 通知先の関数
+	 */
+	InputEventListener(Callback_t fnCallback)
+		: m_fnCallback(fnCallback)
+	{
+	}
+
+	/*!
+	 * デストラクタ
+	 * @method ~InputEventListener
+	 */
+	virtual ~InputEventListener()
+	{
+	}
+
+#if OPENRTM_VERSION_MAJOR >= 2
+	/*!
+	 * 受信したデータを通知する
+	 * @method operator()
+	 * @param  info 接続情報
+	 * @param  data 受信したデータ
+	 * @return NO_CHANGE(データは変更しない)
+	 */
+	virtual RTC::ConnectorListenerStatus::Enum operator()(RTC::ConnectorInfo &info, DataType &data)
+	{
+		m_fnCallback(data);
+		return RTC::ConnectorListenerStatus::NO_CHANGE;
+	}
+#else
+	/*!
+	 * 受信したデータを通知する
+	 * @method operator()
+	 * @param  info 接続情報
+	 * @param  data 受信したデータ
+	 * @return なし
+	 */
+	virtual void operator()(const RTC::ConnectorInfo &info, const DataType &data)
+	{
+		m_fnCallback(data);
+	}
+#endif
+
+private:
+	Callback_t m_fnCallback;		/*!< 通知先の関数		*/
+};
+
+#endif//INPUT_EVENT_LISTENER_H
@@ -0,0 +1,188 @@
+// -*- C++ -*-
+/*!
+ * @file LatencyTrace.h
+ * @brief 共有メモリ上の遅延計測のトレースバッファ
+ * @date 2026/10/19
+ */
+
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+
+#define TRACE_SHM_NAME		"/spider2020_trace"	/*!< 共有メモリの名前			*/
+#define TRACE_CAPACITY		65536				/*!< 格納できる記録の数			*/
+
+/*!
+ * トレースの計測点
+ */
+enum TRACE_POINT_t
+{
+	TRACE_DS4_INPUT = 0,		/*!< DS4: キー入力の検出(起点)			*/
+	TRACE_DS4_OUTPUT,			/*!< DS4: 軸キー・ボタンの書き込み直前	*/
+	TRACE_MOTION_INPUT,			/*!< Motion: 軸キー・ボタンの入力		*/
+	TRACE_MOTION_OUTPUT,		/*!< Motion: 速度・PWM指令の書き込み直前	*/
+	TRACE_CRAWLER_INPUT,		/*!< Crawler: 速度・PWM指令の入力		*/
+	TRACE_CRAWLER_SEND,			/*!< Crawler: SHボードへの書き込み完了	*/
+	TRACE_ESTOP_INPUT,			/*!< DS4: 非常停止のボタンの検出(起点)	*/
+	TRACE_ESTOP_SEND,			/*!< Crawler: 全SHボードへの停止指令の書き込み完了	*/
+	TRACE_POINT_NUM
+};
+
+/*!
+ * トレースの記録
+ */
+struct TRACE_EVENT_t
+{
+	int64_t iOriginNs;		/*!< 起点の時刻 [ns]					*/
+	int64_t iTimeNs;		/*!< 計測点の時刻 [ns]					*/
+	uint32_t uPoint;		/*!< 計測点(TRACE_POINT_t)				*/
+	uint32_t uSeq;			/*!< 起点の通番(起点以外は0)			*/
+};
+
+/*!
+ * 共有メモリ上の遅延計測のトレースバッファ
+ * @details 起点(DS4のキー入力)の時刻をデータポートのタイムスタンプで
+ *          パイプラインの後段に伝搬し、各RTCは入出力の時刻を起点の時刻と
+ *          組にして共有メモリのリングバッファに記録する。
+ *          時刻はプロセス間で比較できるようCLOCK_REALTIMEを使用する。
+ *          書き込みはロックを取らず、複数のプロセス・スレッドから同時に
+ *          記録できる。読み出し側は書き込み中または上書き済みの記録を
+ *          検出して破棄する。
+ *          共有メモリを開けない場合、記録は何もしない。
+ */
+class LatencyTrace
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method LatencyTrace
+	 */
+	LatencyTrace();
+
+	/*!
+	 * デストラクタ
+	 * @method ~LatencyTrace
+	 */
+	virtual ~LatencyTrace();
+
+	/*!
+	 * 共有メモリを開く(存在しない場合は作成する)
+	 * @method Open
+	 * @retval true 成功
+	 * @retval false 失敗
+	 */
+	bool Open(void);
+
+	/*!
+	 * 共有メモリを閉じる
+	 * @method Close
+	 * @return なし
+	 */
+	void Close(void);
+
+	/*!
+	 * 共有メモリを開いているか判定する
+	 * @method IsOpen
+	 * @retval true 開いている
+	 * @retval false 開いていない
+	 */
+	bool IsOpen(void) const;
+
+	/*!
+	 * 現在時刻で計測点を記録する
+	 * @method Record
+	 * @param  ePoint    計測点
+	 * @param  iOriginNs 起点の時刻 [ns]
+	 * @param  uSeq      起点の通番
+	 * @return なし
+	 */
+	void Record(TRACE_POINT_t ePoint, int64_t iOriginNs, uint32_t uSeq = 0);
+
+	/*!
+	 * 指定した時刻で計測点を記録する
+	 * @method RecordAt
+	 * @param  ePoint    計測点
+	 * @param  iOriginNs 起点の時刻 [ns]
+	 * @param  iTimeNs   計測点の時刻 [ns]
+	 * @param  uSeq      起点の通番
+	 * @return なし
+	 */
+	void RecordAt(TRACE_POINT_t ePoint, int64_t iOriginNs, int64_t iTimeNs, uint32_t uSeq = 0);
+
+	/*!
+	 * 次に書き込まれる記録の通し番号を取得する
+	 * @method GetHead
+	 * @return 通し番号(これまでに記録された数)
+	 */
+	uint64_t GetHead(void) const;
+
+	/*!
+	 * 記録を読み出す
+	 * @method Read
+	 * @param  uIndex 記録の通し番号
+	 * @param  [out] stEvent 記録
+	 * @retval true 成功
+	 * @retval false 書き込み中または上書き済み
+	 */
+	bool Read(uint64_t uIndex, TRACE_EVENT_t &stEvent) const;
+
+	/*!
+	 * 現在時刻を取得する
+	 * @method GetTimeNs
+	 * @return 現在時刻 [ns] (CLOCK_REALTIME)
+	 */
+	static int64_t GetTimeNs(void);
+
+	/*!
+	 * データポートのタイムスタンプを時刻に変換する
+	 * @method ToNs
+	 * @param  tm タイムスタンプ(RTC::Time)
+	 * @return 時刻 [ns]
+	 */
+	template <class TimeType>
+	static int64_t ToNs(const TimeType &tm)
+	{
+		return (int64_t)tm.sec*1000000000LL + (int64_t)tm.nsec;
+	}
+
+	/*!
+	 * 時刻をデータポートのタイムスタンプに変換する
+	 * @method FromNs
+	 * @param  iTimeNs 時刻 [ns]
+	 * @param  [out] tm タイムスタンプ(RTC::Time)
+	 * @return なし
+	 */
+	template <class TimeType>
+	static void FromNs(int64_t iTimeNs, TimeType &tm)
+	{
+		tm.sec = (uint32_t)(iTimeNs/1000000000LL);
+		tm.nsec = (uint32_t)(iTimeNs%1000000000LL);
+	}
+
+private:
+	/*!
+	 * リングバッファの要素
+	 */
+	struct SLOT_t
+	{
+		std::atomic<uint64_t> uCommit;	/*!< 書き込み状態(通し番号*2+1: 書き込み中、通し番号*2+2: 確定)	*/
+		TRACE_EVENT_t stEvent;			/*!< 記録											*/
+	};
+
+	/*!
+	 * 共有メモリの配置
+	 */
+	struct BUFFER_t
+	{
+		std::atomic<uint32_t> uMagic;	/*!< 初期化済みの識別子					*/
+		uint32_t uCapacity;				/*!< 格納できる記録の数					*/
+		std::atomic<uint64_t> uHead;	/*!< 次に書き込む記録の通し番号			*/
+		SLOT_t stSlot[TRACE_CAPACITY];	/*!< 記録のリングバッファ				*/
+	};
+
+	BUFFER_t *m_pBuffer;				/*!< 共有メモリ							*/
+};
+
+#endif//LATENCY_TRACE_H
@@ -0,0 +1,162 @@
+// -*- C++ -*-
+/*!
+ * @file LatestReader.h
+ * @brief 入力ポートを最新のデータまで読み込むクラス
+ * @date 2026/10/19
+ */
+
+#ifndef LATEST_READER_H
+#define LATEST_READER_H
+
+#include <rtm/DataInPort.h>
+
+#include <sys/time.h>
+#include <cstdint>
+#include <cstdio>
+
+#define LATEST_READ_MAX	(1024)	/*!< １回の呼び出しで読み込むデータの最大数(送信側が読み込みより速い場合に抜けるため) */
+
+/*!
+ * 入力ポートを最新のデータまで読み込むクラス
+ * @details 呼び出し毎にバッファに溜まったデータを全て読み込み、最新のデータのみを残す。
+ *          送信側の周期が受信側より短い場合や、コネクタにFIFOのバッファを設定した場合でも、
+ *          古いデータを１周期に１つずつ消費して実時間から遅れ続けることがない。
+ *          読み捨てたデータの数と、最新のデータの経過時間(タイムスタンプから現在まで)を
+ *          記録する。全てのデータを順に処理する必要がある入力(履歴や状態の変化)には
+ *          使用しないこと。
+ * @tparam  DataType 入力ポートのデータ型(RTC::Timed～, Spider2020::Timed～)
+ */
+template <class DataType>
+class LatestReader
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method LatestReader
+	 * @param  InPort 読み込む入力ポート
+	 * @param  Data   入力ポートに割り当てた変数
+	 */
+	LatestReader(RTC::InPort<DataType> &InPort, DataType &Data)
+		: m_InPort(InPort)
+		, m_Data(Data)
+		, m_uSkipped(0)
+		, m_uSkippedTotal(0)
+		, m_dAge(0.0)
+		, m_dAgeMax(0.0)
+	{
+	}
+
+	/*!
+	 * 最新のデータまで読み込む
+	 * @method Read
+	 * @retval true 新しいデータを読み込んだ
+	 * @retval false 新しいデータがない(変数は前回のまま)
+	 */
+	bool Read(void)
+	{
+		uint32_t uRead = 0;
+
+		// バッファが空になるまで読み込む(変数には最後に読み込んだデータが残る)
+		// 読み込みに失敗した場合はデータが消費されずisNewが変化しないため、打ち切る
+		while((uRead < LATEST_READ_MAX) && m_InPort.isNew())
+		{
+			if(!m_InPort.read())
+			{
+				break;
+			}
+			uRead++;
+		}
+		if(uRead == 0)
+		{
+			return false;
+		}
+
+		// 読み捨てたデータの数を記録する
+		m_uSkipped = uRead - 1;
+		m_uSkippedTotal += m_uSkipped;
+
+		// 最新のデータの経過時間を記録する(タイムスタンプが未設定なら0とする)
+		m_dAge = 0.0;
+		if((m_Data.tm.sec != 0) || (m_Data.tm.nsec != 0))
+		{
+			struct timeval ti = {0};
+			gettimeofday(&ti, NULL);
+			m_dAge = ((double)ti.tv_sec - (double)m_Data.tm.sec) + ((double)ti.tv_usec/1000000.0 - (double)m_Data.tm.nsec/1000000000.0);
+		}
+		if(m_dAgeMax < m_dAge)
+		{
+			m_dAgeMax = m_dAge;
+		}
+
+		return true;
+	}
+
+	/*!
+	 * 前回の読み込みで読み捨てたデータの数を取得する
+	 * @method GetSkipped
+	 * @return 読み捨てたデータの数
+	 */
+	uint32_t GetSkipped(void) const
+	{
+		return m_uSkipped;
+	}
+
+	/*!
+	 * 読み捨てたデータの累計を取得する
+	 * @method GetSkippedTotal
+	 * @return 読み捨てたデータの累計
+	 */
+	uint64_t GetSkippedTotal(void) const
+	{
+		return m_uSkippedTotal;
+	}
+
+	/*!
+	 * 前回読み込んだ最新のデータの経過時間を取得する
+	 * @method GetAge
+	 * @return 経過時間 [s]
+	 */
+	double GetAge(void) const
+	{
+		return m_dAge;
+	}
+
+	/*!
+	 * 最新のデータの経過時間の最大値を取得する
+	 * @method GetAgeMax
+	 * @return 経過時間の最大値 [s]
+	 */
+	double GetAgeMax(void) const
+	{
+		return m_dAgeMax;
+	}
+
+	/*!
+	 * 統計を表示して初期化する
+	 * @method PrintStatistics
+	 * @param  pName 表示する入力ポートの名前
+	 * @return なし
+	 */
+	void PrintStatistics(const char *pName)
+	{
+		// 読み捨てたデータがある場合のみ表示する
+		if(0 < m_uSkippedTotal)
+		{
+			printf("%s: skipped %llu stale samples (max age %.3f ms)\n", pName, (unsigned long long)m_uSkippedTotal, m_dAgeMax*1000.0);
+		}
+		m_uSkipped = 0;
+		m_uSkippedTotal = 0;
+		m_dAge = 0.0;
+		m_dAgeMax = 0.0;
+	}
+
+private:
+	RTC::InPort<DataType> &m_InPort;	/*!< 読み込む入力ポート						*/
+	DataType &m_Data;					/*!< 入力ポートに割り当てた変数				*/
+	uint32_t m_uSkipped;				/*!< 前回の読み込みで読み捨てたデータの数	*/
+	uint64_t m_uSkippedTotal;			/*!< 読み捨てたデータの累計					*/
+	double m_dAge;						/*!< 最新のデータの経過時間 [s]				*/
+	double m_dAgeMax;					/*!< 最新のデータの経過時間の最大値 [s]		*/
+};
+
+#endif//LATEST_READER_H
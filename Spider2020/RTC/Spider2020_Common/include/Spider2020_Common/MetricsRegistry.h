@@ -0,0 +1,347 @@
+// -*- C++ -*-
+/*!
+ * @file MetricsRegistry.h
+ * @brief 共有メモリ上の性能指標(カウンタ、ゲージ、遅延のヒストグラム)
+ * @date 2026/10/19
+ */
+
+#ifndef METRICS_REGISTRY_H
+#define METRICS_REGISTRY_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+#define METRICS_SHM_PREFIX	"/spider2020_metrics."	/*!< 共有メモリの名前の接頭辞(末尾にPIDと識別子)	*/
+#define METRICS_CAPACITY	64						/*!< １プロセスで登録できる指標の数			*/
+#define METRICS_NAME_LEN	48						/*!< 指標の名前の最大長(終端を含む)			*/
+#define METRICS_SUB_BITS	3						/*!< ヒストグラムの２倍毎の区間の分割数(ビット)	*/
+#define METRICS_SUB_NUM		(1 << METRICS_SUB_BITS)	/*!< ヒストグラムの２倍毎の区間の分割数		*/
+#define METRICS_MAX_BITS	40						/*!< ヒストグラムで区別する最大値のビット数(約1100秒) */
+#define METRICS_BUCKET_NUM	((METRICS_MAX_BITS - METRICS_SUB_BITS + 2)*METRICS_SUB_NUM)	/*!< ヒストグラムの区間の数	*/
+
+/*!
+ * 指標の種類
+ */
+enum METRIC_TYPE_t
+{
+	METRIC_NONE = 0,			/*!< 未使用									*/
+	METRIC_COUNTER,				/*!< カウンタ(累計値)						*/
+	METRIC_GAUGE,				/*!< ゲージ(現在値)							*/
+	METRIC_HISTOGRAM,			/*!< 遅延のヒストグラム [ns]				*/
+};
+
+/*!
+ * 共有メモリ上の指標
+ */
+struct METRIC_SLOT_t
+{
+	std::atomic<uint32_t> uType;						/*!< 指標の種類(METRIC_TYPE_t)				*/
+	char szName[METRICS_NAME_LEN];						/*!< 指標の名前								*/
+	std::atomic<uint64_t> uValue;						/*!< カウンタの値、ゲージの値(doubleのビット列)	*/
+	std::atomic<uint64_t> uCount;						/*!< ヒストグラムの記録数					*/
+	std::atomic<uint64_t> uSum;							/*!< ヒストグラムの合計 [ns]				*/
+	std::atomic<uint64_t> uMax;							/*!< ヒストグラムの最大値 [ns]				*/
+	std::atomic<uint64_t> uBucket[METRICS_BUCKET_NUM];	/*!< ヒストグラムの区間毎の記録数			*/
+};
+
+/*!
+ * 共有メモリの配置
+ */
+struct METRICS_SEGMENT_t
+{
+	std::atomic<uint32_t> uMagic;						/*!< 初期化済みの識別子						*/
+	uint32_t uCapacity;									/*!< 登録できる指標の数						*/
+	uint32_t uBucketNum;								/*!< ヒストグラムの区間の数					*/
+	int32_t iPid;										/*!< プロセスID								*/
+	char szProcess[32];									/*!< プロセス名								*/
+	int64_t iStartNs;									/*!< 作成時刻 [ns] (CLOCK_REALTIME)			*/
+	std::atomic<uint32_t> uCount;						/*!< 登録済みの指標の数						*/
+	METRIC_SLOT_t stSlot[METRICS_CAPACITY];				/*!< 指標								*/
+};
+
+/*!
+ * 共有メモリ上の性能指標の登録先
+ * @details プロセス毎に１つの共有メモリ(METRICS_SHM_PREFIX + PID + 識別子)を作成し、
+ *          プロセス内の全てのRTCの指標を登録する。Spider2020_Compositeのように
+ *          RTCの共有ライブラリを個別に読み込んだ場合は、共有ライブラリ毎に
+ *          作成する(識別子で区別する)。指標の更新はロックを取らず
+ *          アトミック変数の加算・書き込みのみで行うため、実行周期やSHボードとの
+ *          通信の処理から呼び出しても待たされない。
+ *          登録(Register)は初期化時に呼び出すこと(ロックを取る)。
+ *          共有メモリを作成できない場合や登録数の上限を超えた場合、指標の
+ *          更新は何もしない。共有メモリはプロセスの終了時に削除する。
+ *          閲覧側はMapで読み込み専用に開き、RTCの動作に影響を与えない。
+ */
+class MetricsRegistry
+{
+public:
+	/*!
+	 * プロセスで共有する登録先を取得する
+	 * @method Instance
+	 * @return 登録先
+	 */
+	static MetricsRegistry& Instance(void);
+
+	/*!
+	 * 指標を登録する(同じ名前・種類の指標が登録済みならばそれを返す)
+	 * @method Register
+	 * @param  pName 指標の名前("RTC名.指標名"とする)
+	 * @param  eType 指標の種類
+	 * @return 共有メモリ上の指標(失敗した場合はNULL)
+	 */
+	METRIC_SLOT_t* Register(const char *pName, METRIC_TYPE_t eType);
+
+	/*!
+	 * 共有メモリを読み込み専用で開く
+	 * @method Map
+	 * @param  pShmName 共有メモリの名前
+	 * @return 共有メモリ(失敗した場合はNULL)
+	 */
+	static const METRICS_SEGMENT_t* Map(const char *pShmName);
+
+	/*!
+	 * Mapで開いた共有メモリを閉じる
+	 * @method Unmap
+	 * @param  pSegment 共有メモリ
+	 * @return なし
+	 */
+	static void Unmap(const METRICS_SEGMENT_t *pSegment);
+
+	/*!
+	 * 値を含むヒストグラムの区間を取得する
+	 * @method GetBucketIndex
+	 * @param  uValue 値 [ns]
+	 * @return 区間の位置
+	 */
+	static uint32_t GetBucketIndex(uint64_t uValue)
+	{
+		uint32_t uBits = 0;
+		uint32_t uShift = 0;
+
+		if(uValue < METRICS_SUB_NUM)
+		{
+			return (uint32_t)uValue;
+		}
+
+		// 最上位ビットの位置で２倍毎の区間を求め、その中を等分する
+		uBits = 63 - __builtin_clzll(uValue);
+		if(METRICS_MAX_BITS < uBits)
+		{
+			return METRICS_BUCKET_NUM - 1;
+		}
+		uShift = uBits - METRICS_SUB_BITS;
+		return (uShift + 1)*METRICS_SUB_NUM + (uint32_t)((uValue >> uShift) - METRICS_SUB_NUM);
+	}
+
+	/*!
+	 * ヒストグラムの区間の下限値を取得する
+	 * @method GetBucketValue
+	 * @param  uIndex 区間の位置
+	 * @return 下限値 [ns]
+	 */
+	static uint64_t GetBucketValue(uint32_t uIndex)
+	{
+		uint32_t uShift = 0;
+
+		if(uIndex < METRICS_SUB_NUM)
+		{
+			return uIndex;
+		}
+		uShift = uIndex/METRICS_SUB_NUM - 1;
+		return (uint64_t)(METRICS_SUB_NUM + uIndex%METRICS_SUB_NUM) << uShift;
+	}
+
+	/*!
+	 * 経過時間の計測に使用する現在時刻を取得する
+	 * @method GetTimeNs
+	 * @return 現在時刻 [ns] (CLOCK_MONOTONIC)
+	 */
+	static int64_t GetTimeNs(void);
+
+private:
+	/*!
+	 * コンストラクタ
+	 * @method MetricsRegistry
+	 */
+	MetricsRegistry();
+
+	/*!
+	 * デストラクタ(共有メモリを削除する)
+	 * @method ~MetricsRegistry
+	 */
+	~MetricsRegistry();
+
+	/*!
+	 * 共有メモリを作成する
+	 * @method Open
+	 * @retval true 成功
+	 * @retval false 失敗
+	 */
+	bool Open(void);
+
+	METRICS_SEGMENT_t *m_pSegment;	/*!< 共有メモリ						*/
+	char m_szShmName[64];			/*!< 共有メモリの名前				*/
+	bool m_bOpenFailed;				/*!< 共有メモリの作成に失敗したか	*/
+	std::mutex m_Mutex;				/*!< 登録の排他制御					*/
+};
+
+/*!
+ * カウンタ(累計値)
+ */
+class MetricCounter
+{
+public:
+	MetricCounter()
+		: m_pSlot(NULL)
+	{
+	}
+
+	/*!
+	 * 登録する
+	 * @method Register
+	 * @param  pName 指標の名前
+	 * @retval true 成功
+	 * @retval false 失敗(更新は何もしない)
+	 */
+	bool Register(const char *pName)
+	{
+		m_pSlot = MetricsRegistry::Instance().Register(pName, METRIC_COUNTER);
+		return (m_pSlot != NULL);
+	}
+
+	/*!
+	 * 加算する
+	 * @method Add
+	 * @param  uValue 加算する値
+	 * @return なし
+	 */
+	void Add(uint64_t uValue = 1)
+	{
+		if(m_pSlot != NULL)
+		{
+			m_pSlot->uValue.fetch_add(uValue, std::memory_order_relaxed);
+		}
+	}
+
+private:
+	METRIC_SLOT_t *m_pSlot;			/*!< 共有メモリ上の指標				*/
+};
+
+/*!
+ * ゲージ(現在値)
+ */
+class MetricGauge
+{
+public:
+	MetricGauge()
+		: m_pSlot(NULL)
+	{
+	}
+
+	/*!
+	 * 登録する
+	 * @method Register
+	 * @param  pName 指標の名前
+	 * @retval true 成功
+	 * @retval false 失敗(更新は何もしない)
+	 */
+	bool Register(const char *pName)
+	{
+		m_pSlot = MetricsRegistry::Instance().Register(pName, METRIC_GAUGE);
+		return (m_pSlot != NULL);
+	}
+
+	/*!
+	 * 値を設定する
+	 * @method Set
+	 * @param  dValue 値
+	 * @return なし
+	 */
+	void Set(double dValue)
+	{
+		uint64_t uBits = 0;
+
+		if(m_pSlot != NULL)
+		{
+			memcpy(&uBits, &dValue, sizeof(uBits));
+			m_pSlot->uValue.store(uBits, std::memory_order_relaxed);
+		}
+	}
+
+private:
+	METRIC_SLOT_t *m_pSlot;			/*!< 共有メモリ上の指標				*/
+};
+
+/*!
+ * 遅延のヒストグラム
+ * @details 値の大きさに応じて２倍毎の区間をMETRICS_SUB_NUMに等分した区間で
+ *          記録数を数える(相対誤差は1/METRICS_SUB_NUM以下)。
+ */
+class MetricHistogram
+{
+public:
+	MetricHistogram()
+		: m_pSlot(NULL)
+	{
+	}
+
+	/*!
+	 * 登録する
+	 * @method Register
+	 * @param  pName 指標の名前
+	 * @retval true 成功
+	 * @retval false 失敗(記録は何もしない)
+	 */
+	bool Register(const char *pName)
+	{
+		m_pSlot = MetricsRegistry::Instance().Register(pName, METRIC_HISTOGRAM);
+		return (m_pSlot != NULL);
+	}
+
+	/*!
+	 * 値を記録する
+	 * @method Record
+	 * @param  iValueNs 値 [ns] (負の値は0とする)
+	 * @return なし
+	 */
+	void Record(int64_t iValueNs)
+	{
+		uint64_t uValue = (0 < iValueNs) ? (uint64_t)iValueNs : 0;
+		uint64_t uMax = 0;
+
+		if(m_pSlot == NULL)
+		{
+			return;
+		}
+		m_pSlot->uBucket[MetricsRegistry::GetBucketIndex(uValue)].fetch_add(1, std::memory_order_relaxed);
+		m_pSlot->uSum.fetch_add(uValue, std::memory_order_relaxed);
+		m_pSlot->uCount.fetch_add(1, std::memory_order_relaxed);
+
+		// 最大値を更新する(他のスレッドが大きい値を書き込んだら止める)
+		uMax = m_pSlot->uMax.load(std::memory_order_relaxed);
+		while((uMax < uValue) && !m_pSlot->uMax.compare_exchange_weak(uMax, uValue, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	/*!
+	 * 開始時刻から現在までの経過時間を記録する
+	 * @method RecordSince
+	 * @param  iStartNs 開始時刻 [ns] (MetricsRegistry::GetTimeNs)
+	 * @return なし
+	 */
+	void RecordSince(int64_t iStartNs)
+	{
+		if(m_pSlot != NULL)
+		{
+			Record(MetricsRegistry::GetTimeNs() - iStartNs);
+		}
+	}
+
+private:
+	METRIC_SLOT_t *m_pSlot;			/*!< 共有メモリ上の指標				*/
+};
+
+#endif//METRICS_REGISTRY_H
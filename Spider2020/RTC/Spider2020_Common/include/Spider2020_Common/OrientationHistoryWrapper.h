@@ -0,0 +1,136 @@
+/*!
+ * @file OrientationHistoryWrapper.h
+ * @brief 時刻付き姿勢の履歴入出力のラッパークラス
+ * @date 2026/10/19
+ */
+
+#ifndef ORIENTATION_HISTORY_WRAPPER_H
+#define ORIENTATION_HISTORY_WRAPPER_H
+
+#include <rtm/idl/BasicDataTypeSkel.h>
+#include <rtm/idl/ExtendedDataTypesSkel.h>
+#include <rtm/idl/InterfaceDataTypesSkel.h>
+
+#include <rtm/DataInPort.h>
+#include <rtm/DataOutPort.h>
+
+#include <cstdint>
+
+/*!
+ * @brief 時刻付き姿勢の履歴入出力のラッパークラス
+ * @details 次のdouble型配列で提供するデータの操作APIを提供する
+ *          [4n+0]: n番目のサンプルの時刻 [s] (UNIX時刻)
+ *          [4n+1]: n番目のサンプルのロール角 [rad]
+ *          [4n+2]: n番目のサンプルのピッチ角 [rad]
+ *          [4n+3]: n番目のサンプルのヨー角 [rad]
+ *          サンプルは古い順に格納する
+ */
+class OrientationHistoryWrapper
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method OrientationHistoryWrapper
+	 * @param  Port   ラッピングする変数
+	 */
+	OrientationHistoryWrapper(RTC::TimedDoubleSeq& Port);
+
+	/*!
+	 * デストラクタ
+	 * @method OrientationHistoryWrapper
+	 */
+	virtual ~OrientationHistoryWrapper();
+
+	/*!
+	 * 代入演算子のオーバーロード
+	 * @method operator=
+	 */
+	OrientationHistoryWrapper& operator=(const OrientationHistoryWrapper& rhs);
+
+	/*!
+	 * タイムスタンプを設定する
+	 * @method SetTimestamp
+	 * @return なし
+	 */
+	void SetTimestamp(void);
+
+	/*!
+	 * 姿勢の履歴の入出力を初期化する(サンプル数0)
+	 * @method InitData
+	 * @return なし
+	 */
+	void InitData(void);
+
+	/*!
+	 * サンプル数を取得する
+	 * @method GetNumber
+	 * @return サンプル数
+	 */
+	uint32_t GetNumber(void);
+
+	/*!
+	 * サンプル数を設定する
+	 * @method SetNumber
+	 * @param  uNumber  サンプル数
+	 * @return なし
+	 */
+	void SetNumber(const uint32_t uNumber);
+
+	/*!
+	 * サンプルの時刻を取得する
+	 * @method GetTime
+	 * @param  uIndex   サンプルの番号
+	 * @return 時刻
+	 */
+	double GetTime(const uint32_t uIndex);
+
+	/*!
+	 * サンプルのロール角を取得する
+	 * @method GetRoll
+	 * @param  uIndex   サンプルの番号
+	 * @return ロール角
+	 */
+	double GetRoll(const uint32_t uIndex);
+
+	/*!
+	 * サンプルのピッチ角を取得する
+	 * @method GetPitch
+	 * @param  uIndex   サンプルの番号
+	 * @return ピッチ角
+	 */
+	double GetPitch(const uint32_t uIndex);
+
+	/*!
+	 * サンプルのヨー角を取得する
+	 * @method GetYaw
+	 * @param  uIndex   サンプルの番号
+	 * @return ヨー角
+	 */
+	double GetYaw(const uint32_t uIndex);
+
+	/*!
+	 * サンプルを設定する
+	 * @method SetSample
+	 * @param  uIndex   サンプルの番号
+	 * @param  dTime    時刻
+	 * @param  dRoll    ロール角
+	 * @param  dPitch   ピッチ角
+	 * @param  dYaw     ヨー角
+	 * @return なし
+	 */
+	void SetSample(const uint32_t uIndex, const double dTime, const double dRoll, const double dPitch, const double dYaw);
+
+private:
+	/*!
+	 * 指定番号のサンプルの要素を取得する
+	 * @method GetValue
+	 * @param  uIndex   サンプルの番号
+	 * @param  uOffset  要素の位置
+	 * @return 値
+	 */
+	double GetValue(const uint32_t uIndex, const uint32_t uOffset);
+
+	RTC::TimedDoubleSeq& m_Port;	/*!< ラッピングする変数の参照変数	*/
+};
+
+#endif//ORIENTATION_HISTORY_WRAPPER_H
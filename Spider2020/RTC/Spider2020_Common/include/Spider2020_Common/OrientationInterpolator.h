@@ -0,0 +1,114 @@
+// -*- C++ -*-
+/*!
+ * @file OrientationInterpolator.h
+ * @brief 時刻付き姿勢の履歴から任意時刻の姿勢を補間するクラス
+ * @date 2026/10/19
+ */
+
+#ifndef ORIENTATION_INTERPOLATOR_H
+#define ORIENTATION_INTERPOLATOR_H
+
+#include <cstddef>
+#include <vector>
+
+/*!
+ * 時刻付き姿勢の履歴から任意時刻の姿勢を補間するクラス
+ * @details 姿勢はロール・ピッチ・ヨー(Z-Y-X順の回転)で扱い、
+ *          前後のサンプルを四元数の球面線形補間(slerp)で補間する。
+ */
+class OrientationInterpolator
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method OrientationInterpolator
+	 * @param  sizeCapacity 保持するサンプル数
+	 */
+	explicit OrientationInterpolator(size_t sizeCapacity = 256);
+
+	/*!
+	 * デストラクタ
+	 * @method ~OrientationInterpolator
+	 */
+	virtual ~OrientationInterpolator();
+
+	/*!
+	 * 履歴を破棄する
+	 * @method Clear
+	 * @return なし
+	 */
+	void Clear(void);
+
+	/*!
+	 * 履歴にサンプルを追加する
+	 * @method Push
+	 * @param  [in] dTime  サンプルの時刻 [s]
+	 * @param  [in] dRoll  ロール角 [rad]
+	 * @param  [in] dPitch ピッチ角 [rad]
+	 * @param  [in] dYaw   ヨー角 [rad]
+	 * @retval true 成功
+	 * @retval false 最新のサンプルより古い時刻のため破棄
+	 */
+	bool Push(double dTime, double dRoll, double dPitch, double dYaw);
+
+	/*!
+	 * 指定時刻の姿勢を補間して取得する
+	 * @method Interpolate
+	 * @param  [in]  dTime  取得する時刻 [s]
+	 * @param  [out] dRoll  ロール角 [rad]
+	 * @param  [out] dPitch ピッチ角 [rad]
+	 * @param  [out] dYaw   ヨー角 [rad]
+	 * @retval true 成功
+	 * @retval false 履歴なし
+	 * @remark 履歴の範囲外の時刻は、最も近い端のサンプルを返す(外挿しない)
+	 */
+	bool Interpolate(double dTime, double &dRoll, double &dPitch, double &dYaw) const;
+
+	/*!
+	 * 保持しているサンプル数を取得する
+	 * @method GetNumber
+	 * @return サンプル数
+	 */
+	size_t GetNumber(void) const;
+
+	/*!
+	 * 最も古いサンプルの時刻を取得する
+	 * @method GetOldestTime
+	 * @return 時刻 [s] (履歴なしの場合は0)
+	 */
+	double GetOldestTime(void) const;
+
+	/*!
+	 * 最も新しいサンプルの時刻を取得する
+	 * @method GetLatestTime
+	 * @return 時刻 [s] (履歴なしの場合は0)
+	 */
+	double GetLatestTime(void) const;
+
+private:
+	/*!
+	 * 姿勢のサンプル
+	 */
+	struct SAMPLE_t
+	{
+		double dTime;	/*!< 時刻 [s]		*/
+		double dQw;		/*!< 四元数(w)		*/
+		double dQx;		/*!< 四元数(x)		*/
+		double dQy;		/*!< 四元数(y)		*/
+		double dQz;		/*!< 四元数(z)		*/
+	};
+
+	/*!
+	 * 古い順のインデックスからサンプルを取得する
+	 * @method At
+	 * @param  [in] sizeIndex 古い順のインデックス
+	 * @return サンプル
+	 */
+	const SAMPLE_t& At(size_t sizeIndex) const;
+
+	std::vector<SAMPLE_t> m_vecSample;	/*!< サンプルのリングバッファ		*/
+	size_t m_sizeHead;					/*!< 次に書き込む位置				*/
+	size_t m_sizeCount;					/*!< 格納済みのサンプル数			*/
+};
+
+#endif//ORIENTATION_INTERPOLATOR_H
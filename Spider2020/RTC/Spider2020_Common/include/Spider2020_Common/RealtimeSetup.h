@@ -0,0 +1,94 @@
+// -*- C++ -*-
+/*!
+ * @file RealtimeSetup.h
+ * @brief プロセス及びスレッドの実時間設定(メモリのロック、スケジューリング、CPUアフィニティ)
+ * @date 2026/10/19
+ */
+
+#ifndef REALTIME_SETUP_H
+#define REALTIME_SETUP_H
+
+#include <coil/Properties.h>
+#include <sched.h>
+#include <stddef.h>
+#include <string>
+
+/*! @name rtc.confの設定キー
+ *	プロセス全体の実時間設定(各RTCの実行ファイル及びSpider2020_Compositeで読み込む)
+ */
+/*  @{ */
+#define REALTIME_KEY_MLOCKALL		"spider2020.realtime.mlockall"		/*!< 全メモリをロックするか(YES/NO)			*/
+#define REALTIME_KEY_PREFAULT_STACK	"spider2020.realtime.prefault_stack"	/*!< 事前に確保するスタック [KB]			*/
+#define REALTIME_KEY_HEAP_RESERVE	"spider2020.realtime.heap_reserve"	/*!< 事前に確保するヒープ [KB]				*/
+/* @} */
+
+#define REALTIME_CPU_ALL			"ALL"		/*!< CPUアフィニティを変更しない指定	*/
+
+/*!
+ * プロセス及びスレッドの実時間設定
+ * @details ページフォールトとCFSスケジューラによる実行周期の揺らぎを抑えるため、
+ *          プロセスの起動時にSetupProcessでメモリをロックし(mlockall)、
+ *          実行コンテキストやキャプチャのスレッドの開始時にSetupThreadで
+ *          SCHED_FIFOの優先度とCPUアフィニティを設定する。
+ *          mlockall(MCL_FUTURE)の後に生成したスレッドのスタックは生成時に
+ *          確保・ロックされるため、スタックの事前確保はメインスレッドのみ行う。
+ *          権限(CAP_IPC_LOCK、CAP_SYS_NICE、ulimit -l/-r)が不足する場合は
+ *          理由を表示して失敗を返す(設定できなくても動作は継続できる)。
+ */
+class RealtimeSetup
+{
+public:
+	/*!
+	 * rtc.confの設定に従ってプロセス全体の実時間設定を行う
+	 * @method SetupProcess
+	 * @param  prop マネージャの設定(RTC::Manager::getConfig)
+	 * @retval true 成功(設定なしを含む)
+	 * @retval false 失敗
+	 */
+	static bool SetupProcess(const coil::Properties &prop);
+
+	/*!
+	 * プロセス全体の実時間設定を行う
+	 * @method SetupProcess
+	 * @param  bLockMemory       全メモリをロックするか
+	 * @param  sizePrefaultStack 呼び出し元のスレッドで事前に確保するスタック [byte]
+	 * @param  sizeHeapReserve   事前に確保してロックするヒープ [byte] (0は確保しない)
+	 * @retval true 成功
+	 * @retval false 失敗
+	 * @remark ヒープを事前に確保する場合は、解放したメモリをOSに返さないよう
+	 *         mallocの設定を変更し、全スレッドで同じアリーナを使用する。
+	 */
+	static bool SetupProcess(bool bLockMemory, size_t sizePrefaultStack, size_t sizeHeapReserve);
+
+	/*!
+	 * 呼び出し元のスレッドの実時間設定を行う
+	 * @method SetupThread
+	 * @param  iPriority 優先度(1-99はSCHED_FIFO、0は通常のスケジューリング)
+	 * @param  sCpuList  CPUアフィニティ("0"、"2-3"、"0,2"の形式、REALTIME_CPU_ALLは変更しない)
+	 * @param  pRole     スレッドの役割(表示用)
+	 * @retval true 成功
+	 * @retval false 失敗
+	 */
+	static bool SetupThread(int iPriority, const std::string &sCpuList, const char *pRole);
+
+	/*!
+	 * CPUアフィニティの文字列を解析する
+	 * @method ParseCpuList
+	 * @param  [in] sCpuList   CPUアフィニティ("0"、"2-3"、"0,2"の形式)
+	 * @param  [out] stCpuSet  CPUの集合
+	 * @retval true 成功
+	 * @retval false 失敗(書式不正、CPUなし)
+	 */
+	static bool ParseCpuList(const std::string &sCpuList, cpu_set_t &stCpuSet);
+
+private:
+	/*!
+	 * 呼び出し元のスレッドのスタックを事前に確保する
+	 * @method PrefaultStack
+	 * @param  sizeStack 確保する大きさ [byte]
+	 * @return なし
+	 */
+	static void PrefaultStack(size_t sizeStack);
+};
+
+#endif//REALTIME_SETUP_H
@@ -0,0 +1,211 @@
+/*!
+ * @file ArmAngularWrapper.h
+ * @brief Jaco2アームの腕の角度入出力のラッパークラス
+ * @author C.Saito
+ * @date 2019/12/27
+ */
+
+#ifndef ARM_ANGULAR_WRAPPER_H
+#define ARM_ANGULAR_WRAPPER_H
+
+#include <rtm/idl/BasicDataTypeSkel.h>
+#include <rtm/idl/ExtendedDataTypesSkel.h>
+#include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
+
+#include <rtm/DataInPort.h>
+#include <rtm/DataOutPort.h>
+
+#include "PortView.h"
+
+#include <cstdint>
+
+/*!
+ * @brief Jaco2アームの腕の角度入出力のラッパークラス
+ * @details 次のSpider2020::TimedArmAngularで提供するデータの操作APIを提供する
+ *          shoulder: Shoulderの角度
+ *          arm:      Armの角度
+ *          forearm:  Forearmの角度
+ *          wrist1:   Wrist1の角度
+ *          wrist2:   Wrist2の角度
+ *          hand:     Handの角度
+ */
+class ArmAngularWrapper : public PortView<ArmAngularWrapper, Spider2020::TimedArmAngular, CORBA::Double, 6>
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method ArmAngularWrapper
+	 * @param  Port   ラッピングする変数
+	 */
+	ArmAngularWrapper(Spider2020::TimedArmAngular& Port)
+		: PortView(Port)
+	{
+	}
+
+	/*!
+	 * 従来の配列の位置のメンバを取得する
+	 * @method Field
+	 * @param  uIndex 従来の配列の位置
+	 * @return メンバへのポインタ
+	 */
+	static Field_t Field(const uint8_t uIndex)
+	{
+		static constexpr Field_t s_Field[] =
+		{
+			&Data_t::shoulder,	/*!< Shoulder	*/
+			&Data_t::arm,		/*!< Arm		*/
+			&Data_t::forearm,	/*!< Forearm	*/
+			&Data_t::wrist1,	/*!< Wrist1		*/
+			&Data_t::wrist2,	/*!< Wrist2		*/
+			&Data_t::hand,		/*!< Hand		*/
+		};
+		static_assert(sizeof(s_Field) / sizeof(s_Field[0]) == GetNumber(), "field table does not match the data type");
+
+		return s_Field[uIndex];
+	}
+
+	/*!
+	 * Jaco2アームの腕の角度の入出力の配列数と値を初期化する
+	 * @method InitData
+	 * @return なし
+	 */
+	void InitData(void)
+	{
+		// Jaco2アームの腕の入出力の値を初期化する
+		SetShoulderAngular(0.0);
+		SetArmAngular(0.0);
+		SetForearmAngular(0.0);
+		SetWrist1Angular(0.0);
+		SetWrist2Angular(0.0);
+		SetHandAngular(0.0);
+	}
+
+	/*!
+	 * Shoulderの角度を取得する
+	 * @method GetShoulderAngular
+	 * @return Shoulderの角度
+	 */
+	double GetShoulderAngular(void) const
+	{
+		return m_Port.data.shoulder;
+	}
+
+	/*!
+	 * Shoulderの角度を設定する
+	 * @method SetShoulder
+	 * @param  dValue   Shoulderの角度
+	 * @return なし
+	 */
+	void SetShoulderAngular(const double dValue)
+	{
+		m_Port.data.shoulder = dValue;
+	}
+
+	/*!
+	 * Armの角度を取得する
+	 * @method GetArmAngular
+	 * @return Armの角度
+	 */
+	double GetArmAngular(void) const
+	{
+		return m_Port.data.arm;
+	}
+
+	/*!
+	 * Armの角度を設定する
+	 * @method SetArmAngular
+	 * @param  dValue   Armの角度
+	 * @return なし
+	 */
+	void SetArmAngular(const double dValue)
+	{
+		m_Port.data.arm = dValue;
+	}
+
+	/*!
+	 * Forearmの角度を取得する
+	 * @method GetForearm
+	 * @return Forearmの角度
+	 */
+	double GetForearmAngular(void) const
+	{
+		return m_Port.data.forearm;
+	}
+
+	/*!
+	 * Forearmの角度を設定する
+	 * @method SetForearmAngular
+	 * @param  dValue   ForearmAngularの角度
+	 * @return なし
+	 */
+	void SetForearmAngular(const double dValue)
+	{
+		m_Port.data.forearm = dValue;
+	}
+
+	/*!
+	 * Wrist1の角度を取得する
+	 * @method GetWrist1
+	 * @return Wrist1の角度
+	 */
+	double GetWrist1Angular(void) const
+	{
+		return m_Port.data.wrist1;
+	}
+
+	/*!
+	 * Wrist1の角度を設定する
+	 * @method SetWrist1Angular
+	 * @param  dValue   Wrist1の角度
+	 * @return なし
+	 */
+	void SetWrist1Angular(const double dValue)
+	{
+		m_Port.data.wrist1 = dValue;
+	}
+
+	/*!
+	 * Wrist2の角度を取得する
+	 * @method GetWrist2
+	 * @return Wrist2の角度
+	 */
+	double GetWrist2Angular(void) const
+	{
+		return m_Port.data.wrist2;
+	}
+
+	/*!
+	 * Wrist2の角度を設定する
+	 * @method SetWrist2Angular
+	 * @param  dValue   Wrist2の角度
+	 * @return なし
+	 */
+	void SetWrist2Angular(const double dValue)
+	{
+		m_Port.data.wrist2 = dValue;
+	}
+
+	/*!
+	 * Handの角度を取得する
+	 * @method GetHand
+	 * @return Handの角度
+	 */
+	double GetHandAngular(void) const
+	{
+		return m_Port.data.hand;
+	}
+
+	/*!
+	 * Handの角度を設定する
+	 * @method SetHandAngular
+	 * @param  dValue   Handの角度
+	 * @return なし
+	 */
+	void SetHandAngular(const double dValue)
+	{
+		m_Port.data.hand = dValue;
+	}
+};
+
+#endif//ARM_ANGULAR_WRAPPER_H
@@ -0,0 +1,283 @@
+/*!
+ * @file ArmCurrentWrapper.h
+ * @brief Jaco2アームのモータ負荷の入出力のラッパークラス
+ * @author C.Saito
+ * @date 2019/12/27
+ */
+
+#ifndef ARM_CURRENT_WRAPPER_H
+#define ARM_CURRENT_WRAPPER_H
+
+#include <rtm/idl/BasicDataTypeSkel.h>
+#include <rtm/idl/ExtendedDataTypesSkel.h>
+#include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
+
+#include <rtm/DataInPort.h>
+#include <rtm/DataOutPort.h>
+
+#include "PortView.h"
+
+#include <cstdint>
+
+/*!
+ * @brief モータの負荷入出力のラッパークラス
+ * @details 次のSpider2020::TimedArmCurrentで提供するデータの操作APIを提供する
+ *          shoulder:      Shoulderのモータ負荷
+ *          arm:           Armのモータ負荷
+ *          forearm:       Forearmのモータ負荷
+ *          wrist1:        Wrist1のモータ負荷
+ *          wrist2:        Wrist2のモータ負荷
+ *          hand:          Handのモータ負荷
+ *          thumb:         Thumbのモータ負荷
+ *          index_finger:  Index Fingerのモータ負荷
+ *          middle_finger: Middle Fingerのモータ負荷
+ */
+class ArmCurrentWrapper : public PortView<ArmCurrentWrapper, Spider2020::TimedArmCurrent, CORBA::Double, 9>
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method ArmCurrentWrapper
+	 * @param  Port   ラッピングする変数
+	 */
+	ArmCurrentWrapper(Spider2020::TimedArmCurrent& Port)
+		: PortView(Port)
+	{
+	}
+
+	/*!
+	 * 従来の配列の位置のメンバを取得する
+	 * @method Field
+	 * @param  uIndex 従来の配列の位置
+	 * @return メンバへのポインタ
+	 */
+	static Field_t Field(const uint8_t uIndex)
+	{
+		static constexpr Field_t s_Field[] =
+		{
+			&Data_t::shoulder,		/*!< Shoulder		*/
+			&Data_t::arm,			/*!< Arm			*/
+			&Data_t::forearm,		/*!< Forearm		*/
+			&Data_t::wrist1,		/*!< Wrist1			*/
+			&Data_t::wrist2,		/*!< Wrist2			*/
+			&Data_t::hand,			/*!< Hand			*/
+			&Data_t::thumb,			/*!< Thumb			*/
+			&Data_t::index_finger,	/*!< Index Finger	*/
+			&Data_t::middle_finger,	/*!< Middle Finger	*/
+		};
+		static_assert(sizeof(s_Field) / sizeof(s_Field[0]) == GetNumber(), "field table does not match the data type");
+
+		return s_Field[uIndex];
+	}
+
+	/*!
+	 * モータの負荷の入出力の配列数と値を初期化する
+	 * @method InitData
+	 * @return なし
+	 */
+	void InitData(void)
+	{
+		// モータ負荷の入出力の値を初期化する
+		SetShoulderCurrent(0.0);
+		SetArmCurrent(0.0);
+		SetForearmCurrent(0.0);
+		SetWrist1Current(0.0);
+		SetWrist2Current(0.0);
+		SetHandCurrent(0.0);
+		SetThumbCurrent(0.0);
+		SetIndexFingerCurrent(0.0);
+		SetMiddleFingerCurrent(0.0);
+	}
+
+	/*!
+	 * Shoulderのモータ負荷を取得する
+	 * @method GetShoulderCurrent
+	 * @return モータ負荷
+	 */
+	double GetShoulderCurrent(void) const
+	{
+		return m_Port.data.shoulder;
+	}
+
+	/*!
+	 * Shoulderのモータ負荷を設定する
+	 * @method SetShoulderCurrent
+	 * @param  dValue   モータ負荷
+	 * @return なし
+	 */
+	void SetShoulderCurrent(const double dValue)
+	{
+		m_Port.data.shoulder = dValue;
+	}
+
+	/*!
+	 * Armのモータ負荷を取得する
+	 * @method GetArmCurrent
+	 * @return モータ負荷
+	 */
+	double GetArmCurrent(void) const
+	{
+		return m_Port.data.arm;
+	}
+
+	/*!
+	 * Armのモータ負荷を設定する
+	 * @method SetArmCurrent
+	 * @param  dValue   モータ負荷
+	 * @return なし
+	 */
+	void SetArmCurrent(const double dValue)
+	{
+		m_Port.data.arm = dValue;
+	}
+
+	/*!
+	 * Forearmのモータ負荷を取得する
+	 * @method GetForearmCurrent
+	 * @return モータ負荷
+	 */
+	double GetForearmCurrent(void) const
+	{
+		return m_Port.data.forearm;
+	}
+
+	/*!
+	 * Forearmのモータ負荷を設定する
+	 * @method SetForearmCurrent
+	 * @param  dValue   モータ負荷
+	 * @return なし
+	 */
+	void SetForearmCurrent(const double dValue)
+	{
+		m_Port.data.forearm = dValue;
+	}
+
+	/*!
+	 * Wrist1のモータ負荷を取得する
+	 * @method GetWrist1Current
+	 * @return モータ負荷
+	 */
+	double GetWrist1Current(void) const
+	{
+		return m_Port.data.wrist1;
+	}
+
+	/*!
+	 * Wrist1のモータ負荷を設定する
+	 * @method SetWrist1Current
+	 * @param  dValue   モータ負荷
+	 * @return なし
+	 */
+	void SetWrist1Current(const double dValue)
+	{
+		m_Port.data.wrist1 = dValue;
+	}
+
+	/*!
+	 * Wrist2のモータ負荷を取得する
+	 * @method GetWrist2Current
+	 * @return モータ負荷
+	 */
+	double GetWrist2Current(void) const
+	{
+		return m_Port.data.wrist2;
+	}
+
+	/*!
+	 * Wrist2のモータ負荷を設定する
+	 * @method SetWrist2Current
+	 * @param  dValue   モータ負荷
+	 * @return なし
+	 */
+	void SetWrist2Current(const double dValue)
+	{
+		m_Port.data.wrist2 = dValue;
+	}
+
+	/*!
+	 * Handのモータ負荷を取得する
+	 * @method GetHandCurrent
+	 * @return モータ負荷
+	 */
+	double GetHandCurrent(void) const
+	{
+		return m_Port.data.hand;
+	}
+
+	/*!
+	 * Handのモータ負荷を設定する
+	 * @method SetHandCurrent
+	 * @param  dValue   モータ負荷
+	 * @return なし
+	 */
+	void SetHandCurrent(const double dValue)
+	{
+		m_Port.data.hand = dValue;
+	}
+
+	/*!
+	 * Thumbのモータ負荷を取得する
+	 * @method GetThumbCurrent
+	 * @return モータ負荷
+	 */
+	double GetThumbCurrent(void) const
+	{
+		return m_Port.data.thumb;
+	}
+
+	/*!
+	 * Thumbのモータ負荷を設定する
+	 * @method SetThumbCurrent
+	 * @param  dValue   モータ負荷
+	 * @return なし
+	 */
+	void SetThumbCurrent(const double dValue)
+	{
+		m_Port.data.thumb = dValue;
+	}
+
+	/*!
+	 * IndexFingerのモータ負荷を取得する
+	 * @method GetIndexFingerCurrent
+	 * @return モータ負荷
+	 */
+	double GetIndexFingerCurrent(void) const
+	{
+		return m_Port.data.index_finger;
+	}
+
+	/*!
+	 * IndexFingerのモータ負荷を設定する
+	 * @method SetIndexFingerCurrent
+	 * @param  dValue   モータ負荷
+	 * @return なし
+	 */
+	void SetIndexFingerCurrent(const double dValue)
+	{
+		m_Port.data.index_finger = dValue;
+	}
+
+	/*!
+	 * MiddleFingerのモータ負荷を取得する
+	 * @method GetMiddleFingerCurrent
+	 * @return モータ負荷
+	 */
+	double GetMiddleFingerCurrent(void) const
+	{
+		return m_Port.data.middle_finger;
+	}
+
+	/*!
+	 * MiddleFingerのモータ負荷を設定する
+	 * @method SetMiddleFingerCurrent
+	 * @param  dValue   モータ負荷
+	 * @return なし
+	 */
+	void SetMiddleFingerCurrent(const double dValue)
+	{
+		m_Port.data.middle_finger = dValue;
+	}
+};
+
+#endif//ARM_CURRENT_WRAPPER_H
@@ -0,0 +1,253 @@
+/*!
+ * @file AxisWrapper.h
+ * @brief 軸キー入出力のラッパークラス
+ * @author C.Saito
+ * @date 2019/04/15
+ */
+
+#ifndef AXIS_WRAPPER_H
+#define AXIS_WRAPPER_H
+
+#include <rtm/idl/BasicDataTypeSkel.h>
+#include <rtm/idl/ExtendedDataTypesSkel.h>
+#include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
+
+#include <rtm/DataInPort.h>
+#include <rtm/DataOutPort.h>
+
+#include "PortView.h"
+
+#include <cstdint>
+
+/*!
+ * @brief 軸キー入出力のラッパークラス
+ * @details 次のSpider2020::TimedAxisで提供するデータの操作APIを提供する
+ *          dir_vertical:      十字ボタン(上下)の入力具合
+ *          dir_horizontal:    十字ボタン(左右)の入力具合
+ *          lstick_vertical:   左スティック(上下)の入力具合
+ *          lstick_horizontal: 左スティック(左右)の入力具合
+ *          rstick_vertical:   右スティック(上下)の入力具合
+ *          rstick_horizontal: 右スティック(左右)の入力具合
+ *          l2:                L2ボタンの入力具合
+ *          r2:                R2ボタンの入力具合
+ */
+class AxisWrapper : public PortView<AxisWrapper, Spider2020::TimedAxis, CORBA::Double, 8>
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method AxisWrapper
+	 * @param  Port   ラッピングする変数
+	 */
+	AxisWrapper(Spider2020::TimedAxis& Port)
+		: PortView(Port)
+	{
+	}
+
+	/*!
+	 * 従来の配列の位置のメンバを取得する
+	 * @method Field
+	 * @param  uIndex 従来の配列の位置
+	 * @return メンバへのポインタ
+	 */
+	static Field_t Field(const uint8_t uIndex)
+	{
+		static constexpr Field_t s_Field[] =
+		{
+			&Data_t::dir_vertical,		/*!< 十字ボタン(上下)		*/
+			&Data_t::dir_horizontal,	/*!< 十字ボタン(左右)		*/
+			&Data_t::lstick_vertical,	/*!< 左スティック(上下)		*/
+			&Data_t::lstick_horizontal,	/*!< 左スティック(左右)		*/
+			&Data_t::rstick_vertical,	/*!< 右スティック(上下)		*/
+			&Data_t::rstick_horizontal,	/*!< 右スティック(左右)		*/
+			&Data_t::l2,				/*!< L2ボタン				*/
+			&Data_t::r2,				/*!< R2ボタン				*/
+		};
+		static_assert(sizeof(s_Field) / sizeof(s_Field[0]) == GetNumber(), "field table does not match the data type");
+
+		return s_Field[uIndex];
+	}
+
+	/*!
+	 * 軸キーの入出力の配列数と値を初期化する
+	 * @method InitData
+	 * @return なし
+	 */
+	void InitData(void)
+	{
+		// 軸キーの入出力の値を初期化する
+		SetDirVertical(0.0);
+		SetDirHorizontal(0.0);
+		SetLStickVertical(0.0);
+		SetLStickHorizontal(0.0);
+		SetRStickVertical(0.0);
+		SetRStickHorizontal(0.0);
+		SetL2(-1.0);
+		SetR2(-1.0);
+	}
+
+	/*!
+	 * 十字ボタン(左右)の入力具合を取得する
+	 * @method GetDirHorizontal
+	 * @return 押下具合
+	 */
+	double GetDirHorizontal(void) const
+	{
+		return m_Port.data.dir_horizontal;
+	}
+
+	/*!
+	 * 十字ボタン(左右)の入力具合を設定する
+	 * @method SetDirHorizontal
+	 * @param  dValue   入力具合
+	 * @return なし
+	 */
+	void SetDirHorizontal(const double dValue)
+	{
+		m_Port.data.dir_horizontal = dValue;
+	}
+
+	/*!
+	 * 十字ボタン(上下)の入力具合を取得する
+	 * @method GetDirHorizontal
+	 * @return 押下具合
+	 */
+	double GetDirVertical(void) const
+	{
+		return m_Port.data.dir_vertical;
+	}
+
+	/*!
+	 * 十字ボタン(上下)の入力具合を設定する
+	 * @method SetDirHorizontal
+	 * @param  dValue   入力具合
+	 * @return なし
+	 */
+	void SetDirVertical(const double dValue)
+	{
+		m_Port.data.dir_vertical = dValue;
+	}
+
+	/*!
+	 * 左スティック(左右)の入力具合を取得する
+	 * @method GetLStickHorizontal
+	 * @return 押下具合
+	 */
+	double GetLStickHorizontal(void) const
+	{
+		return m_Port.data.lstick_horizontal;
+	}
+
+	/*!
+	 * 左スティック(左右)の入力具合を設定する
+	 * @method SetLStickHorizontal
+	 * @param  dValue   入力具合
+	 */
+	void SetLStickHorizontal(const double dValue)
+	{
+		m_Port.data.lstick_horizontal = dValue;
+	}
+
+	/*!
+	 * 左スティック(上下)の入力具合を取得する
+	 * @method GetLStickVertical
+	 * @return 押下具合
+	 */
+	double GetLStickVertical(void) const
+	{
+		return m_Port.data.lstick_vertical;
+	}
+
+	/*!
+	 * 左スティック(上下)の入力具合を設定する
+	 * @method SetLStickVertical
+	 * @param  dValue   入力具合
+	 */
+	void SetLStickVertical(const double dValue)
+	{
+		m_Port.data.lstick_vertical = dValue;
+	}
+
+	/*!
+	 * 右スティック(左右)の入力具合を取得する
+	 * @method GetRStickHorizontal
+	 * @return 押下具合
+	 */
+	double GetRStickHorizontal(void) const
+	{
+		return m_Port.data.rstick_horizontal;
+	}
+
+	/*!
+	 * 右スティック(左右)の入力具合を設定する
+	 * @method SetRStickHorizontal
+	 * @param  dValue   入力具合
+	 */
+	void SetRStickHorizontal(const double dValue)
+	{
+		m_Port.data.rstick_horizontal = dValue;
+	}
+
+	/*!
+	 * 右スティック(上下)の入力具合を取得する
+	 * @method GetRStickVertical
+	 * @return 押下具合
+	 */
+	double GetRStickVertical(void) const
+	{
+		return m_Port.data.rstick_vertical;
+	}
+
+	/*!
+	 * 右スティック(上下)の入力具合を設定する
+	 * @method SetRStickVertical
+	 * @param  dValue   入力具合
+	 */
+	void SetRStickVertical(const double dValue)
+	{
+		m_Port.data.rstick_vertical = dValue;
+	}
+
+	/*!
+	 * L2ボタンの入力具合を取得する
+	 * @method GetL2
+	 * @return 押下具合
+	 */
+	double GetL2(void) const
+	{
+		return m_Port.data.l2;
+	}
+
+	/*!
+	 * L2ボタンの入力具合を設定する
+	 * @method SetL2
+	 * @param  dValue   入力具合
+	 */
+	void SetL2(const double dValue)
+	{
+		m_Port.data.l2 = dValue;
+	}
+
+	/*!
+	 * R2ボタンの入力具合を取得する
+	 * @method GetR2
+	 * @return 押下具合
+	 */
+	double GetR2(void) const
+	{
+		return m_Port.data.r2;
+	}
+
+	/*!
+	 * R2ボタンの入力具合を設定する
+	 * @method SetR2
+	 * @param  dValue   入力具合
+	 */
+	void SetR2(const double dValue)
+	{
+		m_Port.data.r2 = dValue;
+	}
+};
+
+#endif//AXIS_WRAPPER_H
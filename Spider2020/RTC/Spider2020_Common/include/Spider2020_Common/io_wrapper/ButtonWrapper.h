@@ -0,0 +1,573 @@
+/*!
+ * @file ButtonWrapper.h
+ * @brief ボタン入出力のラッパークラス
+ * @author C.Saito
+ * @date 2019/04/15
+ */
+
+#ifndef BUTTON_WRAPPER_H
+#define BUTTON_WRAPPER_H
+
+#include <rtm/idl/BasicDataTypeSkel.h>
+#include <rtm/idl/ExtendedDataTypesSkel.h>
+#include <rtm/idl/InterfaceDataTypesSkel.h>
+
+#include <rtm/DataInPort.h>
+#include <rtm/DataOutPort.h>
+
+#include <cstdint>
+#include <string>
+
+/*!
+ * @brief ボタン入出力のラッパークラス
+ * @details ULong型で提供するデータの操作APIを提供する
+ *          bit1: SQUAREボタンの押下状態
+ *          bit2: CROSSボタンの押下状態
+ *          bit3: CIRCLEボタンの押下状態
+ *          bit4: TRIANGLEボタンの押下状態
+ *          bit5: L1ボタンの押下状態
+ *          bit6: R1ボタンの押下状態
+ *          bit7: L2ボタンの押下状態
+ *          bit8: R2ボタンの押下状態
+ *          bit9: SHAREボタンの押下状態
+ *          bit10: OPTIONSボタンの押下状態
+ *          bit11: L3ボタンの押下状態
+ *          bit12: R3ボタンの押下状態
+ *          bit13: PSボタンの押下状態
+ *          bit14: TOUCHボタンの押下状態
+ *          bit15-32: 未使用
+ */
+class ButtonWrapper
+{
+public:
+	/*!
+	 * @enum 列挙子
+	 * データのビット位置
+	 */
+	enum DATA_BIT_POS_t
+	{
+		DATA_BIT_POS_SQUARE,		/*!< SQUAREボタン		*/
+		DATA_BIT_POS_CROSS,			/*!< CROSSボタン		*/
+		DATA_BIT_POS_CIRCLE,		/*!< CIRCLEボタン		*/
+		DATA_BIT_POS_TRIANGLE,		/*!< TRIANGLEボタン		*/
+		DATA_BIT_POS_L1,			/*!< L1ボタン			*/
+		DATA_BIT_POS_R1,			/*!< R1ボタン			*/
+		DATA_BIT_POS_L2,			/*!< L2ボタン			*/
+		DATA_BIT_POS_R2,			/*!< R2ボタン			*/
+		DATA_BIT_POS_SHARE,			/*!< SHAREボタン		*/
+		DATA_BIT_POS_OPTIONS,		/*!< OPTIONSボタン		*/
+		DATA_BIT_POS_L3,			/*!< L3ボタン			*/
+		DATA_BIT_POS_R3,			/*!< R3ボタン			*/
+		DATA_BIT_POS_PS,			/*!< PSボタン			*/
+		DATA_BIT_POS_TOUCH,			/*!< TOUCHボタン		*/
+		DATA_BIT_POS_NUM,			/*!< データのビットの数	*/
+	};
+
+	/*!
+	 * コンストラクタ
+	 * @method Button
+	 * @param  Port   ラッピングする変数
+	 */
+	ButtonWrapper(RTC::TimedULong& Port)
+		: m_Port(Port)
+	{
+	}
+
+	/*!
+	 * 代入演算子のオーバーロード
+	 * @method operator=
+	 */
+	ButtonWrapper& operator=(const ButtonWrapper& rhs)
+	{
+		m_Port = rhs.m_Port;
+		return *this;
+	}
+
+	/*!
+	 * タイムスタンプを設定する
+	 * @method SetTimestamp
+	 * @return なし
+	 */
+	void SetTimestamp(void)
+	{
+		// タイムスタンプを設定する
+		setTimestamp(m_Port);
+	}
+
+	/*!
+	 * ボタンの値を初期化する
+	 * @method InitData
+	 * @return なし
+	 */
+	void InitData(void)
+	{
+		// ボタンの入出力の値を初期化する
+		m_Port.data = 0;
+	}
+
+	/*!
+	 * ボタンの数を取得する
+	 * @method GetNumber
+	 * @return ボタンの数
+	 */
+	static constexpr uint8_t GetNumber(void)
+	{
+		return DATA_BIT_POS_NUM;
+	}
+
+	/*!
+	 * SQUAREボタンの押下状態を取得する
+	 * @method GetSquare
+	 * @return 押下状態
+	 */
+	int16_t GetSquare(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_SQUARE) & 1);
+	}
+
+	/*!
+	 * SQUAREボタンの押下状態を設定する
+	 * @method SetSquare
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetSquare(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_SQUARE);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_SQUARE);
+		}
+	}
+
+	/*!
+	 * CROSSボタンの押下状態を取得する
+	 * @method GetCross
+	 * @return 押下状態
+	 */
+	int16_t GetCross(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_CROSS) & 1);
+	}
+
+	/*!
+	 * CROSSボタンの押下状態を設定する
+	 * @method SetCross
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetCross(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_CROSS);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_CROSS);
+		}
+	}
+
+	/*!
+	 * CIRCLEボタンの押下状態を取得する
+	 * @method GetCircle
+	 * @return 押下状態
+	 */
+	int16_t GetCircle(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_CIRCLE) & 1);
+	}
+
+	/*!
+	 * CIRCLEボタンの押下状態を設定する
+	 * @method SetCircle
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetCircle(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_CIRCLE);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_CIRCLE);
+		}
+	}
+
+	/*!
+	 * TRIANGLEボタンの押下状態を取得する
+	 * @method GetTriangle
+	 * @return 押下状態
+	 */
+	int16_t GetTriangle(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_TRIANGLE) & 1);
+	}
+
+	/*!
+	 * TRIANGLEボタンの押下状態を設定する
+	 * @method SetTriangle
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetTriangle(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_TRIANGLE);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_TRIANGLE);
+		}
+	}
+
+	/*!
+	 * L1ボタンの押下状態を取得する
+	 * @method GetL1
+	 * @return 押下状態
+	 */
+	int16_t GetL1(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_L1) & 1);
+	}
+
+	/*!
+	 * L1ボタンの押下状態を設定する
+	 * @method SetL1
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetL1(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_L1);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_L1);
+		}
+	}
+
+	/*!
+	 * R1ボタンの押下状態を取得する
+	 * @method GetR1
+	 * @return 押下状態
+	 */
+	int16_t GetR1(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_R1) & 1);
+	}
+
+	/*!
+	 * R1ボタンの押下状態を設定する
+	 * @method SetR1
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetR1(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_R1);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_R1);
+		}
+	}
+
+	/*!
+	 * L2ボタンの押下状態を取得する
+	 * @method GetL2
+	 * @return 押下状態
+	 */
+	int16_t GetL2(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_L2) & 1);
+	}
+
+	/*!
+	 * L2ボタンの押下状態を設定する
+	 * @method SetL2
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetL2(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_L2);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_L2);
+		}
+	}
+
+	/*!
+	 * R2ボタンの押下状態を取得する
+	 * @method GetR2
+	 * @return 押下状態
+	 */
+	int16_t GetR2(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_R2) & 1);
+	}
+
+	/*!
+	 * R2ボタンの押下状態を設定する
+	 * @method SetR2
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetR2(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_R2);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_R2);
+		}
+	}
+
+	/*!
+	 * SHAREボタンの押下状態を取得する
+	 * @method GetShare
+	 * @return 押下状態
+	 */
+	int16_t GetShare(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_SHARE) & 1);
+	}
+
+	/*!
+	 * SHAREボタンの押下状態を設定する
+	 * @method SetShare
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetShare(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_SHARE);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_SHARE);
+		}
+	}
+
+	/*!
+	 * OPTIONSボタンの押下状態を取得する
+	 * @method GetOptions
+	 * @return 押下状態
+	 */
+	int16_t GetOptions(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_OPTIONS) & 1);
+	}
+
+	/*!
+	 * OPTIONSボタンの押下状態を設定する
+	 * @method SetOptions
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetOptions(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_OPTIONS);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_OPTIONS);
+		}
+	}
+
+	/*!
+	 * L3ボタンの押下状態を取得する
+	 * @method GetL3
+	 * @return 押下状態
+	 */
+	int16_t GetL3(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_L3) & 1);
+	}
+
+	/*!
+	 * L3ボタンの押下状態を設定する
+	 * @method SetL3
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetL3(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_L3);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_L3);
+		}
+	}
+
+	/*!
+	 * R3ボタンの押下状態を取得する
+	 * @method GetR3
+	 * @return 押下状態
+	 */
+	int16_t GetR3(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_R3) & 1);
+	}
+
+	/*!
+	 * R3ボタンの押下状態を設定する
+	 * @method SetR3
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetR3(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_R3);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_R3);
+		}
+	}
+
+	/*!
+	 * PSボタンの押下状態を取得する
+	 * @method GetPS
+	 * @return 押下状態
+	 */
+	int16_t GetPS(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_PS) & 1);
+	}
+
+	/*!
+	 * PSボタンの押下状態を設定する
+	 * @method SetPS
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetPS(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_PS);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_PS);
+		}
+	}
+
+	/*!
+	 * TOUCHボタンの押下状態を取得する
+	 * @method GetTouch
+	 * @return 押下状態
+	 */
+	int16_t GetTouch(void) const
+	{
+		return ((m_Port.data >> DATA_BIT_POS_TOUCH) & 1);
+	}
+
+	/*!
+	 * TOUCHボタンの押下状態を設定する
+	 * @method SetTouch
+	 * @param  iValue   押下状態
+	 * @return なし
+	 */
+	void SetTouch(const int16_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data |= (1 << DATA_BIT_POS_TOUCH);
+		}
+		else
+		{
+			m_Port.data &= ~(1 << DATA_BIT_POS_TOUCH);
+		}
+	}
+
+	/*!
+	 * 全てのボタンが押下されているか判定する
+	 * @method IsPressedAll
+	 * @param  uMask ボタンのビットマスク(ParseMaskで生成する)
+	 * @retval true 全て押下されている
+	 * @retval false 押下されていないボタンがある、またはビットマスクが0
+	 */
+	bool IsPressedAll(uint32_t uMask) const
+	{
+		return ((uMask != 0) && ((m_Port.data & uMask) == uMask));
+	}
+
+	/*!
+	 * ボタン名の組み合わせをビットマスクに変換する
+	 * @method ParseMask
+	 * @param  sNames ボタン名を+で区切った組み合わせ(例: "L1+R1")
+	 * @return ボタンのビットマスク(空の場合は0)
+	 * @remark ボタン名はSQUARE,CROSS,CIRCLE,TRIANGLE,L1,R1,L2,R2,SHARE,OPTIONS,L3,R3,PS,TOUCH
+	 *         不明なボタン名は無視する
+	 */
+	static uint32_t ParseMask(const std::string &sNames)
+	{
+		static const char *s_pButtonName[DATA_BIT_POS_NUM] =
+		{
+			"SQUARE", "CROSS", "CIRCLE", "TRIANGLE", "L1", "R1", "L2", "R2",
+			"SHARE", "OPTIONS", "L3", "R3", "PS", "TOUCH",
+		};
+
+		uint32_t uMask = 0;
+		size_t sizeBegin = 0;
+		size_t sizeEnd = 0;
+
+		while(sizeBegin <= sNames.length())
+		{
+			// +で区切ったボタン名を取り出す(前後の空白は除く)
+			sizeEnd = sNames.find('+', sizeBegin);
+			if(sizeEnd == std::string::npos)
+			{
+				sizeEnd = sNames.length();
+			}
+			std::string sName = sNames.substr(sizeBegin, sizeEnd - sizeBegin);
+			sName.erase(0, sName.find_first_not_of(" \t"));
+			sName.erase(sName.find_last_not_of(" \t") + 1);
+
+			// ボタン名に該当するビットを立てる
+			for(int i = 0; i < DATA_BIT_POS_NUM; i++)
+			{
+				if(sName == s_pButtonName[i])
+				{
+					uMask |= (1 << i);
+					break;
+				}
+			}
+			sizeBegin = sizeEnd + 1;
+		}
+
+		return uMask;
+	}
+
+private:
+	RTC::TimedULong& m_Port;	/*!< ラッピングする変数の参照変数	*/
+};
+
+#endif//BUTTON_WRAPPER_H
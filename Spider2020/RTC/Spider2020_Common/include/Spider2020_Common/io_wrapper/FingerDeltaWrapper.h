@@ -11,16 +11,19 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 #include <rtm/DataInPort.h>
 #include <rtm/DataOutPort.h>
 
+#include "PortView.h"
+
 #include <cstdint>
 
 /*!
  * Jaco2アームの指の開閉具合の変位速度入出力のラッパークラス
  */
-class FingerDeltaWrapper
+class FingerDeltaWrapper : public PortView<FingerDeltaWrapper, Spider2020::TimedFinger, CORBA::Long, 3>
 {
 public:
 	/*!
@@ -28,47 +31,52 @@ public:
 	 * @method FingerDeltaWrapper
 	 * @param  Port   ラッピングする変数
 	 */
-	FingerDeltaWrapper(RTC::TimedLongSeq& Port);
+	FingerDeltaWrapper(Spider2020::TimedFinger& Port)
+		: PortView(Port)
+	{
+	}
 
 	/*!
-	 * デストラクタ
-	 * @method FingerDeltaWrapper
+	 * 従来の配列の位置のメンバを取得する
+	 * @method Field
+	 * @param  uIndex 従来の配列の位置
+	 * @return メンバへのポインタ
 	 */
-	virtual ~FingerDeltaWrapper();
-
-	/*!
-	 * 代入演算子のオーバーロード
-	 * @method operator=
-	 */
-	FingerDeltaWrapper& operator=(const FingerDeltaWrapper& rhs);
-
-	/*!
-	 * タイムスタンプを設定する
-	 * @method SetTimestamp
-	 * @return なし
-	 */
-	void SetTimestamp(void);
+	static Field_t Field(const uint8_t uIndex)
+	{
+		static constexpr Field_t s_Field[] =
+		{
+			&Data_t::thumb,			/*!< 親指	*/
+			&Data_t::index_finger,	/*!< 差指	*/
+			&Data_t::middle_finger,	/*!< 中指	*/
+		};
+		static_assert(sizeof(s_Field) / sizeof(s_Field[0]) == GetNumber(), "field table does not match the data type");
+
+		return s_Field[uIndex];
+	}
 
 	/*!
 	 * Jaco2アームの指の開閉具合の変位速度の入出力の配列数と値を初期化する
 	 * @method InitData
 	 * @return なし
 	 */
-	void InitData(void);
-
-	/*!
-	 * Jaco2アームの指の開閉具合の変位速度の数を取得する
-	 * @method GetNumber
-	 * @return データの数
-	 */
-	 uint8_t GetNumber(void);
+	void InitData(void)
+	{
+		// 指の開閉具合の変位速度の入出力の値を初期化する
+		SetThumbDelta(0);
+		SetIndexFingerDelta(0);
+		SetMiddleFingerDelta(0);
+	}
 
 	/*!
 	 * Jaco2アームの親指の開閉具合の変位速度を取得する
 	 * @method GetThumbDelta(void)
 	 * @return 指の開閉具合の変位速度
 	 */
-	int32_t GetThumbDelta(void);
+	int32_t GetThumbDelta(void) const
+	{
+		return m_Port.data.thumb;
+	}
 
 	/*!
 	 * Jaco2アームの親指の開閉具合の変位速度を設定する
@@ -76,14 +84,20 @@ public:
 	 * @param  iValue   指の開閉具合の変位速度
 	 * @return なし
 	 */
-	void SetThumbDelta(const int32_t iValue);
+	void SetThumbDelta(const int32_t iValue)
+	{
+		m_Port.data.thumb = iValue;
+	}
 
 	/*!
 	 * Jaco2アームの差指の開閉具合の変位速度を取得する
 	 * @method GetIndexFingerDelta(void)
 	 * @return 指の開閉具合の変位速度
 	 */
-	int32_t GetIndexFingerDelta(void);
+	int32_t GetIndexFingerDelta(void) const
+	{
+		return m_Port.data.index_finger;
+	}
 
 	/*!
 	 * Jaco2アームの親指の開閉具合の変位速度を設定する
@@ -91,14 +105,20 @@ public:
 	 * @param  iValue   指の開閉具合の変位速度
 	 * @return なし
 	 */
-	void SetIndexFingerDelta(const int32_t iValue);
+	void SetIndexFingerDelta(const int32_t iValue)
+	{
+		m_Port.data.index_finger = iValue;
+	}
 
 	/*!
 	 * Jaco2アームの中指の開閉具合の変位速度を取得する
 	 * @method GetMiddleFingerDelta(void)
 	 * @return 指の開閉具合の変位速度
 	 */
-	int32_t GetMiddleFingerDelta(void);
+	int32_t GetMiddleFingerDelta(void) const
+	{
+		return m_Port.data.middle_finger;
+	}
 
 	/*!
 	 * Jaco2アームの中指の開閉具合の変位速度を設定する
@@ -106,10 +126,10 @@ public:
 	 * @param  iValue   指の開閉具合の変位速度
 	 * @return なし
 	 */
-	void SetMiddleFingerDelta(const int32_t iValue);
-
-private:
-	RTC::TimedLongSeq& m_Port;	/*!< ラッピングする変数の参照変数	*/
+	void SetMiddleFingerDelta(const int32_t iValue)
+	{
+		m_Port.data.middle_finger = iValue;
+	}
 };
 
 #endif//FINGER_DELTA_WRAPPER_H
@@ -11,20 +11,23 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 #include <rtm/DataInPort.h>
 #include <rtm/DataOutPort.h>
 
+#include "PortView.h"
+
 #include <cstdint>
 
 /*!
  * Jaco2アームの指の開閉具合の入出力のラッパークラス
- * @details 次のlong型配列で提供するデータの操作APIを提供する
- *          [0]: Thumbの開閉具合
- *          [1]: Index Fingerの開閉具合
- *          [2]: Middle Fingerの開閉具合
+ * @details 次のSpider2020::TimedFingerで提供するデータの操作APIを提供する
+ *          thumb:         Thumbの開閉具合
+ *          index_finger:  Index Fingerの開閉具合
+ *          middle_finger: Middle Fingerの開閉具合
  */
-class FingerStatusWrapper
+class FingerStatusWrapper : public PortView<FingerStatusWrapper, Spider2020::TimedFinger, CORBA::Long, 3>
 {
 public:
 	/*!
@@ -32,47 +35,52 @@ public:
 	 * @method FingerStatusWrapper
 	 * @param  Port   ラッピングする変数
 	 */
-	FingerStatusWrapper(RTC::TimedLongSeq& Port);
+	FingerStatusWrapper(Spider2020::TimedFinger& Port)
+		: PortView(Port)
+	{
+	}
 
 	/*!
-	 * デストラクタ
-	 * @method FingerStatusWrapper
+	 * 従来の配列の位置のメンバを取得する
+	 * @method Field
+	 * @param  uIndex 従来の配列の位置
+	 * @return メンバへのポインタ
 	 */
-	virtual ~FingerStatusWrapper();
-
-	/*!
-	 * 代入演算子のオーバーロード
-	 * @method operator=
-	 */
-	FingerStatusWrapper& operator=(const FingerStatusWrapper& rhs);
-
-	/*!
-	 * タイムスタンプを設定する
-	 * @method SetTimestamp
-	 * @return なし
-	 */
-	void SetTimestamp(void);
+	static Field_t Field(const uint8_t uIndex)
+	{
+		static constexpr Field_t s_Field[] =
+		{
+			&Data_t::thumb,			/*!< 親指	*/
+			&Data_t::index_finger,	/*!< 差指	*/
+			&Data_t::middle_finger,	/*!< 中指	*/
+		};
+		static_assert(sizeof(s_Field) / sizeof(s_Field[0]) == GetNumber(), "field table does not match the data type");
+
+		return s_Field[uIndex];
+	}
 
 	/*!
 	 * Jaco2アームの指の開閉具合の入出力の配列数と値を初期化する
 	 * @method InitData
 	 * @return なし
 	 */
-	void InitData(void);
-
-	/*!
-	 * Jaco2アームの指の開閉具合の数を取得する
-	 * @method GetNumber
-	 * @return データの数
-	 */
-	 uint8_t GetNumber(void);
+	void InitData(void)
+	{
+		// Jaco2アームの指の開閉具合の入出力の値を初期化する
+		SetThumbStatus(0);
+		SetIndexFingerStatus(0);
+		SetMiddleFingerStatus(0);
+	}
 
 	/*!
 	 * Jaco2アームの親指の開閉具合を取得する
 	 * @method GetThumbStatus(void)
 	 * @return 親指の開閉具合
 	 */
-	int32_t GetThumbStatus(void);
+	int32_t GetThumbStatus(void) const
+	{
+		return m_Port.data.thumb;
+	}
 
 	/*!
 	 * Jaco2アームの親指の開閉具合を設定する
@@ -80,14 +88,20 @@ public:
 	 * @param  iValue   指の開閉具合の変位速度
 	 * @return なし
 	 */
-	void SetThumbStatus(const int32_t iValue);
+	void SetThumbStatus(const int32_t iValue)
+	{
+		m_Port.data.thumb = iValue;
+	}
 
 	/*!
 	 * Jaco2アームの差指の開閉具合を取得する
 	 * @method GetIndexFingerStatus(void)
 	 * @return 差指の開閉具合
 	 */
-	int32_t GetIndexFingerStatus(void);
+	int32_t GetIndexFingerStatus(void) const
+	{
+		return m_Port.data.index_finger;
+	}
 
 	/*!
 	 * Jaco2アームの親指の開閉具合を設定する
@@ -95,14 +109,20 @@ public:
 	 * @param  iValue   差指の開閉具合
 	 * @return なし
 	 */
-	void SetIndexFingerStatus(const int32_t iValue);
+	void SetIndexFingerStatus(const int32_t iValue)
+	{
+		m_Port.data.index_finger = iValue;
+	}
 
 	/*!
 	 * Jaco2アームの中指の開閉具合を取得する
 	 * @method GetMiddleFingerStatus(void)
 	 * @return 中指の開閉具合
 	 */
-	int32_t GetMiddleFingerStatus(void);
+	int32_t GetMiddleFingerStatus(void) const
+	{
+		return m_Port.data.middle_finger;
+	}
 
 	/*!
 	 * Jaco2アームの中指の開閉具合を設定する
@@ -110,10 +130,10 @@ public:
 	 * @param  iValue   中指の開閉具合
 	 * @return なし
 	 */
-	void SetMiddleFingerStatus(const int32_t iValue);
-
-private:
-	RTC::TimedLongSeq& m_Port;	/*!< ラッピングする変数の参照変数	*/
+	void SetMiddleFingerStatus(const int32_t iValue)
+	{
+		m_Port.data.middle_finger = iValue;
+	}
 };
 
 #endif//FINGER_STATUS_WRAPPER_H
@@ -0,0 +1,163 @@
+/*!
+ * @file FlipperAngleWrapper.h
+ * @brief フリッパーの角度入出力のラッパークラス
+ * @author C.Saito
+ * @date 2019/04/18
+ */
+
+#ifndef FLIPPER_ANGLE_WRAPPER_H
+#define FLIPPER_ANGLE_WRAPPER_H
+
+#include <rtm/idl/BasicDataTypeSkel.h>
+#include <rtm/idl/ExtendedDataTypesSkel.h>
+#include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
+
+#include <rtm/DataInPort.h>
+#include <rtm/DataOutPort.h>
+
+#include "PortView.h"
+
+#include <cstdint>
+
+/*!
+ * @brief フリッパーの角度入出力のラッパークラス
+ * @details 次のSpider2020::TimedFlipperAngleで提供するデータの操作APIを提供する
+ *          front_r: 右前方フリッパーの角度
+ *          front_l: 左前方フリッパーの角度
+ *          back_r:  右後方フリッパーの角度
+ *          back_l:  左後方フリッパーの角度
+ */
+class FlipperAngleWrapper : public PortView<FlipperAngleWrapper, Spider2020::TimedFlipperAngle, CORBA::Double, 4>
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method FlipperAngleWrapper
+	 * @param  Port   ラッピングする変数
+	 */
+	FlipperAngleWrapper(Spider2020::TimedFlipperAngle& Port)
+		: PortView(Port)
+	{
+	}
+
+	/*!
+	 * 従来の配列の位置のメンバを取得する
+	 * @method Field
+	 * @param  uIndex 従来の配列の位置
+	 * @return メンバへのポインタ
+	 */
+	static Field_t Field(const uint8_t uIndex)
+	{
+		static constexpr Field_t s_Field[] =
+		{
+			&Data_t::front_r,	/*!< 右前方フリッパー	*/
+			&Data_t::front_l,	/*!< 左前方フリッパー	*/
+			&Data_t::back_r,	/*!< 右後方フリッパー	*/
+			&Data_t::back_l,	/*!< 左後方フリッパー	*/
+		};
+		static_assert(sizeof(s_Field) / sizeof(s_Field[0]) == GetNumber(), "field table does not match the data type");
+
+		return s_Field[uIndex];
+	}
+
+	/*!
+	 * フリッパーの角度の入出力の配列数と値を初期化する
+	 * @method InitData
+	 * @return なし
+	 */
+	void InitData(void)
+	{
+		// フリッパーの角度の入出力の値を初期化する
+		SetFrontRightAngle(0);
+		SetFrontLeftAngle(0);
+		SetBackRightAngle(0);
+		SetBackLeftAngle(0);
+	}
+
+	/*!
+	 * 右前方フリッパーの角度を取得する
+	 * @method GetFrontRightAngle
+	 * @return フリッパーの角度
+	 */
+	double GetFrontRightAngle(void) const
+	{
+		return m_Port.data.front_r;
+	}
+
+	/*!
+	 * 右前方フリッパーの角度を設定する
+	 * @method SetFrontRightAngle
+	 * @param  dValue   フリッパーの角度
+	 * @return なし
+	 */
+	void SetFrontRightAngle(const double dValue)
+	{
+		m_Port.data.front_r = dValue;
+	}
+
+	/*!
+	 * 左前方フリッパーの角度を取得する
+	 * @method GetFrontLeftAngle
+	 * @return フリッパーの角度
+	 */
+	double GetFrontLeftAngle(void) const
+	{
+		return m_Port.data.front_l;
+	}
+
+	/*!
+	 * 左前方フリッパーの角度を設定する
+	 * @method SetFrontLeftAngle
+	 * @param  dValue   フリッパーの角度
+	 * @return なし
+	 */
+	void SetFrontLeftAngle(const double dValue)
+	{
+		m_Port.data.front_l = dValue;
+	}
+
+	/*!
+	 * 右後方フリッパーの角度を取得する
+	 * @method GetBackRightAngle
+	 * @return フリッパーの角度
+	 */
+	double GetBackRightAngle(void) const
+	{
+		return m_Port.data.back_r;
+	}
+
+	/*!
+	 * 右後方フリッパーの角度を設定する
+	 * @method SetBackRightAngle
+	 * @param  dValue   フリッパーの角度
+	 * @return なし
+	 */
+	void SetBackRightAngle(const double dValue)
+	{
+		m_Port.data.back_r = dValue;
+	}
+
+	/*!
+	 * 左前方フリッパーの角度を取得する
+	 * @method GetBackLeftAngle
+	 * @return フリッパーの角度
+	 */
+	double GetBackLeftAngle(void) const
+	{
+		return m_Port.data.back_l;
+	}
+
+	/*!
+	 * 左前方フリッパーの角度を設定する
+	 * @method SetBackLeftAngle
+	 * @param  dValue   フリッパーの角度
+	 * @return なし
+	 */
+	void SetBackLeftAngle(const double dValue)
+	{
+		m_Port.data.back_l = dValue;
+	}
+};
+
+#endif//FLIPPER_ANGLE_WRAPPER_H
@@ -11,21 +11,24 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 #include <rtm/DataInPort.h>
 #include <rtm/DataOutPort.h>
 
+#include "PortView.h"
+
 #include <cstdint>
 
 /*!
  * @brief フリッパーのPWM指令入出力のラッパークラス
- * @details 次のdouble型配列で提供するデータの操作APIを提供する
- *          [0]: 右前方フリッパーのPWM指令
- *          [1]: 左前方フリッパーのPWM指令
- *          [2]: 右後方フリッパーのPWM指令
- *          [3]: 左後方フリッパーのPWM指令
+ * @details 次のSpider2020::TimedFlipperPwmで提供するデータの操作APIを提供する
+ *          front_r: 右前方フリッパーのPWM指令
+ *          front_l: 左前方フリッパーのPWM指令
+ *          back_r:  右後方フリッパーのPWM指令
+ *          back_l:  左後方フリッパーのPWM指令
  */
-class FlipperPwmWrapper
+class FlipperPwmWrapper : public PortView<FlipperPwmWrapper, Spider2020::TimedFlipperPwm, CORBA::Long, 4>
 {
 public:
 	/*!
@@ -33,47 +36,54 @@ public:
 	 * @method FlipperPwmWrapper
 	 * @param  Port   ラッピングする変数
 	 */
-	FlipperPwmWrapper(RTC::TimedLongSeq& Port);
+	FlipperPwmWrapper(Spider2020::TimedFlipperPwm& Port)
+		: PortView(Port)
+	{
+	}
 
 	/*!
-	 * デストラクタ
-	 * @method FlipperPwmWrapper
+	 * 従来の配列の位置のメンバを取得する
+	 * @method Field
+	 * @param  uIndex 従来の配列の位置
+	 * @return メンバへのポインタ
 	 */
-	virtual ~FlipperPwmWrapper();
-
-	/*!
-	 * 代入演算子のオーバーロード
-	 * @method operator=
-	 */
-	FlipperPwmWrapper& operator=(const FlipperPwmWrapper& rhs);
-
-	/*!
-	 * タイムスタンプを設定する
-	 * @method SetTimestamp
-	 * @return なし
-	 */
-	void SetTimestamp(void);
+	static Field_t Field(const uint8_t uIndex)
+	{
+		static constexpr Field_t s_Field[] =
+		{
+			&Data_t::front_r,	/*!< 右前方フリッパー	*/
+			&Data_t::front_l,	/*!< 左前方フリッパー	*/
+			&Data_t::back_r,	/*!< 右後方フリッパー	*/
+			&Data_t::back_l,	/*!< 左後方フリッパー	*/
+		};
+		static_assert(sizeof(s_Field) / sizeof(s_Field[0]) == GetNumber(), "field table does not match the data type");
+
+		return s_Field[uIndex];
+	}
 
 	/*!
 	 * フリッパーのPWM指令の入出力の配列数と値を初期化する
 	 * @method InitData
 	 * @return なし
 	 */
-	void InitData(void);
-
-	/*!
-	 * フリッパーのPWM指令の数を取得する
-	 * @method GetNumber
-	 * @return データの数
-	 */
-	 uint8_t GetNumber(void);
+	void InitData(void)
+	{
+		// フリッパーのPWM指令の入出力の値を初期化する
+		SetFrontRightPwm(0);
+		SetFrontLeftPwm(0);
+		SetBackRightPwm(0);
+		SetBackLeftPwm(0);
+	}
 
 	/*!
 	 * 右前方フリッパーのPWM指令を取得する
 	 * @method GetFrontRightPwm
 	 * @return フリッパーのPWM指令
 	 */
-	int32_t GetFrontRightPwm(void);
+	int32_t GetFrontRightPwm(void) const
+	{
+		return m_Port.data.front_r;
+	}
 
 	/*!
 	 * 右前方フリッパーのPWM指令を設定する
@@ -81,14 +91,20 @@ public:
 	 * @param  iValue   フリッパーのPWM指令
 	 * @return なし
 	 */
-	void SetFrontRightPwm(const int32_t iValue);
+	void SetFrontRightPwm(const int32_t iValue)
+	{
+		m_Port.data.front_r = iValue;
+	}
 
 	/*!
 	 * 左前方フリッパーのPWM指令を取得する
 	 * @method GetFrontLeftPwm
 	 * @return フリッパーのPWM指令
 	 */
-	int32_t GetFrontLeftPwm(void);
+	int32_t GetFrontLeftPwm(void) const
+	{
+		return m_Port.data.front_l;
+	}
 
 	/*!
 	 * 左前方フリッパーのPWM指令を設定する
@@ -96,14 +112,20 @@ public:
 	 * @param  iValue   フリッパーのPWM指令
 	 * @return なし
 	 */
-	void SetFrontLeftPwm(const int32_t iValue);
+	void SetFrontLeftPwm(const int32_t iValue)
+	{
+		m_Port.data.front_l = iValue;
+	}
 
 	/*!
 	 * 右後方フリッパーのPWM指令を取得する
 	 * @method GetBackRightPwm
 	 * @return フリッパーのPWM指令
 	 */
-	int32_t GetBackRightPwm(void);
+	int32_t GetBackRightPwm(void) const
+	{
+		return m_Port.data.back_r;
+	}
 
 	/*!
 	 * 右後方フリッパーのPWM指令を設定する
@@ -111,14 +133,20 @@ public:
 	 * @param  iValue   フリッパーのPWM指令
 	 * @return なし
 	 */
-	void SetBackRightPwm(const int32_t iValue);
+	void SetBackRightPwm(const int32_t iValue)
+	{
+		m_Port.data.back_r = iValue;
+	}
 
 	/*!
 	 * 左前方フリッパーのPWM指令を取得する
 	 * @method GetBackLeftPwm
 	 * @return フリッパーのPWM指令
 	 */
-	int32_t GetBackLeftPwm(void);
+	int32_t GetBackLeftPwm(void) const
+	{
+		return m_Port.data.back_l;
+	}
 
 	/*!
 	 * 左前方フリッパーのPWM指令を設定する
@@ -126,10 +154,10 @@ public:
 	 * @param  iValue   フリッパーのPWM指令
 	 * @return なし
 	 */
-	void SetBackLeftPwm(const int32_t iValue);
-
-private:
-	RTC::TimedLongSeq& m_Port;	/*!< ラッピングする変数の参照変数	*/
+	void SetBackLeftPwm(const int32_t iValue)
+	{
+		m_Port.data.back_l = iValue;
+	}
 };
 
 #endif//FLIPPER_PWM_WRAPPER_H
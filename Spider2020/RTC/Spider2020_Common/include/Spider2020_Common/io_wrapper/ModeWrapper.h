@@ -11,23 +11,26 @@
 #include <rtm/idl/BasicDataTypeSkel.h>
 #include <rtm/idl/ExtendedDataTypesSkel.h>
 #include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
 
 #include <rtm/DataInPort.h>
 #include <rtm/DataOutPort.h>
 
+#include "PortView.h"
+
 #include <cstdint>
 
 /*!
  * @brief 動作指令の状態入出力のラッパークラス
- * @details 次のlong型配列で提供するデータの操作APIを提供する
- *          [0]: 操作モード
- *          [1]: 走行操作 速度レベル
- *          [2]: 走行操作 最大速度フラグ
- *          [3]: 走行モード フリッパーの選択状態
- *          [4]: 走行モード フリッパーの動作状態
- *          [5]: 走行モード 台車の位置姿勢のクリア
+ * @details 次のSpider2020::TimedModeで提供するデータの操作APIを提供する
+ *          control:            操作モード
+ *          speed_level:        走行操作 速度レベル
+ *          speed_max:          走行操作 最大速度フラグ
+ *          flipper_select:     走行モード フリッパーの選択状態
+ *          flipper_status:     走行モード フリッパーの動作状態
+ *          crawler_pose_clear: 走行モード 台車の位置姿勢のクリア
  */
-class ModeWrapper
+class ModeWrapper : public PortView<ModeWrapper, Spider2020::TimedMode, CORBA::Long, 6>
 {
 public:
 	/*!
@@ -103,48 +106,61 @@ public:
 	 * @method ModeWrapper
 	 * @param  Port   ラッピングする変数
 	 */
-	ModeWrapper(RTC::TimedLongSeq& Port);
-
-	/*!
-	 * デストラクタ
-	 * @method ModeWrapper
-	 */
-	virtual ~ModeWrapper();
-
-	/*!
-	 * 代入演算子のオーバーロード
-	 * @method operator=
-	 */
-	ModeWrapper& operator=(const ModeWrapper& rhs);
+	ModeWrapper(Spider2020::TimedMode& Port)
+		: PortView(Port)
+	{
+	}
 
 	/*!
-	 * タイムスタンプを設定する
-	 * @method SetTimestamp
-	 * @return なし
+	 * 従来の配列の位置のメンバを取得する
+	 * @method Field
+	 * @param  uIndex 従来の配列の位置
+	 * @return メンバへのポインタ
 	 */
-	void SetTimestamp(void);
+	static Field_t Field(const uint8_t uIndex)
+	{
+		static constexpr Field_t s_Field[] =
+		{
+			&Data_t::control,				/*!< 操作モード							*/
+			&Data_t::speed_level,			/*!< 走行モード 速度レベル				*/
+			&Data_t::speed_max,				/*!< 走行モード 最大速度フラグ			*/
+			&Data_t::flipper_select,		/*!< 走行モード フリッパーの選択状態(ビット毎)	*/
+			&Data_t::flipper_status,		/*!< 走行モード フリッパーの動作状態	*/
+			&Data_t::crawler_pose_clear,	/*!< 走行モード 台車の位置姿勢のクリア	*/
+		};
+		static_assert(sizeof(s_Field) / sizeof(s_Field[0]) == GetNumber(), "field table does not match the data type");
+
+		return s_Field[uIndex];
+	}
 
 	/*!
 	 * 動作指令の状態の入出力の配列数と値を初期化する
 	 * @method InitData
 	 * @return なし
 	 */
-	void InitData(void);
-
-	/*!
-	 * 動作指令の状態の数を取得する
-	 * @method GetDataNumber
-	 * @return データの数
-	 */
-	 uint8_t GetDataNumber(void);
-
+	void InitData(void)
+	{
+		// 軸キーの入出力の値を初期化する
+		SetSpeedLevel(ModeWrapper::SPEED_LEVEL_LOW);
+		SetSpeedMax(ModeWrapper::SPEED_MAX_OFF);
+		SetControl(ModeWrapper::CONTROL_DRIVE);
+		SetFrontRightFlipperSelect(ModeWrapper::FLIPPER_SELECT_OFF);
+		SetFrontLeftFlipperSelect(ModeWrapper::FLIPPER_SELECT_OFF);
+		SetBackRightFlipperSelect(ModeWrapper::FLIPPER_SELECT_OFF);
+		SetBackLeftFlipperSelect(ModeWrapper::FLIPPER_SELECT_OFF);
+		SetFlipperStatus(ModeWrapper::FLIPPER_STATUS_STAY);
+		SetCrawlerPoseClear(ModeWrapper::CRAWLER_POSE_CLEAR_OFF);
+	}
 
 	/*!
 	 * 速度レベルを取得する
 	 * @method GetSpeedLevel
 	 * @return 操作モードの種類
 	 */
-	int32_t GetSpeedLevel(void);
+	int32_t GetSpeedLevel(void) const
+	{
+		return m_Port.data.speed_level;
+	}
 
 	/*!
 	 * 速度レベルを設定する
@@ -152,14 +168,20 @@ public:
 	 * @param  iValue   速度レベルの種類
 	 * @return なし
 	 */
-	void SetSpeedLevel(const int32_t iValue);
+	void SetSpeedLevel(const int32_t iValue)
+	{
+		m_Port.data.speed_level = iValue;
+	}
 
 	/*!
 	 * 最大速度フラグを取得する
 	 * @method GetSpeedMax
 	 * @return 最大速度フラグの種類
 	 */
-	int32_t GetSpeedMax(void);
+	int32_t GetSpeedMax(void) const
+	{
+		return m_Port.data.speed_max;
+	}
 
 	/*!
 	 * 最大速度フラグを設定する
@@ -167,14 +189,20 @@ public:
 	 * @param  iValue   最大速度フラグの種類
 	 * @return なし
 	 */
-	void SetSpeedMax(const int32_t iValue);
+	void SetSpeedMax(const int32_t iValue)
+	{
+		m_Port.data.speed_max = iValue;
+	}
 
 	/*!
 	 * 操作モードを取得する
 	 * @method GetControl
 	 * @return 操作モードの種類
 	 */
-	int32_t GetControl(void);
+	int32_t GetControl(void) const
+	{
+		return m_Port.data.control;
+	}
 
 	/*!
 	 * 操作モードを設定する
@@ -182,14 +210,20 @@ public:
 	 * @param  iValue   操作モードの種類
 	 * @return なし
 	 */
-	void SetControl(const int32_t iValue);
+	void SetControl(const int32_t iValue)
+	{
+		m_Port.data.control = iValue;
+	}
 
 	/*!
 	 * 右前方フリッパーの選択状態を取得する
 	 * @method GetFrontRightFlipperSelect
 	 * @return フリッパーの選択状態の種類
 	 */
-	int32_t GetFrontRightFlipperSelect(void);
+	int32_t GetFrontRightFlipperSelect(void) const
+	{
+		return ((m_Port.data.flipper_select >> FLIPPER_SELECT_DATA_BIT_POS_FR) & 1);
+	}
 
 	/*!
 	 * 右前方フリッパーの選択状態を設定する
@@ -197,14 +231,27 @@ public:
 	 * @param  iValue   フリッパーの選択状態の種類
 	 * @return なし
 	 */
-	void SetFrontRightFlipperSelect(const int32_t iValue);
+	void SetFrontRightFlipperSelect(const int32_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data.flipper_select |= (1 << FLIPPER_SELECT_DATA_BIT_POS_FR);
+		}
+		else
+		{
+			m_Port.data.flipper_select &= ~(1 << FLIPPER_SELECT_DATA_BIT_POS_FR);
+		}
+	}
 
 	/*!
 	 * 左前方フリッパーの選択状態を取得する
 	 * @method GetFrontLeftFlipperSelect
 	 * @return フリッパーの選択状態の種類
 	 */
-	int32_t GetFrontLeftFlipperSelect(void);
+	int32_t GetFrontLeftFlipperSelect(void) const
+	{
+		return ((m_Port.data.flipper_select >> FLIPPER_SELECT_DATA_BIT_POS_FL) & 1);
+	}
 
 	/*!
 	 * 左前方フリッパーの選択状態を設定する
@@ -212,14 +259,27 @@ public:
 	 * @param  iValue   フリッパーの選択状態の種類
 	 * @return なし
 	 */
-	void SetFrontLeftFlipperSelect(const int32_t iValue);
+	void SetFrontLeftFlipperSelect(const int32_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data.flipper_select |= (1 << FLIPPER_SELECT_DATA_BIT_POS_FL);
+		}
+		else
+		{
+			m_Port.data.flipper_select &= ~(1 << FLIPPER_SELECT_DATA_BIT_POS_FL);
+		}
+	}
 
 	/*!
 	 * 右後方フリッパーの選択状態を取得する
 	 * @method GetFrontRightFlipperSelect
 	 * @return フリッパーの選択状態の種類
 	 */
-	int32_t GetBackRightFlipperSelect(void);
+	int32_t GetBackRightFlipperSelect(void) const
+	{
+		return ((m_Port.data.flipper_select >> FLIPPER_SELECT_DATA_BIT_POS_BR) & 1);
+	}
 
 	/*!
 	 * 右後方フリッパーの選択状態を設定する
@@ -227,14 +287,27 @@ public:
 	 * @param  iValue   フリッパーの選択状態の種類
 	 * @return なし
 	 */
-	void SetBackRightFlipperSelect(const int32_t iValue);
+	void SetBackRightFlipperSelect(const int32_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data.flipper_select |= (1 << FLIPPER_SELECT_DATA_BIT_POS_BR);
+		}
+		else
+		{
+			m_Port.data.flipper_select &= ~(1 << FLIPPER_SELECT_DATA_BIT_POS_BR);
+		}
+	}
 
 	/*!
 	 * 左後方フリッパーの選択状態を取得する
 	 * @method GetBackLeftFlipperSelect
 	 * @return フリッパーの選択状態の種類
 	 */
-	int32_t GetBackLeftFlipperSelect(void);
+	int32_t GetBackLeftFlipperSelect(void) const
+	{
+		return ((m_Port.data.flipper_select >> FLIPPER_SELECT_DATA_BIT_POS_BL) & 1);
+	}
 
 	/*!
 	 * 左後方フリッパーの選択状態を設定する
@@ -242,14 +315,27 @@ public:
 	 * @param  iValue   フリッパーの選択状態の種類
 	 * @return なし
 	 */
-	void SetBackLeftFlipperSelect(const int32_t iValue);
+	void SetBackLeftFlipperSelect(const int32_t iValue)
+	{
+		if(iValue)
+		{
+			m_Port.data.flipper_select |= (1 << FLIPPER_SELECT_DATA_BIT_POS_BL);
+		}
+		else
+		{
+			m_Port.data.flipper_select &= ~(1 << FLIPPER_SELECT_DATA_BIT_POS_BL);
+		}
+	}
 
 	/*!
 	 * フリッパーの動作状態を取得する
 	 * @method GetBackLeftFlipperSelect
 	 * @return フリッパーの動作状態の種類
 	 */
-	int32_t GetFlipperStatus(void);
+	int32_t GetFlipperStatus(void) const
+	{
+		return m_Port.data.flipper_status;
+	}
 
 	/*!
 	 * フリッパーの動作状態を設定する
@@ -257,14 +343,20 @@ public:
 	 * @param  iValue   フリッパーの動作状態の種類
 	 * @return なし
 	 */
-	void SetFlipperStatus(const int32_t iValue);
+	void SetFlipperStatus(const int32_t iValue)
+	{
+		m_Port.data.flipper_status = iValue;
+	}
 
 	/*!
 	 * 台車の位置姿勢のクリアを取得する
 	 * @method GetCrawlerPoseClear
 	 * @return 台車の位置姿勢のクリアの種類
 	 */
-	int32_t GetCrawlerPoseClear(void);
+	int32_t GetCrawlerPoseClear(void) const
+	{
+		return m_Port.data.crawler_pose_clear;
+	}
 
 	/*!
 	 * 台車の位置姿勢のクリアを設定する
@@ -272,10 +364,24 @@ public:
 	 * @param  iValue   台車の位置姿勢のクリアの種類
 	 * @return なし
 	 */
-	void SetCrawlerPoseClear(const int32_t iValue);
+	void SetCrawlerPoseClear(const int32_t iValue)
+	{
+		m_Port.data.crawler_pose_clear = iValue;
+	}
 
 private:
-	RTC::TimedLongSeq& m_Port;	/*!< ラッピングする変数の参照変数	*/
+	/*!
+	 * @enum 列挙子
+	 * フリッパーの選択状態データのビット位置
+	 */
+	enum FLIPPER_SELECT_DATA_BIT_POS_t
+	{
+		FLIPPER_SELECT_DATA_BIT_POS_FR,		/*!< 右前方フリッパー	*/
+		FLIPPER_SELECT_DATA_BIT_POS_FL,		/*!< 左前方フリッパー	*/
+		FLIPPER_SELECT_DATA_BIT_POS_BR,		/*!< 右後方フリッパー	*/
+		FLIPPER_SELECT_DATA_BIT_POS_BL,		/*!< 左後方フリッパー	*/
+		FLIPPER_SELECT_DATA_BIT_POS_NUM,	/*!< データのビットの数	*/
+	};
 };
 
 #endif//MODE_WRAPPER_H
@@ -0,0 +1,211 @@
+/*!
+ * @file MotorLoadWrapper.h
+ * @brief モータの負荷入出力のラッパークラス
+ * @author C.Saito
+ * @date 2019/06/19
+ */
+
+#ifndef MOTOR_LOAD_WRAPPER_H
+#define MOTOR_LOAD_WRAPPER_H
+
+#include <rtm/idl/BasicDataTypeSkel.h>
+#include <rtm/idl/ExtendedDataTypesSkel.h>
+#include <rtm/idl/InterfaceDataTypesSkel.h>
+#include "Spider2020Skel.h"
+
+#include <rtm/DataInPort.h>
+#include <rtm/DataOutPort.h>
+
+#include "PortView.h"
+
+#include <cstdint>
+
+/*!
+ * @brief モータの負荷入出力のラッパークラス
+ * @details 次のSpider2020::TimedMotorLoadで提供するデータの操作APIを提供する
+ *          main_r: 右メインモータの負荷
+ *          main_l: 左メインモータの負荷
+ *          sub_fr: 右前方サブモータの負荷
+ *          sub_fl: 左前方サブモータの負荷
+ *          sub_br: 右後方サブモータの負荷
+ *          sub_bl: 左後方サブモータの負荷
+ */
+class MotorLoadWrapper : public PortView<MotorLoadWrapper, Spider2020::TimedMotorLoad, CORBA::Double, 6>
+{
+public:
+	/*!
+	 * コンストラクタ
+	 * @method MotorLoadWrapper
+	 * @param  Port   ラッピングする変数
+	 */
+	MotorLoadWrapper(Spider2020::TimedMotorLoad& Port)
+		: PortView(Port)
+	{
+	}
+
+	/*!
+	 * 従来の配列の位置のメンバを取得する
+	 * @method Field
+	 * @param  uIndex 従来の配列の位置
+	 * @return メンバへのポインタ
+	 */
+	static Field_t Field(const uint8_t uIndex)
+	{
+		static constexpr Field_t s_Field[] =
+		{
+			&Data_t::main_r,	/*!< 右メインモータ		*/
+			&Data_t::main_l,	/*!< 左メインモータ		*/
+			&Data_t::sub_fr,	/*!< 右前方サブモータ	*/
+			&Data_t::sub_fl,	/*!< 左前方サブモータ	*/
+			&Data_t::sub_br,	/*!< 右後方サブモータ	*/
+			&Data_t::sub_bl,	/*!< 左後方サブモータ	*/
+		};
+		static_assert(sizeof(s_Field) / sizeof(s_Field[0]) == GetNumber(), "field table does not match the data type");
+
+		return s_Field[uIndex];
+	}
+
+	/*!
+	 * モータの負荷の入出力の配列数と値を初期化する
+	 * @method InitData
+	 * @return なし
+	 */
+	void InitData(void)
+	{
+		// モータの負荷の入出力の値を初期化する
+		SetRightMotorLoad(0.0);
+		SetLeftMotorLoad(0.0);
+		SetFrontRightMotorLoad(0.0);
+		SetFrontLeftMotorLoad(0.0);
+		SetBackRightMotorLoad(0.0);
+		SetBackLeftMotorLoad(0.0);
+	}
+
+	/*!
+	 * 右メインモータの負荷を取得する
+	 * @method GetRightMotorLoad
+	 * @return モータの負荷
+	 */
+	double GetRightMotorLoad(void) const
+	{
+		return m_Port.data.main_r;
+	}
+
+	/*!
+	 * 右メインモータの負荷を設定する
+	 * @method SetRightMotorLoad
+	 * @param  dValue   モータの負荷
+	 * @return なし
+	 */
+	void SetRightMotorLoad(const double dValue)
+	{
+		m_Port.data.main_r = dValue;
+	}
+
+	/*!
+	 * 左メインモータの負荷を取得する
+	 * @method GetLeftMotorLoad
+	 * @return モータの負荷
+	 */
+	double GetLeftMotorLoad(void) const
+	{
+		return m_Port.data.main_l;
+	}
+
+	/*!
+	 * 左メインモータの負荷を設定する
+	 * @method SetLeftMotorLoad
+	 * @param  dValue   モータの負荷
+	 * @return なし
+	 */
+	void SetLeftMotorLoad(const double dValue)
+	{
+		m_Port.data.main_l = dValue;
+	}
+
+	/*!
+	 * 右前方サブモータの負荷を取得する
+	 * @method GetFrontRightMotorLoad
+	 * @return モータの負荷
+	 */
+	double GetFrontRightMotorLoad(void) const
+	{
+		return m_Port.data.sub_fr;
+	}
+
+	/*!
+	 * 右前方サブモータの負荷を設定する
+	 * @method SetFrontRightMotorLoad
+	 * @param  dValue   モータの負荷
+	 * @return なし
+	 */
+	void SetFrontRightMotorLoad(const double dValue)
+	{
+		m_Port.data.sub_fr = dValue;
+	}
+
+	/*!
+	 * 左前方サブモータの負荷を取得する
+	 * @method GetFrontLeftMotorLoad
+	 * @return モータの負荷
+	 */
+	double GetFrontLeftMotorLoad(void) const
+	{
+		return m_Port.data.sub_fl;
+	}
+
+	/*!
+	 * 左前方サブモータの負荷を設定する
+	 * @method SetFrontLeftMotorLoad
+	 * @param  dValue   モータの負荷
+	 * @return なし
+	 */
+	void SetFrontLeftMotorLoad(const double dValue)
+	{
+		m_Port.data.sub_fl = dValue;
+	}
+
+	/*!
+	 * 右後方サブモータの負荷を取得する
+	 * @method GetBackRightMotorLoad
+	 * @return モータの負荷
+	 */
+	double GetBackRightMotorLoad(void) const
+	{
+		return m_Port.data.sub_br;
+	}
+
+	/*!
+	 * 右後方サブモータの負荷を設定する
+	 * @method SetBackRightMotorLoad
+	 * @param  dValue   モータの負荷
+	 * @return なし
+	 */
+	void SetBackRightMotorLoad(const double dValue)
+	{
+		m_Port.data.sub_br = dValue;
+	}
+
+	/*!
+	 * 左後方サブモータの負荷を取得する
+	 * @method GetBackLeftMotorLoad
+	 * @return モータの負荷
+	 */
+	double GetBackLeftMotorLoad(void) const
+	{
+		return m_Port.data.sub_bl;
+	}
+
+	/*!
+	 * 左後方サブモータの負荷を設定する
+	 * @method SetBackLeftMotorLoad
+	 * @param  dValue   モータの負荷
+	 * @return なし
+	 */
+	void SetBackLeftMotorLoad(const double dValue)
+	{
+		m_Port.data.sub_bl = dValue;
+	}
+};
+
+#endif//MOTOR_LOAD_WRAPPER_H
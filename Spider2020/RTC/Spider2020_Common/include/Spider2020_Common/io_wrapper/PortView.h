@@ -0,0 +1,106 @@
+// -*- C++ -*-
+/*!
+ * @file PortView.h
+ * @brief 固定長のデータ型の入出力のラッパークラスの基底クラス
+ * @date 2026/10/19
+ */
+
+#ifndef PORT_VIEW_H
+#define PORT_VIEW_H
+
+#include <rtm/DataInPort.h>
+#include <rtm/DataOutPort.h>
+
+#include <cstdint>
+
+/*!
+ * @brief 固定長のデータ型の入出力のラッパークラスの基底クラス
+ * @details Spider2020.idlの固定長のデータ型(Timed～)の変数を参照し、
+ *          タイムスタンプの設定と、従来の配列の位置によるメンバの読み書きを
+ *          提供する。派生クラスは従来の配列の並びのメンバへのポインタの表を
+ *          静的メンバ関数Fieldで提供する。
+ *          全てのメンバはヘッダー内で定義し、インライン展開される。
+ *          メンバの数とデータ型の大きさが一致しない(表の漏れ、データ型の変更)
+ *          場合はコンパイルエラーとする。
+ * @tparam  Derived   派生クラス
+ * @tparam  TimedType ラッピングするデータ型(Spider2020::Timed～)
+ * @tparam  ValueType メンバの型
+ * @tparam  NUM       メンバの数
+ */
+template <class Derived, class TimedType, class ValueType, uint8_t NUM>
+class PortView
+{
+public:
+	typedef decltype(TimedType::data) Data_t;	/*!< データ部の型					*/
+	typedef ValueType Data_t::*Field_t;			/*!< データ部のメンバへのポインタ	*/
+
+	static_assert(sizeof(Data_t) == sizeof(ValueType)*NUM, "field table does not match the data type layout");
+
+	/*!
+	 * コンストラクタ
+	 * @method PortView
+	 * @param  Port   ラッピングする変数
+	 */
+	explicit PortView(TimedType& Port)
+		: m_Port(Port)
+	{
+	}
+
+	/*!
+	 * 代入演算子のオーバーロード(ラッピングする変数の値を複写する)
+	 * @method operator=
+	 */
+	PortView& operator=(const PortView& rhs)
+	{
+		m_Port = rhs.m_Port;
+		return *this;
+	}
+
+	/*!
+	 * タイムスタンプを設定する
+	 * @method SetTimestamp
+	 * @return なし
+	 */
+	void SetTimestamp(void)
+	{
+		setTimestamp(m_Port);
+	}
+
+	/*!
+	 * データの数を取得する
+	 * @method GetNumber
+	 * @return データの数
+	 */
+	static constexpr uint8_t GetNumber(void)
+	{
+		return NUM;
+	}
+
+	/*!
+	 * 従来の配列の位置でデータを取得する
+	 * @method GetValue
+	 * @param  uIndex 従来の配列の位置(GetNumber未満)
+	 * @return データ
+	 */
+	ValueType GetValue(const uint8_t uIndex) const
+	{
+		return m_Port.data.*Derived::Field(uIndex);
+	}
+
+	/*!
+	 * 従来の配列の位置でデータを設定する
+	 * @method SetValue
+	 * @param  uIndex 従来の配列の位置(GetNumber未満)
+	 * @param  Value  データ
+	 * @return なし
+	 */
+	void SetValue(const uint8_t uIndex, const ValueType Value)
+	{
+		m_Port.data.*Derived::Field(uIndex) = Value;
+	}
+
+protected:
+	TimedType& m_Port;	/*!< ラッピングする変数の参照変数	*/
+};
+
+#endif//PORT_VIEW_H
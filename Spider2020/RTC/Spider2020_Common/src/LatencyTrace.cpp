@@ -0,0 +1,198 @@
+#include "LatencyTrace.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define TRACE_MAGIC			0x53505452		/*!< 初期化済みの識別子("SPTR")			*/
+#define TRACE_OPEN_RETRY	100				/*!< 作成側の初期化を待つ回数			*/
+#define TRACE_OPEN_WAIT		1000			/*!< 作成側の初期化を待つ間隔 [us]		*/
+
+LatencyTrace::LatencyTrace()
+	: m_pBuffer(NULL)
+{
+}
+
+LatencyTrace::~LatencyTrace()
+{
+	Close();
+}
+
+bool LatencyTrace::Open(void)
+{
+	struct stat stStat;
+	void *pMap;
+	bool bCreated = true;
+	int iFd, i;
+
+	if(IsOpen())
+	{
+		return true;
+	}
+
+	// 共有メモリを作成する(作成済みならば開く)
+	iFd = shm_open(TRACE_SHM_NAME, O_RDWR | O_CREAT | O_EXCL, 0666);
+	if((iFd < 0) && (errno == EEXIST))
+	{
+		bCreated = false;
+		iFd = shm_open(TRACE_SHM_NAME, O_RDWR, 0666);
+	}
+	if(iFd < 0)
+	{
+		printf("shm_open(%s) is failed: %s\n", TRACE_SHM_NAME, strerror(errno));
+		return false;
+	}
+
+	// 作成した場合はサイズを確保し、他のユーザーからも書き込めるようにする
+	if(bCreated)
+	{
+		fchmod(iFd, 0666);
+		if(ftruncate(iFd, sizeof(BUFFER_t)) != 0)
+		{
+			printf("ftruncate(%s) is failed: %s\n", TRACE_SHM_NAME, strerror(errno));
+			close(iFd);
+			shm_unlink(TRACE_SHM_NAME);
+			return false;
+		}
+	}
+	else
+	{
+		// 作成側がサイズを確保するまで待つ
+		for(i = 0; i < TRACE_OPEN_RETRY; i++)
+		{
+			if((fstat(iFd, &stStat) == 0) && (sizeof(BUFFER_t) <= (size_t)stStat.st_size))
+			{
+				break;
+			}
+			usleep(TRACE_OPEN_WAIT);
+		}
+		if(TRACE_OPEN_RETRY <= i)
+		{
+			printf("%s has invalid size\n", TRACE_SHM_NAME);
+			close(iFd);
+			return false;
+		}
+	}
+
+	pMap = mmap(NULL, sizeof(BUFFER_t), PROT_READ | PROT_WRITE, MAP_SHARED, iFd, 0);
+	close(iFd);
+	if(pMap == MAP_FAILED)
+	{
+		printf("mmap(%s) is failed: %s\n", TRACE_SHM_NAME, strerror(errno));
+		return false;
+	}
+	m_pBuffer = static_cast<BUFFER_t*>(pMap);
+
+	// 作成した場合は初期化する(ftruncateで０に初期化されている)
+	if(bCreated)
+	{
+		m_pBuffer->uCapacity = TRACE_CAPACITY;
+		m_pBuffer->uMagic.store(TRACE_MAGIC, std::memory_order_release);
+		return true;
+	}
+
+	// 作成側の初期化を待ち、配置が一致するか確認する
+	for(i = 0; i < TRACE_OPEN_RETRY; i++)
+	{
+		if(m_pBuffer->uMagic.load(std::memory_order_acquire) == TRACE_MAGIC)
+		{
+			break;
+		}
+		usleep(TRACE_OPEN_WAIT);
+	}
+	if((TRACE_OPEN_RETRY <= i) || (m_pBuffer->uCapacity != TRACE_CAPACITY))
+	{
+		printf("%s is not initialized or has different layout\n", TRACE_SHM_NAME);
+		Close();
+		return false;
+	}
+	return true;
+}
+
+void LatencyTrace::Close(void)
+{
+	if(m_pBuffer != NULL)
+	{
+		munmap(m_pBuffer, sizeof(BUFFER_t));
+		m_pBuffer = NULL;
+	}
+}
+
+bool LatencyTrace::IsOpen(void) const
+{
+	return (m_pBuffer != NULL);
+}
+
+void LatencyTrace::Record(TRACE_POINT_t ePoint, int64_t iOriginNs, uint32_t uSeq)
+{
+	if(!IsOpen())
+	{
+		return;
+	}
+	RecordAt(ePoint, iOriginNs, GetTimeNs(), uSeq);
+}
+
+void LatencyTrace::RecordAt(TRACE_POINT_t ePoint, int64_t iOriginNs, int64_t iTimeNs, uint32_t uSeq)
+{
+	uint64_t uIndex;
+
+	if(!IsOpen())
+	{
+		return;
+	}
+
+	// 書き込む位置を確保する
+	uIndex = m_pBuffer->uHead.fetch_add(1, std::memory_order_relaxed);
+	SLOT_t &stSlot = m_pBuffer->stSlot[uIndex%TRACE_CAPACITY];
+
+	// 書き込み中にしてから記録を書き込み、確定する
+	stSlot.uCommit.store(uIndex*2 + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	stSlot.stEvent.iOriginNs = iOriginNs;
+	stSlot.stEvent.iTimeNs = iTimeNs;
+	stSlot.stEvent.uPoint = (uint32_t)ePoint;
+	stSlot.stEvent.uSeq = uSeq;
+	stSlot.uCommit.store(uIndex*2 + 2, std::memory_order_release);
+}
+
+uint64_t LatencyTrace::GetHead(void) const
+{
+	if(!IsOpen())
+	{
+		return 0;
+	}
+	return m_pBuffer->uHead.load(std::memory_order_acquire);
+}
+
+bool LatencyTrace::Read(uint64_t uIndex, TRACE_EVENT_t &stEvent) const
+{
+	uint64_t uCommit;
+
+	if(!IsOpen())
+	{
+		return false;
+	}
+	const SLOT_t &stSlot = m_pBuffer->stSlot[uIndex%TRACE_CAPACITY];
+
+	// 確定済みの記録を複写し、複写中に上書きされていないか確認する
+	uCommit = stSlot.uCommit.load(std::memory_order_acquire);
+	if(uCommit != uIndex*2 + 2)
+	{
+		return false;
+	}
+	stEvent = stSlot.stEvent;
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return (stSlot.uCommit.load(std::memory_order_relaxed) == uCommit);
+}
+
+int64_t LatencyTrace::GetTimeNs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return (int64_t)ts.tv_sec*1000000000LL + (int64_t)ts.tv_nsec;
+}
@@ -0,0 +1,181 @@
+#include "MetricsRegistry.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define METRICS_MAGIC		0x5350544D		/*!< 初期化済みの識別子("SPTM")			*/
+
+MetricsRegistry& MetricsRegistry::Instance(void)
+{
+	static MetricsRegistry s_Registry;
+
+	return s_Registry;
+}
+
+MetricsRegistry::MetricsRegistry()
+	: m_pSegment(NULL)
+	, m_bOpenFailed(false)
+{
+	// 同じプロセスに読み込まれた別の共有ライブラリの登録先と区別するため、アドレスを付加する
+	snprintf(m_szShmName, sizeof(m_szShmName), "%s%d.%lx", METRICS_SHM_PREFIX, (int)getpid(), (unsigned long)(uintptr_t)this);
+}
+
+MetricsRegistry::~MetricsRegistry()
+{
+	// 閲覧側に残らないよう共有メモリを削除する
+	// (終了中の他のスレッドが更新する可能性があるため、マップは解除しない)
+	if(m_pSegment != NULL)
+	{
+		shm_unlink(m_szShmName);
+	}
+}
+
+bool MetricsRegistry::Open(void)
+{
+	struct timespec ts;
+	void *pMap;
+	FILE *fp;
+	int iFd;
+
+	// 以前のプロセスの共有メモリが残っていれば作り直す
+	shm_unlink(m_szShmName);
+	iFd = shm_open(m_szShmName, O_RDWR | O_CREAT | O_EXCL, 0644);
+	if(iFd < 0)
+	{
+		printf("shm_open(%s) is failed: %s\n", m_szShmName, strerror(errno));
+		return false;
+	}
+	if(ftruncate(iFd, sizeof(METRICS_SEGMENT_t)) != 0)
+	{
+		printf("ftruncate(%s) is failed: %s\n", m_szShmName, strerror(errno));
+		close(iFd);
+		shm_unlink(m_szShmName);
+		return false;
+	}
+	pMap = mmap(NULL, sizeof(METRICS_SEGMENT_t), PROT_READ | PROT_WRITE, MAP_SHARED, iFd, 0);
+	close(iFd);
+	if(pMap == MAP_FAILED)
+	{
+		printf("mmap(%s) is failed: %s\n", m_szShmName, strerror(errno));
+		shm_unlink(m_szShmName);
+		return false;
+	}
+	m_pSegment = static_cast<METRICS_SEGMENT_t*>(pMap);
+
+	// 初期化する(ftruncateで０に初期化されている)
+	m_pSegment->uCapacity = METRICS_CAPACITY;
+	m_pSegment->uBucketNum = METRICS_BUCKET_NUM;
+	m_pSegment->iPid = (int32_t)getpid();
+	fp = fopen("/proc/self/comm", "r");
+	if(fp != NULL)
+	{
+		if(fgets(m_pSegment->szProcess, sizeof(m_pSegment->szProcess), fp) != NULL)
+		{
+			m_pSegment->szProcess[strcspn(m_pSegment->szProcess, "\n")] = '\0';
+		}
+		fclose(fp);
+	}
+	clock_gettime(CLOCK_REALTIME, &ts);
+	m_pSegment->iStartNs = (int64_t)ts.tv_sec*1000000000LL + (int64_t)ts.tv_nsec;
+	m_pSegment->uMagic.store(METRICS_MAGIC, std::memory_order_release);
+
+	return true;
+}
+
+METRIC_SLOT_t* MetricsRegistry::Register(const char *pName, METRIC_TYPE_t eType)
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	uint32_t uCount = 0;
+
+	// 初回の登録時に共有メモリを作成する(失敗した場合は再試行しない)
+	if((m_pSegment == NULL) && (m_bOpenFailed || !Open()))
+	{
+		m_bOpenFailed = true;
+		return NULL;
+	}
+
+	// 登録済みならばそれを返す
+	uCount = m_pSegment->uCount.load(std::memory_order_relaxed);
+	for(uint32_t i = 0; i < uCount; i++)
+	{
+		METRIC_SLOT_t &stSlot = m_pSegment->stSlot[i];
+		if(strncmp(stSlot.szName, pName, METRICS_NAME_LEN) == 0)
+		{
+			if(stSlot.uType.load(std::memory_order_relaxed) != (uint32_t)eType)
+			{
+				printf("metric %s is already registered as another type\n", pName);
+				return NULL;
+			}
+			return &stSlot;
+		}
+	}
+	if(METRICS_CAPACITY <= uCount)
+	{
+		printf("metric %s is not registered: too many metrics\n", pName);
+		return NULL;
+	}
+
+	// 名前を書き込んでから種類と登録数を公開する
+	METRIC_SLOT_t &stSlot = m_pSegment->stSlot[uCount];
+	strncpy(stSlot.szName, pName, METRICS_NAME_LEN - 1);
+	stSlot.uType.store((uint32_t)eType, std::memory_order_release);
+	m_pSegment->uCount.store(uCount + 1, std::memory_order_release);
+
+	return &stSlot;
+}
+
+const METRICS_SEGMENT_t* MetricsRegistry::Map(const char *pShmName)
+{
+	struct stat stStat;
+	void *pMap;
+	int iFd;
+
+	iFd = shm_open(pShmName, O_RDONLY, 0);
+	if(iFd < 0)
+	{
+		return NULL;
+	}
+
+	// 配置が一致しない(作成中または別の版)ならば開かない
+	if((fstat(iFd, &stStat) != 0) || ((size_t)stStat.st_size != sizeof(METRICS_SEGMENT_t)))
+	{
+		close(iFd);
+		return NULL;
+	}
+	pMap = mmap(NULL, sizeof(METRICS_SEGMENT_t), PROT_READ, MAP_SHARED, iFd, 0);
+	close(iFd);
+	if(pMap == MAP_FAILED)
+	{
+		return NULL;
+	}
+
+	const METRICS_SEGMENT_t *pSegment = static_cast<const METRICS_SEGMENT_t*>(pMap);
+	if((pSegment->uMagic.load(std::memory_order_acquire) != METRICS_MAGIC) || (pSegment->uCapacity != METRICS_CAPACITY) || (pSegment->uBucketNum != METRICS_BUCKET_NUM))
+	{
+		munmap(pMap, sizeof(METRICS_SEGMENT_t));
+		return NULL;
+	}
+
+	return pSegment;
+}
+
+void MetricsRegistry::Unmap(const METRICS_SEGMENT_t *pSegment)
+{
+	if(pSegment != NULL)
+	{
+		munmap(const_cast<METRICS_SEGMENT_t*>(pSegment), sizeof(METRICS_SEGMENT_t));
+	}
+}
+
+int64_t MetricsRegistry::GetTimeNs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec*1000000000LL + (int64_t)ts.tv_nsec;
+}
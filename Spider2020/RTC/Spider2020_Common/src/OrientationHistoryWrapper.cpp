@@ -0,0 +1,96 @@
+#include "OrientationHistoryWrapper.h"
+
+/*!
+ * @enum 列挙子
+ * サンプル内のデータのインデクサ
+ */
+enum DATA_INDEX_t
+{
+	DATA_INDEX_TIME,	/*!< 時刻				*/
+	DATA_INDEX_ROLL,	/*!< ロール角			*/
+	DATA_INDEX_PITCH,	/*!< ピッチ角			*/
+	DATA_INDEX_YAW,		/*!< ヨー角				*/
+	DATA_INDEX_NUM,		/*!< サンプルのデータの数	*/
+};
+
+OrientationHistoryWrapper::OrientationHistoryWrapper(RTC::TimedDoubleSeq& Port)
+	: m_Port(Port)
+{
+}
+
+OrientationHistoryWrapper::~OrientationHistoryWrapper()
+{
+}
+
+OrientationHistoryWrapper& OrientationHistoryWrapper::operator=(const OrientationHistoryWrapper& rhs)
+{
+	m_Port = rhs.m_Port;
+	return *this;
+};
+
+void OrientationHistoryWrapper::SetTimestamp(void)
+{
+	// タイムスタンプを設定する
+	setTimestamp(m_Port);
+}
+
+void OrientationHistoryWrapper::InitData(void)
+{
+	// 姿勢の履歴の入出力の配列数を初期化する
+	m_Port.data.length(0);
+}
+
+uint32_t OrientationHistoryWrapper::GetNumber(void)
+{
+	return m_Port.data.length()/DATA_INDEX_NUM;
+}
+
+void OrientationHistoryWrapper::SetNumber(const uint32_t uNumber)
+{
+	m_Port.data.length(uNumber*DATA_INDEX_NUM);
+}
+
+double OrientationHistoryWrapper::GetTime(const uint32_t uIndex)
+{
+	return GetValue(uIndex, DATA_INDEX_TIME);
+}
+
+double OrientationHistoryWrapper::GetRoll(const uint32_t uIndex)
+{
+	return GetValue(uIndex, DATA_INDEX_ROLL);
+}
+
+double OrientationHistoryWrapper::GetPitch(const uint32_t uIndex)
+{
+	return GetValue(uIndex, DATA_INDEX_PITCH);
+}
+
+double OrientationHistoryWrapper::GetYaw(const uint32_t uIndex)
+{
+	return GetValue(uIndex, DATA_INDEX_YAW);
+}
+
+void OrientationHistoryWrapper::SetSample(const uint32_t uIndex, const double dTime, const double dRoll, const double dPitch, const double dYaw)
+{
+	// 範囲外の番号なら設定しない
+	if(GetNumber() <= uIndex)
+	{
+		return;
+	}
+
+	m_Port.data[uIndex*DATA_INDEX_NUM + DATA_INDEX_TIME] = dTime;
+	m_Port.data[uIndex*DATA_INDEX_NUM + DATA_INDEX_ROLL] = dRoll;
+	m_Port.data[uIndex*DATA_INDEX_NUM + DATA_INDEX_PITCH] = dPitch;
+	m_Port.data[uIndex*DATA_INDEX_NUM + DATA_INDEX_YAW] = dYaw;
+}
+
+double OrientationHistoryWrapper::GetValue(const uint32_t uIndex, const uint32_t uOffset)
+{
+	// 範囲外の番号なら初期値を返す
+	if(GetNumber() <= uIndex)
+	{
+		return 0;
+	}
+
+	return m_Port.data[uIndex*DATA_INDEX_NUM + uOffset];
+}
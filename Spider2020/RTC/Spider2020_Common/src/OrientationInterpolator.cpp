@@ -0,0 +1,140 @@
+#include "OrientationInterpolator.h"
+#include <math.h>
+#include <Eigen/Geometry>
+
+OrientationInterpolator::OrientationInterpolator(size_t sizeCapacity)
+	: m_vecSample((0 < sizeCapacity) ? sizeCapacity : 1)
+	, m_sizeHead(0)
+	, m_sizeCount(0)
+{
+}
+
+OrientationInterpolator::~OrientationInterpolator()
+{
+}
+
+void OrientationInterpolator::Clear(void)
+{
+	m_sizeHead = 0;
+	m_sizeCount = 0;
+}
+
+bool OrientationInterpolator::Push(double dTime, double dRoll, double dPitch, double dYaw)
+{
+	Eigen::Quaterniond q;
+	SAMPLE_t &stSample = m_vecSample[m_sizeHead];
+
+	// 時刻が逆行するサンプルは破棄する
+	if((0 < m_sizeCount) && (dTime < GetLatestTime()))
+	{
+		return false;
+	}
+
+	// オイラー角から四元数を求める
+	q = Eigen::AngleAxisd(dYaw, Eigen::Vector3d::UnitZ())
+	  * Eigen::AngleAxisd(dPitch, Eigen::Vector3d::UnitY())
+	  * Eigen::AngleAxisd(dRoll, Eigen::Vector3d::UnitX());
+
+	// リングバッファに書き込む
+	stSample.dTime = dTime;
+	stSample.dQw = q.w();
+	stSample.dQx = q.x();
+	stSample.dQy = q.y();
+	stSample.dQz = q.z();
+	m_sizeHead = (m_sizeHead + 1) % m_vecSample.size();
+	if(m_sizeCount < m_vecSample.size())
+	{
+		m_sizeCount++;
+	}
+
+	return true;
+}
+
+bool OrientationInterpolator::Interpolate(double dTime, double &dRoll, double &dPitch, double &dYaw) const
+{
+	size_t sizeLow = 0;
+	size_t sizeHigh = 0;
+	size_t sizeMid = 0;
+	double dRatio = 0.0;
+	Eigen::Quaterniond q;
+
+	if(m_sizeCount == 0)
+	{
+		return false;
+	}
+
+	// 履歴の範囲外ならば端のサンプルを使用する
+	if(dTime <= At(0).dTime)
+	{
+		const SAMPLE_t &stSample = At(0);
+		q = Eigen::Quaterniond(stSample.dQw, stSample.dQx, stSample.dQy, stSample.dQz);
+	}
+	else if(At(m_sizeCount - 1).dTime <= dTime)
+	{
+		const SAMPLE_t &stSample = At(m_sizeCount - 1);
+		q = Eigen::Quaterniond(stSample.dQw, stSample.dQx, stSample.dQy, stSample.dQz);
+	}
+	else
+	{
+		// 指定時刻を挟む２つのサンプルを二分探索する
+		sizeLow = 0;
+		sizeHigh = m_sizeCount - 1;
+		while(1 < (sizeHigh - sizeLow))
+		{
+			sizeMid = (sizeLow + sizeHigh)/2;
+			if(At(sizeMid).dTime <= dTime)
+			{
+				sizeLow = sizeMid;
+			}
+			else
+			{
+				sizeHigh = sizeMid;
+			}
+		}
+
+		const SAMPLE_t &stLow = At(sizeLow);
+		const SAMPLE_t &stHigh = At(sizeHigh);
+
+		// 前後のサンプルを球面線形補間する
+		dRatio = (stHigh.dTime - stLow.dTime) > 0.0 ? (dTime - stLow.dTime)/(stHigh.dTime - stLow.dTime) : 0.0;
+		q = Eigen::Quaterniond(stLow.dQw, stLow.dQx, stLow.dQy, stLow.dQz)
+			.slerp(dRatio, Eigen::Quaterniond(stHigh.dQw, stHigh.dQx, stHigh.dQy, stHigh.dQz));
+	}
+
+	// 四元数からオイラー角を求める
+	dRoll = atan2(2.0*(q.w()*q.x() + q.y()*q.z()), 1.0 - 2.0*(q.x()*q.x() + q.y()*q.y()));
+	dPitch = asin(fmax(-1.0, fmin(1.0, 2.0*(q.w()*q.y() - q.z()*q.x()))));
+	dYaw = atan2(2.0*(q.w()*q.z() + q.x()*q.y()), 1.0 - 2.0*(q.y()*q.y() + q.z()*q.z()));
+
+	return true;
+}
+
+size_t OrientationInterpolator::GetNumber(void) const
+{
+	return m_sizeCount;
+}
+
+double OrientationInterpolator::GetOldestTime(void) const
+{
+	if(m_sizeCount == 0)
+	{
+		return 0.0;
+	}
+
+	return At(0).dTime;
+}
+
+double OrientationInterpolator::GetLatestTime(void) const
+{
+	if(m_sizeCount == 0)
+	{
+		return 0.0;
+	}
+
+	return At(m_sizeCount - 1).dTime;
+}
+
+const OrientationInterpolator::SAMPLE_t& OrientationInterpolator::At(size_t sizeIndex) const
+{
+	return m_vecSample[(m_sizeHead + m_vecSample.size() - m_sizeCount + sizeIndex) % m_vecSample.size()];
+}
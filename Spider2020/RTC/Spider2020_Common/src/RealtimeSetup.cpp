@@ -0,0 +1,194 @@
+#include "RealtimeSetup.h"
+#include <alloca.h>
+#include <errno.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+bool RealtimeSetup::SetupProcess(const coil::Properties &prop)
+{
+	std::string sLockMemory = prop.getProperty(REALTIME_KEY_MLOCKALL, "NO");
+	unsigned long ulPrefaultStack = strtoul(prop.getProperty(REALTIME_KEY_PREFAULT_STACK, "0").c_str(), NULL, 10);
+	unsigned long ulHeapReserve = strtoul(prop.getProperty(REALTIME_KEY_HEAP_RESERVE, "0").c_str(), NULL, 10);
+
+	return SetupProcess((sLockMemory == "YES") || (sLockMemory == "yes"), (size_t)ulPrefaultStack*1024, (size_t)ulHeapReserve*1024);
+}
+
+bool RealtimeSetup::SetupProcess(bool bLockMemory, size_t sizePrefaultStack, size_t sizeHeapReserve)
+{
+	struct rlimit stLimit = {0};
+	bool bRet = true;
+	char *pHeap = NULL;
+
+	if(bLockMemory)
+	{
+		// 現在及び今後確保する全てのメモリをロックする
+		if(mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+		{
+			getrlimit(RLIMIT_MEMLOCK, &stLimit);
+			printf("mlockall is failed: %s (CAP_IPC_LOCK or a larger 'ulimit -l' is required, current %lu KB)\n", strerror(errno), (unsigned long)(stLimit.rlim_cur/1024));
+			bRet = false;
+		}
+	}
+
+	if(0 < sizeHeapReserve)
+	{
+		// 解放したメモリをOSに返さず、大きな確保もヒープから行う(再確保でページフォールトしない)
+		mallopt(M_TRIM_THRESHOLD, -1);
+		mallopt(M_MMAP_MAX, 0);
+
+		// スレッド毎のアリーナを作らず、事前に確保したヒープを全スレッドで使用する
+		mallopt(M_ARENA_MAX, 1);
+
+		// ヒープを確保して書き込み、ページを割り当ててから解放する
+		pHeap = static_cast<char*>(malloc(sizeHeapReserve));
+		if(pHeap == NULL)
+		{
+			printf("heap reserve of %lu KB is failed (with mlockall, 'ulimit -l' must include it)\n", (unsigned long)(sizeHeapReserve/1024));
+			bRet = false;
+		}
+		else
+		{
+			for(size_t i = 0; i < sizeHeapReserve; i += (size_t)sysconf(_SC_PAGESIZE))
+			{
+				pHeap[i] = 0;
+			}
+			free(pHeap);
+		}
+	}
+
+	if(0 < sizePrefaultStack)
+	{
+		// メインスレッドのスタックを事前に確保する
+		PrefaultStack(sizePrefaultStack);
+	}
+
+	if(bLockMemory || (0 < sizeHeapReserve) || (0 < sizePrefaultStack))
+	{
+		printf("realtime: mlockall %s, stack %lu KB, heap %lu KB%s\n", bLockMemory ? "YES" : "NO", (unsigned long)(sizePrefaultStack/1024), (unsigned long)(sizeHeapReserve/1024), bRet ? "" : " (failed)");
+	}
+
+	return bRet;
+}
+
+bool RealtimeSetup::SetupThread(int iPriority, const std::string &sCpuList, const char *pRole)
+{
+	struct sched_param stParam = {0};
+	struct rlimit stLimit = {0};
+	cpu_set_t stCpuSet;
+	bool bRet = true;
+	int iRet = 0;
+
+	// スケジューリングを設定する
+	if((iPriority < 0) || (sched_get_priority_max(SCHED_FIFO) < iPriority))
+	{
+		printf("%s: invalid priority %d (0: SCHED_OTHER, 1-%d: SCHED_FIFO)\n", pRole, iPriority, sched_get_priority_max(SCHED_FIFO));
+		bRet = false;
+	}
+	else
+	{
+		stParam.sched_priority = iPriority;
+		iRet = pthread_setschedparam(pthread_self(), (0 < iPriority) ? SCHED_FIFO : SCHED_OTHER, &stParam);
+		if(iRet != 0)
+		{
+			getrlimit(RLIMIT_RTPRIO, &stLimit);
+			printf("%s: SCHED_FIFO priority %d is failed: %s (CAP_SYS_NICE or 'ulimit -r' >= %d is required, current %lu)\n", pRole, iPriority, strerror(iRet), iPriority, (unsigned long)stLimit.rlim_cur);
+			bRet = false;
+		}
+	}
+
+	// CPUアフィニティを設定する
+	if(!sCpuList.empty() && (sCpuList != REALTIME_CPU_ALL))
+	{
+		if(!ParseCpuList(sCpuList, stCpuSet))
+		{
+			printf("%s: invalid cpu list '%s'\n", pRole, sCpuList.c_str());
+			bRet = false;
+		}
+		else
+		{
+			iRet = pthread_setaffinity_np(pthread_self(), sizeof(stCpuSet), &stCpuSet);
+			if(iRet != 0)
+			{
+				printf("%s: cpu affinity '%s' is failed: %s\n", pRole, sCpuList.c_str(), strerror(iRet));
+				bRet = false;
+			}
+		}
+	}
+
+	if((0 < iPriority) || (!sCpuList.empty() && (sCpuList != REALTIME_CPU_ALL)))
+	{
+		printf("realtime: %s %s priority %d, cpu %s%s\n", pRole, (0 < iPriority) ? "SCHED_FIFO" : "SCHED_OTHER", iPriority, sCpuList.c_str(), bRet ? "" : " (failed)");
+	}
+
+	return bRet;
+}
+
+bool RealtimeSetup::ParseCpuList(const std::string &sCpuList, cpu_set_t &stCpuSet)
+{
+	const char *pPos = sCpuList.c_str();
+	char *pEnd = NULL;
+	unsigned long ulFirst = 0;
+	unsigned long ulLast = 0;
+
+	CPU_ZERO(&stCpuSet);
+	while(*pPos != '\0')
+	{
+		// 先頭のCPU番号を読み込む
+		ulFirst = strtoul(pPos, &pEnd, 10);
+		if(pEnd == pPos)
+		{
+			return false;
+		}
+		ulLast = ulFirst;
+		pPos = pEnd;
+
+		// 範囲指定ならば末尾のCPU番号を読み込む
+		if(*pPos == '-')
+		{
+			pPos++;
+			ulLast = strtoul(pPos, &pEnd, 10);
+			if((pEnd == pPos) || (ulLast < ulFirst))
+			{
+				return false;
+			}
+			pPos = pEnd;
+		}
+		if(CPU_SETSIZE <= ulLast)
+		{
+			return false;
+		}
+		for(unsigned long i = ulFirst; i <= ulLast; i++)
+		{
+			CPU_SET(i, &stCpuSet);
+		}
+
+		// 区切りを読み飛ばす
+		if(*pPos == ',')
+		{
+			pPos++;
+		}
+		else if(*pPos != '\0')
+		{
+			return false;
+		}
+	}
+
+	return (0 < CPU_COUNT(&stCpuSet));
+}
+
+void RealtimeSetup::PrefaultStack(size_t sizeStack)
+{
+	volatile char *pStack = static_cast<volatile char*>(alloca(sizeStack));
+
+	// ページ毎に書き込んでスタックのページを割り当てる
+	for(size_t i = 0; i < sizeStack; i += (size_t)sysconf(_SC_PAGESIZE))
+	{
+		pStack[i] = 0;
+	}
+}
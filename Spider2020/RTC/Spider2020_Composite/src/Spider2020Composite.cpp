@@ -0,0 +1,128 @@
+// -*- C++ -*-
+/*!
+ * @file Spider2020Composite.cpp
+ * @brief 同一ホストのSpider2020のRTCを１つのマネージャで起動するランチャ
+ * @date 2026/10/19
+ *
+ * rtc.confのmanager.modules.preload及びmanager.components.precreateで
+ * 全てのRTCを１つのプロセスに読み込み、manager.components.preconnectで
+ * ポートを接続し、manager.components.preactivationで活性化する。
+ * 同一プロセス内の接続は原則interface_type=directとし、CORBAのCDRの
+ * マーシャリングとループバック通信を省略する(受信時のリスナで処理する
+ * ポートは書き込み側のスレッドを止めないようshared_memoryとする)。
+ * -iオプションで全ての接続のインターフェース型を置き換えられる
+ * (shared_memory、corba_cdrとの比較用)。
+ * rtc.confのspider2020.realtime.*でプロセス全体のメモリのロックを設定する
+ * (スレッド毎の優先度とCPUアフィニティは各RTCのコンフィグレーションで設定する)。
+ * その他の引数はOpenRTMのマネージャにそのまま渡す。
+ *
+ * 使用例:
+ *   Spider2020Composite -f rtc.conf                  (direct接続で起動する)
+ *   Spider2020Composite -f rtc.conf -i corba_cdr     (従来のCORBA接続で起動する)
+ *   Spider2020Composite -f rtc.conf -i shared_memory (共有メモリ接続で起動する)
+ */
+
+#include <rtm/Manager.h>
+#include "RealtimeSetup.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define PRECONNECT_KEY		"manager.components.preconnect"	/*!< 接続の設定のキー			*/
+#define INTERFACE_TYPE_KEY	"interface_type="				/*!< インターフェース型の指定	*/
+
+/*! 指定できるインターフェース型 */
+static const char *s_pInterfaceType[] = {"direct", "shared_memory", "corba_cdr"};
+
+/*!
+ * インターフェース型が指定できるものか判定する
+ * @param  sType インターフェース型
+ * @retval true 指定できる
+ * @retval false 指定できない
+ */
+static bool IsValidInterfaceType(const std::string &sType)
+{
+	for(const char *pType : s_pInterfaceType)
+	{
+		if(sType == pType)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/*!
+ * 接続の設定のインターフェース型を置き換える
+ * @param  sPreconnect 接続の設定(カンマ区切り)
+ * @param  sType       置き換えるインターフェース型
+ * @return 置き換えた接続の設定
+ */
+static std::string ReplaceInterfaceType(const std::string &sPreconnect, const std::string &sType)
+{
+	std::string sResult = sPreconnect;
+	std::string::size_type uPos = 0;
+	std::string::size_type uEnd = 0;
+
+	// interface_type=の値を全て置き換える
+	while((uPos = sResult.find(INTERFACE_TYPE_KEY, uPos)) != std::string::npos)
+	{
+		uPos += strlen(INTERFACE_TYPE_KEY);
+		uEnd = sResult.find_first_of("&, \t", uPos);
+		if(uEnd == std::string::npos)
+		{
+			uEnd = sResult.size();
+		}
+		sResult.replace(uPos, uEnd - uPos, sType);
+		uPos += sType.size();
+	}
+
+	return sResult;
+}
+
+int main(int argc, char *argv[])
+{
+	RTC::Manager* manager;
+	std::vector<char*> vecArg;
+	std::string sType;
+
+	// -iオプションを取り出し、残りの引数をマネージャに渡す
+	for(int i = 0; i < argc; i++)
+	{
+		if((strcmp(argv[i], "-i") == 0) && (i + 1 < argc))
+		{
+			sType = argv[++i];
+			continue;
+		}
+		vecArg.push_back(argv[i]);
+	}
+	if(!sType.empty() && !IsValidInterfaceType(sType))
+	{
+		printf("usage: %s [-i direct|shared_memory|corba_cdr] [OpenRTM options]\n", argv[0]);
+		return 1;
+	}
+	vecArg.push_back(NULL);
+
+	manager = RTC::Manager::init((int)vecArg.size() - 1, vecArg.data());
+
+	// 接続のインターフェース型を置き換える(マネージャの活性化時に接続される)
+	if(!sType.empty())
+	{
+		coil::Properties& prop = manager->getConfig();
+		prop[PRECONNECT_KEY] = ReplaceInterfaceType(prop[PRECONNECT_KEY], sType);
+		printf("interface_type: %s\n", sType.c_str());
+	}
+
+	// rtc.confの実時間設定に従ってメモリをロックする(各RTCの実行コンテキストの生成前に行う)
+	RealtimeSetup::SetupProcess(manager->getConfig());
+
+	// RTCを読み込み、生成・接続・活性化する
+	manager->activateManager();
+
+	// マネージャを実行する(終了するまで戻らない)
+	manager->runManager();
+
+	return 0;
+}
@@ -0,0 +1,395 @@
+// -*- C++ -*-
+/*!
+ * @file SpiderTop.cpp
+ * @brief 共有メモリ上の性能指標の表示
+ * @date 2026/10/19
+ *
+ * 各RTCがMetricsRegistryで作成した共有メモリ(/dev/shm/spider2020_metrics.*)を
+ * 読み込み専用で開き、指定した周期で指標を表示する。RTCの処理には一切
+ * 関与しない(ロックも取らない)ため、ロボットの動作中に起動・終了できる。
+ * カウンタは累計と１秒あたりの増加量、ゲージは現在値、ヒストグラムは
+ * 前回の表示からの記録数、平均、p50、p99、最大(区間の上限)を表示する。
+ * 初回の表示は各プロセスの起動からの累計とする。
+ *
+ * 使用例:
+ *   SpiderTop                  (1秒毎に表示する)
+ *   SpiderTop -r 0.5 -f crawler (0.5秒毎に名前にcrawlerを含む指標を表示する)
+ *   SpiderTop -n 1             (起動からの累計を１回表示して終了する)
+ *   SpiderTop -a               (終了したプロセスの共有メモリも表示する)
+ *   SpiderTop -g               (疑似的な指標を生成して動作を確認する)
+ * -nで回数を指定した場合、最終行に集計を key=value 形式で出力する
+ */
+
+#include "MetricsRegistry.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <dirent.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SHM_DIR				("/dev/shm/")	/*!< 共有メモリの一覧を取得するディレクトリ	*/
+
+/*!
+ * 指標の前回の値
+ */
+struct METRIC_SNAPSHOT_t
+{
+	uint64_t uValue;					/*!< カウンタの値						*/
+	uint64_t uSum;						/*!< ヒストグラムの合計 [ns]			*/
+	std::vector<uint64_t> vecBucket;	/*!< ヒストグラムの区間毎の記録数		*/
+};
+
+/*!
+ * 表示中の共有メモリ
+ */
+struct SEGMENT_VIEW_t
+{
+	const METRICS_SEGMENT_t *pSegment;			/*!< 共有メモリ					*/
+	std::vector<METRIC_SNAPSHOT_t> vecSnapshot;	/*!< 指標毎の前回の値			*/
+	bool bFound;								/*!< 今回の一覧に存在したか		*/
+};
+
+/*!
+ * 表示の集計
+ */
+struct VIEW_SUMMARY_t
+{
+	int iProcess;						/*!< 表示したプロセス数				*/
+	int iMetric;						/*!< 表示した指標の数				*/
+	uint64_t uSamples;					/*!< ヒストグラムの記録数の合計		*/
+	double dWorstP99Us;					/*!< ヒストグラムのp99の最大値 [us]	*/
+	std::string sWorstName;				/*!< p99が最大のヒストグラムの名前	*/
+};
+
+/*!
+ * プロセスが動作中か判定する
+ * @param  iPid プロセスID
+ * @retval true 動作中
+ * @retval false 終了済み
+ */
+static bool IsAlive(int iPid)
+{
+	return (kill(iPid, 0) == 0) || (errno == EPERM);
+}
+
+/*!
+ * ヒストグラムの区間毎の増加量から百分位数を取得する
+ * @param  vecDelta 区間毎の増加量
+ * @param  uTotal   増加量の合計
+ * @param  dRate    割合 (0-1)
+ * @return 百分位数を含む区間の上限 [ns]
+ */
+static uint64_t Percentile(const std::vector<uint64_t> &vecDelta, uint64_t uTotal, double dRate)
+{
+	uint64_t uTarget = (uint64_t)(dRate*(double)uTotal);
+	uint64_t uSum = 0;
+
+	for(uint32_t i = 0; i < vecDelta.size(); i++)
+	{
+		uSum += vecDelta[i];
+		if(uTarget < uSum)
+		{
+			return MetricsRegistry::GetBucketValue(i + 1) - 1;
+		}
+	}
+	return 0;
+}
+
+/*!
+ * 共有メモリの一覧を更新する
+ * @param  mapView  表示中の共有メモリ(共有メモリの名前毎)
+ * @param  bAll     終了したプロセスの共有メモリも表示するか
+ * @return なし
+ */
+static void ScanSegments(std::map<std::string, SEGMENT_VIEW_t> &mapView, bool bAll)
+{
+	std::string sPrefix = std::string(METRICS_SHM_PREFIX).substr(1);
+	struct dirent *pEntry = NULL;
+	DIR *pDir = NULL;
+
+	for(auto &itView : mapView)
+	{
+		itView.second.bFound = false;
+	}
+
+	// 共有メモリの一覧から指標の共有メモリを探す
+	pDir = opendir(SHM_DIR);
+	if(pDir != NULL)
+	{
+		while((pEntry = readdir(pDir)) != NULL)
+		{
+			std::string sName = pEntry->d_name;
+			if(sName.compare(0, sPrefix.size(), sPrefix) != 0)
+			{
+				continue;
+			}
+
+			// 未表示ならば開く(作成中または配置が異なる場合は次回に再試行する)
+			auto itView = mapView.find(sName);
+			if(itView == mapView.end())
+			{
+				SEGMENT_VIEW_t stView = SEGMENT_VIEW_t();
+				stView.pSegment = MetricsRegistry::Map(("/" + sName).c_str());
+				if(stView.pSegment == NULL)
+				{
+					continue;
+				}
+				stView.vecSnapshot.resize(METRICS_CAPACITY);
+				itView = mapView.insert(std::make_pair(sName, stView)).first;
+			}
+			itView->second.bFound = true;
+		}
+		closedir(pDir);
+	}
+
+	// 削除された共有メモリと終了したプロセスの共有メモリを閉じる
+	for(auto itView = mapView.begin(); itView != mapView.end(); )
+	{
+		if(!itView->second.bFound || (!bAll && !IsAlive(itView->second.pSegment->iPid)))
+		{
+			MetricsRegistry::Unmap(itView->second.pSegment);
+			itView = mapView.erase(itView);
+		}
+		else
+		{
+			itView++;
+		}
+	}
+}
+
+/*!
+ * 共有メモリの指標を表示する
+ * @param  stView     表示中の共有メモリ
+ * @param  sFilter    表示する指標の名前に含まれる文字列
+ * @param  dInterval  前回の表示からの経過時間 [s] (初回はプロセスの起動から)
+ * @param  stSummary  [out] 表示の集計
+ * @return なし
+ */
+static void PrintSegment(SEGMENT_VIEW_t &stView, const std::string &sFilter, double dInterval, VIEW_SUMMARY_t &stSummary)
+{
+	const METRICS_SEGMENT_t *pSegment = stView.pSegment;
+	uint32_t uCount = std::min(pSegment->uCount.load(std::memory_order_acquire), (uint32_t)METRICS_CAPACITY);
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	double dUptime = (double)((int64_t)ts.tv_sec*1000000000LL + (int64_t)ts.tv_nsec - pSegment->iStartNs)/1000000000.0;
+	printf("pid %d  %s  up %.0fs  %s\n", pSegment->iPid, pSegment->szProcess, dUptime, IsAlive(pSegment->iPid) ? "" : "(exited)");
+	stSummary.iProcess++;
+
+	for(uint32_t i = 0; i < uCount; i++)
+	{
+		const METRIC_SLOT_t &stSlot = pSegment->stSlot[i];
+		METRIC_SNAPSHOT_t &stSnap = stView.vecSnapshot[i];
+		uint32_t uType = stSlot.uType.load(std::memory_order_acquire);
+
+		if(!sFilter.empty() && (strstr(stSlot.szName, sFilter.c_str()) == NULL))
+		{
+			continue;
+		}
+		stSummary.iMetric++;
+
+		if(uType == METRIC_COUNTER)
+		{
+			// 累計と１秒あたりの増加量を表示する
+			uint64_t uValue = stSlot.uValue.load(std::memory_order_relaxed);
+			double dRate = (0.0 < dInterval) ? (double)(uValue - stSnap.uValue)/dInterval : 0.0;
+			printf("  %-32s %12llu %12.1f/s\n", stSlot.szName, (unsigned long long)uValue, dRate);
+			stSnap.uValue = uValue;
+		}
+		else if(uType == METRIC_GAUGE)
+		{
+			// 現在値を表示する
+			uint64_t uBits = stSlot.uValue.load(std::memory_order_relaxed);
+			double dValue = 0.0;
+			memcpy(&dValue, &uBits, sizeof(dValue));
+			printf("  %-32s %12.3f\n", stSlot.szName, dValue);
+		}
+		else if(uType == METRIC_HISTOGRAM)
+		{
+			// 前回からの区間毎の増加量を求める
+			std::vector<uint64_t> vecDelta(METRICS_BUCKET_NUM, 0);
+			uint64_t uTotal = 0;
+			uint64_t uMaxNs = 0;
+			stSnap.vecBucket.resize(METRICS_BUCKET_NUM, 0);
+			for(uint32_t j = 0; j < METRICS_BUCKET_NUM; j++)
+			{
+				uint64_t uBucket = stSlot.uBucket[j].load(std::memory_order_relaxed);
+				vecDelta[j] = uBucket - stSnap.vecBucket[j];
+				stSnap.vecBucket[j] = uBucket;
+				uTotal += vecDelta[j];
+				if(vecDelta[j] != 0)
+				{
+					uMaxNs = MetricsRegistry::GetBucketValue(j + 1) - 1;
+				}
+			}
+			uint64_t uSum = stSlot.uSum.load(std::memory_order_relaxed);
+			uint64_t uMaxAll = stSlot.uMax.load(std::memory_order_relaxed);
+			double dMeanUs = (uTotal == 0) ? 0.0 : (double)(uSum - stSnap.uSum)/(double)uTotal/1000.0;
+			double dP50Us = (double)std::min(Percentile(vecDelta, uTotal, 0.5), uMaxAll)/1000.0;
+			double dP99Us = (double)std::min(Percentile(vecDelta, uTotal, 0.99), uMaxAll)/1000.0;
+			double dMaxUs = (double)std::min(uMaxNs, uMaxAll)/1000.0;
+			stSnap.uSum = uSum;
+
+			// 記録数、平均、p50、p99、最大を表示する [us]
+			printf("  %-32s %12llu %10.1f %10.1f %10.1f %10.1f\n", stSlot.szName, (unsigned long long)uTotal, dMeanUs, dP50Us, dP99Us, dMaxUs);
+			stSummary.uSamples += uTotal;
+			if((0 < uTotal) && (stSummary.dWorstP99Us < dP99Us))
+			{
+				stSummary.dWorstP99Us = dP99Us;
+				stSummary.sWorstName = stSlot.szName;
+			}
+		}
+	}
+}
+
+/*!
+ * 疑似的な指標を生成する
+ * @param  pbExit 終了フラグ
+ * @return なし
+ */
+static void Generate(const std::atomic<bool> *pbExit)
+{
+	MetricCounter Counter;
+	MetricGauge Gauge;
+	MetricHistogram Histogram;
+	std::mt19937 engine(0);
+	std::lognormal_distribution<double> dist(std::log(200000.0), 0.5);
+	uint64_t uLoop = 0;
+
+	Counter.Register("generate.loops");
+	Gauge.Register("generate.phase");
+	Histogram.Register("generate.latency");
+
+	while(!pbExit->load())
+	{
+		// 対数正規分布の遅延(中央値200us)を記録する
+		Histogram.Record((int64_t)dist(engine));
+		Counter.Add();
+		Gauge.Set((double)(uLoop++ % 100));
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	std::map<std::string, SEGMENT_VIEW_t> mapView;
+	std::map<std::string, std::chrono::steady_clock::time_point> mapLast;
+	std::atomic<bool> bExitGenerate(false);
+	std::unique_ptr<std::thread> spGenerate;
+	VIEW_SUMMARY_t stSummary = {};
+	std::string sFilter;
+	double dRefresh = 1.0;
+	long lCount = 0;
+	bool bAll = false;
+	bool bGenerate = false;
+	int iOpt;
+
+	// 引数を解析する
+	while((iOpt = getopt(argc, argv, "r:n:af:gh")) != -1)
+	{
+		switch(iOpt)
+		{
+		case 'r':
+			dRefresh = std::max(0.1, atof(optarg));
+			break;
+		case 'n':
+			lCount = std::max(0L, atol(optarg));
+			break;
+		case 'a':
+			bAll = true;
+			break;
+		case 'f':
+			sFilter = optarg;
+			break;
+		case 'g':
+			bGenerate = true;
+			break;
+		default:
+			printf("usage: %s [-r refresh_sec] [-n count] [-a] [-f filter] [-g]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	// 疑似的な指標を生成する(最初の表示までに記録を溜める)
+	if(bGenerate)
+	{
+		spGenerate.reset(new std::thread(Generate, &bExitGenerate));
+		std::this_thread::sleep_for(std::chrono::duration<double>(dRefresh));
+	}
+
+	for(long lLoop = 0; (lCount == 0) || (lLoop < lCount); lLoop++)
+	{
+		if(0 < lLoop)
+		{
+			std::this_thread::sleep_for(std::chrono::duration<double>(dRefresh));
+		}
+
+		// 共有メモリの一覧を更新する
+		ScanSegments(mapView, bAll);
+
+		// 連続して表示する場合は画面を消去する
+		if(lCount != 1)
+		{
+			printf("\033[H\033[2J");
+		}
+		printf("%-34s %12s %10s %10s %10s %10s\n", "metric", "count", "mean[us]", "p50[us]", "p99[us]", "max[us]");
+
+		stSummary = VIEW_SUMMARY_t();
+		std::chrono::steady_clock::time_point tpNow = std::chrono::steady_clock::now();
+		for(auto &itView : mapView)
+		{
+			// 前回の表示からの経過時間を求める(初回はプロセスの起動から)
+			double dInterval = 0.0;
+			auto itLast = mapLast.find(itView.first);
+			if(itLast != mapLast.end())
+			{
+				dInterval = std::chrono::duration<double>(tpNow - itLast->second).count();
+			}
+			else
+			{
+				struct timespec ts;
+				clock_gettime(CLOCK_REALTIME, &ts);
+				dInterval = (double)((int64_t)ts.tv_sec*1000000000LL + (int64_t)ts.tv_nsec - itView.second.pSegment->iStartNs)/1000000000.0;
+			}
+			mapLast[itView.first] = tpNow;
+
+			PrintSegment(itView.second, sFilter, dInterval, stSummary);
+		}
+		if(mapView.empty())
+		{
+			printf("no metrics found in %s\n", SHM_DIR);
+		}
+		fflush(stdout);
+	}
+
+	// 疑似的な指標の生成を終了する
+	if(spGenerate)
+	{
+		bExitGenerate = true;
+		spGenerate->join();
+	}
+
+	// 集計を出力する
+	printf("processes=%d metrics=%d samples=%llu worst_p99_us=%.1f worst_p99_metric=%s\n", stSummary.iProcess, stSummary.iMetric, (unsigned long long)stSummary.uSamples, stSummary.dWorstP99Us, stSummary.sWorstName.empty() ? "none" : stSummary.sWorstName.c_str());
+
+	for(auto &itView : mapView)
+	{
+		MetricsRegistry::Unmap(itView.second.pSegment);
+	}
+
+	return 0;
+}
@@ -0,0 +1,318 @@
+// -*- C++ -*-
+/*!
+ * @file TransportBench.cpp
+ * @brief データポートのインターフェース型毎の転送性能の比較
+ * @date 2026/10/19
+ *
+ * 書き込み側と読み込み側の計測用RTCを１つのマネージャに生成し、
+ * インターフェース型(corba_cdr、shared_memory、direct)毎に接続して
+ * 指定した数のデータを転送する。push型・flush方式で接続するため、
+ * 書き込み(write)から戻った時点でデータは読み込み側に届いている。
+ * 書き込みの開始から読み込みの完了までを１データの遅延とし、
+ * 遅延の分布と１秒あたりの転送数を求める。
+ * corba_cdrは同一プロセス内の呼び出しとなるため、ループバック通信を
+ * 含まない(別プロセスの場合より小さい)値となる。
+ *
+ * 使用例:
+ *   TransportBench                         (全てのインターフェース型を比較する)
+ *   TransportBench -n 100000 -s 256        (256要素のデータを10万回転送する)
+ *   TransportBench -i direct,corba_cdr     (指定したインターフェース型のみ計測する)
+ * 最終行にインターフェース型毎の結果を key=value 形式で出力する
+ */
+
+#include <rtm/Manager.h>
+#include <rtm/DataFlowComponentBase.h>
+#include <rtm/DataInPort.h>
+#include <rtm/DataOutPort.h>
+#include <rtm/NVUtil.h>
+#include <rtm/CORBA_SeqUtil.h>
+#include <rtm/idl/BasicDataTypeSkel.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#define WARMUP_COUNT		(100)		/*!< 計測前に転送するデータの数				*/
+#define RECEIVE_TIMEOUT_SEC	(1.0)		/*!< 読み込み側にデータが届くまでの待ち時間 [s]	*/
+
+/*! 計測用RTCの仕様 */
+static const char *s_pWriterSpec[] =
+{
+	"implementation_id", "TransportBenchWriter",
+	"type_name",         "TransportBenchWriter",
+	"description",       "transport benchmark writer",
+	"version",           "1.0.0",
+	"vendor",            "AIZUK",
+	"category",          "Benchmark",
+	"activity_type",     "PERIODIC",
+	"kind",              "DataFlowComponent",
+	"max_instance",      "1",
+	"language",          "C++",
+	"lang_type",         "compile",
+	""
+};
+
+static const char *s_pReaderSpec[] =
+{
+	"implementation_id", "TransportBenchReader",
+	"type_name",         "TransportBenchReader",
+	"description",       "transport benchmark reader",
+	"version",           "1.0.0",
+	"vendor",            "AIZUK",
+	"category",          "Benchmark",
+	"activity_type",     "PERIODIC",
+	"kind",              "DataFlowComponent",
+	"max_instance",      "1",
+	"language",          "C++",
+	"lang_type",         "compile",
+	""
+};
+
+/*!
+ * 書き込み側の計測用RTC
+ */
+class BenchWriter
+  : public RTC::DataFlowComponentBase
+{
+public:
+	BenchWriter(RTC::Manager* manager)
+		: RTC::DataFlowComponentBase(manager)
+		, m_OutOut("Out", m_Out)
+	{
+	}
+
+	virtual RTC::ReturnCode_t onInitialize()
+	{
+		addOutPort("Out", m_OutOut);
+		return RTC::RTC_OK;
+	}
+
+	RTC::TimedDoubleSeq m_Out;					/*!< 書き込むデータ		*/
+	RTC::OutPort<RTC::TimedDoubleSeq> m_OutOut;	/*!< 書き込みポート		*/
+};
+
+/*!
+ * 読み込み側の計測用RTC
+ */
+class BenchReader
+  : public RTC::DataFlowComponentBase
+{
+public:
+	BenchReader(RTC::Manager* manager)
+		: RTC::DataFlowComponentBase(manager)
+		, m_InIn("In", m_In)
+	{
+	}
+
+	virtual RTC::ReturnCode_t onInitialize()
+	{
+		addInPort("In", m_InIn);
+		return RTC::RTC_OK;
+	}
+
+	RTC::TimedDoubleSeq m_In;					/*!< 読み込んだデータ	*/
+	RTC::InPort<RTC::TimedDoubleSeq> m_InIn;	/*!< 読み込みポート		*/
+};
+
+/*!
+ * 百分位数を取得する
+ * @param  vecValue ソート済みの値
+ * @param  dRate    割合 (0-1)
+ * @return 百分位数
+ */
+static double Percentile(const std::vector<double> &vecValue, double dRate)
+{
+	if(vecValue.empty())
+	{
+		return 0.0;
+	}
+	return vecValue[std::min(vecValue.size() - 1, (size_t)(dRate*vecValue.size()))];
+}
+
+/*!
+ * 書き込みポートと読み込みポートを接続する
+ * @param  pWriter 書き込み側のRTC
+ * @param  pReader 読み込み側のRTC
+ * @param  sType   インターフェース型
+ * @param  sId     [out] 接続のID
+ * @retval true 成功
+ * @retval false 失敗(インターフェース型が未対応など)
+ */
+static bool Connect(BenchWriter *pWriter, BenchReader *pReader, const std::string &sType, std::string &sId)
+{
+	RTC::ConnectorProfile prof;
+
+	prof.connector_id = CORBA::string_dup("");
+	prof.name = CORBA::string_dup(sType.c_str());
+	prof.ports.length(2);
+	prof.ports[0] = RTC::PortService::_duplicate(pWriter->m_OutOut.getPortRef());
+	prof.ports[1] = RTC::PortService::_duplicate(pReader->m_InIn.getPortRef());
+	CORBA_SeqUtil::push_back(prof.properties, NVUtil::newNV("dataport.interface_type", sType.c_str()));
+	CORBA_SeqUtil::push_back(prof.properties, NVUtil::newNV("dataport.dataflow_type", "push"));
+	CORBA_SeqUtil::push_back(prof.properties, NVUtil::newNV("dataport.subscription_type", "flush"));
+
+	if(prof.ports[0]->connect(prof) != RTC::RTC_OK)
+	{
+		return false;
+	}
+	sId = (const char*)prof.connector_id;
+
+	return true;
+}
+
+/*!
+ * １データを転送して遅延を計測する
+ * @param  pWriter 書き込み側のRTC
+ * @param  pReader 読み込み側のRTC
+ * @param  dLatency [out] 遅延 [us]
+ * @retval true 成功
+ * @retval false 読み込み側にデータが届かない
+ */
+static bool Transfer(BenchWriter *pWriter, BenchReader *pReader, double &dLatency)
+{
+	std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point tpNow;
+
+	// 書き込む
+	setTimestamp(pWriter->m_Out);
+	pWriter->m_OutOut.write();
+
+	// 読み込み側に届くまで待って読み込む
+	while(!pReader->m_InIn.isNew())
+	{
+		tpNow = std::chrono::steady_clock::now();
+		if(RECEIVE_TIMEOUT_SEC <= std::chrono::duration<double>(tpNow - tpStart).count())
+		{
+			return false;
+		}
+	}
+	pReader->m_InIn.read();
+
+	tpNow = std::chrono::steady_clock::now();
+	dLatency = std::chrono::duration<double, std::micro>(tpNow - tpStart).count();
+
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	std::vector<std::string> vecType = {"corba_cdr", "shared_memory", "direct"};
+	std::ostringstream ossResult;
+	long lCount = 10000;
+	long lSize = 8;
+	int iOpt;
+
+	// 引数を解析する
+	while((iOpt = getopt(argc, argv, "n:s:i:h")) != -1)
+	{
+		switch(iOpt)
+		{
+		case 'n':
+			lCount = std::max(1L, atol(optarg));
+			break;
+		case 's':
+			lSize = std::max(0L, atol(optarg));
+			break;
+		case 'i':
+			{
+				std::istringstream iss(optarg);
+				std::string sType;
+				vecType.clear();
+				while(std::getline(iss, sType, ','))
+				{
+					vecType.push_back(sType);
+				}
+			}
+			break;
+		default:
+			printf("usage: %s [-n count] [-s doubles] [-i corba_cdr,shared_memory,direct]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	// ネームサーバに登録せずにマネージャを起動する
+	char *pArg[] = {argv[0], (char*)"-o", (char*)"naming.enable: NO", (char*)"-o", (char*)"logger.enable: NO", NULL};
+	RTC::Manager* manager = RTC::Manager::init(5, pArg);
+	manager->activateManager();
+	manager->runManager(true);
+
+	// 計測用RTCを生成する
+	coil::Properties profWriter(s_pWriterSpec);
+	coil::Properties profReader(s_pReaderSpec);
+	manager->registerFactory(profWriter, RTC::Create<BenchWriter>, RTC::Delete<BenchWriter>);
+	manager->registerFactory(profReader, RTC::Create<BenchReader>, RTC::Delete<BenchReader>);
+	BenchWriter *pWriter = dynamic_cast<BenchWriter*>(manager->createComponent("TransportBenchWriter"));
+	BenchReader *pReader = dynamic_cast<BenchReader*>(manager->createComponent("TransportBenchReader"));
+	if((pWriter == NULL) || (pReader == NULL))
+	{
+		printf("createComponent is failed\n");
+		manager->shutdown();
+		return 1;
+	}
+	pWriter->m_Out.data.length(lSize);
+	for(long i = 0; i < lSize; i++)
+	{
+		pWriter->m_Out.data[i] = (double)i;
+	}
+
+	printf("count: %ld, payload: %ld doubles (%ld bytes)\n", lCount, lSize, lSize*(long)sizeof(double));
+	printf("%-14s %10s %10s %10s %10s %10s %12s\n", "interface", "mean[us]", "p50[us]", "p99[us]", "max[us]", "lost", "msg/s");
+
+	for(const std::string &sType : vecType)
+	{
+		std::vector<double> vecLatency;
+		std::string sId;
+		double dLatency = 0.0;
+		double dSum = 0.0;
+		long lLost = 0;
+
+		// 接続する
+		if(!Connect(pWriter, pReader, sType, sId))
+		{
+			printf("%-14s not supported\n", sType.c_str());
+			continue;
+		}
+
+		// 慣らし運転をする
+		for(long i = 0; i < WARMUP_COUNT; i++)
+		{
+			Transfer(pWriter, pReader, dLatency);
+		}
+
+		// 転送して遅延を計測する
+		vecLatency.reserve(lCount);
+		std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+		for(long i = 0; i < lCount; i++)
+		{
+			if(!Transfer(pWriter, pReader, dLatency))
+			{
+				lLost++;
+				continue;
+			}
+			vecLatency.push_back(dLatency);
+			dSum += dLatency;
+		}
+		double dElapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - tpStart).count();
+
+		// 切断する
+		pWriter->m_OutOut.getPortRef()->disconnect(sId.c_str());
+
+		// 結果を出力する
+		std::sort(vecLatency.begin(), vecLatency.end());
+		double dMean = vecLatency.empty() ? 0.0 : dSum/vecLatency.size();
+		double dRate = (0.0 < dElapsed) ? vecLatency.size()/dElapsed : 0.0;
+		printf("%-14s %10.2f %10.2f %10.2f %10.2f %10ld %12.0f\n", sType.c_str(), dMean, Percentile(vecLatency, 0.5), Percentile(vecLatency, 0.99), vecLatency.empty() ? 0.0 : vecLatency.back(), lLost, dRate);
+		ossResult << sType << "_p50_us=" << Percentile(vecLatency, 0.5) << " " << sType << "_p99_us=" << Percentile(vecLatency, 0.99) << " " << sType << "_msg_per_sec=" << (long)dRate << " ";
+	}
+
+	printf("%s\n", ossResult.str().c_str());
+
+	manager->shutdown();
+
+	return 0;
+}